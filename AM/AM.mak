@@ -123,7 +123,7 @@ endif
 ${BUILD_DIR}/AMParams.o: ${AM_SRC_DIR}/AMParams.cc  ${AM_HEADER_DIR}/AMParams.h ${AM_HEADER_DIR}/IlluminationModel.h ${UTILITIES_HEADER_DIR}/excpUtils.h ${MACROS_HEADER_DIR}/common.h 
 	${CXX} -c ${MTF_PIC_FLAG} ${WARNING_FLAGS} ${OPT_FLAGS} ${PROF_FLAGS} ${MTF_COMPILETIME_FLAGS} ${MTF_INCLUDE_FLAGS} ${SSD_FLAGS} $< -o $@
 	
-${BUILD_DIR}/ImageBase.o: ${AM_SRC_DIR}/ImageBase.cc  ${AM_HEADER_DIR}/ImageBase.h ${MACROS_HEADER_DIR}/common.h ${UTILITIES_HEADER_DIR}/imgUtils.h ${UTILITIES_HEADER_DIR}/excpUtils.h
+${BUILD_DIR}/ImageBase.o: ${AM_SRC_DIR}/ImageBase.cc  ${AM_HEADER_DIR}/ImageBase.h ${MACROS_HEADER_DIR}/common.h ${UTILITIES_HEADER_DIR}/imgUtils.h ${UTILITIES_HEADER_DIR}/excpUtils.h ${UTILITIES_HEADER_DIR}/cacheUtils.h
 	${CXX} -c ${MTF_PIC_FLAG} ${WARNING_FLAGS} ${OPT_FLAGS} ${PROF_FLAGS} ${MTF_COMPILETIME_FLAGS} ${MTF_INCLUDE_FLAGS} ${SSD_FLAGS} $< -o $@
 	
 ${BUILD_DIR}/SSDBase.o: ${AM_SRC_DIR}/SSDBase.cc ${AM_HEADER_DIR}/SSDBase.h ${AM_BASE_HEADERS}  ${MACROS_HEADER_DIR}/common.h ${UTILITIES_HEADER_DIR}/imgUtils.h ${UTILITIES_HEADER_DIR}/spiUtils.h
@@ -204,7 +204,7 @@ ${BUILD_DIR}/MCRSCV.o: ${AM_SRC_DIR}/MCRSCV.cc ${AM_HEADER_DIR}/MCRSCV.h ${AM_HE
 ${BUILD_DIR}/MCZNCC.o: ${AM_SRC_DIR}/MCZNCC.cc ${AM_HEADER_DIR}/MCZNCC.h ${AM_HEADER_DIR}/ZNCC.h ${AM_HEADER_DIR}/SSDBase.h ${AM_BASE_HEADERS} ${MACROS_HEADER_DIR}/common.h
 	${CXX} -c ${MTF_PIC_FLAG} ${WARNING_FLAGS} ${OPT_FLAGS} ${PROF_FLAGS} ${MTF_COMPILETIME_FLAGS} ${MTF_INCLUDE_FLAGS} ${ZNCC_FLAGS} $< -o $@	
 	
-${BUILD_DIR}/MCMI.o: ${AM_SRC_DIR}/MCMI.cc ${AM_HEADER_DIR}/MCMI.h ${AM_HEADER_DIR}/MI.h ${AM_BASE_HEADERS} ${MACROS_HEADER_DIR}/common.h
+${BUILD_DIR}/MCMI.o: ${AM_SRC_DIR}/MCMI.cc ${AM_HEADER_DIR}/MCMI.h ${AM_HEADER_DIR}/MI.h ${AM_BASE_HEADERS} ${MACROS_HEADER_DIR}/common.h ${UTILITIES_HEADER_DIR}/histUtils.h
 	${CXX} -c ${MTF_PIC_FLAG} ${WARNING_FLAGS} ${OPT_FLAGS} ${PROF_FLAGS} ${MTF_COMPILETIME_FLAGS} ${MTF_INCLUDE_FLAGS} ${MI_FLAGS} $< -o $@
 	
 ${BUILD_DIR}/MCNCC.o: ${AM_SRC_DIR}/MCNCC.cc ${AM_HEADER_DIR}/MCNCC.h ${AM_HEADER_DIR}/NCC.h ${AM_BASE_HEADERS} ${MACROS_HEADER_DIR}/common.h
@@ -216,7 +216,7 @@ ${BUILD_DIR}/MCSSIM.o: ${AM_SRC_DIR}/MCSSIM.cc ${AM_HEADER_DIR}/MCSSIM.h ${AM_HE
 ${BUILD_DIR}/MCSPSS.o: ${AM_SRC_DIR}/MCSPSS.cc ${AM_HEADER_DIR}/MCSPSS.h ${AM_HEADER_DIR}/SPSS.h ${AM_BASE_HEADERS} ${MACROS_HEADER_DIR}/common.h
 	${CXX} -c ${MTF_PIC_FLAG} ${WARNING_FLAGS} ${OPT_FLAGS} ${PROF_FLAGS} ${MTF_COMPILETIME_FLAGS} ${MTF_INCLUDE_FLAGS} ${SPSS_FLAGS} $< -o $@	
 	
-${BUILD_DIR}/MCCCRE.o: ${AM_SRC_DIR}/MCCCRE.cc ${AM_HEADER_DIR}/MCCCRE.h ${AM_HEADER_DIR}/CCRE.h ${AM_BASE_HEADERS} ${MACROS_HEADER_DIR}/common.h
+${BUILD_DIR}/MCCCRE.o: ${AM_SRC_DIR}/MCCCRE.cc ${AM_HEADER_DIR}/MCCCRE.h ${AM_HEADER_DIR}/CCRE.h ${AM_BASE_HEADERS} ${MACROS_HEADER_DIR}/common.h ${UTILITIES_HEADER_DIR}/histUtils.h
 	${CXX} -c ${MTF_PIC_FLAG} ${WARNING_FLAGS} ${OPT_FLAGS} ${PROF_FLAGS} ${MTF_COMPILETIME_FLAGS} ${MTF_INCLUDE_FLAGS} ${CCRE_FLAGS} $< -o $@	
 	
 ${BUILD_DIR}/MCRIU.o: ${AM_SRC_DIR}/MCRIU.cc ${AM_HEADER_DIR}/MCRIU.h ${AM_HEADER_DIR}/RIU.h ${AM_BASE_HEADERS} ${MACROS_HEADER_DIR}/common.h
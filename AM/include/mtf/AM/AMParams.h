@@ -23,6 +23,7 @@ struct AMParams : ImgParams{
 		double _grad_eps = GRAD_EPS,
 		double _hess_eps = HESS_EPS,
 		bool _uchar_input = UCHAR_INPUT,
+		bool _use_grad_cache = USE_GRAD_CACHE,
 		double _likelihood_alpha = AM_LIKELIHOOD_ALPHA,
 		double _likelihood_beta = AM_LIKELIHOOD_BETA,
 		bool _dist_from_likelihood = AM_DIST_FROM_LIKELIHOOD,
@@ -7,6 +7,7 @@
 #include "ImageBase.h"
 #include "AMParams.h"
 #include "mtf/Utilities/excpUtils.h"
+#include "mtf/Utilities/spiUtils.h"
 #include <memory>
 
 _MTF_BEGIN_NAMESPACE
@@ -69,7 +70,9 @@ public:
 	explicit AppearanceModel(const AMParams *params = nullptr, 
 		const int _n_channels = 1) :
 		ImageBase(params, _n_channels), f(0), state_size(0),
-		first_iter(false), spi_mask(nullptr){}
+		first_iter(false), spi_mask(nullptr){
+		updateSPIPixIDs();
+	}
 	/** destructor */
 	virtual ~AppearanceModel(){}
 
@@ -225,9 +228,16 @@ public:
 		am_func_not_implemeted(estimateOpticalFlow);
 	}
 
-	virtual void setSPIMask(const bool *_spi_mask){ spi_mask = _spi_mask; }
+	/**
+	must be called again whenever the contents of the mask change since the AM only
+	processes the pixels in the list of active ones that is compacted here
+	*/
+	virtual void setSPIMask(const bool *_spi_mask){
+		spi_mask = _spi_mask;
+		updateSPIPixIDs();
+	}
 	virtual const bool* getSPIMask() const{ return spi_mask; }
-	virtual void clearSPIMask(){ spi_mask = nullptr; }
+	virtual void clearSPIMask(){ setSPIMask(nullptr); }
 
 	/**
 	should be overridden by an implementing class once it implements SPI functionality
@@ -388,6 +398,15 @@ protected:
 	these can be used by the AM when the non masked entries of the computed variable do not depend on the masked pixels;
 	*/
 	const bool *spi_mask;
+	/**
+	IDs of the pixels that are active in the SPI mask or of all the pixels if there is no mask;
+	each pixel corresponds to n_channels consecutive entries in the patch
+	*/
+	std::vector<unsigned int> spi_pix_ids;
+	//! must also be called by any AM that changes n_pix after construction
+	void updateSPIPixIDs(){
+		utils::spi::getActiveIDs(spi_pix_ids, spi_mask, n_pix);
+	}
 
 	/**
 	indicator variables used to keep track of which state variables have been initialized;
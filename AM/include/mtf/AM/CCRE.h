@@ -2,6 +2,7 @@
 #define MTF_CCRE_H
 
 #include "AppearanceModel.h"
+#include "mtf/Utilities/histUtils.h"
 
 _MTF_BEGIN_NAMESPACE
 
@@ -23,17 +24,20 @@ struct CCREParams : AMParams{
 	// with respect to initial and current pixel values
 	// as far as the gradient and hessian computations are concerned;	
 	bool symmetrical_grad;
-	// no. of blocks in which to divide pixel level computations to get better performance 
-	// with parallelization libraries like TBB and OpenMP; only matters if these are enabled during compilation;
-	// if set to 0 (default), this is set equal to the no. of pixels so that each block contains a single pixel
+	// no. of blocks of pixels that are processed in parallel with each block accumulating into its own copy 
+	// of the histograms and Hessians that are added in block order so that the results are reproducible;
+	// 1 or less (default) processes all the pixels serially
 	int n_blocks;	
+	// no. of quantization levels per bin of the normalized pixel values in the table of B Spline weights
+	// that is looked up instead of evaluating the spline for each pixel; 0 (default) disables the table
+	int lut_res;
 
 	bool debug_mode; 
 	//! value constructor
 	CCREParams(const AMParams *am_params,
 		int _n_bins, bool _partition_of_unity,
 		double _pre_seed, bool _symmetrical_grad,
-		int _n_blocks, 
+		int _n_blocks, int _lut_res,
 		bool _debug_mode);
 	//! default and copy constructor
 	CCREParams(const CCREParams *params = nullptr);
@@ -166,7 +170,11 @@ protected:
 	MatrixX2i curr_bspl_ids;
 	MatrixXi linear_idx, linear_idx2;
 
-	MatrixX2i block_extents;
+	utils::BSpl3Table bspl_table;
+	//! per block histograms and Hessians for parallel accumulation
+	utils::BlockAccumulator<VectorXd, MatrixXd> hist_accum;
+	utils::BlockAccumulator<MatrixXd, MatrixXd> hess_accum;
+
 	char *log_fname;
 	char *time_fname;
 
@@ -8,6 +8,7 @@
 #define GRAD_EPS 1e-8
 #define HESS_EPS 1
 #define UCHAR_INPUT false
+#define USE_GRAD_CACHE false
 
 
 #define PIX_MAX 255.0
@@ -15,6 +16,7 @@
 
 #include "mtf/Macros/common.h"
 #include "mtf/Utilities/excpUtils.h"
+#include "mtf/Utilities/cacheUtils.h"
 
 _MTF_BEGIN_NAMESPACE
 
@@ -25,10 +27,13 @@ struct ImgParams{
 	//! using the method of finite differences
 	double grad_eps, hess_eps;
 	bool uchar_input;
+	//! sample the warp of the gradient from dense gradient images shared through the frame cache when available
+	bool use_grad_cache;
 	ImgParams(int _resx, int _resy,
 		double _grad_eps = GRAD_EPS,
 		double _hess_eps = HESS_EPS,
-		bool _uchar_input = UCHAR_INPUT);
+		bool _uchar_input = UCHAR_INPUT,
+		bool _use_grad_cache = USE_GRAD_CACHE);
 	ImgParams(const ImgParams *img_params = nullptr);
 };
 
@@ -115,6 +120,10 @@ public:
 
 	// -------- functions for updating state variables when a new image arrives -------- //
 	virtual void updatePixVals(const PtsT& curr_pts);
+	//! requests the next call to updatePixVals to also extract the warp of the current image gradient
+	//! in the same pass so that a following call to updatePixGrad at the same points can reuse it;
+	//! only has an effect with single channel floating point inputs
+	virtual void fuseNextPixGrad(){ fuse_pix_grad = true; }
 
 	virtual void updatePixGrad(const GradPtsT &warped_offset_pts);
 	virtual void updatePixGrad(const PtsT &curr_pts);
@@ -168,6 +177,16 @@ protected:
 	//! incremented once during initialization and thereafter everytime the template is updated
 	unsigned int frame_count;
 
+	//! set by fuseNextPixGrad and cleared by the next call to updatePixVals
+	bool fuse_pix_grad, pix_grad_fused;
+	PtsT fused_pix_grad_pts;
+
+	const bool use_grad_cache;
+	//! cache that the current image belongs to, if any, whose dense gradient images
+	//! are sampled for the warp of the gradient when use_grad_cache is enabled
+	utils::FrameCache::Entry img_cache;
+	void getCachedPixGrad(PixGradT &pix_grad, const PtsT &pts);
+
 private:
 	InputType getInputType(const ImgParams *img_params){
 		bool uchar_input = img_params ? img_params->uchar_input : UCHAR_INPUT;
@@ -187,6 +206,9 @@ private:
 	double getHessEps(const ImgParams *img_params){
 		return img_params ? img_params->hess_eps : HESS_EPS;
 	}
+	bool getUseGradCache(const ImgParams *img_params){
+		return img_params ? img_params->use_grad_cache : USE_GRAD_CACHE;
+	}
 
 };
 
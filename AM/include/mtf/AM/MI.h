@@ -2,6 +2,7 @@
 #define MTF_MI_H
 
 #include "AppearanceModel.h"
+#include "mtf/Utilities/histUtils.h"
 
 _MTF_BEGIN_NAMESPACE
 
@@ -19,6 +20,13 @@ struct MIParams : AMParams{
 	//! decides whether the partition of unity constraint has to be strictly observed for border bins;
 	//! if enabled, the pixel values will be normalized in the range [1, n_bins-2] so each pixel contributes to all 4 bins
 	bool partition_of_unity;
+	//! no. of blocks of pixels whose contributions to the histograms are computed in parallel,
+	//! each into its own copy of the histograms that are added in block order so that the results are reproducible;
+	//! 1 (default) or less processes all the pixels serially
+	int n_blocks;
+	//! no. of quantization levels per bin of the normalized pixel values in the table of B Spline weights
+	//! that is looked up instead of evaluating the spline for each pixel; 0 (default) disables the table
+	int lut_res;
 	ImageBase *pix_mapper;
 
 	bool debug_mode; //! decides whether logging data will be printed for debugging purposes; 
@@ -27,7 +35,8 @@ struct MIParams : AMParams{
 	//! value constructor
 	MIParams(const AMParams *am_params,
 		int _n_bins, double _pre_seed,
-		bool _partition_of_unity,		
+		bool _partition_of_unity,
+		int _n_blocks, int _lut_res,
 		ImageBase *_pix_mapper,
 		bool _debug_mode);
 	//! default/copy constructor
@@ -146,6 +155,11 @@ private:
 	MatrixX2i curr_bspl_ids;
 	MatrixXi linear_idx;
 
+	utils::BSpl3Table bspl_table;
+	//! per block histograms and Hessians for parallel accumulation
+	utils::BlockAccumulator<VectorXd, MatrixXd> hist_accum;
+	utils::BlockAccumulator<MatrixXd, MatrixXd> hess_accum;
+
 	void cmptSelfHist();
 };
 
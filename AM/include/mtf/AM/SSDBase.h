@@ -168,13 +168,15 @@ protected:
 
 	void cmptILMHessian(MatrixXd &d2f_dp2, const MatrixXd &dI_dpssm, 
 		const double* I, const double* df_dg = nullptr);
-	// functions to provide support for SPI
-	virtual void getJacobian(RowVectorXd &jacobian, const bool *pix_mask,
+	//! rows of the pixel Jacobian corresponding to the active pixels when SPI is enabled
+	MatrixXd spi_dI_dpssm;
+	// functions to provide support for SPI; these only process the pixels in spi_pix_ids
+	virtual void getJacobian(RowVectorXd &jacobian,
 		const RowVectorXd &curr_grad, const MatrixXd &pix_jacobian);
-	virtual void getHessian(MatrixXd &hessian, const bool *pix_mask, const MatrixXd &pix_jacobian);
-	virtual void getDifferenceOfJacobians(RowVectorXd &diff_of_jacobians, const bool *pix_mask,
+	virtual void getHessian(MatrixXd &hessian, const MatrixXd &pix_jacobian);
+	virtual void getDifferenceOfJacobians(RowVectorXd &diff_of_jacobians,
 		const MatrixXd &init_pix_jacobian, const MatrixXd &curr_pix_jacobian);
-	virtual void getSumOfHessians(MatrixXd &sum_of_hessians, const bool *pix_mask,
+	virtual void getSumOfHessians(MatrixXd &sum_of_hessians,
 		const MatrixXd &init_pix_jacobian, const MatrixXd &curr_pix_jacobian);
 };
 
@@ -52,6 +52,10 @@ public:
 	//-----------------------------------------------------------------------------------//
 
 	void updatePixVals(const PtsT& curr_pts) override;
+	void fuseNextPixGrad() override{
+		am1->fuseNextPixGrad();
+		am2->fuseNextPixGrad();
+	}
 
 	void updatePixGrad(const GradPtsT &warped_offset_pts) override;
 	void updatePixGrad(const PtsT &curr_pts) override;
@@ -7,13 +7,14 @@ int _resx, int _resy,
 double _grad_eps,
 double _hess_eps,
 bool _use_uchar_input,
+bool _use_grad_cache,
 double _likelihood_alpha,
 double _likelihood_beta,
 bool _dist_from_likelihood,
 double _forgetting_factor,
 IlluminationModel *_ilm) :
 ImgParams(_resx, _resy, 
-_grad_eps, _hess_eps, _use_uchar_input),
+_grad_eps, _hess_eps, _use_uchar_input, _use_grad_cache),
 likelihood_alpha(_likelihood_alpha),
 likelihood_beta(_likelihood_beta),
 dist_from_likelihood(_dist_from_likelihood),
@@ -5,16 +5,12 @@
 #include "mtf/Utilities/graphUtils.h"
 #include "opencv2/highgui/highgui.hpp"
 
-//! OpenMP scheduler
-#ifndef CCRE_OMP_SCHD
-#define CCRE_OMP_SCHD static
-#endif
-
 #define CCRE_N_BINS 8
 #define CCRE_PRE_SEED 10
 #define CCRE_POU false
 #define CCRE_SYMMETRICAL_GRAD false
-#define CCRE_N_BLOCKS 0
+#define CCRE_N_BLOCKS 1
+#define CCRE_LUT_RES 0
 #define CCRE_DEBUG_MODE false
 
 _MTF_BEGIN_NAMESPACE
@@ -22,7 +18,7 @@ _MTF_BEGIN_NAMESPACE
 CCREParams::CCREParams(const AMParams *am_params,
 int _n_bins, bool _partition_of_unity,
 double _pre_seed, bool _symmetrical_grad,
-int _n_blocks,
+int _n_blocks, int _lut_res,
 bool _debug_mode) :
 AMParams(am_params),
 n_bins(_n_bins),
@@ -30,6 +26,7 @@ partition_of_unity(_partition_of_unity),
 pre_seed(_pre_seed),
 symmetrical_grad(_symmetrical_grad),
 n_blocks(_n_blocks),
+lut_res(_lut_res),
 debug_mode(_debug_mode){}
 
 //! default and copy constructor
@@ -40,6 +37,7 @@ partition_of_unity(CCRE_POU),
 pre_seed(CCRE_PRE_SEED),
 symmetrical_grad(CCRE_SYMMETRICAL_GRAD),
 n_blocks(CCRE_N_BLOCKS),
+lut_res(CCRE_LUT_RES),
 debug_mode(CCRE_DEBUG_MODE){
 	if(params){
 		n_bins = params->n_bins;
@@ -47,6 +45,7 @@ debug_mode(CCRE_DEBUG_MODE){
 		pre_seed = params->pre_seed;
 		symmetrical_grad = params->symmetrical_grad;
 		n_blocks = params->n_blocks;
+		lut_res = params->lut_res;
 		debug_mode = params->debug_mode;
 	}
 }
@@ -71,10 +70,8 @@ params(ccre_params){
 	printf("pre_seed: %f\n", params.pre_seed);
 	printf("partition_of_unity: %d\n", params.partition_of_unity);
 	printf("symmetrical_grad: %d\n", params.symmetrical_grad);
-	if(params.n_blocks <= 0){
-		params.n_blocks = patch_size;
-	}
 	printf("n_blocks: %d\n", params.n_blocks);
+	printf("lut_res: %d\n", params.lut_res);
 	printf("likelihood_alpha: %f\n", params.likelihood_alpha);
 	printf("likelihood_beta: %f\n", params.likelihood_beta);
 	printf("debug_mode: %d\n", params.debug_mode);
@@ -129,14 +126,9 @@ params(ccre_params){
 			linear_idx2(j, bin_id) = linear_idx(bin_id, j) = bin_id * params.n_bins + j;
 		}
 	}
-	int pix_per_block = patch_size / params.n_blocks;
-	printf("pix_per_block: %d\n", pix_per_block);
-	block_extents.resize(params.n_blocks, Eigen::NoChange);
-	for(int block_id = 0; block_id < params.n_blocks; block_id++) {
-		block_extents(block_id, 0) = block_id*pix_per_block;
-		block_extents(block_id, 1) = (block_id + 1)*pix_per_block - 1;
-	}
-	block_extents(params.n_blocks - 1, 1) = patch_size - 1;
+	bspl_table.initialize(std_bspl_ids, params.lut_res);
+	hist_accum.initialize(patch_size, params.n_blocks);
+	hess_accum.initialize(patch_size, params.n_blocks);
 
 #ifndef CCRE_DISABLE_TRUE_CUM_HIST
 	printf("Using true cumulative histograms\n");
@@ -144,9 +136,7 @@ params(ccre_params){
 	printf("Using approximate cumulative histograms\n");
 #endif
 
-#ifdef ENABLE_TBB
-	printf(" ******* Parallelization enabled using TBB ******* \n");
-#elif defined ENABLE_OMP
+#ifdef ENABLE_OMP
 	printf(" ******* Parallelization enabled using OpenMP ******* \n");
 #endif
 
@@ -176,13 +166,10 @@ void CCRE::initializeSimilarity(){
 	init_hist_mat.setZero();
 	init_hist_grad.setZero();
 	for(unsigned int pix_id = 0; pix_id < patch_size; ++pix_id) {
-		init_bspl_ids.row(pix_id) = std_bspl_ids.row(static_cast<int>(I0(pix_id)));
-		double curr_diff = init_bspl_ids(pix_id, 0) - I0(pix_id);
+		bspl_table.getWeights(init_hist_mat, init_hist_grad, init_bspl_ids, pix_id, I0(pix_id));
 		for(int hist_id = init_bspl_ids(pix_id, 0); hist_id <= init_bspl_ids(pix_id, 1); hist_id++) {
-			utils::bSpl3WithGrad(init_hist_mat(hist_id, pix_id), init_hist_grad(hist_id, pix_id), curr_diff);
 			init_hist_grad(hist_id, pix_id) *= -hist_norm_mult;
 			init_hist(hist_id) += init_hist_mat(hist_id, pix_id);
-			++curr_diff;
 		}
 	}
 	init_hist *= hist_norm_mult;
@@ -192,6 +179,7 @@ void CCRE::initializeSimilarity(){
 		//! initial cumulative histogram and its gradient
 		init_cum_hist.fill(hist_pre_seed);
 		for(unsigned int pix_id = 0; pix_id < patch_size; ++pix_id) {
+			bspl_table.getCumWeights(init_cum_hist_mat, init_cum_hist_grad, init_bspl_ids, pix_id, I0(pix_id));
 			int cum_hist_id = 0;
 			while(cum_hist_id < init_bspl_ids(pix_id, 0)){
 #ifndef CCRE_DISABLE_TRUE_CUM_HIST
@@ -202,12 +190,9 @@ void CCRE::initializeSimilarity(){
 #endif
 				++cum_hist_id;
 			}
-			double curr_diff = cum_hist_id - I0(pix_id);
 			while(cum_hist_id <= init_bspl_ids(pix_id, 1)){
-				utils::cumBSpl3WithGrad(init_cum_hist_mat(cum_hist_id, pix_id), init_cum_hist_grad(cum_hist_id, pix_id), curr_diff);
 				init_cum_hist_grad(cum_hist_id, pix_id) *= -hist_norm_mult;
 				init_cum_hist(cum_hist_id) += init_cum_hist_mat(cum_hist_id, pix_id);
-				++curr_diff;
 				++cum_hist_id;
 			}
 			while(cum_hist_id < params.n_bins){
@@ -326,75 +311,46 @@ void CCRE::updateSimilarity(bool prereq_only){
 	cum_joint_hist.fill(params.pre_seed);
 
 	if(is_initialized.grad){
-		/**
-		compute both the histogram and its differential simultaneously
-		to take advantage of the many common computations involved
-		*/
 		curr_cum_hist_grad.setZero();
-#ifdef ENABLE_OMP
-#pragma omp parallel for schedule(CCRE_OMP_SCHD)
-#endif	
-		for(unsigned int pix_id = 0; pix_id < patch_size; ++pix_id){
-			curr_bspl_ids.row(pix_id) = std_bspl_ids.row(static_cast<int>(It(pix_id)));
-			int curr_id = 0;
-			while(curr_id < curr_bspl_ids(pix_id, 0)){
-#ifndef CCRE_DISABLE_TRUE_CUM_HIST
-				// curr_cum_hist_mat is unity and curr_cum_hist_grad is zero but the latter has already been zeroed
-				curr_cum_hist_mat(curr_id, pix_id) = 1;
-				++curr_cum_hist(curr_id);
-				for(int init_id = init_bspl_ids(pix_id, 0); init_id <= init_bspl_ids(pix_id, 1); init_id++) {
-					cum_joint_hist(curr_id, init_id) += init_hist_mat(init_id, pix_id);
-			}
-#else
-				curr_cum_hist_mat(curr_id, pix_id) = 0;
-#endif
-				++curr_id;
-			}
-			double curr_diff = curr_id - It(pix_id);
-			while(curr_id <= curr_bspl_ids(pix_id, 1)){
-				utils::cumBSpl3WithGrad(curr_cum_hist_mat(curr_id, pix_id), curr_cum_hist_grad(curr_id, pix_id), curr_diff);
-				curr_cum_hist_grad(curr_id, pix_id) *= -hist_norm_mult;
-
-				curr_cum_hist(curr_id) += curr_cum_hist_mat(curr_id, pix_id);
-				for(int init_id = init_bspl_ids(pix_id, 0); init_id <= init_bspl_ids(pix_id, 1); init_id++) {
-					cum_joint_hist(curr_id, init_id) += curr_cum_hist_mat(curr_id, pix_id) * init_hist_mat(init_id, pix_id);
-				}
-				++curr_diff;
-				++curr_id;
+	}
+	hist_accum.accumulate(curr_cum_hist, cum_joint_hist, [&](unsigned int start_id, unsigned int end_id,
+		VectorXd &block_cum_hist, MatrixXd &block_cum_joint_hist){
+		for(unsigned int pix_id = start_id; pix_id < end_id; ++pix_id){
+			/**
+			compute both the histogram and its differential simultaneously
+			to take advantage of the many common computations involved
+			*/
+			if(is_initialized.grad){
+				bspl_table.getCumWeights(curr_cum_hist_mat, curr_cum_hist_grad, curr_bspl_ids, pix_id, It(pix_id));
+			} else{
+				bspl_table.getCumWeights(curr_cum_hist_mat, curr_bspl_ids, pix_id, It(pix_id));
 			}
-		}
-	} else{
-#ifdef ENABLE_OMP
-#pragma omp parallel for schedule(CCRE_OMP_SCHD)
-#endif	
-		for(unsigned int pix_id = 0; pix_id < patch_size; ++pix_id){
-			curr_bspl_ids.row(pix_id) = std_bspl_ids.row(static_cast<int>(It(pix_id)));
 			int curr_id = 0;
 			while(curr_id < curr_bspl_ids(pix_id, 0)){
 #ifndef CCRE_DISABLE_TRUE_CUM_HIST
-				//! curr_cum_hist_mat is unity
+				// curr_cum_hist_mat is unity and curr_cum_hist_grad is zero but the latter has already been zeroed
 				curr_cum_hist_mat(curr_id, pix_id) = 1;
-				++curr_cum_hist(curr_id);
+				++block_cum_hist(curr_id);
 				for(int init_id = init_bspl_ids(pix_id, 0); init_id <= init_bspl_ids(pix_id, 1); init_id++) {
-					cum_joint_hist(curr_id, init_id) += init_hist_mat(init_id, pix_id);
+					block_cum_joint_hist(curr_id, init_id) += init_hist_mat(init_id, pix_id);
 				}
 #else
 				curr_cum_hist_mat(curr_id, pix_id) = 0;
 #endif
 				++curr_id;
 			}
-			double curr_diff = curr_id - It(pix_id);
 			while(curr_id <= curr_bspl_ids(pix_id, 1)){
-				curr_cum_hist_mat(curr_id, pix_id) = utils::cumBSpl3(curr_diff);
-				curr_cum_hist(curr_id) += curr_cum_hist_mat(curr_id, pix_id);
+				if(is_initialized.grad){
+					curr_cum_hist_grad(curr_id, pix_id) *= -hist_norm_mult;
+				}
+				block_cum_hist(curr_id) += curr_cum_hist_mat(curr_id, pix_id);
 				for(int init_id = init_bspl_ids(pix_id, 0); init_id <= init_bspl_ids(pix_id, 1); init_id++) {
-					cum_joint_hist(curr_id, init_id) += curr_cum_hist_mat(curr_id, pix_id) * init_hist_mat(init_id, pix_id);
+					block_cum_joint_hist(curr_id, init_id) += curr_cum_hist_mat(curr_id, pix_id) * init_hist_mat(init_id, pix_id);
 				}
-				++curr_diff;
 				++curr_id;
 			}
 		}
-	}
+	});
 	curr_cum_hist *= hist_norm_mult;
 	cum_joint_hist *= hist_norm_mult;
 	curr_cum_hist_log = curr_cum_hist.array().log();
@@ -430,50 +386,51 @@ void CCRE::updateInitGrad(){
 	// compute differential of the current joint histogram w.r.t. initial pixel values simultaneously with init_grad;
 	// this does not need to be normalized since init_hist_grad has already been normalized
 	init_cum_joint_hist_grad.setZero();
-#ifdef ENABLE_OMP
-#pragma omp parallel for schedule(CCRE_OMP_SCHD)
-#endif	
-	for(unsigned int pix_id = 0; pix_id < patch_size; ++pix_id){
-		df_dI0(pix_id) = 0;
-		for(int init_id = init_bspl_ids(pix_id, 0); init_id <= init_bspl_ids(pix_id, 1); init_id++) {
-			int curr_id = 0;
-			while(curr_id < curr_bspl_ids(pix_id, 0)){
+	hist_accum.run([&](unsigned int start_id, unsigned int end_id){
+		for(unsigned int pix_id = start_id; pix_id < end_id; ++pix_id){
+			df_dI0(pix_id) = 0;
+			for(int init_id = init_bspl_ids(pix_id, 0); init_id <= init_bspl_ids(pix_id, 1); init_id++) {
+				int curr_id = 0;
+				while(curr_id < curr_bspl_ids(pix_id, 0)){
 #ifndef CCRE_DISABLE_TRUE_CUM_HIST
-				int joint_id = linear_idx(curr_id, init_id);
-				init_cum_joint_hist_grad(joint_id, pix_id) = init_hist_grad(init_id, pix_id);
-				df_dI0(pix_id) += init_cum_joint_hist_grad(joint_id, pix_id) * (1 + ccre_log_term(curr_id, init_id))
-					- cum_joint_hist(curr_id, init_id) * init_hist_grad_ratio(init_id, pix_id);
+					int joint_id = linear_idx(curr_id, init_id);
+					init_cum_joint_hist_grad(joint_id, pix_id) = init_hist_grad(init_id, pix_id);
+					df_dI0(pix_id) += init_cum_joint_hist_grad(joint_id, pix_id) * (1 + ccre_log_term(curr_id, init_id))
+						- cum_joint_hist(curr_id, init_id) * init_hist_grad_ratio(init_id, pix_id);
 #else
-				df_dI0(pix_id) -= cum_joint_hist(curr_id, init_id) * init_hist_grad_ratio(init_id, pix_id);
+					df_dI0(pix_id) -= cum_joint_hist(curr_id, init_id) * init_hist_grad_ratio(init_id, pix_id);
 #endif
-				++curr_id;
-			}
-			while(curr_id <= curr_bspl_ids(pix_id, 1)){
-				int joint_id = linear_idx(curr_id, init_id);
-				init_cum_joint_hist_grad(joint_id, pix_id) = curr_cum_hist_mat(curr_id, pix_id) * init_hist_grad(init_id, pix_id);
-				df_dI0(pix_id) += init_cum_joint_hist_grad(joint_id, pix_id) * (1 + ccre_log_term(curr_id, init_id))
-					- cum_joint_hist(curr_id, init_id) * init_hist_grad_ratio(init_id, pix_id);
-				++curr_id;
-			}
-			while(curr_id < params.n_bins){
-				df_dI0(pix_id) -= cum_joint_hist(curr_id, init_id) * init_hist_grad_ratio(init_id, pix_id);
-				++curr_id;
+					++curr_id;
+				}
+				while(curr_id <= curr_bspl_ids(pix_id, 1)){
+					int joint_id = linear_idx(curr_id, init_id);
+					init_cum_joint_hist_grad(joint_id, pix_id) = curr_cum_hist_mat(curr_id, pix_id) * init_hist_grad(init_id, pix_id);
+					df_dI0(pix_id) += init_cum_joint_hist_grad(joint_id, pix_id) * (1 + ccre_log_term(curr_id, init_id))
+						- cum_joint_hist(curr_id, init_id) * init_hist_grad_ratio(init_id, pix_id);
+					++curr_id;
+				}
+				while(curr_id < params.n_bins){
+					df_dI0(pix_id) -= cum_joint_hist(curr_id, init_id) * init_hist_grad_ratio(init_id, pix_id);
+					++curr_id;
+				}
 			}
 		}
-	}
+	});
 }
 void CCRE::updateCurrGrad(){
 	curr_cum_joint_hist_grad.setZero();
-	for(unsigned int pix_id = 0; pix_id < patch_size; ++pix_id){
-		df_dIt(pix_id) = 0;
-		for(int curr_id = curr_bspl_ids(pix_id, 0); curr_id <= curr_bspl_ids(pix_id, 1); curr_id++) {
-			for(int init_id = init_bspl_ids(pix_id, 0); init_id <= init_bspl_ids(pix_id, 1); init_id++) {
-				int joint_id = linear_idx(curr_id, init_id);
-				curr_cum_joint_hist_grad(joint_id, pix_id) = curr_cum_hist_grad(curr_id, pix_id) * init_hist_mat(init_id, pix_id);
-				df_dIt(pix_id) += curr_cum_joint_hist_grad(joint_id, pix_id) * ccre_log_term(curr_id, init_id);
+	hist_accum.run([&](unsigned int start_id, unsigned int end_id){
+		for(unsigned int pix_id = start_id; pix_id < end_id; ++pix_id){
+			df_dIt(pix_id) = 0;
+			for(int curr_id = curr_bspl_ids(pix_id, 0); curr_id <= curr_bspl_ids(pix_id, 1); curr_id++) {
+				for(int init_id = init_bspl_ids(pix_id, 0); init_id <= init_bspl_ids(pix_id, 1); init_id++) {
+					int joint_id = linear_idx(curr_id, init_id);
+					curr_cum_joint_hist_grad(joint_id, pix_id) = curr_cum_hist_grad(curr_id, pix_id) * init_hist_mat(init_id, pix_id);
+					df_dIt(pix_id) += curr_cum_joint_hist_grad(joint_id, pix_id) * ccre_log_term(curr_id, init_id);
+				}
 			}
 		}
-	}
+	});
 	//if(params.debug_mode){
 	//	utils::printMatrixToFile(_curr_bspl_ids.transpose(), "_curr_bspl_ids", log_fname, "%d");
 	//	utils::printMatrixToFile(_init_bspl_ids.transpose(), "_init_bspl_ids", log_fname, "%d");
@@ -543,9 +500,6 @@ void  CCRE::cmptInitHessian(MatrixXd &hessian, const MatrixXd &init_pix_jacobian
 		}
 		hessian += cum_joint_hist_sum(init_id)*init_hist_grad_ratio_jac.row(init_id).transpose()*init_hist_grad_ratio_jac.row(init_id);
 	}
-#ifdef ENABLE_OMP
-#pragma omp parallel for schedule(CCRE_OMP_SCHD)
-#endif	
 	for(unsigned int pix_id = 0; pix_id < patch_size; ++pix_id){
 		double scalar_term = 0;
 		for(int init_id = init_bspl_ids(pix_id, 0); init_id <= init_bspl_ids(pix_id, 1); init_id++) {
@@ -572,25 +526,24 @@ void  CCRE::cmptCurrHessian(MatrixXd &hessian, const MatrixXd &curr_pix_jacobian
 	joint_hist_jacobian.setZero();
 	curr_cum_hist_hess.setZero();
 
-#ifdef ENABLE_OMP
-#pragma omp parallel for schedule(CCRE_OMP_SCHD)
-#endif	
-	for(unsigned int pix_id = 0; pix_id < patch_size; ++pix_id){
-		double curr_diff = curr_bspl_ids(pix_id, 0) - It(pix_id);
-		double hist_hess_term = 0;
-		for(int curr_id = curr_bspl_ids(pix_id, 0); curr_id <= curr_bspl_ids(pix_id, 1); curr_id++) {
-			double inner_term = 0;
-			for(int init_id = init_bspl_ids(pix_id, 0); init_id <= init_bspl_ids(pix_id, 1); init_id++) {
-				int joint_id = linear_idx(curr_id, init_id);
-				joint_hist_jacobian.row(joint_id) += curr_cum_joint_hist_grad(joint_id, pix_id)*curr_pix_jacobian.row(pix_id);
-				inner_term += init_hist_mat(init_id, pix_id) * ccre_log_term(curr_id, init_id);
+	hess_accum.accumulate(hessian, joint_hist_jacobian, [&](unsigned int start_id, unsigned int end_id,
+		MatrixXd &block_hessian, MatrixXd &block_joint_hist_jacobian){
+		for(unsigned int pix_id = start_id; pix_id < end_id; ++pix_id){
+			bspl_table.getCumHess(curr_cum_hist_hess, curr_bspl_ids, pix_id, It(pix_id));
+			double hist_hess_term = 0;
+			for(int curr_id = curr_bspl_ids(pix_id, 0); curr_id <= curr_bspl_ids(pix_id, 1); curr_id++) {
+				double inner_term = 0;
+				for(int init_id = init_bspl_ids(pix_id, 0); init_id <= init_bspl_ids(pix_id, 1); init_id++) {
+					int joint_id = linear_idx(curr_id, init_id);
+					block_joint_hist_jacobian.row(joint_id) += curr_cum_joint_hist_grad(joint_id, pix_id)*curr_pix_jacobian.row(pix_id);
+					inner_term += init_hist_mat(init_id, pix_id) * ccre_log_term(curr_id, init_id);
+				}
+				curr_cum_hist_hess(curr_id, pix_id) *= hist_norm_mult;
+				hist_hess_term += curr_cum_hist_hess(curr_id, pix_id)*inner_term;
 			}
-			curr_cum_hist_hess(curr_id, pix_id) = hist_norm_mult*utils::cumBSpl3Hess(curr_diff);
-			++curr_diff;
-			hist_hess_term += curr_cum_hist_hess(curr_id, pix_id)*inner_term;
+			block_hessian += hist_hess_term * curr_pix_jacobian.row(pix_id).transpose() * curr_pix_jacobian.row(pix_id);
 		}
-		hessian += hist_hess_term * curr_pix_jacobian.row(pix_id).transpose() * curr_pix_jacobian.row(pix_id);
-	}
+	});
 
 	for(int curr_id = 0; curr_id < params.n_bins; curr_id++){
 		for(int init_id = 0; init_id < params.n_bins; init_id++){
@@ -608,28 +561,26 @@ void CCRE::cmptCumSelfHist(){
 	curr_hist_mat.setZero();
 	curr_cum_hist_hess.setZero();
 
-#ifdef ENABLE_OMP
-#pragma omp parallel for schedule(CCRE_OMP_SCHD)
-#endif	
-	for(unsigned int pix_id = 0; pix_id < patch_size; ++pix_id) {
-		double curr_diff = curr_bspl_ids(pix_id, 0) - It(pix_id);
-		for(int hist_id = curr_bspl_ids(pix_id, 0); hist_id <= curr_bspl_ids(pix_id, 1); ++hist_id) {
-			curr_hist_mat(hist_id, pix_id) = utils::bSpl3(curr_diff);
-			curr_cum_hist_hess(hist_id, pix_id) = hist_norm_mult*utils::cumBSpl3Hess(curr_diff);
-			++curr_diff;
-			curr_hist(hist_id) += curr_hist_mat(hist_id, pix_id);
+	hist_accum.accumulate(curr_hist, self_cum_joint_hist, [&](unsigned int start_id, unsigned int end_id,
+		VectorXd &block_hist, MatrixXd &block_cum_joint_hist){
+		for(unsigned int pix_id = start_id; pix_id < end_id; ++pix_id){
+			bspl_table.getWeightsWithCumHess(curr_hist_mat, curr_cum_hist_hess, curr_bspl_ids, pix_id, It(pix_id));
+			for(int hist_id = curr_bspl_ids(pix_id, 0); hist_id <= curr_bspl_ids(pix_id, 1); ++hist_id) {
+				curr_cum_hist_hess(hist_id, pix_id) *= hist_norm_mult;
+				block_hist(hist_id) += curr_hist_mat(hist_id, pix_id);
 
-			int cum_hist_id = 0;
-			while(cum_hist_id < curr_bspl_ids(pix_id, 0)){
-				self_cum_joint_hist(cum_hist_id, hist_id) += curr_hist_mat(hist_id, pix_id);
-				++cum_hist_id;
-			}
-			while(cum_hist_id <= curr_bspl_ids(pix_id, 1)){
-				self_cum_joint_hist(cum_hist_id, hist_id) += curr_cum_hist_mat(cum_hist_id, pix_id) * curr_hist_mat(hist_id, pix_id);
-				++cum_hist_id;
+				int cum_hist_id = 0;
+				while(cum_hist_id < curr_bspl_ids(pix_id, 0)){
+					block_cum_joint_hist(cum_hist_id, hist_id) += curr_hist_mat(hist_id, pix_id);
+					++cum_hist_id;
+				}
+				while(cum_hist_id <= curr_bspl_ids(pix_id, 1)){
+					block_cum_joint_hist(cum_hist_id, hist_id) += curr_cum_hist_mat(cum_hist_id, pix_id) * curr_hist_mat(hist_id, pix_id);
+					++cum_hist_id;
+				}
 			}
 		}
-	}
+	});
 	curr_hist *= hist_norm_mult;
 	self_cum_joint_hist *= hist_norm_mult;
 	curr_hist_log = curr_hist.array().log();
@@ -651,23 +602,23 @@ void CCRE::cmptSelfHessian(MatrixXd &self_hessian, const MatrixXd &curr_pix_jaco
 	MatrixXd joint_hist_jacobian(joint_hist_size, ssm_state_size);
 	self_hessian.setZero();
 	joint_hist_jacobian.setZero();
-#ifdef ENABLE_OMP
-#pragma omp parallel for schedule(CCRE_OMP_SCHD)
-#endif	
-	for(unsigned int pix_id = 0; pix_id < patch_size; ++pix_id){
-		double hist_hess_term = 0;
-		for(int cum_hist_id = curr_bspl_ids(pix_id, 0); cum_hist_id <= curr_bspl_ids(pix_id, 1); ++cum_hist_id) {
-			double inner_term = 0;
-			for(int hist_id = curr_bspl_ids(pix_id, 0); hist_id <= curr_bspl_ids(pix_id, 1); ++hist_id) {
-				int joint_id = linear_idx(cum_hist_id, hist_id);
-				joint_hist_jacobian.row(joint_id) += curr_cum_hist_grad(cum_hist_id, pix_id) * curr_hist_mat(hist_id, pix_id) *
-					curr_pix_jacobian.row(pix_id);
-				inner_term += curr_hist_mat(hist_id, pix_id) * self_ccre_log_term(cum_hist_id, hist_id);
+	hess_accum.accumulate(self_hessian, joint_hist_jacobian, [&](unsigned int start_id, unsigned int end_id,
+		MatrixXd &block_hessian, MatrixXd &block_joint_hist_jacobian){
+		for(unsigned int pix_id = start_id; pix_id < end_id; ++pix_id){
+			double hist_hess_term = 0;
+			for(int cum_hist_id = curr_bspl_ids(pix_id, 0); cum_hist_id <= curr_bspl_ids(pix_id, 1); ++cum_hist_id) {
+				double inner_term = 0;
+				for(int hist_id = curr_bspl_ids(pix_id, 0); hist_id <= curr_bspl_ids(pix_id, 1); ++hist_id) {
+					int joint_id = linear_idx(cum_hist_id, hist_id);
+					block_joint_hist_jacobian.row(joint_id) += curr_cum_hist_grad(cum_hist_id, pix_id) * curr_hist_mat(hist_id, pix_id) *
+						curr_pix_jacobian.row(pix_id);
+					inner_term += curr_hist_mat(hist_id, pix_id) * self_ccre_log_term(cum_hist_id, hist_id);
+				}
+				hist_hess_term += curr_cum_hist_hess(cum_hist_id, pix_id)*inner_term;
 			}
-			hist_hess_term += curr_cum_hist_hess(cum_hist_id, pix_id)*inner_term;
+			block_hessian += hist_hess_term * curr_pix_jacobian.row(pix_id).transpose() * curr_pix_jacobian.row(pix_id);
 		}
-		self_hessian += hist_hess_term * curr_pix_jacobian.row(pix_id).transpose() * curr_pix_jacobian.row(pix_id);
-	}
+	});
 	for(int r = 0; r < params.n_bins; ++r){
 		for(int t = 0; t < params.n_bins; ++t){
 			int idx = linear_idx(r, t);
@@ -684,26 +635,27 @@ void CCRE::updateSymSimilarity(bool prereq_only){
 	curr_hist.fill(hist_pre_seed);
 	curr_hist_mat.setZero();
 	cum_joint_hist.fill(params.pre_seed);
-	for(unsigned int pix_id = 0; pix_id < patch_size; ++pix_id) {
-		double curr_diff = curr_bspl_ids(pix_id, 0) - It(pix_id);
-		for(int curr_id = curr_bspl_ids(pix_id, 0); curr_id <= curr_bspl_ids(pix_id, 1); ++curr_id) {
-			curr_hist_mat(curr_id, pix_id) = utils::bSpl3(curr_diff);
-			++curr_diff;
-			curr_hist(curr_id) += curr_hist_mat(curr_id, pix_id);
-			int init_id = 0;
-			while(init_id < init_bspl_ids(pix_id, 0)){
+	hist_accum.accumulate(curr_hist, cum_joint_hist, [&](unsigned int start_id, unsigned int end_id,
+		VectorXd &block_hist, MatrixXd &block_cum_joint_hist){
+		for(unsigned int pix_id = start_id; pix_id < end_id; ++pix_id){
+			bspl_table.getWeights(curr_hist_mat, curr_bspl_ids, pix_id, It(pix_id));
+			for(int curr_id = curr_bspl_ids(pix_id, 0); curr_id <= curr_bspl_ids(pix_id, 1); ++curr_id) {
+				block_hist(curr_id) += curr_hist_mat(curr_id, pix_id);
+				int init_id = 0;
+				while(init_id < init_bspl_ids(pix_id, 0)){
 #ifndef CCRE_DISABLE_TRUE_CUM_HIST
-				// init_cum_hist_mat is unity
-				cum_joint_hist(init_id, curr_id) += curr_hist_mat(curr_id, pix_id);
+					// init_cum_hist_mat is unity
+					block_cum_joint_hist(init_id, curr_id) += curr_hist_mat(curr_id, pix_id);
 #endif
-				++init_id;
-			}
-			while(init_id <= init_bspl_ids(pix_id, 1)){
-				cum_joint_hist(init_id, curr_id) += init_cum_hist_mat(init_id, pix_id) * curr_hist_mat(curr_id, pix_id);
-				++init_id;
+					++init_id;
+				}
+				while(init_id <= init_bspl_ids(pix_id, 1)){
+					block_cum_joint_hist(init_id, curr_id) += init_cum_hist_mat(init_id, pix_id) * curr_hist_mat(curr_id, pix_id);
+					++init_id;
+				}
 			}
 		}
-	}
+	});
 	cum_joint_hist *= hist_norm_mult;
 	curr_hist *= hist_norm_mult;
 	cum_joint_hist_log = cum_joint_hist.array().log();
@@ -722,16 +674,18 @@ void CCRE::updateSymSimilarity(bool prereq_only){
 }
 void CCRE::updateSymInitGrad(){
 	init_cum_joint_hist_grad.setZero();
-	for(unsigned int pix_id = 0; pix_id < patch_size; ++pix_id) {
-		df_dI0(pix_id) = 0;
-		for(int curr_id = curr_bspl_ids(pix_id, 0); curr_id <= curr_bspl_ids(pix_id, 1); curr_id++) {
-			for(int init_id = init_bspl_ids(pix_id, 0); init_id <= init_bspl_ids(pix_id, 1); init_id++) {
-				int joint_id = linear_idx(init_id, curr_id);
-				init_cum_joint_hist_grad(joint_id, pix_id) = init_cum_hist_grad(init_id, pix_id) * curr_hist_mat(curr_id, pix_id);
-				df_dI0(pix_id) += init_cum_joint_hist_grad(joint_id, pix_id) * ccre_log_term(init_id, curr_id);
+	hist_accum.run([&](unsigned int start_id, unsigned int end_id){
+		for(unsigned int pix_id = start_id; pix_id < end_id; ++pix_id){
+			df_dI0(pix_id) = 0;
+			for(int curr_id = curr_bspl_ids(pix_id, 0); curr_id <= curr_bspl_ids(pix_id, 1); curr_id++) {
+				for(int init_id = init_bspl_ids(pix_id, 0); init_id <= init_bspl_ids(pix_id, 1); init_id++) {
+					int joint_id = linear_idx(init_id, curr_id);
+					init_cum_joint_hist_grad(joint_id, pix_id) = init_cum_hist_grad(init_id, pix_id) * curr_hist_mat(curr_id, pix_id);
+					df_dI0(pix_id) += init_cum_joint_hist_grad(joint_id, pix_id) * ccre_log_term(init_id, curr_id);
+				}
 			}
 		}
-	}
+	});
 }
 void  CCRE::cmptSymInitHessian(MatrixXd &hessian, const MatrixXd &init_pix_jacobian){
 	assert(hessian.rows() == hessian.cols() && hessian.cols() == init_pix_jacobian.cols());
@@ -741,22 +695,22 @@ void  CCRE::cmptSymInitHessian(MatrixXd &hessian, const MatrixXd &init_pix_jacob
 	MatrixXd joint_hist_jacobian(joint_hist_size, ssm_state_size);
 	joint_hist_jacobian.setZero();
 	hessian.setZero();
-#ifdef ENABLE_OMP
-#pragma omp parallel for schedule(CCRE_OMP_SCHD)
-#endif	
-	for(unsigned int pix_id = 0; pix_id < patch_size; ++pix_id){
-		double hist_hess_term = 0;
-		for(int init_id = init_bspl_ids(pix_id, 0); init_id <= init_bspl_ids(pix_id, 1); init_id++) {
-			double inner_term = 0;
-			for(int curr_id = curr_bspl_ids(pix_id, 0); curr_id <= curr_bspl_ids(pix_id, 1); curr_id++) {
-				int joint_id = linear_idx(init_id, curr_id);
-				joint_hist_jacobian.row(joint_id) += init_cum_joint_hist_grad(joint_id, pix_id)*init_pix_jacobian.row(pix_id);
-				inner_term += curr_hist_mat(curr_id, pix_id) * ccre_log_term(init_id, curr_id);
+	hess_accum.accumulate(hessian, joint_hist_jacobian, [&](unsigned int start_id, unsigned int end_id,
+		MatrixXd &block_hessian, MatrixXd &block_joint_hist_jacobian){
+		for(unsigned int pix_id = start_id; pix_id < end_id; ++pix_id){
+			double hist_hess_term = 0;
+			for(int init_id = init_bspl_ids(pix_id, 0); init_id <= init_bspl_ids(pix_id, 1); init_id++) {
+				double inner_term = 0;
+				for(int curr_id = curr_bspl_ids(pix_id, 0); curr_id <= curr_bspl_ids(pix_id, 1); curr_id++) {
+					int joint_id = linear_idx(init_id, curr_id);
+					block_joint_hist_jacobian.row(joint_id) += init_cum_joint_hist_grad(joint_id, pix_id)*init_pix_jacobian.row(pix_id);
+					inner_term += curr_hist_mat(curr_id, pix_id) * ccre_log_term(init_id, curr_id);
+				}
+				hist_hess_term += init_cum_hist_hess(init_id, pix_id)*inner_term;
 			}
-			hist_hess_term += init_cum_hist_hess(init_id, pix_id)*inner_term;
+			block_hessian += hist_hess_term * init_pix_jacobian.row(pix_id).transpose() * init_pix_jacobian.row(pix_id);
 		}
-		hessian += hist_hess_term * init_pix_jacobian.row(pix_id).transpose() * init_pix_jacobian.row(pix_id);
-	}
+	});
 	for(int init_id = 0; init_id < params.n_bins; init_id++){
 		for(int curr_id = 0; curr_id < params.n_bins; curr_id++){
 			int joint_id = linear_idx(init_id, curr_id);
@@ -771,25 +725,24 @@ void  CCRE::cmptSymInitHessian(MatrixXd &hessian, const MatrixXd &init_pix_jacob
 void CCRE::updateDistFeat(double* feat_addr){
 	MatrixXdMr cum_hist_mat(feat_addr, 9, patch_size);
 
-#ifdef ENABLE_OMP
-#pragma omp parallel for schedule(CCRE_OMP_SCHD)
-#endif	
-	for(size_t patch_id = 0; patch_id < patch_size; patch_id++) {
-		int pix_val_floor = static_cast<int>(It(patch_id));
-		double pix_diff = std_bspl_ids(pix_val_floor, 0) - It(patch_id);
-		cum_hist_mat(0, patch_id) = pix_val_floor;
-		cum_hist_mat(1, patch_id) = utils::cumBSpl3(pix_diff);
-		cum_hist_mat(5, patch_id) = utils::bSpl3(pix_diff++);
-
-		cum_hist_mat(2, patch_id) = utils::cumBSpl3(pix_diff);
-		cum_hist_mat(6, patch_id) = utils::bSpl3(pix_diff++);
-
-		cum_hist_mat(3, patch_id) = utils::cumBSpl3(pix_diff);
-		cum_hist_mat(7, patch_id) = utils::bSpl3(pix_diff++);
-
-		cum_hist_mat(4, patch_id) = utils::cumBSpl3(pix_diff);
-		cum_hist_mat(8, patch_id) = utils::bSpl3(pix_diff);
-	}
+	hist_accum.run([&](unsigned int start_id, unsigned int end_id){
+		for(size_t patch_id = start_id; patch_id < end_id; patch_id++){
+			int pix_val_floor = static_cast<int>(It(patch_id));
+			double pix_diff = std_bspl_ids(pix_val_floor, 0) - It(patch_id);
+			cum_hist_mat(0, patch_id) = pix_val_floor;
+			cum_hist_mat(1, patch_id) = utils::cumBSpl3(pix_diff);
+			cum_hist_mat(5, patch_id) = utils::bSpl3(pix_diff++);
+
+			cum_hist_mat(2, patch_id) = utils::cumBSpl3(pix_diff);
+			cum_hist_mat(6, patch_id) = utils::bSpl3(pix_diff++);
+
+			cum_hist_mat(3, patch_id) = utils::cumBSpl3(pix_diff);
+			cum_hist_mat(7, patch_id) = utils::bSpl3(pix_diff++);
+
+			cum_hist_mat(4, patch_id) = utils::cumBSpl3(pix_diff);
+			cum_hist_mat(8, patch_id) = utils::bSpl3(pix_diff);
+		}
+	});
 }
 
 //----------------------------------- Second order Hessians -----------------------------------//
@@ -837,24 +790,24 @@ void CCRE::cmptSelfHessian(MatrixXd &self_hessian, const MatrixXd &curr_pix_jaco
 	MatrixXd joint_hist_jacobian(joint_hist_size, ssm_state_size);
 	self_hessian.setZero();
 	joint_hist_jacobian.setZero();
-#ifdef ENABLE_OMP
-#pragma omp parallel for schedule(CCRE_OMP_SCHD)
-#endif	
-	for(unsigned int pix_id = 0; pix_id < patch_size; ++pix_id){
-		double hist_hess_term = 0, hist_grad_term = 0;
-		for(int r = curr_bspl_ids(pix_id, 0); r <= curr_bspl_ids(pix_id, 1); r++) {
-			double inner_term = 0;
-			for(int t = curr_bspl_ids(pix_id, 0); t <= curr_bspl_ids(pix_id, 1); t++) {
-				int idx = linear_idx(r, t);
-				joint_hist_jacobian.row(idx) += curr_cum_hist_grad(r, pix_id) * curr_hist_mat(t, pix_id)*curr_pix_jacobian.row(pix_id);
-				inner_term += curr_hist_mat(t, pix_id) * self_ccre_log_term(r, t);
+	hess_accum.accumulate(self_hessian, joint_hist_jacobian, [&](unsigned int start_id, unsigned int end_id,
+		MatrixXd &block_hessian, MatrixXd &block_joint_hist_jacobian){
+		for(unsigned int pix_id = start_id; pix_id < end_id; ++pix_id){
+			double hist_hess_term = 0, hist_grad_term = 0;
+			for(int r = curr_bspl_ids(pix_id, 0); r <= curr_bspl_ids(pix_id, 1); r++) {
+				double inner_term = 0;
+				for(int t = curr_bspl_ids(pix_id, 0); t <= curr_bspl_ids(pix_id, 1); t++) {
+					int idx = linear_idx(r, t);
+					block_joint_hist_jacobian.row(idx) += curr_cum_hist_grad(r, pix_id) * curr_hist_mat(t, pix_id)*curr_pix_jacobian.row(pix_id);
+					inner_term += curr_hist_mat(t, pix_id) * self_ccre_log_term(r, t);
+				}
+				hist_hess_term += curr_cum_hist_hess(r, pix_id)*inner_term;
+				hist_grad_term += curr_cum_hist_grad(r, pix_id)*inner_term;
 			}
-			hist_hess_term += curr_cum_hist_hess(r, pix_id)*inner_term;
-			hist_grad_term += curr_cum_hist_grad(r, pix_id)*inner_term;
+			block_hessian += hist_hess_term * curr_pix_jacobian.row(pix_id).transpose() * curr_pix_jacobian.row(pix_id)
+				+ hist_grad_term * Map<const MatrixXd>(curr_pix_hessian.col(pix_id).data(), ssm_state_size, ssm_state_size);
 		}
-		self_hessian += hist_hess_term * curr_pix_jacobian.row(pix_id).transpose() * curr_pix_jacobian.row(pix_id)
-			+ hist_grad_term * Map<const MatrixXd>(curr_pix_hessian.col(pix_id).data(), ssm_state_size, ssm_state_size);
-	}
+	});
 	for(int r = 0; r < params.n_bins; r++){
 		for(int t = 0; t < params.n_bins; t++){
 			int idx = linear_idx(r, t);
@@ -885,9 +838,6 @@ double CCREDist::operator()(const double* hist1_mat_addr, const double* hist2_ma
 
 	//utils::printMatrixToFile(hist1_mat, "hist1_mat", "log/ccre_log.txt");
 	//utils::printMatrixToFile(hist2_mat, "hist2_mat", "log/ccre_log.txt");
-#ifdef ENABLE_OMP
-#pragma omp parallel for schedule(CCRE_OMP_SCHD)
-#endif	
 	for(size_t patch_id = 0; patch_id < patch_size; ++patch_id) {
 		int pix1_floor = static_cast<int>(cum_hist_mat(0, patch_id));
 		int pix2_floor = static_cast<int>(hist_mat(0, patch_id));
@@ -109,6 +109,7 @@ SSDBase(dfm_params), params(dfm_params) {
 	std::cout << "The feature blob size is " << feature_blob->shape(0) << " " << feature_blob->shape(2) << " " << feature_blob->shape(3) << std::endl;
 
 	n_pix = feature_blob->shape(2) * feature_blob->shape(3) * params.nfmaps;
+	updateSPIPixIDs();
 
 	/* Load the binaryproto mean file. */
 	set_mean(mean_file);
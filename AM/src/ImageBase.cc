@@ -5,21 +5,23 @@ _MTF_BEGIN_NAMESPACE
 
 ImgParams::ImgParams(int _resx, int _resy,
 double _grad_eps, double _hess_eps,
-bool _use_uchar_input) :
+bool _use_uchar_input, bool _use_grad_cache) :
 resx(_resx), resy(_resy),
 grad_eps(_grad_eps), hess_eps(_hess_eps),
-uchar_input(_use_uchar_input){}
+uchar_input(_use_uchar_input),
+use_grad_cache(_use_grad_cache){}
 
 ImgParams::ImgParams(const ImgParams *img_params) :
 resx(MTF_RES), resy(MTF_RES),
 grad_eps(GRAD_EPS), hess_eps(HESS_EPS),
-uchar_input(UCHAR_INPUT){
+uchar_input(UCHAR_INPUT), use_grad_cache(USE_GRAD_CACHE){
 	if(img_params){
 		resx = img_params->resx;
 		resy = img_params->resy;
 		grad_eps = img_params->grad_eps;
 		hess_eps = img_params->hess_eps;
 		uchar_input = img_params->uchar_input;
+		use_grad_cache = img_params->use_grad_cache;
 	}
 }
 
@@ -29,7 +31,9 @@ n_channels(_n_channels), patch_size(n_pix*n_channels),
 grad_eps(getGradEps(params)), hess_eps(getHessEps(params)),
 input_type(getInputType(params)),
 curr_img(nullptr, 0, 0), img_height(0), img_width(0),
-pix_norm_add(0.0), pix_norm_mult(1.0), frame_count(0){
+pix_norm_add(0.0), pix_norm_mult(1.0), frame_count(0),
+fuse_pix_grad(false), pix_grad_fused(false),
+use_grad_cache(getUseGradCache(params)){
 	if(resx == 0 || resy == 0) {
 		throw utils::InvalidArgument("ImageBase::Invalid sampling resolution provided");
 	}
@@ -40,6 +44,7 @@ void ImageBase::setCurrImg(const cv::Mat &cv_img){
 	img_height = cv_img.rows;
 	img_width = cv_img.cols;
 	curr_img_cv = cv_img;
+	pix_grad_fused = false;
 
 	//uchar_input = cv_img.type() == CV_8UC1 || cv_img.type() == CV_8UC3;
 	//input_type = uchar_input ?
@@ -56,6 +61,9 @@ void ImageBase::setCurrImg(const cv::Mat &cv_img){
 		// single channel image can share data with an Eigen matrix
 		// not really necessary but remains as a relic from the past
 		new (&curr_img) EigImgT((EigPixT*)(cv_img.data), img_height, img_width);
+		if(use_grad_cache){
+			img_cache = utils::FrameCache::find(cv_img);
+		}
 	}
 }
 
@@ -115,8 +123,12 @@ void ImageBase::initializePixGrad(const Matrix2Xd &init_pts){
 			img_height, img_width, pix_norm_mult);
 		break;
 	case InputType::MTF_32FC1:
-		utils::getImgGrad(dI0_dx, curr_img, init_pts, grad_eps, n_pix,
-			img_height, img_width, pix_norm_mult);
+		if(img_cache.cache){
+			getCachedPixGrad(dI0_dx, init_pts);
+		} else{
+			utils::getImgGrad(dI0_dx, curr_img, init_pts, grad_eps, n_pix,
+				img_height, img_width, pix_norm_mult);
+		}
 		break;
 	case InputType::MTF_32FC3:
 		utils::mc::getImgGrad<float>(dI0_dx, curr_img_cv, init_pts, grad_eps, n_pix,
@@ -267,6 +279,8 @@ VectorXd ImageBase::getPatch(const PtsT& curr_pts){
 
 void ImageBase::updatePixVals(const Matrix2Xd& curr_pts){
 	assert(curr_pts.cols() == n_pix);
+	bool fuse_grad = fuse_pix_grad && !img_cache.cache;
+	fuse_pix_grad = false;
 	switch(input_type){
 	case InputType::MTF_8UC1:
 		utils::sc::getPixVals<uchar>(It, curr_img_cv, curr_pts, n_pix, img_height, img_width,
@@ -277,8 +291,15 @@ void ImageBase::updatePixVals(const Matrix2Xd& curr_pts){
 			pix_norm_mult, pix_norm_add);
 		break;
 	case InputType::MTF_32FC1:
-		utils::getPixVals(It, curr_img, curr_pts, n_pix, img_height, img_width,
-			pix_norm_mult, pix_norm_add);
+		if(fuse_grad){
+			utils::getPixValsWithGrad(It, dIt_dx, curr_img, curr_pts, grad_eps, n_pix,
+				img_height, img_width, pix_norm_mult, pix_norm_add);
+			fused_pix_grad_pts = curr_pts;
+			pix_grad_fused = true;
+		} else{
+			utils::getPixVals(It, curr_img, curr_pts, n_pix, img_height, img_width,
+				pix_norm_mult, pix_norm_add);
+		}
 		break;
 	case InputType::MTF_32FC3:
 		utils::mc::getPixVals<float>(It, curr_img_cv, curr_pts, n_pix, img_height, img_width,
@@ -291,6 +312,17 @@ void ImageBase::updatePixVals(const Matrix2Xd& curr_pts){
 
 void ImageBase::updatePixGrad(const Matrix2Xd &curr_pts){
 	assert(curr_pts.cols() == n_pix);
+	if(input_type == InputType::MTF_32FC1){
+		if(img_cache.cache){
+			getCachedPixGrad(dIt_dx, curr_pts);
+			return;
+		}
+		if(pix_grad_fused){
+			//! can be used only once since the points and the image might change afterwards
+			pix_grad_fused = false;
+			if(curr_pts == fused_pix_grad_pts){ return; }
+		}
+	}
 	switch(input_type){
 	case InputType::MTF_8UC1:
 		utils::sc::getImgGrad<uchar>(dIt_dx, curr_img_cv, curr_pts,
@@ -313,6 +345,16 @@ void ImageBase::updatePixGrad(const Matrix2Xd &curr_pts){
 	}
 }
 
+void ImageBase::getCachedPixGrad(PixGradT &pix_grad, const PtsT &pts){
+	cv::Mat grad_x, grad_y;
+	//! only built by the first AM to request them for the current frame
+	img_cache.cache->getGradient(grad_x, grad_y, img_cache.level, img_cache.scale_factor);
+	utils::getImgGrad(pix_grad,
+		EigImgT((EigPixT*)(grad_x.data), img_height, img_width),
+		EigImgT((EigPixT*)(grad_y.data), img_height, img_width),
+		pts, n_pix, img_height, img_width, pix_norm_mult);
+}
+
 void ImageBase::updatePixHess(const Matrix2Xd &curr_pts){
 	assert(curr_pts.cols() == n_pix);
 	switch(input_type){
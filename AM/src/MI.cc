@@ -6,6 +6,8 @@
 #define MI_N_BINS 8
 #define MI_PRE_SEED 10
 #define MI_POU false
+#define MI_N_BLOCKS 1
+#define MI_LUT_RES 0
 #define MI_PIX_MAPPER nullptr
 #define MI_DEBUG_MODE false
 
@@ -15,13 +17,15 @@ _MTF_BEGIN_NAMESPACE
 MIParams::MIParams(const AMParams *am_params,
 int _n_bins, double _pre_seed,
 bool _partition_of_unity,
-
+int _n_blocks, int _lut_res,
 ImageBase *_pix_mapper,
 bool _debug_mode) :
 AMParams(am_params),
 n_bins(_n_bins),
 pre_seed(_pre_seed),
 partition_of_unity(_partition_of_unity),
+n_blocks(_n_blocks),
+lut_res(_lut_res),
 pix_mapper(_pix_mapper),
 debug_mode(_debug_mode){}
 
@@ -31,12 +35,16 @@ AMParams(params),
 n_bins(MI_N_BINS),
 pre_seed(MI_PRE_SEED),
 partition_of_unity(MI_POU),
+n_blocks(MI_N_BLOCKS),
+lut_res(MI_LUT_RES),
 pix_mapper(MI_PIX_MAPPER),
 debug_mode(MI_DEBUG_MODE){
 	if(params){
 		n_bins = params->n_bins;
 		pre_seed = params->pre_seed;
 		partition_of_unity = params->partition_of_unity;
+		n_blocks = params->n_blocks;
+		lut_res = params->lut_res;
 		pix_mapper = params->pix_mapper;		
 		debug_mode = params->debug_mode;
 	}
@@ -59,6 +67,8 @@ AppearanceModel(mi_params, _n_channels), params(mi_params){
 	printf("n_bins: %d\n", params.n_bins);
 	printf("pre_seed: %f\n", params.pre_seed);
 	printf("partition_of_unity: %d\n", params.partition_of_unity);
+	printf("n_blocks: %d\n", params.n_blocks);
+	printf("lut_res: %d\n", params.lut_res);
 	printf("likelihood_alpha: %f\n", params.likelihood_alpha);
 	printf("debug_mode: %d\n", params.debug_mode);
 
@@ -118,6 +128,10 @@ AppearanceModel(mi_params, _n_channels), params(mi_params){
 			linear_idx(i, j) = i * params.n_bins + j;
 		}
 	}
+	bspl_table.initialize(std_bspl_ids, params.lut_res);
+	hist_accum.initialize(patch_size, params.n_blocks);
+	hess_accum.initialize(patch_size, params.n_blocks);
+
 	//for functor support
 	feat_size = 5 * patch_size;
 }
@@ -231,17 +245,11 @@ void MI::initializeSimilarity(){
 	init_hist_mat.setZero();
 	init_hist_grad.setZero();
 	for(unsigned int pix_id = 0; pix_id < patch_size; pix_id++) {
-		init_bspl_ids.row(pix_id) = std_bspl_ids.row(static_cast<int>(I0(pix_id)));
-		double curr_diff = init_bspl_ids(pix_id, 0) - I0(pix_id);
+		bspl_table.getWeights(init_hist_mat, init_hist_grad, init_bspl_ids, pix_id, I0(pix_id));
 		for(int id1 = init_bspl_ids(pix_id, 0); id1 <= init_bspl_ids(pix_id, 1); id1++) {
-			utils::bSpl3WithGrad(init_hist_mat(id1, pix_id), init_hist_grad(id1, pix_id), curr_diff);
 			init_hist_grad(id1, pix_id) *= -hist_norm_mult;
 			init_hist(id1) += init_hist_mat(id1, pix_id);
-			// since the ids of all bins affected by a pixel are sequential, repeated computation
-			// of curr_diff can be avoided by simply incrementing it by 1 which is (hopefully) faster
-			++curr_diff;
 		}
-
 	}
 	/* normalize the histograms and compute their log*/
 	init_hist *= hist_norm_mult;
@@ -351,19 +359,19 @@ void MI::updateSimilarity(bool prereq_only){
 	joint_hist.fill(params.pre_seed);
 	curr_hist_mat.setZero();
 	curr_hist_grad.setZero();
-	for(unsigned int pix_id = 0; pix_id < patch_size; pix_id++) {
-		curr_bspl_ids.row(pix_id) = std_bspl_ids.row(static_cast<int>(It(pix_id)));
-		double curr_diff = curr_bspl_ids(pix_id, 0) - It(pix_id);
-		for(int curr_id = curr_bspl_ids(pix_id, 0); curr_id <= curr_bspl_ids(pix_id, 1); curr_id++) {
-			utils::bSpl3WithGrad(curr_hist_mat(curr_id, pix_id), curr_hist_grad(curr_id, pix_id), curr_diff);
-			++curr_diff;
-			curr_hist_grad(curr_id, pix_id) *= -hist_norm_mult;
-			curr_hist(curr_id) += curr_hist_mat(curr_id, pix_id);
-			for(int init_id = init_bspl_ids(pix_id, 0); init_id <= init_bspl_ids(pix_id, 1); init_id++) {
-				joint_hist(curr_id, init_id) += curr_hist_mat(curr_id, pix_id) * init_hist_mat(init_id, pix_id);
+	hist_accum.accumulate(curr_hist, joint_hist, [&](unsigned int start_id, unsigned int end_id,
+		VectorXd &block_hist, MatrixXd &block_joint_hist){
+		for(unsigned int pix_id = start_id; pix_id < end_id; pix_id++) {
+			bspl_table.getWeights(curr_hist_mat, curr_hist_grad, curr_bspl_ids, pix_id, It(pix_id));
+			for(int curr_id = curr_bspl_ids(pix_id, 0); curr_id <= curr_bspl_ids(pix_id, 1); curr_id++) {
+				curr_hist_grad(curr_id, pix_id) *= -hist_norm_mult;
+				block_hist(curr_id) += curr_hist_mat(curr_id, pix_id);
+				for(int init_id = init_bspl_ids(pix_id, 0); init_id <= init_bspl_ids(pix_id, 1); init_id++) {
+					block_joint_hist(curr_id, init_id) += curr_hist_mat(curr_id, pix_id) * init_hist_mat(init_id, pix_id);
+				}
 			}
 		}
-	}
+	});
 
 	// normalize the histograms and compute their log
 	curr_hist *= hist_norm_mult;
@@ -404,16 +412,18 @@ void MI::updateInitGrad(){
 	// differential of the current joint histogram w.r.t. initial pixel values; this does not need to be normalized 
 	// since init_hist_grad has already been normalized and the computed differential will thus be implicitly normalized
 	init_joint_hist_grad.setZero();
-	for(unsigned int pix_id = 0; pix_id < patch_size; pix_id++) {
-		df_dI0(pix_id) = 0;
-		for(int init_id = init_bspl_ids(pix_id, 0); init_id <= init_bspl_ids(pix_id, 1); init_id++) {
-			for(int curr_id = curr_bspl_ids(pix_id, 0); curr_id <= curr_bspl_ids(pix_id, 1); curr_id++) {
-				int joint_id = linear_idx(init_id, curr_id);
-				init_joint_hist_grad(joint_id, pix_id) = init_hist_grad(init_id, pix_id) * curr_hist_mat(curr_id, pix_id);
-				df_dI0(pix_id) += init_joint_hist_grad(joint_id, pix_id) * init_grad_factor(init_id, curr_id);
+	hist_accum.run([&](unsigned int start_id, unsigned int end_id){
+		for(unsigned int pix_id = start_id; pix_id < end_id; pix_id++) {
+			df_dI0(pix_id) = 0;
+			for(int init_id = init_bspl_ids(pix_id, 0); init_id <= init_bspl_ids(pix_id, 1); init_id++) {
+				for(int curr_id = curr_bspl_ids(pix_id, 0); curr_id <= curr_bspl_ids(pix_id, 1); curr_id++) {
+					int joint_id = linear_idx(init_id, curr_id);
+					init_joint_hist_grad(joint_id, pix_id) = init_hist_grad(init_id, pix_id) * curr_hist_mat(curr_id, pix_id);
+					df_dI0(pix_id) += init_joint_hist_grad(joint_id, pix_id) * init_grad_factor(init_id, curr_id);
+				}
 			}
 		}
-	}
+	});
 }
 /**
 * updateCurrGrad
@@ -430,16 +440,18 @@ void MI::updateCurrGrad(){
 		}
 	}
 	curr_joint_hist_grad.setZero();
-	for(unsigned int pix_id = 0; pix_id < patch_size; pix_id++){
-		df_dIt(pix_id) = 0;
-		for(int curr_id = curr_bspl_ids(pix_id, 0); curr_id <= curr_bspl_ids(pix_id, 1); curr_id++) {
-			for(int init_id = init_bspl_ids(pix_id, 0); init_id <= init_bspl_ids(pix_id, 1); init_id++) {
-				int joint_id = linear_idx(curr_id, init_id);
-				curr_joint_hist_grad(joint_id, pix_id) = curr_hist_grad(curr_id, pix_id) * init_hist_mat(init_id, pix_id);
-				df_dIt(pix_id) += curr_joint_hist_grad(joint_id, pix_id) * curr_grad_factor(curr_id, init_id);
+	hist_accum.run([&](unsigned int start_id, unsigned int end_id){
+		for(unsigned int pix_id = start_id; pix_id < end_id; pix_id++){
+			df_dIt(pix_id) = 0;
+			for(int curr_id = curr_bspl_ids(pix_id, 0); curr_id <= curr_bspl_ids(pix_id, 1); curr_id++) {
+				for(int init_id = init_bspl_ids(pix_id, 0); init_id <= init_bspl_ids(pix_id, 1); init_id++) {
+					int joint_id = linear_idx(curr_id, init_id);
+					curr_joint_hist_grad(joint_id, pix_id) = curr_hist_grad(curr_id, pix_id) * init_hist_mat(init_id, pix_id);
+					df_dIt(pix_id) += curr_joint_hist_grad(joint_id, pix_id) * curr_grad_factor(curr_id, init_id);
+				}
 			}
 		}
-	}
+	});
 }
 void MI::initializeHess(){
 	if(!is_initialized.hess){
@@ -476,29 +488,31 @@ void  MI::cmptInitHessian(MatrixXd &hessian, const MatrixXd &init_pix_jacobian){
 
 	//utils::printMatrix(hessian, "init: hessian start", "%e");
 
-	for(unsigned int pix_id = 0; pix_id < patch_size; pix_id++){
-		double hist_hess_term = 0;
-		for(int init_id = init_bspl_ids(pix_id, 0); init_id <= init_bspl_ids(pix_id, 1); init_id++) {
-			double inner_term = 0;
-			for(int curr_id = curr_bspl_ids(pix_id, 0); curr_id <= curr_bspl_ids(pix_id, 1); curr_id++) {
-				int joint_id = linear_idx(curr_id, init_id);
-				//init_joint_hist_grad(joint_id, pix_id) = init_hist_grad(curr_id, pix_id) * init_hist_mat(init_id, pix_id);
-				//init_grad_factor(curr_id, init_id) = 1 + joint_hist_log(curr_id, init_id) - init_hist_log(curr_id);				
-				joint_hist_jacobian.row(joint_id) += init_joint_hist_grad(linear_idx(init_id, curr_id), pix_id)*init_pix_jacobian.row(pix_id);
-				inner_term += curr_hist_mat(curr_id, pix_id) * init_grad_factor(init_id, curr_id);
+	hess_accum.accumulate(hessian, joint_hist_jacobian, [&](unsigned int start_id, unsigned int end_id,
+		MatrixXd &block_hessian, MatrixXd &block_joint_hist_jacobian){
+		for(unsigned int pix_id = start_id; pix_id < end_id; pix_id++){
+			double hist_hess_term = 0;
+			for(int init_id = init_bspl_ids(pix_id, 0); init_id <= init_bspl_ids(pix_id, 1); init_id++) {
+				double inner_term = 0;
+				for(int curr_id = curr_bspl_ids(pix_id, 0); curr_id <= curr_bspl_ids(pix_id, 1); curr_id++) {
+					int joint_id = linear_idx(curr_id, init_id);
+					//init_joint_hist_grad(joint_id, pix_id) = init_hist_grad(curr_id, pix_id) * init_hist_mat(init_id, pix_id);
+					//init_grad_factor(curr_id, init_id) = 1 + joint_hist_log(curr_id, init_id) - init_hist_log(curr_id);				
+					block_joint_hist_jacobian.row(joint_id) += init_joint_hist_grad(linear_idx(init_id, curr_id), pix_id)*init_pix_jacobian.row(pix_id);
+					inner_term += curr_hist_mat(curr_id, pix_id) * init_grad_factor(init_id, curr_id);
 
-				//joint_hist_jacobian.row(joint_id) += init_hist_grad(init_id, pix_id)*curr_hist_mat(curr_id, pix_id)*init_pix_jacobian.row(pix_id);
-				//inner_term += curr_hist_mat(curr_id, pix_id) * (1 + joint_hist_log(curr_id, init_id) - init_hist_log(init_id));
+					//joint_hist_jacobian.row(joint_id) += init_hist_grad(init_id, pix_id)*curr_hist_mat(curr_id, pix_id)*init_pix_jacobian.row(pix_id);
+					//inner_term += curr_hist_mat(curr_id, pix_id) * (1 + joint_hist_log(curr_id, init_id) - init_hist_log(init_id));
+				}
+				hist_hess_term += init_hist_hess(init_id, pix_id)*inner_term;
 			}
-			hist_hess_term += init_hist_hess(init_id, pix_id)*inner_term;
-		}
-		//utils::printScalar(hist_hess_term, "init: hist_hess_term", "%20.16f");
-
-		hessian += hist_hess_term * init_pix_jacobian.row(pix_id).transpose() * init_pix_jacobian.row(pix_id);
-		//utils::printMatrix(init_pix_jacobian.row(pix_id).transpose() * init_pix_jacobian.row(pix_id), "init: init_pix_jacobian term", "%20.16f");
-		//utils::printMatrix(hessian, "init: hessian", "%20.16f");
+			//utils::printScalar(hist_hess_term, "init: hist_hess_term", "%20.16f");
 
-	}
+			block_hessian += hist_hess_term * init_pix_jacobian.row(pix_id).transpose() * init_pix_jacobian.row(pix_id);
+			//utils::printMatrix(init_pix_jacobian.row(pix_id).transpose() * init_pix_jacobian.row(pix_id), "init: init_pix_jacobian term", "%20.16f");
+			//utils::printMatrix(hessian, "init: hessian", "%20.16f");
+		}
+	});
 	//utils::printMatrix(init_pix_jacobian, "init: init_pix_jacobian", "%e");
 	//utils::printMatrix(joint_hist, "init: joint_hist", "%e");
 	//utils::printMatrix(joint_hist_jacobian, "init: joint_hist_jacobian", "%e");
@@ -611,22 +625,25 @@ void  MI::cmptCurrHessian(MatrixXd &hessian, const MatrixXd &curr_pix_jacobian){
 	MatrixXd joint_hist_jacobian(joint_hist_size, ssm_state_size);
 	hessian.setZero();
 	joint_hist_jacobian.setZero();
-	for(unsigned int pix_id = 0; pix_id < patch_size; pix_id++){
-		double curr_diff = curr_bspl_ids(pix_id, 0) - It(pix_id);
-		double hist_hess_term = 0;
-		for(int curr_id = curr_bspl_ids(pix_id, 0); curr_id <= curr_bspl_ids(pix_id, 1); curr_id++) {
-			curr_hist_hess(curr_id, pix_id) = hist_norm_mult*utils::bSpl3Hess(curr_diff);
-			++curr_diff;
-			double inner_term = 0;
-			for(int init_id = init_bspl_ids(pix_id, 0); init_id <= init_bspl_ids(pix_id, 1); init_id++) {
-				int idx = linear_idx(curr_id, init_id);
-				joint_hist_jacobian.row(idx) += curr_joint_hist_grad(idx, pix_id)*curr_pix_jacobian.row(pix_id);
-				inner_term += init_hist_mat(init_id, pix_id) * curr_grad_factor(curr_id, init_id);
+	hess_accum.accumulate(hessian, joint_hist_jacobian, [&](unsigned int start_id, unsigned int end_id,
+		MatrixXd &block_hessian, MatrixXd &block_joint_hist_jacobian){
+		for(unsigned int pix_id = start_id; pix_id < end_id; pix_id++){
+			double curr_diff = curr_bspl_ids(pix_id, 0) - It(pix_id);
+			double hist_hess_term = 0;
+			for(int curr_id = curr_bspl_ids(pix_id, 0); curr_id <= curr_bspl_ids(pix_id, 1); curr_id++) {
+				curr_hist_hess(curr_id, pix_id) = hist_norm_mult*utils::bSpl3Hess(curr_diff);
+				++curr_diff;
+				double inner_term = 0;
+				for(int init_id = init_bspl_ids(pix_id, 0); init_id <= init_bspl_ids(pix_id, 1); init_id++) {
+					int idx = linear_idx(curr_id, init_id);
+					block_joint_hist_jacobian.row(idx) += curr_joint_hist_grad(idx, pix_id)*curr_pix_jacobian.row(pix_id);
+					inner_term += init_hist_mat(init_id, pix_id) * curr_grad_factor(curr_id, init_id);
+				}
+				hist_hess_term += curr_hist_hess(curr_id, pix_id)*inner_term;
 			}
-			hist_hess_term += curr_hist_hess(curr_id, pix_id)*inner_term;
+			block_hessian += hist_hess_term * curr_pix_jacobian.row(pix_id).transpose() * curr_pix_jacobian.row(pix_id);
 		}
-		hessian += hist_hess_term * curr_pix_jacobian.row(pix_id).transpose() * curr_pix_jacobian.row(pix_id);
-	}
+	});
 	for(int curr_id = 0; curr_id < params.n_bins; curr_id++){
 		for(int init_id = 0; init_id < params.n_bins; init_id++){
 			int idx = linear_idx(curr_id, init_id);
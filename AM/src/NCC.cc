@@ -64,7 +64,7 @@ void NCC::initializeSimilarity(){
 	//! I0 specific values cannot be pre-computed here
 
 //	if(spi_mask){
-//		I0_mean = utils::getMean(spi_mask, I0, patch_size);
+//		I0_mean = utils::getMean(spi_pix_ids, I0);
 //		I0_cntr = (I0.array() - I0_mean);
 //		c = Map<const VectorXb>(spi_mask, n_pix).select(I0_cntr, 0).norm();
 //		//c = 0;
@@ -124,16 +124,19 @@ void NCC::initializeGrad(){
 void NCC::updateSimilarity(bool prereq_only){
 #ifndef DISABLE_SPI
 	if(spi_mask){
-		It_mean = utils::getMean(spi_mask, It, patch_size);
-		I0_mean = utils::getMean(spi_mask, I0, patch_size);
-		a = b = 0;
-		for(unsigned int patch_id = 0; patch_id < patch_size; ++patch_id){
-			if(!spi_mask[patch_id]){ continue; }
-			It_cntr[patch_id] = It[patch_id] - It_mean;
-			I0_cntr[patch_id] = I0[patch_id] - I0_mean;
-			a += I0_cntr[patch_id] * It_cntr[patch_id];
-			b += It_cntr[patch_id] * It_cntr[patch_id];
-			c += I0_cntr[patch_id] * I0_cntr[patch_id];
+		It_mean = utils::getMean(spi_pix_ids, It, n_channels);
+		I0_mean = utils::getMean(spi_pix_ids, I0, n_channels);
+		a = b = c = 0;
+		for(unsigned int pix_id : spi_pix_ids){
+			unsigned int patch_id = pix_id*n_channels;
+			for(unsigned int ch_id = 0; ch_id < n_channels; ++ch_id){
+				It_cntr[patch_id] = It[patch_id] - It_mean;
+				I0_cntr[patch_id] = I0[patch_id] - I0_mean;
+				a += I0_cntr[patch_id] * It_cntr[patch_id];
+				b += It_cntr[patch_id] * It_cntr[patch_id];
+				c += I0_cntr[patch_id] * I0_cntr[patch_id];
+				++patch_id;
+			}
 		}
 		b = std::sqrt(b);
 		c = std::sqrt(c);
@@ -164,16 +167,16 @@ void NCC::updateInitGrad(){
 #ifndef DISABLE_SPI
 	if(spi_mask){
 		df_dI0_ncntr_mean = 0;
-		unsigned int valid_patch_size = 0;
-		for(unsigned int patch_id = 0; patch_id < patch_size; ++patch_id){
-			if(!spi_mask[patch_id]){ continue; }
-			It_cntr_b(patch_id) = It_cntr(patch_id) / b;
-			df_dI0_ncntr(patch_id) = (It_cntr_b(patch_id) - f*I0_cntr_c(patch_id)) / c;
-			df_dI0_ncntr_mean += df_dI0_ncntr(patch_id);
-			++valid_patch_size;
+		for(unsigned int pix_id : spi_pix_ids){
+			unsigned int patch_id = pix_id*n_channels;
+			for(unsigned int ch_id = 0; ch_id < n_channels; ++ch_id){
+				It_cntr_b(patch_id) = It_cntr(patch_id) / b;
+				df_dI0_ncntr(patch_id) = (It_cntr_b(patch_id) - f*I0_cntr_c(patch_id)) / c;
+				df_dI0_ncntr_mean += df_dI0_ncntr(patch_id);
+				++patch_id;
+			}
 		}
-		df_dI0_ncntr_mean /= valid_patch_size;
-		//utils::printScalar(valid_patch_size, "valid_patch_size", "%d");
+		df_dI0_ncntr_mean /= spi_pix_ids.size()*n_channels;
 		//utils::printScalar(df_dI0_ncntr_mean, "df_dI0_ncntr_mean");
 	} else{
 #endif
@@ -197,15 +200,16 @@ void NCC::updateCurrGrad(){
 #ifndef DISABLE_SPI
 	if(spi_mask){
 		df_dIt_ncntr_mean = 0;
-		unsigned int valid_patch_size = 0;
-		for(unsigned int patch_id = 0; patch_id < patch_size; ++patch_id){
-			if(!spi_mask[patch_id]){ continue; }
-			It_cntr_b(patch_id) = It_cntr(patch_id) / b;
-			df_dIt_ncntr(patch_id) = (I0_cntr_c(patch_id) - f*It_cntr_b(patch_id)) / b;
-			df_dIt_ncntr_mean += df_dIt_ncntr(patch_id);
-			++valid_patch_size;
+		for(unsigned int pix_id : spi_pix_ids){
+			unsigned int patch_id = pix_id*n_channels;
+			for(unsigned int ch_id = 0; ch_id < n_channels; ++ch_id){
+				It_cntr_b(patch_id) = It_cntr(patch_id) / b;
+				df_dIt_ncntr(patch_id) = (I0_cntr_c(patch_id) - f*It_cntr_b(patch_id)) / b;
+				df_dIt_ncntr_mean += df_dIt_ncntr(patch_id);
+				++patch_id;
+			}
 		}
-		df_dIt_ncntr_mean /= valid_patch_size;
+		df_dIt_ncntr_mean /= spi_pix_ids.size()*n_channels;
 		//utils::printScalar(a, "a");
 		//utils::printScalar(b, "b");
 		//utils::printScalar(c, "c");
@@ -214,7 +218,6 @@ void NCC::updateCurrGrad(){
 		//utils::printMatrix(It_cntr_b, "It_cntr_b");
 		//utils::printMatrix(I0_cntr_c, "I0_cntr_c");
 		//utils::printMatrix(Map<const VectorXb>(spi_mask, n_pix), "spi_mask", "%d");
-		//utils::printScalar(valid_patch_size, "valid_patch_size", "%d");
 	} else{
 #endif
 		df_dIt_ncntr_mean = 0;
@@ -239,8 +242,7 @@ void NCC::cmptInitJacobian(RowVectorXd &df_dp,
 	assert(dI0_dp.rows() == patch_size);
 #ifndef DISABLE_SPI
 	if(spi_mask){
-		utils::getProd(df_dp, spi_mask, df_dI0, dI0_dp,
-			n_pix, n_channels);
+		utils::getProd(df_dp, spi_pix_ids, df_dI0, dI0_dp, n_channels);
 	} else{
 #endif
 		df_dp.noalias() = df_dI0 * dI0_dp;
@@ -255,8 +257,7 @@ void NCC::cmptCurrJacobian(RowVectorXd &df_dp,
 	assert(dIt_dp.rows() == patch_size);
 #ifndef DISABLE_SPI
 	if(spi_mask){
-		utils::getProd(df_dp, spi_mask, df_dIt, dIt_dp,
-			n_pix, n_channels);
+		utils::getProd(df_dp, spi_pix_ids, df_dIt, dIt_dp, n_channels);
 	} else{
 #endif
 		df_dp.noalias() = df_dIt * dIt_dp;
@@ -269,8 +270,8 @@ void NCC::cmptDifferenceOfJacobians(RowVectorXd &df_dp_diff,
 	const MatrixXd &dI0_dp, const MatrixXd &dIt_dp){
 #ifndef DISABLE_SPI
 	if(spi_mask){
-		utils::getDiffOfProd(df_dp_diff, spi_mask, df_dIt, dIt_dp,
-			df_dI0, dI0_dp, n_pix, n_channels);
+		utils::getDiffOfProd(df_dp_diff, spi_pix_ids, df_dIt, dIt_dp,
+			df_dI0, dI0_dp, n_channels);
 	} else{
 #endif
 		df_dp_diff.noalias() = (df_dIt * dIt_dp) - (df_dI0 * dI0_dp);
@@ -339,26 +340,32 @@ void NCC::cmptSelfHessian(MatrixXd &d2f_dp2, const MatrixXd &dIt_dp){
 #ifndef DISABLE_SPI
 	if(spi_mask){
 		RowVectorXd dIt_dp_mean(dIt_dp.cols());
-		utils::getMean(dIt_dp_mean, spi_mask, dIt_dp, patch_size);
+		utils::getMean(dIt_dp_mean, spi_pix_ids, dIt_dp, n_channels);
 		MatrixXd dIt_dp_cntr = (dIt_dp.rowwise() - dIt_dp_mean).array() / b;
 		if(params.fast_hess){
 			d2f_dp2.setZero();
-			for(unsigned int patch_id = 0; patch_id < patch_size; ++patch_id){
-				if(!spi_mask[patch_id]){ continue; }
-				d2f_dp2 += -dIt_dp_cntr.row(patch_id).transpose()*dIt_dp_cntr.row(patch_id)
-					+
-					dIt_dp_cntr.row(patch_id).transpose()*
-					(It_cntr_b[patch_id] * It_cntr_b[patch_id])*
-					dIt_dp_cntr.row(patch_id);
+			for(unsigned int pix_id : spi_pix_ids){
+				unsigned int patch_id = pix_id*n_channels;
+				for(unsigned int ch_id = 0; ch_id < n_channels; ++ch_id){
+					d2f_dp2 += -dIt_dp_cntr.row(patch_id).transpose()*dIt_dp_cntr.row(patch_id)
+						+
+						dIt_dp_cntr.row(patch_id).transpose()*
+						(It_cntr_b[patch_id] * It_cntr_b[patch_id])*
+						dIt_dp_cntr.row(patch_id);
+					++patch_id;
+				}
 			}
 		} else{
 			d2f_dp2.setZero();
-			for(unsigned int patch_id = 0; patch_id < patch_size; ++patch_id){
-				if(!spi_mask[patch_id]){ continue; }
-				d2f_dp2 += -dIt_dp_cntr.row(patch_id).transpose()*dIt_dp_cntr.row(patch_id)
-					+
-					(dIt_dp_cntr.row(patch_id).transpose()*It_cntr_b(patch_id))
-					*(It_cntr_b[patch_id] * dIt_dp_cntr.row(patch_id));
+			for(unsigned int pix_id : spi_pix_ids){
+				unsigned int patch_id = pix_id*n_channels;
+				for(unsigned int ch_id = 0; ch_id < n_channels; ++ch_id){
+					d2f_dp2 += -dIt_dp_cntr.row(patch_id).transpose()*dIt_dp_cntr.row(patch_id)
+						+
+						(dIt_dp_cntr.row(patch_id).transpose()*It_cntr_b(patch_id))
+						*(It_cntr_b[patch_id] * dIt_dp_cntr.row(patch_id));
+					++patch_id;
+				}
 			}
 		}
 	} else{
@@ -393,9 +400,12 @@ void NCC::cmptInitHessian(MatrixXd &init_hessian, const MatrixXd &init_pix_jacob
 	int ssm_state_size = init_hessian.rows();
 	assert(init_pix_hessian.rows() == ssm_state_size * ssm_state_size);
 	cmptInitHessian(init_hessian, init_pix_jacobian);
-	for(unsigned int pix_id = 0; pix_id < patch_size; pix_id++){
-		spi_pt_check(spi_mask, pix_id);
-		init_hessian += Map<const MatrixXd>(init_pix_hessian.col(pix_id).data(), ssm_state_size, ssm_state_size) * df_dI0(pix_id);;
+	for(unsigned int pix_id : spi_pix_ids){
+		unsigned int ch_pix_id = pix_id*n_channels;
+		for(unsigned int ch_id = 0; ch_id < n_channels; ++ch_id){
+			init_hessian += Map<const MatrixXd>(init_pix_hessian.col(ch_pix_id).data(), ssm_state_size, ssm_state_size) * df_dI0(ch_pix_id);
+			++ch_pix_id;
+		}
 	}
 }
 void NCC::cmptCurrHessian(MatrixXd &curr_hessian, const MatrixXd &curr_pix_jacobian,
@@ -403,9 +413,12 @@ void NCC::cmptCurrHessian(MatrixXd &curr_hessian, const MatrixXd &curr_pix_jacob
 	int ssm_state_size = curr_hessian.rows();
 	assert(curr_pix_hessian.rows() == ssm_state_size * ssm_state_size);
 	cmptCurrHessian(curr_hessian, curr_pix_jacobian);
-	for(unsigned int pix_id = 0; pix_id < patch_size; pix_id++){
-		spi_pt_check(spi_mask, pix_id);
-		curr_hessian += Map<const MatrixXd>(curr_pix_hessian.col(pix_id).data(), ssm_state_size, ssm_state_size) * df_dIt(pix_id);;
+	for(unsigned int pix_id : spi_pix_ids){
+		unsigned int ch_pix_id = pix_id*n_channels;
+		for(unsigned int ch_id = 0; ch_id < n_channels; ++ch_id){
+			curr_hessian += Map<const MatrixXd>(curr_pix_hessian.col(ch_pix_id).data(), ssm_state_size, ssm_state_size) * df_dIt(ch_pix_id);
+			++ch_pix_id;
+		}
 	}
 }
 
@@ -83,8 +83,11 @@ void SSDBase::updateSimilarity(bool prereq_only){
 	if(prereq_only){ return; }
 #ifndef DISABLE_SPI
 	if(spi_mask){
-		VectorXd masked_err_vec = Map<const VectorXb>(spi_mask, n_pix).select(I_diff, 0);
-		f = -masked_err_vec.squaredNorm() / 2;
+		f = 0;
+		for(unsigned int pix_id : spi_pix_ids){
+			f -= I_diff.segment(pix_id*n_channels, n_channels).squaredNorm();
+		}
+		f /= 2;
 	} else{
 #endif
 		f = -I_diff.squaredNorm() / 2;
@@ -132,7 +135,7 @@ void SSDBase::cmptInitJacobian(RowVectorXd &df_dp,
 	} else{
 #ifndef DISABLE_SPI
 		if(spi_mask){
-			getJacobian(df_dp, spi_mask, df_dI0, dI0_dpssm);
+			getJacobian(df_dp, df_dI0, dI0_dpssm);
 		} else{
 #endif
 			df_dp.noalias() = df_dI0 * dI0_dpssm;
@@ -154,7 +157,7 @@ void SSDBase::cmptCurrJacobian(RowVectorXd &df_dp,
 	} else{
 #ifndef DISABLE_SPI
 		if(spi_mask){
-			getJacobian(df_dp, spi_mask, df_dIt, dIt_dpssm);
+			getJacobian(df_dp, df_dIt, dIt_dpssm);
 		} else{
 #endif
 			//printf("df_dp: %ld x %ld\n", df_dp.rows(), df_dp.cols());
@@ -180,7 +183,7 @@ void SSDBase::cmptDifferenceOfJacobians(RowVectorXd &df_dp_diff,
 	} else{
 #ifndef DISABLE_SPI
 		if(spi_mask){
-			getDifferenceOfJacobians(df_dp_diff, spi_mask, dI0_dpssm, dIt_dpssm);
+			getDifferenceOfJacobians(df_dp_diff, dI0_dpssm, dIt_dpssm);
 		} else{
 #endif
 			df_dp_diff.noalias() = df_dIt * (dI0_dpssm + dIt_dpssm);
@@ -256,7 +259,7 @@ void SSDBase::cmptInitHessian(MatrixXd &d2f_dp2, const MatrixXd &dI0_dpssm){
 	} else{
 #ifndef DISABLE_SPI
 		if(spi_mask){
-			getHessian(d2f_dp2, spi_mask, dI0_dpssm);
+			getHessian(d2f_dp2, dI0_dpssm);
 		} else{
 #endif
 			d2f_dp2.noalias() = -dI0_dpssm.transpose() * dI0_dpssm;
@@ -274,7 +277,7 @@ void SSDBase::cmptCurrHessian(MatrixXd &d2f_dp2,
 	} else{
 #ifndef DISABLE_SPI
 		if(spi_mask){
-			getHessian(d2f_dp2, spi_mask, dIt_dpssm);
+			getHessian(d2f_dp2, dIt_dpssm);
 		} else{
 #endif
 			d2f_dp2.noalias() = -dIt_dpssm.transpose() * dIt_dpssm;
@@ -298,7 +301,7 @@ void SSDBase::cmptSumOfHessians(MatrixXd &d2f_dp2_sum,
 	} else{
 #ifndef DISABLE_SPI
 		if(spi_mask){
-			getSumOfHessians(d2f_dp2_sum, spi_mask,
+			getSumOfHessians(d2f_dp2_sum,
 				dI0_dpssm, dIt_dpssm);
 		} else{
 #endif
@@ -323,7 +326,7 @@ void SSDBase::cmptInitHessian(MatrixXd &d2f_dp2, const MatrixXd &dI0_dpssm,
 	} else{
 #ifndef DISABLE_SPI
 		if(spi_mask){
-			getHessian(d2f_dp2, spi_mask, dI0_dpssm);
+			getHessian(d2f_dp2, dI0_dpssm);
 		} else{
 #endif
 			d2f_dp2.noalias() = -dI0_dpssm.transpose() * dI0_dpssm;
@@ -331,9 +334,8 @@ void SSDBase::cmptInitHessian(MatrixXd &d2f_dp2, const MatrixXd &dI0_dpssm,
 		}
 #endif
 	}
-	int ch_pix_id = 0;
-	for(unsigned int pix_id = 0; pix_id < n_pix; ++pix_id){
-		spi_pt_check_mc(spi_mask, pix_id, ch_pix_id);
+	for(unsigned int pix_id : spi_pix_ids){
+		unsigned int ch_pix_id = pix_id*n_channels;
 		for(unsigned int channel_id = 0; channel_id < n_channels; ++channel_id){
 			d2f_dp2 += Map<const MatrixXd>(d2I0_dpssm2.col(ch_pix_id).data(), ssm_state_size, ssm_state_size) * df_dI0(ch_pix_id);
 			++ch_pix_id;
@@ -355,7 +357,7 @@ void SSDBase::cmptCurrHessian(MatrixXd &d2f_dp2, const MatrixXd &dIt_dpssm,
 	} else{
 #ifndef DISABLE_SPI
 		if(spi_mask){
-			getHessian(d2f_dp2, spi_mask, dIt_dpssm);
+			getHessian(d2f_dp2, dIt_dpssm);
 		} else{
 #endif
 			d2f_dp2.noalias() = -dIt_dpssm.transpose() * dIt_dpssm;
@@ -363,9 +365,8 @@ void SSDBase::cmptCurrHessian(MatrixXd &d2f_dp2, const MatrixXd &dIt_dpssm,
 		}
 #endif
 	}
-	int ch_pix_id = 0;
-	for(unsigned int pix_id = 0; pix_id < n_pix; ++pix_id){
-		spi_pt_check_mc(spi_mask, pix_id, ch_pix_id);
+	for(unsigned int pix_id : spi_pix_ids){
+		unsigned int ch_pix_id = pix_id*n_channels;
 		for(unsigned int channel_id = 0; channel_id < n_channels; ++channel_id){
 			d2f_dp2 += Map<const MatrixXd>(d2It_dpssm2.col(ch_pix_id).data(), ssm_state_size, ssm_state_size) * df_dIt(ch_pix_id);
 			++ch_pix_id;
@@ -391,7 +392,7 @@ void SSDBase::cmptSumOfHessians(MatrixXd &d2f_dp2_sum,
 	} else{
 #ifndef DISABLE_SPI
 		if(spi_mask){
-			getSumOfHessians(d2f_dp2_sum, spi_mask,
+			getSumOfHessians(d2f_dp2_sum,
 				dI0_dpssm, dIt_dpssm);
 		} else{
 #endif
@@ -402,11 +403,10 @@ void SSDBase::cmptSumOfHessians(MatrixXd &d2f_dp2_sum,
 #endif
 	}
 
-	int ch_pix_id = 0;
-	for(unsigned int pix_id = 0; pix_id < n_pix; ++pix_id){
-		spi_pt_check_mc(spi_mask, pix_id, ch_pix_id);
+	for(unsigned int pix_id : spi_pix_ids){
+		unsigned int ch_pix_id = pix_id*n_channels;
 		for(unsigned int channel_id = 0; channel_id < n_channels; ++channel_id){
-			d2f_dp2_sum += df_dI0(pix_id)*
+			d2f_dp2_sum += df_dI0(ch_pix_id)*
 				(Map<const MatrixXd>(d2I0_dpssm2.col(ch_pix_id).data(), ssm_state_size, ssm_state_size)
 				+ Map<const MatrixXd>(d2It_dpssm2.col(ch_pix_id).data(), ssm_state_size, ssm_state_size));
 			++ch_pix_id;
@@ -414,68 +414,51 @@ void SSDBase::cmptSumOfHessians(MatrixXd &d2f_dp2_sum,
 	}
 }
 
-void SSDBase::getJacobian(RowVectorXd &jacobian, const bool *pix_mask,
+void SSDBase::getJacobian(RowVectorXd &jacobian,
 	const RowVectorXd &df_dI, const MatrixXd &dI_dpssm){
 	assert(dI_dpssm.rows() == patch_size && dI_dpssm.rows() == jacobian.size());
 	jacobian.setZero();
-	int ch_pix_id = 0;
-	for(unsigned int pix_id = 0; pix_id < n_pix; ++pix_id){
-		spi_check_mc(pix_mask, pix_id, ch_pix_id);
+	for(unsigned int pix_id : spi_pix_ids){
+		unsigned int ch_pix_id = pix_id*n_channels;
 		for(unsigned int channel_id = 0; channel_id < n_channels; ++channel_id){
 			jacobian += df_dI[ch_pix_id] * dI_dpssm.row(ch_pix_id);
 			++ch_pix_id;
 		}
-
 	}
 }
 
-void SSDBase::getDifferenceOfJacobians(RowVectorXd &diff_of_jacobians, const bool *pix_mask,
+void SSDBase::getDifferenceOfJacobians(RowVectorXd &diff_of_jacobians,
 	const MatrixXd &dI0_dpssm, const MatrixXd &dIt_dpssm){
 	assert(dI0_dpssm.rows() == n_channels * n_pix && dIt_dpssm.rows() == n_channels * n_pix);
 	assert(dI0_dpssm.rows() == diff_of_jacobians.size());
 
 	diff_of_jacobians.setZero();
-	int ch_pix_id = 0;
-	for(unsigned int pix_id = 0; pix_id < n_pix; ++pix_id){
-		spi_check_mc(pix_mask, pix_id, ch_pix_id);
+	for(unsigned int pix_id : spi_pix_ids){
+		unsigned int ch_pix_id = pix_id*n_channels;
 		for(unsigned int channel_id = 0; channel_id < n_channels; ++channel_id){
 			diff_of_jacobians += df_dIt[ch_pix_id] *
 				(dI0_dpssm.row(ch_pix_id) + dIt_dpssm.row(ch_pix_id));
 			++ch_pix_id;
 		}
-
 	}
 }
-
-void SSDBase::getHessian(MatrixXd &d2f_dp2, const bool *pix_mask, const MatrixXd &dI_dpssm){
+//! the rows of the active pixels are gathered first so that the product is a single dense one
+void SSDBase::getHessian(MatrixXd &d2f_dp2, const MatrixXd &dI_dpssm){
 	assert(dI_dpssm.rows() == n_channels * n_pix);
 
-	d2f_dp2.setZero();
-	int ch_pix_id = 0;
-	for(unsigned int pix_id = 0; pix_id < n_pix; ++pix_id){
-		spi_check_mc(pix_mask, pix_id, ch_pix_id);
-		for(unsigned int channel_id = 0; channel_id < n_channels; ++channel_id){
-			d2f_dp2 -= dI_dpssm.row(ch_pix_id).transpose()*dI_dpssm.row(ch_pix_id);
-			++ch_pix_id;
-		}
-	}
+	utils::spi::getActiveRows(spi_dI_dpssm, dI_dpssm, spi_pix_ids, n_channels);
+	d2f_dp2.noalias() = -spi_dI_dpssm.transpose() * spi_dI_dpssm;
 }
 
-void SSDBase::getSumOfHessians(MatrixXd &d2f_dp2, const bool *pix_mask,
+void SSDBase::getSumOfHessians(MatrixXd &d2f_dp2,
 	const MatrixXd &dI0_dpssm, const MatrixXd &dIt_dpssm){
 	assert(dI0_dpssm.rows() == n_channels * n_pix && dIt_dpssm.rows() == n_channels * n_pix);
 	assert(d2f_dp2.rows() == d2f_dp2.cols() && d2f_dp2.rows() == dI0_dpssm.cols());
 
-	d2f_dp2.setZero();
-	unsigned int ch_pix_id = 0;
-	for(unsigned int pix_id = 0; pix_id < n_pix; ++pix_id){
-		spi_check_mc(pix_mask, pix_id, ch_pix_id);
-		for(unsigned int channel_id = 0; channel_id < n_channels; ++channel_id){
-			d2f_dp2 -= dI0_dpssm.row(ch_pix_id).transpose()*dI0_dpssm.row(ch_pix_id)
-				+ dIt_dpssm.row(ch_pix_id).transpose()*dIt_dpssm.row(ch_pix_id);
-			++ch_pix_id;
-		}
-	}
+	utils::spi::getActiveRows(spi_dI_dpssm, dI0_dpssm, spi_pix_ids, n_channels);
+	d2f_dp2.noalias() = -spi_dI_dpssm.transpose() * spi_dI_dpssm;
+	utils::spi::getActiveRows(spi_dI_dpssm, dIt_dpssm, spi_pix_ids, n_channels);
+	d2f_dp2.noalias() -= spi_dI_dpssm.transpose() * spi_dI_dpssm;
 }
 
 // -------------------------------------------------------------------------- //
@@ -0,0 +1,958 @@
+/**
+list of all the parameters in mtf::params::Config included by parameters.h once to declare them as members
+of Config and once more to make the members of the global configuration accessible by their names;
+MTF_PARAM(type, name, default) must be defined before including this file and there is no include guard;
+new parameters only need to be added here
+*/
+// folder where the config files mtf.cfg, modules.cfg and multi.cfg are located
+MTF_PARAM(std::string, config_dir, "Config")
+
+/* default parameters */
+MTF_PARAM(int, seq_id, 0)
+MTF_PARAM(int, actor_id, 0)
+MTF_PARAM(std::string, db_root_path, "../../../Datasets")
+MTF_PARAM(std::string, actor)
+MTF_PARAM(std::string, seq_path)
+MTF_PARAM(std::string, seq_name)
+MTF_PARAM(std::string, seq_fmt)
+MTF_PARAM(bool, invert_seq, false)
+MTF_PARAM(unsigned int, n_trackers, 1)
+MTF_PARAM(bool, track_single_obj, false)
+MTF_PARAM(char, pipeline, 'c')
+MTF_PARAM(char, img_source, 'u')
+MTF_PARAM(double, img_resize_factor, 1.0)
+MTF_PARAM(int, input_buffer_size, 10)
+//! no. of frames buffered between consecutive stages of the pipelined frame loop; 0 disables pipelining
+MTF_PARAM(int, pipeline_queue_size, 0)
+//! no. of frames in the ring shared between the input and tracker threads in pyMTF2 and mexMTF2
+MTF_PARAM(int, input_ring_size, 8)
+MTF_PARAM(bool, input_ring_block, false)
+MTF_PARAM(int, buffer_id, 0)
+//! runtime stage profiler
+MTF_PARAM(bool, prof_enable, false)
+MTF_PARAM(std::string, prof_fname, "log/mtf_prof.txt")
+MTF_PARAM(double, prof_interval, 10)
+
+//! flags
+MTF_PARAM(int, mtf_visualize, 1)
+MTF_PARAM(int, pause_after_frame, 0)
+MTF_PARAM(bool, print_corners, false)
+MTF_PARAM(bool, print_fps, false)
+MTF_PARAM(int, show_corner_ids, 0)
+MTF_PARAM(int, show_ground_truth, 0)
+MTF_PARAM(int, reinit_gt_from_bin, 1)
+MTF_PARAM(int, read_obj_from_file, 0)
+MTF_PARAM(int, read_obj_from_gt, 1)
+MTF_PARAM(bool, sel_quad_obj, false)
+MTF_PARAM(int, line_thickness, 2)
+MTF_PARAM(int, record_frames, 0)
+MTF_PARAM(bool, gt_write_ssm_params, false)
+MTF_PARAM(int, write_tracking_data, 0)
+MTF_PARAM(bool, overwrite_gt, 0)
+MTF_PARAM(int, show_proc_img, 0)
+MTF_PARAM(int, write_objs, 0)
+MTF_PARAM(char, rec_source, 'u')
+MTF_PARAM(std::string, rec_seq_suffix)
+MTF_PARAM(int, rec_fps, 24)
+MTF_PARAM(std::vector<std::string>, tracker_labels)
+
+MTF_PARAM(int, reinit_at_each_frame, 0)
+MTF_PARAM(int, reset_at_each_frame, 0)
+MTF_PARAM(bool, reset_to_init, false)
+MTF_PARAM(int, reinit_on_failure, false)
+MTF_PARAM(double, reinit_err_thresh, 5.0)
+MTF_PARAM(int, reinit_frame_skip, 5)
+MTF_PARAM(bool, reinit_with_new_obj, false)
+
+MTF_PARAM(bool, use_reinit_gt, false)
+MTF_PARAM(bool, use_opt_gt, false)
+MTF_PARAM(std::string, opt_gt_ssm, "2")
+MTF_PARAM(int, debug_mode, 0)
+MTF_PARAM(int, reset_template, 0)
+MTF_PARAM(int, patch_size, 0)
+
+MTF_PARAM(std::string, read_obj_fname, "sel_objs/selected_objects.txt")
+MTF_PARAM(std::string, write_obj_fname, "sel_objs/selected_objects.txt")
+MTF_PARAM(std::string, tracking_data_fname)
+MTF_PARAM(std::string, record_frames_fname)
+MTF_PARAM(std::string, record_frames_dir)
+
+//! for Xvision trackers
+MTF_PARAM(int, xv_visualize, 0)
+MTF_PARAM(int, xv_steps_per_frame, 1)
+/* only for pyramidal trackers */
+MTF_PARAM(int, xv_no_of_levels, 2)
+MTF_PARAM(double, xv_scale, 0.5)
+/* for xvision grid tracker */
+MTF_PARAM(int, xv_patch_size, 32)
+MTF_PARAM(int, xv_tracker_type, 't')
+MTF_PARAM(int, xvg_grid_size_x, 4)
+MTF_PARAM(int, xvg_grid_size_y, -1)
+MTF_PARAM(int, xvg_reset_pos, 0)
+MTF_PARAM(int, xvg_reset_wts, 0)
+MTF_PARAM(double, xvg_sel_reset_thresh, 1.0)
+MTF_PARAM(int, xvg_pause_after_line, 0)
+MTF_PARAM(int, xvg_show_tracked_pts, 0)
+MTF_PARAM(int, xvg_use_constant_slope, 0)
+MTF_PARAM(int, xvg_use_ls, 0)
+MTF_PARAM(int, xvg_update_wts, 0)
+MTF_PARAM(double, xvg_inter_alpha_thresh, 0.10)
+MTF_PARAM(double, xvg_intra_alpha_thresh, 0.05)
+MTF_PARAM(int, xvg_adjust_grid, 0)
+MTF_PARAM(int, xvg_adjust_lines, 1)
+
+//! for MTF
+MTF_PARAM(unsigned int, mtf_res, 50)
+MTF_PARAM(unsigned int, resx, 50)
+MTF_PARAM(unsigned int, resy, 50)
+MTF_PARAM(int, init_frame_id, 0)
+MTF_PARAM(int, start_frame_id, 0)
+MTF_PARAM(int, end_frame_id, 0)
+MTF_PARAM(int, frame_gap, 1)
+MTF_PARAM(int, max_iters, 10)
+MTF_PARAM(double, epsilon, 0.01)
+MTF_PARAM(char *, mtf_sm, "esm")
+MTF_PARAM(char *, mtf_am, "ssd")
+MTF_PARAM(char *, mtf_ssm, "8")
+MTF_PARAM(char *, mtf_ilm, "0")
+MTF_PARAM(bool, enable_nt, false)
+MTF_PARAM(bool, enable_fixed_res, false)
+MTF_PARAM(bool, fixed_res_float, false)
+MTF_PARAM(bool, invalid_state_check, true)
+MTF_PARAM(double, invalid_state_err_thresh, 0)
+MTF_PARAM(bool, uchar_input, false)
+
+MTF_PARAM(bool, ic_update_ssm, true)
+MTF_PARAM(bool, ic_chained_warp, true)
+MTF_PARAM(int, ic_hess_type, 0)
+
+MTF_PARAM(bool, fc_chained_warp, false)
+MTF_PARAM(int, fc_hess_type, 1)
+MTF_PARAM(bool, fc_write_ssm_updates, false)
+MTF_PARAM(bool, fc_show_grid, false)
+MTF_PARAM(bool, fc_show_patch, false)
+MTF_PARAM(double, fc_patch_resize_factor, 1.0)
+MTF_PARAM(bool, fc_debug_mode, false)
+
+MTF_PARAM(int, fa_hess_type, 1)
+MTF_PARAM(bool, fa_show_grid, false)
+MTF_PARAM(bool, fa_show_patch, false)
+MTF_PARAM(double, fa_patch_resize_factor, 1.0)
+MTF_PARAM(bool, fa_write_frames, false)
+
+MTF_PARAM(int, ia_hess_type, 1)
+
+MTF_PARAM(int, esm_jac_type, 1)
+MTF_PARAM(int, esm_hess_type, 2)
+MTF_PARAM(bool, esm_chained_warp, false)
+
+MTF_PARAM(bool, sec_ord_hess, false)
+MTF_PARAM(bool, leven_marq, false)
+MTF_PARAM(double, lm_delta_init, 0.01)
+MTF_PARAM(double, lm_delta_update, 10)
+
+MTF_PARAM(int, c2f_sub_ratio, 1)
+MTF_PARAM(double, c2f_thresh, 1e-2)
+MTF_PARAM(int, stagnation_iters, 0)
+
+MTF_PARAM(bool, enable_learning, false)
+MTF_PARAM(double, learning_rate, 0.5)
+
+
+MTF_PARAM(bool, ssd_show_template, false)
+
+MTF_PARAM(double, nssd_norm_pix_min, 0.0)
+MTF_PARAM(double, nssd_norm_pix_max, 1.0)
+
+MTF_PARAM(double, zncc_likelihood_alpha, 50)
+
+MTF_PARAM(double, res_from_size, 0)
+MTF_PARAM(int, show_tracking_error, 0)
+MTF_PARAM(int, write_tracking_error, 0)
+MTF_PARAM(int, write_tracking_sr, 0)
+MTF_PARAM(vectord, sr_err_thresh)
+
+MTF_PARAM(vector_s, obj_cols)
+MTF_PARAM(std::string, fps_col, "green")
+MTF_PARAM(std::string, gt_col, "green")
+MTF_PARAM(std::string, err_col, "green")
+
+MTF_PARAM(int, tracking_err_type, 0)
+MTF_PARAM(bool, show_jaccard_error, false)
+MTF_PARAM(double, grad_eps, 1e-8)
+MTF_PARAM(bool, use_grad_cache, false)
+MTF_PARAM(double, hess_eps, 1.0)
+MTF_PARAM(double, likelihood_alpha, 1.0)
+MTF_PARAM(double, likelihood_beta, 0.0)
+MTF_PARAM(bool, dist_from_likelihood, false)
+
+MTF_PARAM(std::string, pre_proc_type, "gauss")
+//! perform histogram equalization during pre processing;
+MTF_PARAM(bool, pre_proc_hist_eq, false)
+//! only pre process regions around the trackers expanded by this fraction of their size; 0 disables
+MTF_PARAM(double, pre_proc_roi_margin, 0)
+//! Gaussian filtering
+MTF_PARAM(int, gauss_kernel_size, 5)
+MTF_PARAM(double, gauss_sigma_x, 3)
+MTF_PARAM(double, gauss_sigma_y, 3)
+//! median filtering
+MTF_PARAM(int, med_kernel_size, 5)
+//! normalized box filtering
+MTF_PARAM(int, box_kernel_size, 5)
+//! bilateral filtering
+MTF_PARAM(int, bil_diameter, 5)
+MTF_PARAM(double, bil_sigma_col, 15)
+MTF_PARAM(double, bil_sigma_space, 15)
+//! Sobel filtering
+MTF_PARAM(int, sobel_kernel_size, 5)
+MTF_PARAM(bool, sobel_normalize, false)
+//! Anisotropic diffusion
+MTF_PARAM(double, aniso_lambda, 0.14285714285)
+MTF_PARAM(double, aniso_kappa, 30)
+MTF_PARAM(unsigned int, aniso_n_iters, 15)
+
+//! Affine
+MTF_PARAM(int, aff_normalized_init, 0)
+MTF_PARAM(int, aff_pt_based_sampling, 0)
+
+//! Lie Affine
+MTF_PARAM(int, laff_normalized_init, 0)
+MTF_PARAM(double, laff_grad_eps, 1e-8)
+
+//! Homograhy
+MTF_PARAM(int, hom_normalized_init, 0)
+MTF_PARAM(bool, hom_corner_based_sampling, true)
+
+//! Lie Homograhy
+MTF_PARAM(int, lhom_normalized_init, 0)
+MTF_PARAM(double, lhom_grad_eps, 1e-8)
+
+//! Corner based Homograhy
+MTF_PARAM(int, cbh_normalized_init, 0)
+MTF_PARAM(double, cbh_grad_eps, 1e-8)
+
+//! ASRT
+MTF_PARAM(bool, asrt_normalized_init, false)
+MTF_PARAM(int, asrt_pt_based_sampling, 0)
+
+//! Similitude
+MTF_PARAM(bool, sim_normalized_init, false)
+MTF_PARAM(bool, sim_geom_sampling, true)
+MTF_PARAM(int, sim_pt_based_sampling, 0)
+MTF_PARAM(int, sim_n_model_pts, 2)
+
+//! Isometry
+MTF_PARAM(int, iso_pt_based_sampling, 0)
+
+//! SL3
+MTF_PARAM(int, sl3_normalized_init, 0)
+MTF_PARAM(bool, sl3_iterative_sample_mean, true)
+MTF_PARAM(int, sl3_sample_mean_max_iters, 10)
+MTF_PARAM(double, sl3_sample_mean_eps, 1e-4)
+MTF_PARAM(bool, sl3_debug_mode, 0)
+
+//! Spline SSM
+MTF_PARAM(int, spl_control_size, 10)
+MTF_PARAM(double, spl_control_overlap, 1)
+MTF_PARAM(int, spl_interp_type, 0)
+MTF_PARAM(bool, spl_static_wts, true)
+MTF_PARAM(bool, spl_debug_mode, 0)
+
+//! SCV and RSCV
+MTF_PARAM(int, scv_hist_type, 0)
+MTF_PARAM(bool, scv_use_bspl, 0)
+MTF_PARAM(int, scv_n_bins, 256)
+MTF_PARAM(double, scv_preseed, 0)
+MTF_PARAM(bool, scv_pou, 1)
+MTF_PARAM(bool, scv_weighted_mapping, 1)
+MTF_PARAM(bool, scv_mapped_gradient, 1)
+MTF_PARAM(bool, scv_affine_mapping, 0)
+MTF_PARAM(bool, scv_once_per_frame, 0)
+MTF_PARAM(bool, scv_approx_dist_feat, true)
+MTF_PARAM(double, scv_likelihood_alpha, 0)
+
+//! LSCV and LRSCV
+MTF_PARAM(int, lscv_sub_regions, 3)
+MTF_PARAM(int, lscv_spacing, 10)
+MTF_PARAM(bool, lscv_show_subregions, false)
+
+//! LKLD
+MTF_PARAM(int, lkld_n_bins, 8)
+MTF_PARAM(double, lkld_pre_seed, 0.1)
+MTF_PARAM(bool, lkld_pou, 1)
+MTF_PARAM(int, lkld_sub_regions, 0)
+MTF_PARAM(int, lkld_spacing, 1)
+
+//! NCC
+MTF_PARAM(bool, ncc_fast_hess, false)
+MTF_PARAM(double, ncc_likelihood_alpha, 50)
+
+//! SPSS
+MTF_PARAM(double, spss_k, 0.01)
+MTF_PARAM(double, spss_likelihood_alpha, 50)
+
+//! SSIM
+MTF_PARAM(int, ssim_pix_proc_type, 0)
+MTF_PARAM(double, ssim_k1, 0.01)
+MTF_PARAM(double, ssim_k2, 0.03)
+MTF_PARAM(double, ssim_likelihood_alpha, 50)
+
+//! Sum of AMs
+MTF_PARAM(std::string, sum_am1)
+MTF_PARAM(std::string, sum_am2)
+
+MTF_PARAM(char *, pix_mapper, nullptr)
+
+//! MI & CCRE
+MTF_PARAM(int, mi_n_bins, 8)
+MTF_PARAM(double, mi_pre_seed, 10)
+MTF_PARAM(bool, mi_pou, false)
+MTF_PARAM(int, mi_n_blocks, 1)
+MTF_PARAM(int, mi_lut_res, 0)
+MTF_PARAM(double, mi_likelihood_alpha, 50)
+
+//! CCRE
+MTF_PARAM(int, ccre_n_bins, 8)
+MTF_PARAM(double, ccre_pre_seed, 10)
+MTF_PARAM(bool, ccre_pou, false)
+MTF_PARAM(bool, ccre_symmetrical_grad, false)
+MTF_PARAM(int, ccre_n_blocks, 1)
+MTF_PARAM(int, ccre_lut_res, 0)
+MTF_PARAM(double, ccre_likelihood_alpha, 50)
+
+//!NGF
+MTF_PARAM(double, ngf_eta, 5.0)
+MTF_PARAM(bool, ngf_use_ssd, false)
+
+//! NN
+MTF_PARAM(int, nn_max_iters, 10)
+MTF_PARAM(int, nn_n_samples, 1000)
+MTF_PARAM(vectori, nn_ssm_sigma_ids)
+MTF_PARAM(vectori, nn_ssm_mean_ids)
+MTF_PARAM(double, nn_corner_sigma_d, 0.04)
+MTF_PARAM(double, nn_corner_sigma_t, 0.06)
+MTF_PARAM(vectord, nn_pix_sigma)
+MTF_PARAM(int, nn_n_trees, 6)
+MTF_PARAM(double, nn_ssm_sigma_prec, 1.1)
+MTF_PARAM(int, nn_index_type, 1)
+MTF_PARAM(int, nn_search_type, 0)
+MTF_PARAM(bool, nn_additive_update, false)
+MTF_PARAM(int, nn_show_samples, 0)
+MTF_PARAM(int, nn_add_samples_gap, 0)
+MTF_PARAM(int, nn_n_samples_to_add, 0)
+MTF_PARAM(int, nn_remove_samples, 0)
+MTF_PARAM(bool, nn_save_index, false)
+MTF_PARAM(bool, nn_load_index, false)
+MTF_PARAM(int, nn_saved_index_fid, 0)
+MTF_PARAM(int, nn_db_format, 0)
+//! GNN
+MTF_PARAM(int, nn_gnn_degree, 250)
+MTF_PARAM(int, nn_gnn_max_steps, 10)
+MTF_PARAM(int, nn_gnn_cmpt_dist_thresh, 10000)
+MTF_PARAM(bool, nn_gnn_random_start, false)
+MTF_PARAM(int, nn_gnn_n_workers, 1)
+MTF_PARAM(int, nn_gnn_build_block_size, 64)
+MTF_PARAM(bool, nn_gnn_verbose, false)
+MTF_PARAM(int, nn_fgnn_index_type, 0)
+//! FLANN specific params
+MTF_PARAM(int, nn_srch_checks, 32)
+MTF_PARAM(float, nn_srch_eps, 0.0)
+MTF_PARAM(bool, nn_srch_sorted, true)
+MTF_PARAM(int, nn_srch_max_neighbors, -1)
+MTF_PARAM(int, nn_srch_cores, 1)
+MTF_PARAM(bool, nn_srch_matrices_in_gpu_ram, false)
+MTF_PARAM(int, nn_srch_use_heap, 2)
+MTF_PARAM(int, nn_kdt_trees, 6)
+MTF_PARAM(int, nn_km_branching, 32)
+MTF_PARAM(int, nn_km_iterations, 11)
+MTF_PARAM(int, nn_km_centers_init, 0)
+MTF_PARAM(float, nn_km_cb_index, 0.2f)
+MTF_PARAM(int, nn_kdts_leaf_max_size, 10)
+MTF_PARAM(int, nn_kdtc_leaf_max_size, 64)
+MTF_PARAM(int, nn_hc_branching, 32)
+MTF_PARAM(int, nn_hc_trees, 4)
+MTF_PARAM(int, nn_hc_leaf_max_size, 100)
+MTF_PARAM(int, nn_hc_centers_init, 0)
+MTF_PARAM(float, nn_auto_target_precision, 0.9f)
+MTF_PARAM(float, nn_auto_build_weight, 0.01f)
+MTF_PARAM(float, nn_auto_memory_weight, 0.0f)
+MTF_PARAM(float, nn_auto_sample_fraction, 0.1f)
+
+// Multi Layer Nearest Filter
+MTF_PARAM(int, nnk_n_layers)
+MTF_PARAM(vectorvi, nnk_ssm_sigma_ids)
+
+//! Regression Network
+MTF_PARAM(int, rg_max_iters, 10)
+MTF_PARAM(int, rg_n_samples, 1000)
+MTF_PARAM(vectori, rg_ssm_sigma_ids)
+MTF_PARAM(vectori, rg_ssm_mean_ids)
+MTF_PARAM(vectord, rg_pix_sigma)
+MTF_PARAM(bool, rg_additive_update, false)
+MTF_PARAM(int, rg_show_samples, 0)
+MTF_PARAM(int, rg_add_points, 0)
+MTF_PARAM(int, rg_remove_points, 0)
+MTF_PARAM(bool, rg_save_index, false)
+MTF_PARAM(bool, rg_load_index, false)
+MTF_PARAM(int, rg_saved_index_fid, 0)
+MTF_PARAM(int, rg_nepochs, 10)
+MTF_PARAM(int, rg_bs, 128)
+MTF_PARAM(bool, rg_preproc, true)
+MTF_PARAM(char *, rg_solver, nullptr)
+MTF_PARAM(char *, rg_train, nullptr)
+MTF_PARAM(char *, rg_mean, nullptr)
+MTF_PARAM(bool, rg_dbg, false)
+MTF_PARAM(bool, rg_pretrained, false)
+
+//! RIU AM
+MTF_PARAM(double, riu_likelihood_alpha, 50.0)
+
+//! Gradient Descent
+MTF_PARAM(double, sd_learning_rate, 0.1)
+
+//! Gain and Bias Illumination Model
+MTF_PARAM(bool, gb_additive_update, false)
+
+//! Piecewise Gain and Bias Illumination Model
+MTF_PARAM(bool, pgb_additive_update, false)
+MTF_PARAM(int, pgb_sub_regions_x, 3)
+MTF_PARAM(int, pgb_sub_regions_y, 3)
+
+//! Radial Basis Function illumination model
+MTF_PARAM(bool, rbf_additive_update, false)
+MTF_PARAM(int, rbf_n_ctrl_pts_x, 3)
+MTF_PARAM(int, rbf_n_ctrl_pts_y, 3)
+
+//! Particle Filter
+MTF_PARAM(int, pf_max_iters, 1)
+MTF_PARAM(int, pf_n_particles, 100)
+MTF_PARAM(int, pf_dynamic_model, 1)
+MTF_PARAM(int, pf_update_type, 0)
+MTF_PARAM(int, pf_likelihood_func, 0)
+MTF_PARAM(int, pf_resampling_type, 0)
+MTF_PARAM(int, pf_mean_type, 1)
+MTF_PARAM(bool, pf_reset_to_mean, false)
+MTF_PARAM(vectori, pf_ssm_sigma_ids)
+MTF_PARAM(vectori, pf_ssm_mean_ids)
+MTF_PARAM(bool, pf_update_distr_wts, false)
+MTF_PARAM(double, pf_min_distr_wt, 0.1)
+MTF_PARAM(double, pf_adaptive_resampling_thresh, 0)
+MTF_PARAM(double, pf_measurement_sigma, 0.1)
+MTF_PARAM(vectord, pf_pix_sigma)
+MTF_PARAM(int, pf_show_particles, 0)
+MTF_PARAM(bool, pf_jacobian_as_sigma, false)
+MTF_PARAM(int, pf_n_workers, 1)
+MTF_PARAM(bool, pf_debug_mode, false)
+
+//! Batch Tracker
+MTF_PARAM(int, batch_n_workers, 1)
+
+//! Multi Layer Particle Filter
+MTF_PARAM(int, pfk_n_layers)
+MTF_PARAM(vectorvi, pfk_ssm_sigma_ids)
+
+//! Gaussian parameters for sampling SSM parameters - used by NN, PF and RG
+MTF_PARAM(vectorvd, ssm_sigma)
+MTF_PARAM(vectorvd, ssm_mean)
+
+MTF_PARAM(vectorvd, am_sigma)
+MTF_PARAM(vectorvd, am_mean)
+
+//! Hierarchical SSM tracker
+MTF_PARAM(char *, hrch_sm, "iclk")
+MTF_PARAM(char *, hrch_am, "ssd")
+
+//! Cascade tracker
+MTF_PARAM(int, casc_n_trackers, 2)
+MTF_PARAM(bool, casc_enable_feedback, 1)
+MTF_PARAM(bool, casc_auto_reinit, false)
+MTF_PARAM(double, casc_reinit_err_thresh, 1.0)
+MTF_PARAM(int, casc_reinit_frame_gap, 1)
+
+//! Grid tracker
+MTF_PARAM(char *, grid_sm, "iclk")
+MTF_PARAM(char *, grid_am, "ssd")
+MTF_PARAM(char *, grid_ssm, "2")
+MTF_PARAM(char *, grid_ilm, "0")
+
+MTF_PARAM(int, grid_res, 10)
+MTF_PARAM(int, grid_patch_size, 10)
+MTF_PARAM(int, grid_patch_res, 0)
+MTF_PARAM(int, grid_reset_at_each_frame, 1)
+MTF_PARAM(bool, grid_dyn_patch_size, false)
+MTF_PARAM(bool, grid_patch_centroid_inside, true)
+MTF_PARAM(double, grid_fb_err_thresh, 0)
+MTF_PARAM(bool, grid_fb_reinit, 0)
+MTF_PARAM(bool, grid_show_trackers, false)
+MTF_PARAM(bool, grid_show_tracker_edges, false)
+MTF_PARAM(bool, grid_use_tbb, true)
+//! OpenCV grid tracker
+MTF_PARAM(int, grid_pyramid_levels, 2)
+MTF_PARAM(bool, grid_use_min_eig_vals, 0)
+MTF_PARAM(bool, grid_rgb_input, false)
+MTF_PARAM(double, grid_min_eig_thresh, 1e-4)
+
+MTF_PARAM(std::string, feat_detector_type, "orb")
+MTF_PARAM(std::string, feat_descriptor_type, "orb")
+MTF_PARAM(double, feat_max_dist_ratio, 0.75)
+MTF_PARAM(int, feat_min_matches, 10)
+MTF_PARAM(bool, feat_rebuild_index, false)
+MTF_PARAM(bool, feat_use_cv_flann, true)
+MTF_PARAM(bool, feat_show_keypoints, 0)
+MTF_PARAM(bool, feat_show_matches, 0)
+MTF_PARAM(bool, feat_debug_mode, 0)
+
+MTF_PARAM(bool, grid_use_const_grad, true)
+
+MTF_PARAM(int, sift_n_features, 0)
+MTF_PARAM(int, sift_n_octave_layers, 3)
+MTF_PARAM(double, sift_contrast_thresh, 0.04)
+MTF_PARAM(double, sift_edge_thresh, 10)
+MTF_PARAM(double, sift_sigma, 1.6)
+
+MTF_PARAM(double, surf_hessian_threshold, 100)
+MTF_PARAM(int, surf_n_octaves, 4)
+MTF_PARAM(int, surf_n_octave_layers, 3)
+MTF_PARAM(bool, surf_extended, false)
+MTF_PARAM(bool, surf_upright, false)
+
+MTF_PARAM(int, brisk_thresh, 30)
+MTF_PARAM(int, brisk_octaves, 3)
+MTF_PARAM(float, brisk_pattern_scale, 1.0f)
+
+MTF_PARAM(int, orb_n_features, 500)
+MTF_PARAM(float, orb_scale_factor, 1.2f)
+MTF_PARAM(int, orb_n_levels, 8)
+MTF_PARAM(int, orb_edge_threshold, 31)
+MTF_PARAM(int, orb_first_level, 0)
+MTF_PARAM(int, orb_WTA_K, 2)
+MTF_PARAM(int, orb_score_type, 0)
+MTF_PARAM(int, orb_patch_size, 31)
+MTF_PARAM(int, orb_fast_threshold, 20)
+
+MTF_PARAM(int, mser_delta, 5)
+MTF_PARAM(int, mser_min_area, 60)
+MTF_PARAM(int, mser_max_area, 14400)
+MTF_PARAM(double, mser_max_variation, 0.25)
+MTF_PARAM(double, mser_min_diversity, .2)
+MTF_PARAM(int, mser_max_evolution, 200)
+MTF_PARAM(double, mser_area_threshold, 1.01)
+MTF_PARAM(double, mser_min_margin, 0.003)
+MTF_PARAM(int, mser_edge_blur_size, 5)
+
+MTF_PARAM(int, fast_threshold, 10)
+MTF_PARAM(bool, fast_non_max_suppression, true)
+MTF_PARAM(int, fast_type, 2)
+
+MTF_PARAM(int, agast_threshold, 10)
+MTF_PARAM(bool, agast_non_max_suppression, true)
+MTF_PARAM(int, agast_type, 3)
+
+MTF_PARAM(int, gftt_max_corners, 1000)
+MTF_PARAM(double, gftt_quality_level, 0.01)
+MTF_PARAM(double, gftt_min_distance, 1)
+MTF_PARAM(int, gftt_block_size, 3)
+MTF_PARAM(bool, gftt_use_harris_detector, false)
+MTF_PARAM(double, gftt_k, 0.04)
+
+MTF_PARAM(int, brief_bytes, 32)
+MTF_PARAM(bool, brief_use_orientation, false)
+
+MTF_PARAM(bool, freak_orientation_normalized, true)
+MTF_PARAM(bool, freak_scale_normalized, true)
+MTF_PARAM(float, freak_pattern_scale, 22.0f)
+MTF_PARAM(int, freak_n_octaves, 4)
+
+MTF_PARAM(int, lucid_kernel, 1)
+MTF_PARAM(int, lucid_blur_kernel, 2)
+
+MTF_PARAM(int, latch_bytes, 32)
+MTF_PARAM(bool, latch_rotation_invariance, true)
+MTF_PARAM(int, latch_half_ssd_size, 3)
+
+MTF_PARAM(float, daisy_radius, 15)
+MTF_PARAM(int, daisy_q_radius, 3)
+MTF_PARAM(int, daisy_q_theta, 8)
+MTF_PARAM(int, daisy_q_hist, 8)
+MTF_PARAM(int, daisy_norm, 100)
+MTF_PARAM(vectorf, daisy_H)
+MTF_PARAM(bool, daisy_interpolation, true)
+MTF_PARAM(bool, daisy_use_orientation, false)
+
+MTF_PARAM(int, vgg_desc, 100)
+MTF_PARAM(float, vgg_isigma, 1.4f)
+MTF_PARAM(bool, vgg_img_normalize, true)
+MTF_PARAM(bool, vgg_use_scale_orientation, true)
+MTF_PARAM(float, vgg_scale_factor, 6.25f)
+MTF_PARAM(bool, vgg_dsc_normalize, false)
+
+MTF_PARAM(int, boost_desc_desc, 302)
+MTF_PARAM(bool, boost_desc_use_scale_orientation, true)
+MTF_PARAM(float, boost_desc_scale_factor, 6.25f)
+
+MTF_PARAM(int, star_max_size, 45)
+MTF_PARAM(int, star_response_threshold, 30)
+MTF_PARAM(int, star_line_threshold_projected, 10)
+MTF_PARAM(int, star_line_threshold_binarized, 8)
+MTF_PARAM(int, star_suppress_nonmax_size, 5)
+
+MTF_PARAM(int, msd_patch_radius, 3)
+MTF_PARAM(int, msd_search_area_radius, 5)
+MTF_PARAM(int, msd_nms_radius, 5)
+MTF_PARAM(int, msd_nms_scale_radius, 0)
+MTF_PARAM(float, msd_th_saliency, 250.0f)
+MTF_PARAM(int, msd_kNN, 4)
+MTF_PARAM(float, msd_scale_factor, 1.25f)
+MTF_PARAM(int, msd_n_scales, -1)
+MTF_PARAM(bool, msd_compute_orientation, false)
+
+//! SSM Estimator
+MTF_PARAM(int, est_method, 0)
+MTF_PARAM(double, est_ransac_reproj_thresh, 10)
+MTF_PARAM(int, est_n_model_pts, 4)
+MTF_PARAM(int, est_max_iters, 2000)
+MTF_PARAM(int, est_max_subset_attempts, 300)
+MTF_PARAM(bool, est_use_boost_rng, false)
+MTF_PARAM(double, est_confidence, 0.995)
+MTF_PARAM(bool, est_refine, true)
+MTF_PARAM(int, est_lm_max_iters, 10)
+MTF_PARAM(int, est_n_workers, 1)
+MTF_PARAM(bool, est_sprt, true)
+
+
+MTF_PARAM(char *, line_sm, "iclk")
+MTF_PARAM(char *, line_am, "ssd")
+MTF_PARAM(char *, line_ssm, "2")
+MTF_PARAM(int, line_grid_size, 5)
+MTF_PARAM(int, line_patch_size, 25)
+MTF_PARAM(bool, line_use_constant_slope, false)
+MTF_PARAM(bool, line_use_ls, false)
+MTF_PARAM(double, line_inter_alpha_thresh, 0.1)
+MTF_PARAM(double, line_intra_alpha_thresh, 0.05)
+MTF_PARAM(bool, line_reset_pos, false)
+MTF_PARAM(bool, line_reset_template, false)
+MTF_PARAM(bool, line_debug_mode, false)
+
+//! RKL Tracker
+MTF_PARAM(char *, rkl_sm, "iclk")
+MTF_PARAM(bool, rkl_enable_spi, true)
+MTF_PARAM(bool, rkl_enable_feedback, true)
+MTF_PARAM(bool, rkl_failure_detection, true)
+MTF_PARAM(double, rkl_failure_thresh, 15.0)
+
+//! Parallel Tracker
+MTF_PARAM(int, prl_n_trackers, 1)
+MTF_PARAM(int, prl_estimation_method, 0)
+MTF_PARAM(bool, prl_reset_to_mean, false)
+MTF_PARAM(bool, prl_auto_reinit, false)
+MTF_PARAM(double, prl_reinit_err_thresh, 1.0)
+MTF_PARAM(int, prl_reinit_frame_gap, 1)
+MTF_PARAM(int, prl_n_workers, 1)
+
+//! Pyramidal Tracker
+MTF_PARAM(std::string, pyr_sm, "fc")
+MTF_PARAM(int, pyr_no_of_levels, 3)
+MTF_PARAM(double, pyr_scale_factor, 0.50)
+MTF_PARAM(bool, pyr_scale_res, true)
+MTF_PARAM(bool, pyr_show_levels, false)
+
+//! MTF Diagnostics
+MTF_PARAM(char *, diag_am, "ssd")
+MTF_PARAM(char *, diag_ssm, "2")
+MTF_PARAM(char *, diag_ilm, "0")
+MTF_PARAM(bool, diag_3d, false)
+MTF_PARAM(std::vector<int>, diag_3d_ids, { 0, 1 })
+MTF_PARAM(int, diag_frame_gap, 0)
+MTF_PARAM(double, diag_range, 0)
+MTF_PARAM(std::vector<double>, diag_ssm_range)
+MTF_PARAM(std::vector<double>, diag_am_range)
+MTF_PARAM(int, diag_ssm_range_id, 0)
+MTF_PARAM(int, diag_am_range_id, 0)
+MTF_PARAM(std::string, diag_gen_norm, "000")// Norm,FeatNorm
+MTF_PARAM(std::string, diag_gen_jac, "000")// Std,ESM,Diff
+MTF_PARAM(std::string, diag_gen_hess, "0000")// Std,ESM,InitSelf,CurrSelf
+MTF_PARAM(std::string, diag_gen_hess2, "0000")// Std2,ESM2,InitSelf2,CurrSelf2
+MTF_PARAM(std::string, diag_gen_hess_sum, "0000")// Std, Std2, Self, Self2
+MTF_PARAM(std::string, diag_gen_num, "000") // Jac, Hess, NHess
+MTF_PARAM(std::string, diag_gen_ssm, "0")// ssm params
+
+MTF_PARAM(bool, diag_bin, true)
+MTF_PARAM(bool, diag_inv, true)
+MTF_PARAM(bool, diag_show_data, false)
+MTF_PARAM(bool, diag_show_corners, false)
+MTF_PARAM(bool, diag_show_patches, false)
+MTF_PARAM(bool, diag_verbose, false)
+
+MTF_PARAM(double, diag_grad_diff, 0.1)
+MTF_PARAM(int, diag_res, 50)
+MTF_PARAM(int, diag_update_type, 0)
+MTF_PARAM(int, diag_start_id, 0)
+MTF_PARAM(int, diag_end_id, 0)
+
+MTF_PARAM(std::string, diag_out_prefix)
+
+
+MTF_PARAM(bool, diag_enable_validation, false)
+MTF_PARAM(double, diag_validation_prec, 1e-20)
+MTF_PARAM(int, diag_n_workers, 1)
+MTF_PARAM(bool, diag_resume, false)
+
+MTF_PARAM(bool, esm_spi_enable, false)
+MTF_PARAM(double, esm_spi_thresh, 10)
+
+//! DSST
+MTF_PARAM(double, dsst_padding, 1)
+MTF_PARAM(double, dsst_sigma, 1.0 / 16)
+MTF_PARAM(double, dsst_scale_sigma, 1.0 / 4)
+MTF_PARAM(double, dsst_lambda, 1e-2)
+MTF_PARAM(double, dsst_learning_rate, 0.025)
+MTF_PARAM(int, dsst_number_scales, 33)
+MTF_PARAM(int, dsst_number_rots, 21)
+MTF_PARAM(double, dsst_scale_step, 1.02)
+MTF_PARAM(double, dsst_rot_step, 2)
+MTF_PARAM(int, dsst_resize_factor, 4)
+MTF_PARAM(int, dsst_is_scaling, 1)
+MTF_PARAM(int, dsst_is_rotating, 1)
+MTF_PARAM(int, dsst_bin_size, 1)
+
+//! KCF
+MTF_PARAM(double, kcf_padding) //extra area surrounding the target
+MTF_PARAM(double, kcf_lambda) //regularization
+MTF_PARAM(double, kcf_output_sigma_factor) //spatial bandwidth (proportional to target)
+MTF_PARAM(double, kcf_interp_factor) //linear interpolation factor for adaptation
+MTF_PARAM(double, kcf_kernel_sigma) //gaussian kernel bandwidth
+//! for scaling
+MTF_PARAM(int, kcf_number_scales)
+MTF_PARAM(double, kcf_scale_step)
+MTF_PARAM(double, kcf_scale_model_max_area)
+MTF_PARAM(double, kcf_scale_sigma_factor)
+MTF_PARAM(double, kcf_scale_learning_rate)
+MTF_PARAM(bool, kcf_is_scaling)
+MTF_PARAM(int, kcf_resize_factor)
+
+MTF_PARAM(int, mil_algorithm, 100)
+MTF_PARAM(int, mil_num_classifiers, 100)
+MTF_PARAM(float, mil_overlap, 0.99f)
+MTF_PARAM(float, mil_search_factor, 2.0f)
+MTF_PARAM(float, mil_pos_radius_train, 4.0f)
+MTF_PARAM(int, mil_neg_num_train, 65)
+MTF_PARAM(int, mil_num_features, 250)
+
+//! CMT
+MTF_PARAM(bool, cmt_estimate_scale, true)
+MTF_PARAM(bool, cmt_estimate_rotation, false)
+MTF_PARAM(char *, cmt_feat_detector, "FAST")
+MTF_PARAM(char *, cmt_desc_extractor, "BRISK")
+MTF_PARAM(double, cmt_resize_factor, 0.5)
+
+//! TLD
+MTF_PARAM(bool, tld_tracker_enabled, true)
+MTF_PARAM(bool, tld_detector_enabled, true)
+MTF_PARAM(bool, tld_learning_enabled, true)
+MTF_PARAM(bool, tld_alternating, false)
+
+//! RCT
+MTF_PARAM(int, rct_min_n_rect, 2)
+MTF_PARAM(int, rct_max_n_rect, 4)
+MTF_PARAM(int, rct_n_feat, 50)
+MTF_PARAM(int, rct_rad_outer_pos, 4)
+MTF_PARAM(int, rct_rad_search_win, 25)
+MTF_PARAM(double, rct_learning_rate, 0.85)
+
+MTF_PARAM(std::string, strk_config_path, "Config/struck.cfg")
+
+//! ViSP Template Tracker
+MTF_PARAM(char *, vptt_sm, "fclk")
+MTF_PARAM(char *, vptt_am, "ssd")
+MTF_PARAM(char *, vptt_ssm, "8")
+MTF_PARAM(int, vptt_max_iters, 30)
+MTF_PARAM(int, vptt_res, 50)
+MTF_PARAM(double, vptt_lambda, 0.001)
+MTF_PARAM(double, vptt_thresh_grad, 60)
+MTF_PARAM(int, vptt_pyr_n_levels, 0)
+MTF_PARAM(int, vptt_pyr_level_to_stop, 1)
+
+//! ViSP Pipeline
+MTF_PARAM(int, vp_usb_n_buffers, 3)
+MTF_PARAM(std::string, vp_usb_res, "0")
+MTF_PARAM(std::string, vp_usb_fps, "0")
+MTF_PARAM(std::string, vp_fw_res, "0")
+MTF_PARAM(std::string, vp_fw_fps, "0")
+MTF_PARAM(std::string, vp_fw_depth, "0")
+MTF_PARAM(std::string, vp_fw_iso, "0")
+MTF_PARAM(bool, vp_fw_print_info)
+MTF_PARAM(float, vp_pg_fw_shutter_ms)
+MTF_PARAM(float, vp_pg_fw_gain)
+MTF_PARAM(float, vp_pg_fw_exposure)
+MTF_PARAM(float, vp_pg_fw_brightness)
+
+//! OpenCV 3 Tracking
+MTF_PARAM(std::string, cv3_tracker_type, "mil")
+
+//! PFSL3
+MTF_PARAM(int, pfsl3_p_x, 40)
+MTF_PARAM(int, pfsl3_p_y, 40)
+MTF_PARAM(double, pfsl3_rot, 0)
+MTF_PARAM(double, pfsl3_ncc_std, 0.1)
+MTF_PARAM(double, pfsl3_pca_std, 10)
+MTF_PARAM(std::vector<double>, pfsl3_state_std)
+MTF_PARAM(double, pfsl3_ar_p, 0.5)
+MTF_PARAM(int, pfsl3_n, 40)
+MTF_PARAM(int, pfsl3_n_c, 10)
+MTF_PARAM(int, pfsl3_n_iter, 5)
+MTF_PARAM(int, pfsl3_sampling, 0)
+MTF_PARAM(int, pfsl3_capture, 0)
+MTF_PARAM(int, pfsl3_mean_check, 0)
+MTF_PARAM(int, pfsl3_outlier_flag, 0)
+MTF_PARAM(int, pfsl3_len, 100)
+MTF_PARAM(int, pfsl3_init_size, 15)
+MTF_PARAM(int, pfsl3_update_period, 5)
+MTF_PARAM(float, pfsl3_ff, 0.99f)
+MTF_PARAM(double, pfsl3_basis_thr, 0.95)
+MTF_PARAM(int, pfsl3_max_num_basis, 30)
+MTF_PARAM(int, pfsl3_max_num_used_basis, 10)
+MTF_PARAM(bool, pfsl3_show_weights, false)
+MTF_PARAM(bool, pfsl3_show_templates, false)
+MTF_PARAM(bool, pfsl3_debug_mode, false)
+
+//! GOTURN
+MTF_PARAM(bool, gtrn_do_train, true)
+MTF_PARAM(int, gtrn_gpu_id, 0)
+MTF_PARAM(bool, gtrn_show_intermediate_output, false)
+MTF_PARAM(std::string, gtrn_model_file, "Data/GOTURN/tracker.prototxt")
+MTF_PARAM(std::string, gtrn_trained_file, "Data/GOTURN/solver.prototxt")
+
+//! DFT
+MTF_PARAM(float, dft_res_to_l, 1e-10f)
+MTF_PARAM(float, dft_p_to_l, 5e-5f)
+MTF_PARAM(int, dft_max_iter, 50)
+MTF_PARAM(int, dft_max_iter_single_level, 10)
+MTF_PARAM(std::vector<float>, dft_pyramid_smoothing_variance, { 7 })
+MTF_PARAM(float, dft_presmoothing_variance, 1)
+MTF_PARAM(int, dft_n_control_points_on_edge, 25)
+MTF_PARAM(bool, dft_b_adaptative_choice_of_points, 0)
+MTF_PARAM(bool, dft_b_normalize_descriptors, 0)
+MTF_PARAM(int, dft_optimization_type, 2)
+
+MTF_PARAM(int, frg_n_bins, 16)
+MTF_PARAM(int, frg_search_margin, 7)
+MTF_PARAM(int, frg_hist_cmp_metric, 3)
+MTF_PARAM(double, frg_resize_factor, 0.5)
+MTF_PARAM(bool, frg_show_window, false)
+
+//! PCA Patch Extraction
+MTF_PARAM(std::vector<int>, extracted_frame_ids, { 0, 1, 2, 3, 4 })
+MTF_PARAM(int, extraction_id, 0)
+// PCA
+MTF_PARAM(int, pca_n_eigenvec, 16)
+MTF_PARAM(int, pca_batchsize, 5)
+MTF_PARAM(float, pca_f_factor, 0.95f)
+MTF_PARAM(bool, pca_show_basis, false)
+
+//! DFM
+MTF_PARAM(int, dfm_nfmaps, 1)
+MTF_PARAM(char *, dfm_layer_name, "conv1")
+MTF_PARAM(int, dfm_vis, 0)
+MTF_PARAM(int, dfm_zncc, 0)
+MTF_PARAM(char *, dfm_model_f_name, "../../../VGG_Models/VGG_deploy.prototxt")
+MTF_PARAM(char *, dfm_params_f_name, "../../../VGG_Models/VGG_CNN_F.caffemodel")
+MTF_PARAM(char *, dfm_mean_f_name, "../../../VGG_Models/VGG_mean.binaryproto")
+
+//! SPI
+MTF_PARAM(int, spi_type, 0)
+MTF_PARAM(double, spi_pix_diff_thresh, 10)
+MTF_PARAM(double, spi_grad_thresh, 0.005)
+MTF_PARAM(bool, spi_grad_use_union, false)
+// GFTT
+MTF_PARAM(int, spi_gftt_max_corners, 1000)
+MTF_PARAM(double, spi_gftt_quality_level, 0.01)
+MTF_PARAM(double, spi_gftt_min_distance, 0)
+MTF_PARAM(int, spi_gftt_block_size, 3)
+MTF_PARAM(bool, spi_gftt_use_harris_detector, false)
+MTF_PARAM(double, spi_gftt_k, 0.04)
+// SPI with GFTT
+MTF_PARAM(bool, spi_gftt_use_union, false)
+MTF_PARAM(int, spi_gftt_neigh_offset, 0)
+
+//! Registered sequence generator
+MTF_PARAM(std::string, reg_ssm, "8")
+MTF_PARAM(std::string, reg_ilm, "0")
+MTF_PARAM(int, reg_track_border, 0)
+MTF_PARAM(bool, reg_grayscale_img, false)
+MTF_PARAM(bool, reg_show_output, true)
+MTF_PARAM(bool, reg_save_as_video, false)
+MTF_PARAM(int, reg_video_fps, 24)
+
+//! Synthetic sequence generator
+MTF_PARAM(std::string, syn_ssm, "c8")
+MTF_PARAM(std::string, syn_ilm, "0")
+MTF_PARAM(int, syn_frame_id, 0)
+MTF_PARAM(bool, syn_grayscale_img, false)
+MTF_PARAM(bool, syn_continuous_warping, true)
+MTF_PARAM(vectori, syn_ssm_sigma_ids)
+MTF_PARAM(vectori, syn_ssm_mean_ids)
+MTF_PARAM(vectori, syn_am_sigma_ids)
+MTF_PARAM(vectori, syn_am_mean_ids)
+MTF_PARAM(double, syn_pix_sigma, 0)
+MTF_PARAM(bool, syn_am_on_obj, false)
+MTF_PARAM(bool, syn_warp_entire_image, false)
+MTF_PARAM(int, syn_background_type, 0)
+MTF_PARAM(bool, syn_use_inv_warp, false)
+MTF_PARAM(std::string, syn_out_suffix)
+MTF_PARAM(int, syn_n_frames, 1)
+MTF_PARAM(bool, syn_add_noise, true)
+MTF_PARAM(double, syn_noise_mean, 0.0)
+MTF_PARAM(double, syn_noise_sigma, 1.0)
+MTF_PARAM(bool, syn_save_as_video, false)
+MTF_PARAM(int, syn_video_fps, 24)
+MTF_PARAM(int, syn_jpg_quality, 100)
+MTF_PARAM(bool, syn_show_output, true)
+
+//! Benchmark
+MTF_PARAM(vector_s, bench_sm)
+MTF_PARAM(vector_s, bench_am)
+MTF_PARAM(vector_s, bench_ssm)
+MTF_PARAM(vector_s, bench_ilm)
+MTF_PARAM(vectori, bench_res)
+MTF_PARAM(vectori, bench_n_threads)
+MTF_PARAM(int, bench_n_frames, 100)
+MTF_PARAM(double, bench_pix_sigma, 1)
+MTF_PARAM(double, bench_noise_sigma, 0)
+MTF_PARAM(int, bench_seed, 0)
+MTF_PARAM(double, bench_err_thresh, 5)
+MTF_PARAM(std::string, bench_out_fname, "log/mtf_bench.csv")
+
+//! Online mosaic creator
+MTF_PARAM(bool, mos_inv_tracking, true)
+MTF_PARAM(int, mos_use_norm_corners, true)
+MTF_PARAM(int, mos_track_border, 100)
+MTF_PARAM(int, mos_border_width, 200)
+MTF_PARAM(int, mos_border_height, 200)
+MTF_PARAM(int, mos_init_offset_x, 0)
+MTF_PARAM(int, mos_init_offset_y, 0)
+MTF_PARAM(int, mos_disp_width, 200)
+MTF_PARAM(int, mos_disp_height, 200)
+MTF_PARAM(bool, mos_show_grid, false)
+MTF_PARAM(bool, mos_show_tracked_img, false)
+MTF_PARAM(bool, mos_show_patch, false)
+MTF_PARAM(bool, mos_show_mask, false)
+MTF_PARAM(bool, mos_use_write_mask, false)
+MTF_PARAM(bool, mos_save_img, true)
+MTF_PARAM(std::string, mos_out_fname)
+MTF_PARAM(std::string, mos_out_fmt, "jpg")
+
+//! QR tracker
+MTF_PARAM(std::vector<std::string>, qr_input)
+MTF_PARAM(std::string, qr_root_dir, "Data/QRTracker")
+MTF_PARAM(std::string, qr_detector_ssm, "4")
+MTF_PARAM(double, qr_duplicate_min_dist, 50)
+MTF_PARAM(double, qr_min_size, 10)
+MTF_PARAM(bool, qr_init_with_rect, 1)
+MTF_PARAM(int, qr_n_markers, -1)
+//! pyMTF
+MTF_PARAM(int, py_visualize, 1)
+MTF_PARAM(int, py_live_init, 1)
+//! mexMTF
+MTF_PARAM(int, mex_visualize, 1)
+MTF_PARAM(int, mex_live_init, 1)
+
@@ -61,906 +61,16 @@ namespace fs = boost::filesystem;
 
 namespace mtf{
 	namespace params{
-		// folder where the config files mtf.cfg, modules.cfg and multi.cfg are located
-		std::string config_dir = "Config";
-
-		/* default parameters */
-		int seq_id = 0;
-		int actor_id = 0;
-		std::string db_root_path = "../../../Datasets";
-		std::string actor;
-		std::string seq_path;
-		std::string seq_name;
-		std::string seq_fmt;
-		bool invert_seq = false;
-		unsigned int n_trackers = 1;
-		bool track_single_obj = false;
-		char pipeline = 'c';
-		char img_source = 'u';
-		double img_resize_factor = 1.0;
-		int input_buffer_size = 10;
-		int buffer_id = 0;
-
-		//! flags
-		int mtf_visualize = 1;
-		int pause_after_frame = 0;
-		bool print_corners = false;
-		bool print_fps = false;
-		int show_corner_ids = 0;
-		int show_ground_truth = 0;
-		int reinit_gt_from_bin = 1;
-		int read_obj_from_file = 0;
-		int read_obj_from_gt = 1;
-		bool sel_quad_obj = false;
-		int line_thickness = 2;
-		int record_frames = 0;
-		bool gt_write_ssm_params = false;
-		int write_tracking_data = 0;
-		bool overwrite_gt = 0;
-		int show_proc_img = 0;
-		int write_objs = 0;
-		char rec_source = 'u';
-		std::string rec_seq_suffix;
-		int rec_fps = 24;
-		std::vector<std::string> tracker_labels;
-
-		int reinit_at_each_frame = 0;
-		int reset_at_each_frame = 0;
-		bool reset_to_init = false;
-		int reinit_on_failure = false;
-		double reinit_err_thresh = 5.0;
-		int reinit_frame_skip = 5;
-		bool reinit_with_new_obj = false;
-
-		bool use_reinit_gt = false;
-		bool use_opt_gt = false;
-		std::string opt_gt_ssm = "2";
-		int debug_mode = 0;
-		int reset_template = 0;
-		int patch_size = 0;
-
-		std::string read_obj_fname = "sel_objs/selected_objects.txt";
-		std::string write_obj_fname = "sel_objs/selected_objects.txt";
-		std::string tracking_data_fname;
-		std::string record_frames_fname, record_frames_dir;
-
-		//! for Xvision trackers
-		int xv_visualize = 0;
-		int xv_steps_per_frame = 1;
-		/* only for pyramidal trackers */
-		int xv_no_of_levels = 2;
-		double xv_scale = 0.5;
-		/* for xvision grid tracker */
-		int xv_patch_size = 32;
-		int xv_tracker_type = 't';
-		int xvg_grid_size_x = 4;
-		int xvg_grid_size_y = -1;
-		int xvg_reset_pos = 0;
-		int xvg_reset_wts = 0;
-		double xvg_sel_reset_thresh = 1.0;
-		int xvg_pause_after_line = 0;
-		int xvg_show_tracked_pts = 0;
-		int xvg_use_constant_slope = 0;
-		int xvg_use_ls = 0;
-		int xvg_update_wts = 0;
-		double xvg_inter_alpha_thresh = 0.10;
-		double xvg_intra_alpha_thresh = 0.05;
-		int xvg_adjust_grid = 0;
-		int xvg_adjust_lines = 1;
-
-		//! for MTF
-		unsigned int mtf_res = 50;
-		unsigned int resx = 50;
-		unsigned int resy = 50;
-		int init_frame_id = 0;
-		int start_frame_id = 0;
-		int end_frame_id = 0;
-		int frame_gap = 1;
-		int max_iters = 10;
-		double epsilon = 0.01;
-		char* mtf_sm = "esm";
-		char* mtf_am = "ssd";
-		char* mtf_ssm = "8";
-		char* mtf_ilm = "0";
-		bool enable_nt = false;
-		bool invalid_state_check = true;
-		double invalid_state_err_thresh = 0;
-		bool uchar_input = false;
-
-		bool ic_update_ssm = true;
-		bool ic_chained_warp = true;
-		int ic_hess_type = 0;
-
-		bool fc_chained_warp = false;
-		int fc_hess_type = 1;
-		bool fc_write_ssm_updates = false;
-		bool fc_show_grid = false;
-		bool fc_show_patch = false;
-		double fc_patch_resize_factor = 1.0;
-		bool fc_debug_mode = false;
-
-		int fa_hess_type = 1;
-		bool fa_show_grid = false;
-		bool fa_show_patch = false;
-		double fa_patch_resize_factor = 1.0;
-		bool fa_write_frames = false;
-
-		int ia_hess_type = 1;
-
-		int esm_jac_type = 1;
-		int esm_hess_type = 2;
-		bool esm_chained_warp = false;
-
-		bool sec_ord_hess = false;
-		bool leven_marq = false;
-		double lm_delta_init = 0.01;
-		double lm_delta_update = 10;
-
-		bool enable_learning = false;
-		double learning_rate = 0.5;
-
-
-		bool ssd_show_template = false;
-
-		double nssd_norm_pix_min = 0.0;
-		double nssd_norm_pix_max = 1.0;
-
-		double zncc_likelihood_alpha = 50;
-
-		double res_from_size = 0;
-		int show_tracking_error = 0;
-		int write_tracking_error = 0;
-		int write_tracking_sr = 0;
-		vectord sr_err_thresh;
-
-		vector_s obj_cols;
-		std::string fps_col = "green";
-		std::string gt_col = "green";
-		std::string err_col = "green";		
-
-		int tracking_err_type = 0;
-		bool show_jaccard_error = false;
-		double grad_eps = 1e-8;
-		double hess_eps = 1.0;
-		double likelihood_alpha = 1.0;
-		double likelihood_beta = 0.0;
-		bool dist_from_likelihood = false;
-
-		std::string pre_proc_type = "gauss";
-		//! perform histogram equalization during pre processing;
-		bool pre_proc_hist_eq = false;
-		//! Gaussian filtering
-		int gauss_kernel_size = 5;
-		double gauss_sigma_x = 3;
-		double gauss_sigma_y = 3;
-		//! median filtering
-		int med_kernel_size = 5;
-		//! normalized box filtering
-		int box_kernel_size = 5;
-		//! bilateral filtering
-		int bil_diameter = 5;
-		double bil_sigma_col = 15;
-		double bil_sigma_space = 15;
-		//! Sobel filtering
-		int sobel_kernel_size = 5;
-		bool sobel_normalize = false;
-		//! Anisotropic diffusion
-		double aniso_lambda = 0.14285714285;
-		double aniso_kappa = 30;
-		unsigned int aniso_n_iters = 15;
-
-		//! Affine
-		int aff_normalized_init = 0;
-		int aff_pt_based_sampling = 0;
-
-		//! Lie Affine
-		int laff_normalized_init = 0;
-		double laff_grad_eps = 1e-8;
-
-		//! Homograhy
-		int hom_normalized_init = 0;
-		bool hom_corner_based_sampling = true;
-
-		//! Lie Homograhy
-		int lhom_normalized_init = 0;
-		double lhom_grad_eps = 1e-8;
-
-		//! Corner based Homograhy
-		int cbh_normalized_init = 0;
-		double cbh_grad_eps = 1e-8;
-
-		//! ASRT
-		bool asrt_normalized_init = false;
-		int asrt_pt_based_sampling = 0;
-
-		//! Similitude
-		bool sim_normalized_init = false;
-		bool sim_geom_sampling = true;
-		int sim_pt_based_sampling = 0;
-		int sim_n_model_pts = 2;
-
-		//! Isometry
-		int iso_pt_based_sampling = 0;
-
-		//! SL3
-		int sl3_normalized_init = 0;
-		bool sl3_iterative_sample_mean = true;
-		int sl3_sample_mean_max_iters = 10;
-		double sl3_sample_mean_eps = 1e-4;
-		bool sl3_debug_mode = 0;
-
-		//! Spline SSM
-		int spl_control_size = 10;
-		double	spl_control_overlap = 1;
-		int	spl_interp_type = 0;
-		bool spl_static_wts = true;
-		bool spl_debug_mode = 0;
-
-		//! SCV and RSCV
-		int scv_hist_type = 0;
-		bool scv_use_bspl = 0;
-		int scv_n_bins = 256;
-		double scv_preseed = 0;
-		bool scv_pou = 1;
-		bool scv_weighted_mapping = 1;
-		bool scv_mapped_gradient = 1;
-		bool scv_affine_mapping = 0;
-		bool scv_once_per_frame = 0;
-		bool scv_approx_dist_feat = true;
-		double scv_likelihood_alpha = 0;
-
-		//! LSCV and LRSCV
-		int lscv_sub_regions = 3;
-		int lscv_spacing = 10;
-		bool lscv_show_subregions = false;
-
-		//! LKLD
-		int lkld_n_bins = 8;
-		double lkld_pre_seed = 0.1;
-		bool lkld_pou = 1;
-		int lkld_sub_regions = 0;
-		int lkld_spacing = 1;
-
-		//! NCC
-		bool ncc_fast_hess = false;
-		double ncc_likelihood_alpha = 50;
-
-		//! SPSS
-		double spss_k = 0.01;
-		double spss_likelihood_alpha = 50;
-
-		//! SSIM
-		int ssim_pix_proc_type = 0;
-		double ssim_k1 = 0.01;
-		double ssim_k2 = 0.03;
-		double ssim_likelihood_alpha = 50;
-
-		//! Sum of AMs
-		std::string sum_am1, sum_am2;
-
-		char *pix_mapper = nullptr;
-
-		//! MI & CCRE
-		int mi_n_bins = 8;
-		double mi_pre_seed = 10;
-		bool mi_pou = false;
-		double mi_likelihood_alpha = 50;
-
-		//! CCRE
-		int ccre_n_bins = 8;
-		double ccre_pre_seed = 10;
-		bool ccre_pou = false;
-		bool ccre_symmetrical_grad = false;
-		int ccre_n_blocks = 0;
-		double ccre_likelihood_alpha = 50;
-
-		//!NGF
-		double ngf_eta = 5.0;
-		bool ngf_use_ssd = false;
-
-		//! NN
-		int nn_max_iters = 10;
-		int nn_n_samples = 1000;
-		vectori nn_ssm_sigma_ids;
-		vectori nn_ssm_mean_ids;
-		double nn_corner_sigma_d = 0.04;
-		double nn_corner_sigma_t = 0.06;
-		vectord nn_pix_sigma;
-		int nn_n_trees = 6;
-		double nn_ssm_sigma_prec = 1.1;
-		int nn_index_type = 1;
-		int nn_search_type = 0;
-		bool nn_additive_update = false;
-		int nn_show_samples = 0;
-		int nn_add_samples_gap = 0;
-		int nn_n_samples_to_add = 0;
-		int nn_remove_samples = 0;
-		bool nn_save_index = false;
-		bool nn_load_index = false;
-		int nn_saved_index_fid = 0;
-		//! GNN
-		int nn_gnn_degree = 250;
-		int nn_gnn_max_steps = 10;
-		int nn_gnn_cmpt_dist_thresh = 10000;
-		bool nn_gnn_random_start = false;
-		bool nn_gnn_verbose = false;
-		int nn_fgnn_index_type = 0;
-		//! FLANN specific params
-		int nn_srch_checks = 32;
-		float nn_srch_eps = 0.0;
-		bool nn_srch_sorted = true;
-		int nn_srch_max_neighbors = -1;
-		int nn_srch_cores = 1;
-		bool nn_srch_matrices_in_gpu_ram = false;
-		int nn_srch_use_heap = 2;
-		int nn_kdt_trees = 6;
-		int nn_km_branching = 32;
-		int nn_km_iterations = 11;
-		int nn_km_centers_init = 0;
-		float nn_km_cb_index = 0.2f;
-		int nn_kdts_leaf_max_size = 10;
-		int nn_kdtc_leaf_max_size = 64;
-		int nn_hc_branching = 32;
-		int nn_hc_trees = 4;
-		int nn_hc_leaf_max_size = 100;
-		int nn_hc_centers_init = 0;
-		float nn_auto_target_precision = 0.9f;
-		float nn_auto_build_weight = 0.01f;
-		float nn_auto_memory_weight = 0.0f;
-		float nn_auto_sample_fraction = 0.1f;
-
-		// Multi Layer Nearest Filter
-		int nnk_n_layers;
-		vectorvi nnk_ssm_sigma_ids;
-
-		//! Regression Network
-		int rg_max_iters = 10;
-		int rg_n_samples = 1000;
-		vectori rg_ssm_sigma_ids;
-		vectori rg_ssm_mean_ids;
-		vectord rg_pix_sigma;
-		bool rg_additive_update = false;
-		int rg_show_samples = 0;
-		int rg_add_points = 0;
-		int rg_remove_points = 0;
-		bool rg_save_index = false;
-		bool rg_load_index = false;
-		int rg_saved_index_fid = 0;
-		int rg_nepochs = 10;
-		int rg_bs = 128;
-		bool rg_preproc = true;
-		char *rg_solver = nullptr;
-		char *rg_train = nullptr;
-		char *rg_mean = nullptr;
-		bool rg_dbg = false;
-		bool rg_pretrained = false;
-
-		//! RIU AM
-		double riu_likelihood_alpha = 50.0;
-
-		//! Gradient Descent
-		double sd_learning_rate = 0.1;
-
-		//! Gain and Bias Illumination Model
-		bool gb_additive_update = false;
-
-		//! Piecewise Gain and Bias Illumination Model
-		bool pgb_additive_update = false;
-		int pgb_sub_regions_x = 3;
-		int pgb_sub_regions_y = 3;
-
-		//! Radial Basis Function illumination model
-		bool rbf_additive_update = false;
-		int rbf_n_ctrl_pts_x = 3;
-		int rbf_n_ctrl_pts_y = 3;
-
-		//! Particle Filter
-		int pf_max_iters = 1;
-		int pf_n_particles = 100;
-		int pf_dynamic_model = 1;
-		int pf_update_type = 0;
-		int pf_likelihood_func = 0;
-		int pf_resampling_type = 0;
-		int pf_mean_type = 1;
-		bool pf_reset_to_mean = false;
-		vectori pf_ssm_sigma_ids;
-		vectori pf_ssm_mean_ids;
-		bool pf_update_distr_wts = false;
-		double pf_min_distr_wt = 0.1;
-		double pf_adaptive_resampling_thresh = 0;
-		double pf_measurement_sigma = 0.1;
-		vectord pf_pix_sigma;
-		int pf_show_particles = 0;
-		bool pf_jacobian_as_sigma = false;
-		bool pf_debug_mode = false;
-
-		//! Multi Layer Particle Filter
-		int pfk_n_layers;
-		vectorvi pfk_ssm_sigma_ids;
-
-		//! Gaussian parameters for sampling SSM parameters - used by NN, PF and RG
-		vectorvd ssm_sigma;
-		vectorvd ssm_mean;
-
-		vectorvd am_sigma;
-		vectorvd am_mean;
-
-		//! Hierarchical SSM tracker
-		char* hrch_sm = "iclk";
-		char* hrch_am = "ssd";
-
-		//! Cascade tracker
-		int casc_n_trackers = 2;
-		bool casc_enable_feedback = 1;
-		bool casc_auto_reinit = false;
-		double casc_reinit_err_thresh = 1.0;
-		int casc_reinit_frame_gap = 1;
-
-		//! Grid tracker
-		char* grid_sm = "iclk";
-		char* grid_am = "ssd";
-		char* grid_ssm = "2";
-		char* grid_ilm = "0";
-
-		int grid_res = 10;
-		int grid_patch_size = 10;
-		int grid_patch_res = 0;
-		int grid_reset_at_each_frame = 1;
-		bool grid_dyn_patch_size = false;
-		bool grid_patch_centroid_inside = true;
-		double grid_fb_err_thresh = 0;
-		bool grid_fb_reinit = 0;
-		bool grid_show_trackers = false;
-		bool grid_show_tracker_edges = false;
-		bool grid_use_tbb = true;
-		//! OpenCV grid tracker
-		int grid_pyramid_levels = 2;
-		bool grid_use_min_eig_vals = 0;
-		bool grid_rgb_input = false;
-		double grid_min_eig_thresh = 1e-4;
-
-		std::string feat_detector_type = "orb";
-		std::string feat_descriptor_type = "orb";
-		double feat_max_dist_ratio = 0.75;
-		int feat_min_matches = 10;
-		bool feat_rebuild_index = false;
-		bool feat_use_cv_flann = true;
-		bool feat_show_keypoints = 0;
-		bool feat_show_matches = 0;
-		bool feat_debug_mode = 0;
-
-		bool grid_use_const_grad = true;
-
-		int sift_n_features = 0;
-		int sift_n_octave_layers = 3;
-		double sift_contrast_thresh = 0.04;
-		double sift_edge_thresh = 10;
-		double sift_sigma = 1.6;
-
-		double surf_hessian_threshold = 100;
-		int surf_n_octaves = 4;
-		int surf_n_octave_layers = 3;
-		bool surf_extended = false;
-		bool surf_upright = false;
-
-		int brisk_thresh = 30; 
-		int brisk_octaves = 3;
-		float brisk_pattern_scale = 1.0f;
-
-		int orb_n_features = 500;
-		float orb_scale_factor = 1.2f;
-		int orb_n_levels = 8;
-		int orb_edge_threshold = 31;
-		int orb_first_level = 0;
-		int orb_WTA_K = 2;
-		int orb_score_type = 0;
-		int orb_patch_size = 31;
-		int orb_fast_threshold = 20;
-
-		int mser_delta = 5;
-		int mser_min_area = 60;
-		int mser_max_area = 14400;
-		double mser_max_variation = 0.25;
-		double mser_min_diversity = .2;
-		int mser_max_evolution = 200;
-		double mser_area_threshold = 1.01;
-		double mser_min_margin = 0.003;
-		int mser_edge_blur_size = 5;
-
-		int fast_threshold = 10;
-		bool fast_non_max_suppression = true;
-		int fast_type = 2;
-
-		int agast_threshold = 10;
-		bool agast_non_max_suppression = true;
-		int agast_type = 3;
-
-		int gftt_max_corners = 1000;
-		double gftt_quality_level = 0.01;
-		double gftt_min_distance = 1;
-		int gftt_block_size = 3;
-		bool gftt_use_harris_detector = false;
-		double gftt_k = 0.04;
-
-		int brief_bytes = 32;
-		bool brief_use_orientation = false;
-
-		bool freak_orientation_normalized = true;
-		bool freak_scale_normalized = true;
-		float freak_pattern_scale = 22.0f;
-		int freak_n_octaves = 4;
-
-		int lucid_kernel = 1;
-		int lucid_blur_kernel = 2;
-
-		int latch_bytes = 32;
-		bool latch_rotation_invariance = true; 
-		int latch_half_ssd_size = 3;
-
-		float daisy_radius = 15; 
-		int daisy_q_radius = 3; 
-		int daisy_q_theta = 8;
-		int daisy_q_hist = 8; 
-		int daisy_norm = 100; 
-		vectorf daisy_H;
-		bool daisy_interpolation = true; 
-		bool daisy_use_orientation = false;
-
-		int vgg_desc = 100; 
-		float vgg_isigma = 1.4f;
-		bool vgg_img_normalize = true; 
-		bool vgg_use_scale_orientation = true;
-		float vgg_scale_factor = 6.25f; 
-		bool vgg_dsc_normalize = false;
-
-		int boost_desc_desc = 302;
-		bool boost_desc_use_scale_orientation = true;
-		float boost_desc_scale_factor = 6.25f;
-
-		int star_max_size = 45; 
-		int star_response_threshold = 30;
-		int star_line_threshold_projected = 10;
-		int star_line_threshold_binarized = 8;
-		int star_suppress_nonmax_size = 5;
-
-		int msd_patch_radius = 3;
-		int msd_search_area_radius = 5;
-		int msd_nms_radius = 5;
-		int msd_nms_scale_radius = 0;
-		float msd_th_saliency = 250.0f;
-		int msd_kNN = 4;
-		float msd_scale_factor = 1.25f;
-		int msd_n_scales = -1;
-		bool msd_compute_orientation = false;
-
-		//! SSM Estimator
-		int est_method = 0;
-		double est_ransac_reproj_thresh = 10;
-		int est_n_model_pts = 4;
-		int est_max_iters = 2000;
-		int est_max_subset_attempts = 300;
-		bool est_use_boost_rng = false;
-		double est_confidence = 0.995;
-		bool est_refine = true;
-		int est_lm_max_iters = 10;
-
-
-		char* line_sm = "iclk";
-		char* line_am = "ssd";
-		char* line_ssm = "2";
-		int line_grid_size = 5;
-		int line_patch_size = 25;
-		bool line_use_constant_slope = false;
-		bool line_use_ls = false;
-		double line_inter_alpha_thresh = 0.1;
-		double line_intra_alpha_thresh = 0.05;
-		bool line_reset_pos = false;
-		bool line_reset_template = false;
-		bool line_debug_mode = false;
-
-		//! RKL Tracker
-		char* rkl_sm = "iclk";
-		bool rkl_enable_spi = true;
-		bool rkl_enable_feedback = true;
-		bool rkl_failure_detection = true;
-		double rkl_failure_thresh = 15.0;
-
-		//! Parallel Tracker
-		int prl_n_trackers = 1;
-		int prl_estimation_method = 0;
-		bool prl_reset_to_mean = false;
-		bool prl_auto_reinit = false;
-		double prl_reinit_err_thresh = 1.0;
-		int prl_reinit_frame_gap = 1;
-
-		//! Pyramidal Tracker
-		std::string pyr_sm = "fc";
-		int pyr_no_of_levels = 3;
-		double pyr_scale_factor = 0.50;
-		bool pyr_scale_res = true;
-		bool pyr_show_levels = false;
-
-		//! MTF Diagnostics
-		char* diag_am = "ssd";
-		char* diag_ssm = "2";
-		char* diag_ilm = "0";
-		bool diag_3d = false;
-		std::vector<int> diag_3d_ids = { 0, 1 };
-		int diag_frame_gap = 0;
-		double diag_range = 0;
-		std::vector<double> diag_ssm_range;
-		std::vector<double> diag_am_range;
-		int diag_ssm_range_id = 0;
-		int diag_am_range_id = 0;
-		std::string diag_gen_norm = "000";// Norm,FeatNorm
-		std::string diag_gen_jac = "000";// Std,ESM,Diff
-		std::string diag_gen_hess = "0000";// Std,ESM,InitSelf,CurrSelf
-		std::string diag_gen_hess2 = "0000";// Std2,ESM2,InitSelf2,CurrSelf2
-		std::string diag_gen_hess_sum = "0000";// Std, Std2, Self, Self2
-		std::string diag_gen_num = "000"; // Jac, Hess, NHess
-		std::string diag_gen_ssm = "0";// ssm params
-
-		bool diag_bin = true;
-		bool diag_inv = true;
-		bool diag_show_data = false;
-		bool diag_show_corners = false;
-		bool diag_show_patches = false;
-		bool diag_verbose = false;
-
-		double diag_grad_diff = 0.1;
-		int diag_res = 50;
-		int diag_update_type = 0;
-		int diag_start_id = 0;
-		int diag_end_id = 0;
-
-		std::string diag_out_prefix;
-
-
-		bool diag_enable_validation = false;
-		double diag_validation_prec = 1e-20;
-
-		bool esm_spi_enable = false;
-		double esm_spi_thresh = 10;
-
-		//! DSST
-		double dsst_padding = 1;
-		double dsst_sigma = 1.0 / 16;
-		double dsst_scale_sigma = 1.0 / 4;
-		double dsst_lambda = 1e-2;
-		double dsst_learning_rate = 0.025;
-		int dsst_number_scales = 33;
-		int dsst_number_rots = 21;
-		double dsst_scale_step = 1.02;
-		double dsst_rot_step = 2;
-		int dsst_resize_factor = 4;
-		int dsst_is_scaling = 1;
-		int dsst_is_rotating = 1;
-		int dsst_bin_size = 1;
-
-		//! KCF
-		double kcf_padding; //extra area surrounding the target
-		double kcf_lambda; //regularization
-		double kcf_output_sigma_factor; //spatial bandwidth (proportional to target)
-		double kcf_interp_factor; //linear interpolation factor for adaptation
-		double kcf_kernel_sigma; //gaussian kernel bandwidth
-		//! for scaling
-		int kcf_number_scales;
-		double kcf_scale_step;
-		double kcf_scale_model_max_area;
-		double kcf_scale_sigma_factor;
-		double kcf_scale_learning_rate;
-		bool kcf_is_scaling;
-		int kcf_resize_factor;
-
-		int mil_algorithm = 100;
-		int mil_num_classifiers = 100;
-		float mil_overlap = 0.99f;
-		float mil_search_factor = 2.0f;
-		float mil_pos_radius_train = 4.0f;
-		int mil_neg_num_train = 65;
-		int mil_num_features = 250;
-
-		//! CMT
-		bool cmt_estimate_scale = true;
-		bool cmt_estimate_rotation = false;
-		char* cmt_feat_detector = "FAST";
-		char* cmt_desc_extractor = "BRISK";
-		double cmt_resize_factor = 0.5;
-
-		//! TLD
-		bool tld_tracker_enabled = true;
-		bool tld_detector_enabled = true;
-		bool tld_learning_enabled = true;
-		bool tld_alternating = false;
-
-		//! RCT
-		int rct_min_n_rect = 2;
-		int rct_max_n_rect = 4;
-		int rct_n_feat = 50;
-		int rct_rad_outer_pos = 4;
-		int rct_rad_search_win = 25;
-		double rct_learning_rate = 0.85;
-
-		std::string strk_config_path = "Config/struck.cfg";
-
-		//! ViSP Template Tracker
-		char* vptt_sm = "fclk";
-		char* vptt_am = "ssd";
-		char* vptt_ssm = "8";
-		int vptt_max_iters = 30;
-		int vptt_res = 50;
-		double vptt_lambda = 0.001;
-		double vptt_thresh_grad = 60;
-		int vptt_pyr_n_levels = 0;
-		int vptt_pyr_level_to_stop = 1;
-
-		//! ViSP Pipeline
-		int vp_usb_n_buffers = 3;
-		std::string vp_usb_res = "0";
-		std::string vp_usb_fps = "0";
-		std::string vp_fw_res = "0";
-		std::string vp_fw_fps = "0";
-		std::string vp_fw_depth = "0";
-		std::string vp_fw_iso = "0";
-		bool vp_fw_print_info;
-		float vp_pg_fw_shutter_ms;
-		float vp_pg_fw_gain;
-		float vp_pg_fw_exposure;
-		float vp_pg_fw_brightness;
-
-		//! OpenCV 3 Tracking
-		std::string cv3_tracker_type = "mil";
-
-		//! PFSL3
-		int pfsl3_p_x = 40;
-		int pfsl3_p_y = 40;
-		double pfsl3_rot = 0;
-		double pfsl3_ncc_std = 0.1;
-		double pfsl3_pca_std = 10;
-		std::vector<double> pfsl3_state_std;
-		double pfsl3_ar_p = 0.5;
-		int pfsl3_n = 40;
-		int pfsl3_n_c = 10;
-		int pfsl3_n_iter = 5;
-		int pfsl3_sampling = 0;
-		int pfsl3_capture = 0;
-		int pfsl3_mean_check = 0;
-		int pfsl3_outlier_flag = 0;
-		int pfsl3_len = 100;
-		int pfsl3_init_size = 15;
-		int pfsl3_update_period = 5;
-		float pfsl3_ff = 0.99f;
-		double pfsl3_basis_thr = 0.95;
-		int pfsl3_max_num_basis = 30;
-		int pfsl3_max_num_used_basis = 10;
-		bool pfsl3_show_weights = false;
-		bool pfsl3_show_templates = false;
-		bool pfsl3_debug_mode = false;
-
-		//! GOTURN
-		bool gtrn_do_train = true;
-		int gtrn_gpu_id = 0;
-		bool gtrn_show_intermediate_output = false;
-		std::string gtrn_model_file = "Data/GOTURN/tracker.prototxt";
-		std::string gtrn_trained_file = "Data/GOTURN/solver.prototxt";
-
-		//! DFT
-		float dft_res_to_l = 1e-10f;
-		float dft_p_to_l = 5e-5f;
-		int dft_max_iter = 50;
-		int dft_max_iter_single_level = 10;
-		std::vector<float> dft_pyramid_smoothing_variance = { 7 };
-		float dft_presmoothing_variance = 1;
-		int dft_n_control_points_on_edge = 25;
-		bool dft_b_adaptative_choice_of_points = 0;
-		bool dft_b_normalize_descriptors = 0;
-		int dft_optimization_type = 2;
-
-		int frg_n_bins = 16;
-		int frg_search_margin = 7;
-		int frg_hist_cmp_metric = 3;
-		double frg_resize_factor = 0.5;
-		bool frg_show_window = false;
-
-		//! PCA Patch Extraction
-		std::vector<int> extracted_frame_ids = { 0, 1, 2, 3, 4 };
-		int extraction_id = 0;
-		// PCA
-		int pca_n_eigenvec = 16;
-		int pca_batchsize = 5;
-		float pca_f_factor = 0.95f;
-		bool pca_show_basis = false;
-
-		//! DFM
-		int dfm_nfmaps = 1;
-		char* dfm_layer_name = "conv1";
-		int dfm_vis = 0;
-		int dfm_zncc = 0;
-		char *dfm_model_f_name = "../../../VGG_Models/VGG_deploy.prototxt";
-		char *dfm_params_f_name = "../../../VGG_Models/VGG_CNN_F.caffemodel";
-		char *dfm_mean_f_name = "../../../VGG_Models/VGG_mean.binaryproto";
-
-		//! SPI
-		int spi_type = 0;
-		double spi_pix_diff_thresh = 10;
-		double spi_grad_thresh = 0.005;
-		bool spi_grad_use_union = false;
-		// GFTT
-		int spi_gftt_max_corners = 1000;
-		double spi_gftt_quality_level = 0.01;
-		double spi_gftt_min_distance = 0;
-		int spi_gftt_block_size = 3;
-		bool spi_gftt_use_harris_detector = false;
-		double spi_gftt_k = 0.04;
-		// SPI with GFTT
-		bool spi_gftt_use_union = false;
-		int spi_gftt_neigh_offset = 0;
-
-		//! Registered sequence generator
-		std::string  reg_ssm = "8";
-		std::string  reg_ilm = "0";
-		int reg_track_border = 0;
-		bool reg_grayscale_img = false;
-		bool reg_show_output = true;
-		bool reg_save_as_video = false;
-		int reg_video_fps = 24;
-
-		//! Synthetic sequence generator
-		std::string  syn_ssm = "c8";
-		std::string  syn_ilm = "0";
-		int syn_frame_id = 0;
-		bool syn_grayscale_img = false;
-		bool syn_continuous_warping = true;
-		vectori syn_ssm_sigma_ids, syn_ssm_mean_ids;
-		vectori syn_am_sigma_ids, syn_am_mean_ids;
-		double syn_pix_sigma = 0;
-		bool syn_am_on_obj = false;
-		bool syn_warp_entire_image = false;
-		int syn_background_type = 0;
-		bool syn_use_inv_warp = false;
-		std::string syn_out_suffix;
-		int syn_n_frames = 1;
-		bool syn_add_noise = true;
-		double syn_noise_mean = 0.0;
-		double syn_noise_sigma = 1.0;
-		bool syn_save_as_video = false;
-		int syn_video_fps = 24;
-		int syn_jpg_quality = 100;
-		bool syn_show_output = true;
-
-		//! Online mosaic creator
-		bool mos_inv_tracking = true;
-		int mos_use_norm_corners = true;
-		int mos_track_border = 100;
-		int mos_border_width = 200;
-		int mos_border_height = 200;
-		int mos_init_offset_x = 0;
-		int mos_init_offset_y = 0;
-		int mos_disp_width = 200;
-		int mos_disp_height = 200;
-		bool mos_show_grid = false;
-		bool mos_show_tracked_img = false;
-		bool mos_show_patch = false;
-		bool mos_show_mask = false;
-		bool mos_use_write_mask = false;
-		bool mos_save_img = true;
-		std::string mos_out_fname;
-		std::string mos_out_fmt = "jpg";
-
-		//! QR tracker
-		std::vector<std::string> qr_input;
-		std::string qr_root_dir = "Data/QRTracker";
-		std::string qr_detector_ssm = "4";
-		double qr_duplicate_min_dist = 50;
-		double qr_min_size = 10;
-		bool qr_init_with_rect = 1;
-		int qr_n_markers = -1;
-		//! pyMTF
-		int py_visualize = 1;
-		int py_live_init = 1;
-		//! mexMTF
-		int mex_visualize = 1;
-		int mex_live_init = 1;
+		/**
+		all the parameters along with the functions that read them from the configuration files and argument pairs;
+		each instance is independent of the others so trackers with different settings can be created concurrently
+		by passing their own instances to mtf::TrackerFactory; the parameters accessed directly from this namespace
+		are the members of the global instance declared at the end of this file
+		*/
+		struct Config{
+#define MTF_PARAM(type, name, ...) type name{__VA_ARGS__};
+#include "paramList.h"
+#undef MTF_PARAM
 
 		inline void split(const std::string &s, char delim, std::vector<std::string> &elems) {
 			stringstream ss(s);
@@ -1424,6 +534,14 @@ namespace mtf{
 				enable_nt = atoi(arg_val);
 				return;
 			}
+			if(!strcmp(arg_name, "enable_fixed_res")){
+				enable_fixed_res = atoi(arg_val);
+				return;
+			}
+			if(!strcmp(arg_name, "fixed_res_float")){
+				fixed_res_float = atoi(arg_val);
+				return;
+			}
 			if(!strcmp(arg_name, "invalid_state_err_thresh")){
 				invalid_state_err_thresh = atof(arg_val);
 				return;
@@ -1513,6 +631,30 @@ namespace mtf{
 				input_buffer_size = atoi(arg_val);
 				return;
 			}
+			if(!strcmp(arg_name, "pipeline_queue_size")){
+				pipeline_queue_size = atoi(arg_val);
+				return;
+			}
+			if(!strcmp(arg_name, "input_ring_size")){
+				input_ring_size = atoi(arg_val);
+				return;
+			}
+			if(!strcmp(arg_name, "input_ring_block")){
+				input_ring_block = atoi(arg_val);
+				return;
+			}
+			if(!strcmp(arg_name, "prof_enable")){
+				prof_enable = atoi(arg_val);
+				return;
+			}
+			if(!strcmp(arg_name, "prof_fname")){
+				prof_fname = std::string(arg_val);
+				return;
+			}
+			if(!strcmp(arg_name, "prof_interval")){
+				prof_interval = atof(arg_val);
+				return;
+			}
 			if(!strcmp(arg_name, "nssd_norm_pix_max")){
 				nssd_norm_pix_max = atof(arg_val);
 				return;
@@ -1585,6 +727,10 @@ namespace mtf{
 				grad_eps = strtod(arg_val, nullptr);
 				return;
 			}
+			if(!strcmp(arg_name, "use_grad_cache")){
+				use_grad_cache = atoi(arg_val);
+				return;
+			}
 			if(!strcmp(arg_name, "hess_eps")){
 				hess_eps = strtod(arg_val, nullptr);
 				return;
@@ -1653,6 +799,10 @@ namespace mtf{
 				pre_proc_hist_eq = atoi(arg_val);
 				return;
 			}
+			if(!strcmp(arg_name, "pre_proc_roi_margin")){
+				pre_proc_roi_margin = atof(arg_val);
+				return;
+			}
 			//! Gaussian smoothing
 			if(!strcmp(arg_name, "gauss_kernel_size")){
 				gauss_kernel_size = atoi(arg_val);
@@ -1969,6 +1119,19 @@ namespace mtf{
 				lm_delta_update = atof(arg_val);
 				return;
 			}
+			//! coarse to fine schedule
+			if(!strcmp(arg_name, "c2f_sub_ratio")){
+				c2f_sub_ratio = atoi(arg_val);
+				return;
+			}
+			if(!strcmp(arg_name, "c2f_thresh")){
+				c2f_thresh = atof(arg_val);
+				return;
+			}
+			if(!strcmp(arg_name, "stagnation_iters")){
+				stagnation_iters = atoi(arg_val);
+				return;
+			}
 			//! Online learning in AM
 			if(!strcmp(arg_name, "enable_learning")){
 				enable_learning = atof(arg_val);
@@ -2004,6 +1167,14 @@ namespace mtf{
 				mi_n_bins = atoi(arg_val);
 				return;
 			}
+			if(!strcmp(arg_name, "mi_n_blocks")){
+				mi_n_blocks = atoi(arg_val);
+				return;
+			}
+			if(!strcmp(arg_name, "mi_lut_res")){
+				mi_lut_res = atoi(arg_val);
+				return;
+			}
 			if(!strcmp(arg_name, "mi_likelihood_alpha")){
 				mi_likelihood_alpha = atof(arg_val);
 				return;
@@ -2029,6 +1200,10 @@ namespace mtf{
 				ccre_n_blocks = atoi(arg_val);
 				return;
 			}
+			if(!strcmp(arg_name, "ccre_lut_res")){
+				ccre_lut_res = atoi(arg_val);
+				return;
+			}
 			if(!strcmp(arg_name, "ccre_likelihood_alpha")){
 				ccre_likelihood_alpha = atof(arg_val);
 				return;
@@ -2163,6 +1338,14 @@ namespace mtf{
 				diag_validation_prec = atof(arg_val);
 				return;
 			}
+			if(!strcmp(arg_name, "diag_n_workers")){
+				diag_n_workers = atoi(arg_val);
+				return;
+			}
+			if(!strcmp(arg_name, "diag_resume")){
+				diag_resume = atoi(arg_val);
+				return;
+			}
 			if(!strcmp(arg_name, "diag_out_prefix")){
 				diag_out_prefix = std::string(arg_val);
 				return;
@@ -2258,6 +1441,10 @@ namespace mtf{
 				nn_saved_index_fid = atoi(arg_val);
 				return;
 			}
+			if(!strcmp(arg_name, "nn_db_format")){
+				nn_db_format = atoi(arg_val);
+				return;
+			}
 			//! NN Index specific parameters
 			if(!strcmp(arg_name, "nn_srch_checks")){
 				nn_srch_checks = atoi(arg_val);
@@ -2303,6 +1490,14 @@ namespace mtf{
 				nn_gnn_random_start = atoi(arg_val);
 				return;
 			}
+			if(!strcmp(arg_name, "nn_gnn_n_workers")){
+				nn_gnn_n_workers = atoi(arg_val);
+				return;
+			}
+			if(!strcmp(arg_name, "nn_gnn_build_block_size")){
+				nn_gnn_build_block_size = atoi(arg_val);
+				return;
+			}
 			if(!strcmp(arg_name, "nn_fgnn_index_type")){
 				nn_fgnn_index_type = atoi(arg_val);
 				return;
@@ -3002,6 +2197,14 @@ namespace mtf{
 				est_lm_max_iters = atoi(arg_val);
 				return;
 			}
+			if(!strcmp(arg_name, "est_n_workers")){
+				est_n_workers = atoi(arg_val);
+				return;
+			}
+			if(!strcmp(arg_name, "est_sprt")){
+				est_sprt = atoi(arg_val);
+				return;
+			}
 			//! RKLT
 			if(!strcmp(arg_name, "rkl_sm")){
 				processStringParam(rkl_sm, arg_val);
@@ -3048,6 +2251,10 @@ namespace mtf{
 				prl_reinit_frame_gap = atoi(arg_val);
 				return;
 			}
+			if(!strcmp(arg_name, "prl_n_workers")) {
+				prl_n_workers = atoi(arg_val);
+				return;
+			}
 			//! Pyramidal Tracker
 			if(!strcmp(arg_name, "pyr_sm")) {
 				pyr_sm = std::string(arg_val);
@@ -3174,10 +2381,19 @@ namespace mtf{
 				pf_jacobian_as_sigma = atoi(arg_val);
 				return;
 			}
+			if(!strcmp(arg_name, "pf_n_workers")){
+				pf_n_workers = atoi(arg_val);
+				return;
+			}
 			if(!strcmp(arg_name, "pf_debug_mode")){
 				pf_debug_mode = atoi(arg_val);
 				return;
 			}
+			//! Batch Tracker
+			if(!strcmp(arg_name, "batch_n_workers")){
+				batch_n_workers = atoi(arg_val);
+				return;
+			}
 			//! Multi layer PF
 			if(!strcmp(arg_name, "pfk_n_layers")){
 				pfk_n_layers = atoi(arg_val);
@@ -3903,6 +3119,55 @@ namespace mtf{
 				syn_show_output = atoi(arg_val);
 				return;
 			}
+			//! benchmark
+			if(!strcmp(arg_name, "bench_sm")){
+				bench_sm = string_arr(arg_val);
+				return;
+			}
+			if(!strcmp(arg_name, "bench_am")){
+				bench_am = string_arr(arg_val);
+				return;
+			}
+			if(!strcmp(arg_name, "bench_ssm")){
+				bench_ssm = string_arr(arg_val);
+				return;
+			}
+			if(!strcmp(arg_name, "bench_ilm")){
+				bench_ilm = string_arr(arg_val);
+				return;
+			}
+			if(!strcmp(arg_name, "bench_res")){
+				bench_res = atoi_arr(arg_val);
+				return;
+			}
+			if(!strcmp(arg_name, "bench_n_threads")){
+				bench_n_threads = atoi_arr(arg_val);
+				return;
+			}
+			if(!strcmp(arg_name, "bench_n_frames")){
+				bench_n_frames = atoi(arg_val);
+				return;
+			}
+			if(!strcmp(arg_name, "bench_pix_sigma")){
+				bench_pix_sigma = atof(arg_val);
+				return;
+			}
+			if(!strcmp(arg_name, "bench_noise_sigma")){
+				bench_noise_sigma = atof(arg_val);
+				return;
+			}
+			if(!strcmp(arg_name, "bench_seed")){
+				bench_seed = atoi(arg_val);
+				return;
+			}
+			if(!strcmp(arg_name, "bench_err_thresh")){
+				bench_err_thresh = atof(arg_val);
+				return;
+			}
+			if(!strcmp(arg_name, "bench_out_fname")){
+				bench_out_fname = std::string(arg_val);
+				return;
+			}
 			//! online image mosaicing
 			if(!strcmp(arg_name, "mos_inv_tracking")){
 				mos_inv_tracking = atoi(arg_val);
@@ -4355,6 +3620,44 @@ namespace mtf{
 		}
 
 		inline void freeParams(){}
+		};
+		//! configuration used by the example applications and by the free factory functions in mtf.h
+		Config global_config;
+		//! members of the global configuration accessible by their names as before
+#define MTF_PARAM(type, name, ...) auto &name = global_config.name;
+#include "paramList.h"
+#undef MTF_PARAM
+
+		inline bool readParams(int cmd_argc, char* cmd_argv[]){
+			return global_config.readParams(cmd_argc, cmd_argv);
+		}
+		inline bool readParams(const char* param_str){
+			return global_config.readParams(param_str);
+		}
+		inline FILE* readTrackerParams(FILE * fid = nullptr, int print_args = 0){
+			return global_config.readTrackerParams(fid, print_args);
+		}
+		inline bool parseArgumentPairs(char * argv[], int argc,
+			int parse_type = 0, int print_args = 0){
+			return global_config.parseArgumentPairs(argv, argc, parse_type, print_args);
+		}
+		inline std::string getSyntheticSeqName(){
+			return global_config.getSyntheticSeqName();
+		}
+		inline bool postProcessParams(){
+			return global_config.postProcessParams();
+		}
+		inline void getSamplerParams(vectorvd &sigma, vectorvd &mean,
+			const vectori &sigma_ids, const vectori &mean_ids,
+			const char* name){
+			global_config.getSamplerParams(sigma, mean, sigma_ids, mean_ids, name);
+		}
+		inline void getAMSamplerParams(vectorvd &sigma, vectorvd &mean,
+			const vectori &sigma_ids, const vectori &mean_ids,
+			const char* name){
+			global_config.getAMSamplerParams(sigma, mean, sigma_ids, mean_ids, name);
+		}
+		inline void freeParams(){ global_config.freeParams(); }
 	}
 }
 
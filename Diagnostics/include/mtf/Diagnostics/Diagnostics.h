@@ -61,7 +61,17 @@ public:
 		const ParamType *diag_params = nullptr);
 	virtual ~Diagnostics();
 	int inputType() const { return am->inputType(); }
-	void setImage(const cv::Mat &img){ am->setCurrImg(img); }
+	void setImage(const cv::Mat &img);
+	/**
+	AM/SSM instances with the same types and settings as the ones passed to the constructor,
+	one for each additional worker thread; generateAnalyticalData, generateAnalyticalData3D and
+	generateNumericalData spread their samples over these and the main instances and each
+	worker writes directly into its own entries of the preallocated data matrix;
+	patches and corners are not shown while running in parallel;
+	must be called before initialize
+	*/
+	void setWorkers(const std::vector<AM> &worker_ams, const std::vector<SSM> &worker_ssms);
+	unsigned int getNWorkers() const{ return static_cast<unsigned int>(workers.size()) + 1; }
 
 	void initialize(const cv::Mat &corners, const bool *gen_flags);
 	void update(const cv::Mat &corners);
@@ -83,6 +93,7 @@ public:
 	void generateSSMParamData(VectorXd &param_range_vec,
 		int n_pts, const char* fname);
 	double getADTVal(ADT data_type, int state_id);
+	double getNDTVal(NDT data_type, int state_id, double grad_diff);
 	double getInvADTVal(ADT data_type, int state_id);
 
 	const char* toString(ADT data_type);
@@ -140,6 +151,14 @@ private:
 	MatrixXd ssm_grad_norm;
 	RowVectorXd ssm_grad_norm_mean;
 
+	std::vector<std::unique_ptr<Diagnostics>> workers;
+	VectorXd grad_update;
+
+	Diagnostics* getWorker(unsigned int worker_id){
+		return worker_id == 0 ? this : workers[worker_id - 1].get();
+	}
+	void showCurrData(int state_id, double param_range);
+
 	void updateSSM(const VectorXd &state_update);
 	void resetSSM(const VectorXd &state_update);
 
@@ -26,7 +26,6 @@ int n_pts, ADT data_type, const char* fname){
 	//utils::printMatrix(max_state, "max_state");
 
 
-	VectorXd state_update(state_size);
 	diagnostics_data.resize(n_pts, 2 * state_size);
 	//if(data_type == iHessian){
 	//	am->cmptCurrHessian(hessian, init_pix_jacobian, init_pix_hessian);		
@@ -44,66 +43,31 @@ int n_pts, ADT data_type, const char* fname){
 	//roi.height += 80;
 
 	for(unsigned int state_id = 0; state_id < state_size; ++state_id){
-		//printf("Processing state parameter %d....\n", state_id);
-
-		//if(data_type == ADT::Norm){			
-		//	//am->getCurrImg().convertTo(curr_img_cv_out, curr_img_cv_out.type());
-		//	curr_img_cv_out = CV_RGB(255, 255, 255);
-		//	utils::printScalarToFile(state_id, "state", "log/diagnostics/extreme_corners.txt", "%d");
-		//	utils::printMatrixToFile(ssm->getCorners(), nullptr, "log/diagnostics/extreme_corners.txt");
-		//	drawCurrCorners(curr_img_cv_out, state_id, 1, false, CV_RGB(0, 0, 0));
-		//}
-
-		state_update.setZero();
 		diagnostics_data.col(2 * state_id) = VectorXd::LinSpaced(n_pts, min_state(state_id), max_state(state_id));
-		for(int pt_id = 0; pt_id < n_pts; pt_id++){
-
+	}
+	//! sample_id = state_id * n_pts + pt_id and each worker takes every n_workers-th sample
+	const unsigned int n_workers = getNWorkers();
+	const int n_samples = state_size*n_pts;
+	auto run_worker = [&](unsigned int worker_id){
+		Diagnostics *diag = getWorker(worker_id);
+		VectorXd state_update(state_size);
+		for(int sample_id = worker_id; sample_id < n_samples; sample_id += n_workers){
+			int state_id = sample_id / n_pts, pt_id = sample_id % n_pts;
+			state_update.setZero();
 			state_update(state_id) = diagnostics_data(pt_id, 2 * state_id);
 
-			//utils::printMatrix(ssm->getCorners(), "init_corners");
-
-			updateState(state_update, state_id);
-
-			//utils::printMatrix(state_update, "state_update");
-			//utils::printMatrix(ssm->getCorners(), "curr_corners");
-
-			double data_val = getADTVal(data_type, state_id);
-
-			if(params.show_patches){
-				curr_patch.convertTo(curr_patch_uchar, curr_patch_uchar.type());
-				imshow(curr_patch_win_name, curr_patch_uchar);
-				if(cv::waitKey(1) == 27){
-					exit(0);
-				}
-			}
-			if(params.show_corners){
-				curr_img_cv.convertTo(curr_img_cv_uchar, curr_img_cv_uchar.type());
-				putText(curr_img_cv_uchar, cv::format("param: %d range: %f", state_id, param_range_vec_norm(state_id)),
-					cv::Point(10, 20), cv::FONT_HERSHEY_SIMPLEX, 0.50, cv::Scalar(255, 255, 255));
-				drawCurrCorners(curr_img_cv_uchar, state_id);
-				imshow(curr_img_win_name, curr_img_cv_uchar);
-				if(cv::waitKey(1) == 27){ exit(0); }
+			diag->updateState(state_update, state_id);
+			diagnostics_data(pt_id, 2 * state_id + 1) = diag->getADTVal(data_type, state_id);
+			if(n_workers == 1){
+				showCurrData(state_id, param_range_vec_norm(state_id));
 			}
-			//if(data_type == ADT::Norm){
-			//	if(pt_id == 0){
-			//		utils::printMatrixToFile(ssm->getCorners(), nullptr, "log/diagnostics/extreme_corners.txt");
-			//		drawCurrCorners(curr_img_cv_out, state_id, 1, false, CV_RGB(255, 0, 0));
-			//	} else if(pt_id == n_pts - 1){
-			//		utils::printMatrixToFile(ssm->getCorners(), nullptr, "log/diagnostics/extreme_corners.txt");
-			//		drawCurrCorners(curr_img_cv_out, state_id, 1, false, CV_RGB(0, 255, 0));
-			//	}
-			//}
-			diagnostics_data(pt_id, 2 * state_id + 1) = data_val;
-
-			resetState(state_update, state_id);
-
-			//if((pt_id + 1) % 50 == 0){ printf("Done %d points\n", pt_id + 1); }
+			diag->resetState(state_update, state_id);
 		}
-		//if(data_type == ADT::Norm){
-		//	//imshow("curr_img_cv_out", curr_img_cv_out);
-		//	//if(cv::waitKey(0) == 27){ exit(0); }
-		//	cv::imwrite(cv::format("log/diagnostics/frame_%d_state_%d.bmp", frame_id, state_id), curr_img_cv_out(roi));
-		//}
+	};
+	if(n_workers > 1){
+		utils::runWorkers(n_workers, run_worker);
+	} else{
+		run_worker(0);
 	}
 	if(params.show_data){
 		utils::printMatrix(diagnostics_data, cv::format("%s data", toString(data_type)).c_str());
@@ -141,7 +105,6 @@ void Diagnostics::generateAnalyticalData3D(VectorXd &x_vec, VectorXd &y_vec,
 	//utils::printMatrix(max_state, "max_state");
 
 
-	VectorXd state_update(state_size);
 	diagnostics_data.resize(n_pts, n_pts);
 	//if(data_type == iHessian){
 	//	am->cmptCurrHessian(hessian, init_pix_jacobian, init_pix_hessian);		
@@ -149,44 +112,51 @@ void Diagnostics::generateAnalyticalData3D(VectorXd &x_vec, VectorXd &y_vec,
 	x_vec = VectorXd::LinSpaced(n_pts, min_state(state_ids[0]), max_state(state_ids[0]));
 	y_vec = VectorXd::LinSpaced(n_pts, min_state(state_ids[1]), max_state(state_ids[1]));
 
-	state_update.setZero();
-	for(int pt_id1 = 0; pt_id1 < n_pts; pt_id1++){
-		//printf("Processing state parameter %d....\n", state_id);		
-		state_update(state_ids[0]) = x_vec(pt_id1);
-		for(int pt_id2 = 0; pt_id2 < n_pts; pt_id2++){
-
+	const unsigned int n_workers = getNWorkers();
+	const int n_samples = n_pts*n_pts;
+	auto run_worker = [&](unsigned int worker_id){
+		Diagnostics *diag = getWorker(worker_id);
+		VectorXd state_update = VectorXd::Zero(state_size);
+		for(int sample_id = worker_id; sample_id < n_samples; sample_id += n_workers){
+			int pt_id1 = sample_id / n_pts, pt_id2 = sample_id % n_pts;
+			state_update(state_ids[0]) = x_vec(pt_id1);
 			state_update(state_ids[1]) = y_vec(pt_id2);
 
-			//utils::printMatrix(ssm->getCorners(), "init_corners");
-			updateState(state_update, state_ids[0]);
-			//utils::printMatrix(state_update, "state_update");
-			//utils::printMatrix(ssm->getCorners(), "curr_corners");
-			diagnostics_data(pt_id1, pt_id2) = getADTVal(data_type, state_ids[1]);
-
-			if(params.show_patches){
-				curr_patch.convertTo(curr_patch_uchar, curr_patch_uchar.type());
-				imshow(curr_patch_win_name, curr_patch_uchar);
-				if(cv::waitKey(1) == 27)
-					exit(0);
-			}
-			if(params.show_corners){
-				curr_img_cv.convertTo(curr_img_cv_uchar, curr_img_cv_uchar.type());
-				putText(curr_img_cv_uchar, cv::format("param: %d range: %f", state_ids[1], param_range_vec_norm(state_ids[1])),
-					cv::Point(10, 20), cv::FONT_HERSHEY_SIMPLEX, 0.50, cv::Scalar(255, 255, 255));
-				drawCurrCorners(curr_img_cv_uchar, state_ids[1]);
-				imshow(curr_img_win_name, curr_img_cv_uchar);
-				if(cv::waitKey(1) == 27)
-					exit(0);
+			diag->updateState(state_update, state_ids[0]);
+			diagnostics_data(pt_id1, pt_id2) = diag->getADTVal(data_type, state_ids[1]);
+			if(n_workers == 1){
+				showCurrData(state_ids[1], param_range_vec_norm(state_ids[1]));
 			}
-			resetState(state_update, state_ids[0]);
-			//if((pt_id + 1) % 50 == 0){ printf("Done %d points\n", pt_id + 1); }
+			diag->resetState(state_update, state_ids[0]);
 		}
+	};
+	if(n_workers > 1){
+		utils::runWorkers(n_workers, run_worker);
+	} else{
+		run_worker(0);
 	}
 	if(fname){
 		printf("Writing diagnostics data to: %s\n", fname);
 		utils::printMatrixToFile(diagnostics_data, "diagnostics_data", fname, "%15.9f", "w");
 	}
 }
+void Diagnostics::showCurrData(int state_id, double param_range){
+	if(params.show_patches){
+		curr_patch.convertTo(curr_patch_uchar, curr_patch_uchar.type());
+		imshow(curr_patch_win_name, curr_patch_uchar);
+		if(cv::waitKey(1) == 27){
+			exit(0);
+		}
+	}
+	if(params.show_corners){
+		curr_img_cv.convertTo(curr_img_cv_uchar, curr_img_cv_uchar.type());
+		putText(curr_img_cv_uchar, cv::format("param: %d range: %f", state_id, param_range),
+			cv::Point(10, 20), cv::FONT_HERSHEY_SIMPLEX, 0.50, cv::Scalar(255, 255, 255));
+		drawCurrCorners(curr_img_cv_uchar, state_id);
+		imshow(curr_img_win_name, curr_img_cv_uchar);
+		if(cv::waitKey(1) == 27){ exit(0); }
+	}
+}
 double Diagnostics::getADTVal(ADT data_type, int state_id){
 	switch(data_type){
 	case  ADT::Norm:
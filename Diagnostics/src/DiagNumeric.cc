@@ -19,88 +19,29 @@ void Diagnostics::generateNumericalData(VectorXd &param_range_vec,
 	VectorXd min_state = -param_range_vec_norm;
 	VectorXd max_state = param_range_vec_norm;
 
-	VectorXd state_update(state_size), grad_update(state_size);
 	diagnostics_data.resize(n_pts, 2 * state_size);
-
-	double grad_mult_factor = 1.0 / (2 * grad_diff);
-	double data_val;
 	for(unsigned int state_id = 0; state_id < state_size; ++state_id){
-		//printf("Processing state parameter %d....\n", state_id);
-
-		state_update.setZero();
-		grad_update.setZero();
 		diagnostics_data.col(2 * state_id) = VectorXd::LinSpaced(n_pts, min_state(state_id), max_state(state_id));
-		for(int pt_id = 0; pt_id < n_pts; pt_id++){
+	}
+	const unsigned int n_workers = getNWorkers();
+	const int n_samples = state_size*n_pts;
+	auto run_worker = [&](unsigned int worker_id){
+		Diagnostics *diag = getWorker(worker_id);
+		VectorXd state_update(state_size);
+		for(int sample_id = worker_id; sample_id < n_samples; sample_id += n_workers){
+			int state_id = sample_id / n_pts, pt_id = sample_id % n_pts;
+			state_update.setZero();
 			state_update(state_id) = diagnostics_data(pt_id, 2 * state_id);
 
-			updateState(state_update, state_id);
-
-			switch(data_type){
-			case NDT::Jacobian:
-			{
-				grad_update(state_id) = grad_diff;
-				updateState(grad_update, state_id);
-				updateCurrSimilarity();
-				double norm_inc = am->getSimilarity();	
-				resetState(grad_update, state_id);
-
-				grad_update(state_id) = -grad_diff;
-				updateState(grad_update, state_id);
-				updateCurrSimilarity();
-				double norm_dec = am->getSimilarity();
-				resetState(grad_update, state_id);
-
-				data_val = (norm_inc - norm_dec) * grad_mult_factor;
-				break;
-			}
-			case NDT::Hessian:
-			{
-				grad_update(state_id) = grad_diff;
-				updateState(grad_update, state_id);
-				updateCurrPixJacobian();
-				updateCurrGrad();
-				am->cmptCurrJacobian(similarity_jacobian, curr_pix_jacobian);
-				double jacobian_inc = similarity_jacobian(state_id);
-				resetState(grad_update, state_id);
-
-				grad_update(state_id) = -grad_diff;
-				updateState(grad_update, state_id);
-				updateCurrPixJacobian();
-				updateCurrGrad();
-				am->cmptCurrJacobian(similarity_jacobian, curr_pix_jacobian);
-				double jacobian_dec = similarity_jacobian(state_id);
-				resetState(grad_update, state_id);
-
-				data_val = (jacobian_inc - jacobian_dec) * grad_mult_factor;
-				break;
-			}
-			case NDT::NHessian:
-			{
-				updateCurrSimilarity();
-				double norm = am->getSimilarity();
-
-				grad_update(state_id) = grad_diff;
-				updateState(grad_update, state_id);
-				updateCurrSimilarity();
-				double norm_inc = am->getSimilarity();
-				resetState(grad_update, state_id);
-
-				grad_update(state_id) = -grad_diff;
-				updateState(grad_update, state_id);
-				updateCurrSimilarity();
-				double norm_dec = am->getSimilarity();
-				resetState(grad_update, state_id);
-
-				data_val = (norm_inc + norm_dec - 2 * norm) / (grad_diff * grad_diff);
-				break;
-			}
-			default:
-				throw utils::InvalidArgument("Diagnostics :: Invalid numerical data type specified");
-			}
-			diagnostics_data(pt_id, 2 * state_id + 1) = data_val;
-			resetState(state_update, state_id);
-			//if((pt_id + 1) % 50 == 0){ printf("Done %d points\n", pt_id + 1); }
+			diag->updateState(state_update, state_id);
+			diagnostics_data(pt_id, 2 * state_id + 1) = diag->getNDTVal(data_type, state_id, grad_diff);
+			diag->resetState(state_update, state_id);
 		}
+	};
+	if(n_workers > 1){
+		utils::runWorkers(n_workers, run_worker);
+	} else{
+		run_worker(0);
 	}
 	if(params.show_data){
 		utils::printMatrix(diagnostics_data, cv::format("%s data", toString(data_type)).c_str());
@@ -112,6 +53,70 @@ void Diagnostics::generateNumericalData(VectorXd &param_range_vec,
 }
 
 
+double Diagnostics::getNDTVal(NDT data_type, int state_id, double grad_diff){
+	double grad_mult_factor = 1.0 / (2 * grad_diff);
+	grad_update.setZero();
+	switch(data_type){
+	case NDT::Jacobian:
+	{
+		grad_update(state_id) = grad_diff;
+		updateState(grad_update, state_id);
+		updateCurrSimilarity();
+		double norm_inc = am->getSimilarity();	
+		resetState(grad_update, state_id);
+
+		grad_update(state_id) = -grad_diff;
+		updateState(grad_update, state_id);
+		updateCurrSimilarity();
+		double norm_dec = am->getSimilarity();
+		resetState(grad_update, state_id);
+
+		return (norm_inc - norm_dec) * grad_mult_factor;
+	}
+	case NDT::Hessian:
+	{
+		grad_update(state_id) = grad_diff;
+		updateState(grad_update, state_id);
+		updateCurrPixJacobian();
+		updateCurrGrad();
+		am->cmptCurrJacobian(similarity_jacobian, curr_pix_jacobian);
+		double jacobian_inc = similarity_jacobian(state_id);
+		resetState(grad_update, state_id);
+
+		grad_update(state_id) = -grad_diff;
+		updateState(grad_update, state_id);
+		updateCurrPixJacobian();
+		updateCurrGrad();
+		am->cmptCurrJacobian(similarity_jacobian, curr_pix_jacobian);
+		double jacobian_dec = similarity_jacobian(state_id);
+		resetState(grad_update, state_id);
+
+		return (jacobian_inc - jacobian_dec) * grad_mult_factor;
+	}
+	case NDT::NHessian:
+	{
+		updateCurrSimilarity();
+		double norm = am->getSimilarity();
+
+		grad_update(state_id) = grad_diff;
+		updateState(grad_update, state_id);
+		updateCurrSimilarity();
+		double norm_inc = am->getSimilarity();
+		resetState(grad_update, state_id);
+
+		grad_update(state_id) = -grad_diff;
+		updateState(grad_update, state_id);
+		updateCurrSimilarity();
+		double norm_dec = am->getSimilarity();
+		resetState(grad_update, state_id);
+
+		return (norm_inc + norm_dec - 2 * norm) / (grad_diff * grad_diff);
+	}
+	default:
+		throw utils::InvalidArgument("Diagnostics :: Invalid numerical data type specified");
+	}
+}
+
 void Diagnostics::generateInverseNumericalData(VectorXd &param_range_vec,
 	int n_pts, NDT data_type, const char* fname, double grad_diff){
 	assert(param_range_vec.size() == state_size);
@@ -103,6 +103,7 @@ Diagnostics::Diagnostics(AM _am, SSM _ssm,
 	mean_pix_hessian.resize(ssm_state_size*ssm_state_size, n_pix);
 
 	similarity_jacobian.resize(state_size);
+	grad_update.resize(state_size);
 	hessian.resize(state_size, state_size);
 	init_hessian.resize(state_size, state_size);
 
@@ -127,6 +128,33 @@ Diagnostics::Diagnostics(AM _am, SSM _ssm,
 	dist_func.reset(am->getDistFunc());
 }
 
+void Diagnostics::setWorkers(const std::vector<AM> &worker_ams,
+	const std::vector<SSM> &worker_ssms){
+	if(worker_ams.size() != worker_ssms.size()){
+		throw utils::InvalidArgument("Diagnostics :: No. of worker AMs and SSMs must be the same");
+	}
+	ParamType worker_params(&params);
+	worker_params.show_data = worker_params.show_corners = worker_params.show_patches = false;
+	worker_params.enable_validation = false;
+	workers.clear();
+	for(unsigned int worker_id = 0; worker_id < worker_ams.size(); ++worker_id){
+		if(worker_ams[worker_id]->getNPix() != n_pix ||
+			worker_ams[worker_id]->getStateSize() != am_state_size ||
+			worker_ssms[worker_id]->getStateSize() != ssm_state_size){
+			throw utils::InvalidArgument(
+				cv::format("Diagnostics :: AM/SSM of worker %d do not match the main ones", worker_id + 1));
+		}
+		workers.emplace_back(new Diagnostics(worker_ams[worker_id], worker_ssms[worker_id], &worker_params));
+	}
+}
+
+void Diagnostics::setImage(const cv::Mat &img){
+	am->setCurrImg(img);
+	for(auto &worker : workers){
+		worker->setImage(img);
+	}
+}
+
 
 bool Diagnostics::validateHessians(const MatrixXd &self_hessian){
 	bool matching_hess = true;
@@ -168,6 +196,9 @@ bool Diagnostics::validateHessians(const MatrixXd &self_hessian){
 void Diagnostics::initialize(const cv::Mat &corners, 
 	const bool *gen_flags){
 
+	for(auto &worker : workers){
+		worker->initialize(corners, gen_flags);
+	}
 	ssm->initialize(corners);
 	am->initializePixVals(ssm->getPts());
 	am->initializeSimilarity();
@@ -257,6 +288,9 @@ void Diagnostics::update(const cv::Mat &corners){
 	//}
 	++frame_id;
 
+	for(auto &worker : workers){
+		worker->update(corners);
+	}
 	ssm->initialize(corners);
 	am->setFirstIter();
 
@@ -27,9 +27,9 @@ set(MTF_MEX_INSTALL_DIR "" CACHE PATH "Directory to install the Matlab interface
 # message(STATUS "Boost_LIBRARIES:")
 # message(STATUS "Examples: MTF_RUNTIME_FLAGS: ${MTF_RUNTIME_FLAGS} ${MTF_COMPILETIME_FLAGS}")
 set(MTF_EXEC_INSTALL_DIR ${MTF_INSTALL_DIR}/bin)
-set(EX_TARGET_NAMES runMTF createMosaic generateSyntheticSeq trackUAVTrajectory extractPatch diagnoseMTF) 
-set(EX_INSTALL_TARGET_NAMES install_exe install_mos install_syn install_uav install_patch install_diag install_diag_lib) 
-set(EX_COMBINED_TARGET_NAMES mtfe mtfm mtfs mtfu mtfpa mtft) 
+set(EX_TARGET_NAMES runMTF createMosaic generateSyntheticSeq benchMTF trackUAVTrajectory extractPatch diagnoseMTF) 
+set(EX_INSTALL_TARGET_NAMES install_exe install_mos install_syn install_bench install_uav install_patch install_diag install_diag_lib) 
+set(EX_COMBINED_TARGET_NAMES mtfe mtfm mtfs mtfb mtfu mtfpa mtft) 
 
 add_executable(runMTF Examples/cpp/runMTF.cc)
 target_compile_definitions(runMTF PUBLIC ${MTF_DEFINITIONS})
@@ -120,6 +120,14 @@ add_custom_target(patch DEPENDS extractPatch)
 	# add_custom_target(mtfpa DEPENDS extractPatch install_patch)
 # endif()
 
+add_executable(comparePrecision Examples/cpp/comparePrecision.cc)
+target_compile_definitions(comparePrecision PUBLIC ${MTF_DEFINITIONS})
+target_compile_options(comparePrecision PUBLIC ${MTF_RUNTIME_FLAGS} ${MTF_COMPILETIME_FLAGS})
+target_include_directories(comparePrecision PUBLIC  ${MTF_INCLUDE_DIRS} ${MTF_EXT_INCLUDE_DIRS})
+target_link_libraries(comparePrecision mtf ${MTF_LIBS})
+install(TARGETS comparePrecision RUNTIME DESTINATION ${MTF_EXEC_INSTALL_DIR} COMPONENT precision)
+add_custom_target(precision DEPENDS comparePrecision)
+
 add_executable(generateSyntheticSeq Examples/cpp/generateSyntheticSeq.cc)
 target_compile_definitions(generateSyntheticSeq PUBLIC ${MTF_DEFINITIONS})
 target_compile_options(generateSyntheticSeq PUBLIC ${MTF_RUNTIME_FLAGS} ${MTF_COMPILETIME_FLAGS})
@@ -137,6 +145,14 @@ add_custom_target(syn DEPENDS generateSyntheticSeq)
 	# add_custom_target(mtfs DEPENDS generateSyntheticSeq install_syn)
 # endif()
 
+add_executable(benchMTF Examples/cpp/benchMTF.cc)
+target_compile_definitions(benchMTF PUBLIC ${MTF_DEFINITIONS})
+target_compile_options(benchMTF PUBLIC ${MTF_RUNTIME_FLAGS} ${MTF_COMPILETIME_FLAGS})
+target_include_directories(benchMTF PUBLIC  ${MTF_INCLUDE_DIRS} ${MTF_EXT_INCLUDE_DIRS})
+target_link_libraries(benchMTF mtf ${MTF_LIBS})
+install(TARGETS benchMTF RUNTIME DESTINATION ${MTF_EXEC_INSTALL_DIR} COMPONENT bench)
+add_custom_target(bench DEPENDS benchMTF)
+
 add_executable(createMosaic Examples/cpp/createMosaic.cc)
 target_compile_definitions(createMosaic PUBLIC ${MTF_DEFINITIONS})
 target_compile_options(createMosaic PUBLIC ${MTF_RUNTIME_FLAGS} ${MTF_COMPILETIME_FLAGS})
@@ -42,7 +42,7 @@ endif
 
 MTF_MEX_INSTALL_DIR ?= $(MATLAB_DIR)/toolbox/local
 
-EXAMPLE_TARGETS = exe uav mos syn gt patch rec py diag
+EXAMPLE_TARGETS = exe uav mos syn gt patch rec py diag bench precision
 
 # check if MATLAB folder exists
 ifneq ($(wildcard ${MATLAB_DIR}/.),)
@@ -129,6 +129,8 @@ ifeq (${o}, 1)
 	_MTF_UAV_EXE_NAME = trackUAVTrajectory
 	_MTF_GT_EXE_NAME = showGroundTruth
 	_MTF_SYN_EXE_NAME = generateSyntheticSeq
+	_MTF_BENCH_EXE_NAME = benchMTF
+	_MTF_PREC_EXE_NAME = comparePrecision
 	_MTF_MOS_EXE_NAME = createMosaic
 	_MTF_REC_EXE_NAME = recordSeq
 	_MTF_QR_EXE_NAME = trackMarkers
@@ -148,6 +150,8 @@ else ifeq (${o}, 2)
 	_MTF_UAV_EXE_NAME = trackUAVTrajectory_fast
 	_MTF_GT_EXE_NAME = showGroundTruth_fast
 	_MTF_SYN_EXE_NAME = generateSyntheticSeq_fast
+	_MTF_BENCH_EXE_NAME = benchMTF_fast
+	_MTF_PREC_EXE_NAME = comparePrecision_fast
 	_MTF_MOS_EXE_NAME = createMosaic_fast
 	_MTF_REC_EXE_NAME = recordSeq_fast
 	_MTF_QR_EXE_NAME = trackMarkers_fast
@@ -166,6 +170,8 @@ else
 	_MTF_UAV_EXE_NAME = trackUAVTrajectory_debug
 	_MTF_GT_EXE_NAME = showGroundTruth_debug
 	_MTF_SYN_EXE_NAME = generateSyntheticSeq_debug
+	_MTF_BENCH_EXE_NAME = benchMTF_debug
+	_MTF_PREC_EXE_NAME = comparePrecision_debug
 	_MTF_MOS_EXE_NAME = createMosaic_debug
 	_MTF_REC_EXE_NAME = recordSeq_debug
 	_MTF_QR_EXE_NAME = trackMarkers_debug
@@ -180,6 +186,8 @@ MTF_PATCH_EXE_NAME = $(addsuffix ${LIB_POST_FIX}${MTF_EXE_EXT}, ${_MTF_PATCH_EXE
 MTF_UAV_EXE_NAME = $(addsuffix ${LIB_POST_FIX}${MTF_EXE_EXT}, ${_MTF_UAV_EXE_NAME})
 MTF_GT_EXE_NAME = $(addsuffix ${LIB_POST_FIX}${MTF_EXE_EXT}, ${_MTF_GT_EXE_NAME})
 MTF_SYN_EXE_NAME = $(addsuffix ${LIB_POST_FIX}${MTF_EXE_EXT}, ${_MTF_SYN_EXE_NAME})
+MTF_BENCH_EXE_NAME = $(addsuffix ${LIB_POST_FIX}${MTF_EXE_EXT}, ${_MTF_BENCH_EXE_NAME})
+MTF_PREC_EXE_NAME = $(addsuffix ${LIB_POST_FIX}${MTF_EXE_EXT}, ${_MTF_PREC_EXE_NAME})
 MTF_MOS_EXE_NAME = $(addsuffix ${LIB_POST_FIX}${MTF_EXE_EXT}, ${_MTF_MOS_EXE_NAME})
 MTF_REC_EXE_NAME = $(addsuffix ${LIB_POST_FIX}${MTF_EXE_EXT}, ${_MTF_REC_EXE_NAME})
 MTF_QR_EXE_NAME = $(addsuffix ${LIB_POST_FIX}${MTF_EXE_EXT}, ${_MTF_QR_EXE_NAME})
@@ -198,14 +206,16 @@ ifeq (${vp}, 1)
 endif
 
 
-.PHONY: exe uav mos syn py diag gt patch qr app mtfi mtfp mtfc mtfu mtfd mtfs mtfm
-.PHONY: install_exe install_uav install_mos install_patch install_qr install_rec install_syn install_py install_diag install_app install_all install_mex2 install_mex
+.PHONY: exe uav mos syn bench precision py diag gt patch qr app mtfi mtfp mtfc mtfu mtfd mtfs mtfm
+.PHONY: install_exe install_uav install_mos install_patch install_qr install_rec install_syn install_bench install_precision install_py install_diag install_app install_all install_mex2 install_mex
 .PHONY: run
 
 exe: ${BUILD_DIR}/${MTF_EXE_NAME}
 uav: ${BUILD_DIR}/${MTF_UAV_EXE_NAME}
 mos: ${BUILD_DIR}/${MTF_MOS_EXE_NAME}
 syn: ${BUILD_DIR}/${MTF_SYN_EXE_NAME}
+bench: ${BUILD_DIR}/${MTF_BENCH_EXE_NAME}
+precision: ${BUILD_DIR}/${MTF_PREC_EXE_NAME}
 py: ${BUILD_DIR}/${MTF_PY_LIB_NAME}
 py2: ${BUILD_DIR}/${MTF_PY2_LIB_NAME}
 mex: ${BUILD_DIR}/${MTF_MEX_MODULE_NAME}
@@ -224,6 +234,8 @@ install_uav: ${MTF_EXEC_INSTALL_DIR}/${MTF_UAV_EXE_NAME}
 install_mos: ${MTF_EXEC_INSTALL_DIR}/${MTF_MOS_EXE_NAME}
 install_patch: ${MTF_EXEC_INSTALL_DIR}/${MTF_PATCH_EXE_NAME}
 install_syn: ${MTF_EXEC_INSTALL_DIR}/${MTF_SYN_EXE_NAME}
+install_bench: ${MTF_EXEC_INSTALL_DIR}/${MTF_BENCH_EXE_NAME}
+install_precision: ${MTF_EXEC_INSTALL_DIR}/${MTF_PREC_EXE_NAME}
 install_rec: ${MTF_EXEC_INSTALL_DIR}/${MTF_REC_EXE_NAME}
 install_qr: ${MTF_EXEC_INSTALL_DIR}/${MTF_QR_EXE_NAME}
 install_py: ${MTF_PY_INSTALL_DIR}/${MTF_PY_LIB_NAME}
@@ -240,6 +252,7 @@ mtfx: install install_mex
 mtfu: install install_uav
 mtfg: install install_gt
 mtfs: install install_syn
+mtfb: install install_bench
 mtfm: install install_mos
 mtfq: install install_qr
 mtfr: install_rec
@@ -259,6 +272,10 @@ ${MTF_EXEC_INSTALL_DIR}/${MTF_PATCH_EXE_NAME}: ${BUILD_DIR}/${MTF_PATCH_EXE_NAME
 	${MTF_EXE_INSTALL_CMD_PREFIX} ${CP_CMD} $< $@
 ${MTF_EXEC_INSTALL_DIR}/${MTF_SYN_EXE_NAME}: ${BUILD_DIR}/${MTF_SYN_EXE_NAME}
 	${MTF_EXE_INSTALL_CMD_PREFIX} ${CP_CMD} $< $@
+${MTF_EXEC_INSTALL_DIR}/${MTF_BENCH_EXE_NAME}: ${BUILD_DIR}/${MTF_BENCH_EXE_NAME}
+	${MTF_EXE_INSTALL_CMD_PREFIX} ${CP_CMD} $< $@
+${MTF_EXEC_INSTALL_DIR}/${MTF_PREC_EXE_NAME}: ${BUILD_DIR}/${MTF_PREC_EXE_NAME}
+	${MTF_EXE_INSTALL_CMD_PREFIX} ${CP_CMD} $< $@
 ${MTF_EXEC_INSTALL_DIR}/${MTF_GT_EXE_NAME}: ${BUILD_DIR}/${MTF_GT_EXE_NAME}
 	${MTF_EXE_INSTALL_CMD_PREFIX} ${CP_CMD} $< $@
 ${MTF_EXEC_INSTALL_DIR}/${MTF_MOS_EXE_NAME}: ${BUILD_DIR}/${MTF_MOS_EXE_NAME}
@@ -288,6 +305,8 @@ ${BUILD_DIR}/${MTF_REC_EXE_NAME}: | ${BUILD_DIR}
 ${BUILD_DIR}/${MTF_UAV_EXE_NAME}: | ${BUILD_DIR}	
 ${BUILD_DIR}/${MTF_GT_EXE_NAME}: | ${BUILD_DIR}	
 ${BUILD_DIR}/${MTF_SYN_EXE_NAME}: | ${BUILD_DIR}	
+${BUILD_DIR}/${MTF_BENCH_EXE_NAME}: | ${BUILD_DIR}	
+${BUILD_DIR}/${MTF_PREC_EXE_NAME}: | ${BUILD_DIR}	
 ${BUILD_DIR}/${MTF_MOS_EXE_NAME}: | ${BUILD_DIR}	
 ${BUILD_DIR}/${MTF_QR_EXE_NAME}: | ${BUILD_DIR}	
 ${BUILD_DIR}/${MTF_MEX_MODULE_NAME}: | ${BUILD_DIR}	
@@ -334,6 +353,12 @@ ${BUILD_DIR}/${MTF_REC_EXE_NAME}: ${EXAMPLES_SRC_DIR}/recordSeq.cc ${EXAMPLES_HE
 ${BUILD_DIR}/${MTF_SYN_EXE_NAME}: ${EXAMPLES_SRC_DIR}/generateSyntheticSeq.cc ${MTF_HEADERS}
 	${CXX}  $< -o $@ -w ${WARNING_FLAGS} ${MTF_RUNTIME_FLAGS} ${MTF_INCLUDE_FLAGS} ${EXAMPLES_INCLUDE_FLAGS} ${OPENCV_FLAGS} ${LIBS} ${MTF_LIB_LINK} ${BOOST_LIBS} ${LIBS_PARALLEL} ${MTF_LIBS_DIRS} ${MTF_LIBS} ${OPENCV_LIBS}
 	
+${BUILD_DIR}/${MTF_BENCH_EXE_NAME}: ${EXAMPLES_SRC_DIR}/benchMTF.cc ${MTF_HEADERS}
+	${CXX}  $< -o $@ -w ${WARNING_FLAGS} ${MTF_RUNTIME_FLAGS} ${MTF_INCLUDE_FLAGS} ${EXAMPLES_INCLUDE_FLAGS} ${OPENCV_FLAGS} ${LIBS} ${MTF_LIB_LINK} ${BOOST_LIBS} ${LIBS_PARALLEL} ${MTF_LIBS_DIRS} ${MTF_LIBS} ${OPENCV_LIBS}
+	
+${BUILD_DIR}/${MTF_PREC_EXE_NAME}: ${EXAMPLES_SRC_DIR}/comparePrecision.cc ${MTF_HEADERS}
+	${CXX}  $< -o $@ -w ${WARNING_FLAGS} ${MTF_RUNTIME_FLAGS} ${MTF_INCLUDE_FLAGS} ${EXAMPLES_INCLUDE_FLAGS} ${OPENCV_FLAGS} ${LIBS} ${MTF_LIB_LINK} ${BOOST_LIBS} ${LIBS_PARALLEL} ${MTF_LIBS_DIRS} ${MTF_LIBS} ${OPENCV_LIBS}
+	
 ${BUILD_DIR}/${MTF_MOS_EXE_NAME}: ${EXAMPLES_SRC_DIR}/createMosaic.cc ${MTF_HEADERS}
 	${CXX}  $< -o $@ -w ${WARNING_FLAGS} ${MTF_RUNTIME_FLAGS} ${MTF_INCLUDE_FLAGS} ${EXAMPLES_INCLUDE_FLAGS} ${OPENCV_FLAGS} ${LIBS} ${MTF_LIB_LINK} ${BOOST_LIBS} ${LIBS_PARALLEL} ${MTF_LIBS_DIRS} ${MTF_LIBS} ${OPENCV_LIBS} 
 	
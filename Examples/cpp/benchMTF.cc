@@ -0,0 +1,385 @@
+/**
+application to benchmark the speed and accuracy of a grid of tracker configurations
+on synthetic sequences generated in memory by warping the first frame of the input
+so that the ground truth is known exactly and every configuration sees identical frames
+*/
+
+#include "mtf/mtf.h"
+// tools for reading in images from various sources like image sequences,
+// videos and cameras as well as for pre processing them
+#include "mtf/pipeline.h"
+#include "mtf/Config/parameters.h"
+#include "mtf/Utilities/miscUtils.h"
+#include "mtf/Utilities/imgUtils.h"
+#include "mtf/Utilities/excpUtils.h"
+
+#include <vector>
+#include <memory>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+
+#ifdef ENABLE_OMP
+#include <omp.h>
+#endif
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+#include "opencv2/core/core.hpp"
+
+using namespace std;
+using namespace mtf::params;
+
+typedef mtf::utils::TrackErrT TrackErrT;
+typedef unique_ptr<mtf::TrackerBase> Tracker_;
+typedef std::chrono::steady_clock BenchClock;
+
+struct BenchResult{
+	std::string sm, am, ssm, ilm;
+	int res, n_threads;
+	//! ok or the reason for which the configuration could not be run to completion
+	std::string status;
+	int n_frames;
+	//! all times are in milliseconds
+	double init_time, mean_time, p50_time, p90_time, p99_time, max_time;
+	double fps, success_rate, mean_err;
+	double peak_rss;
+	BenchResult() : res(0), n_threads(1), n_frames(0), init_time(0), mean_time(0), p50_time(0),
+		p90_time(0), p99_time(0), max_time(0), fps(0), success_rate(0), mean_err(0), peak_rss(0){}
+};
+
+/**
+peak resident set size of the process in MB; on Linux this is the high water mark
+since the last call to resetPeakRSS and otherwise since the process started
+*/
+double getPeakRSS(){
+#ifdef __linux__
+	std::ifstream status_file("/proc/self/status");
+	std::string line;
+	while(std::getline(status_file, line)){
+		if(line.compare(0, 6, "VmHWM:") == 0){
+			return atof(line.c_str() + 6) / 1024.0;
+		}
+	}
+#endif
+#ifndef _WIN32
+	struct rusage usage;
+	if(getrusage(RUSAGE_SELF, &usage) == 0){
+#ifdef __APPLE__
+		return usage.ru_maxrss / (1024.0*1024.0);
+#else
+		return usage.ru_maxrss / 1024.0;
+#endif
+	}
+#endif
+	return 0;
+}
+void resetPeakRSS(){
+#ifdef __linux__
+	std::ofstream clear_refs("/proc/self/clear_refs");
+	if(clear_refs){ clear_refs << "5"; }
+#endif
+}
+//! number of threads used by Eigen, OpenMP and all the modules that can run in parallel
+void setNThreads(int n_threads){
+	Eigen::setNbThreads(n_threads);
+#ifdef ENABLE_OMP
+	omp_set_num_threads(n_threads);
+#endif
+	pf_n_workers = prl_n_workers = nn_gnn_n_workers = n_threads;
+	mi_n_blocks = ccre_n_blocks = n_threads;
+}
+//! nearest rank percentile of sorted values
+double getPercentile(const vector<double> &sorted_vals, double percentile){
+	if(sorted_vals.empty()){ return 0; }
+	int rank = static_cast<int>(std::ceil(percentile * sorted_vals.size())) - 1;
+	return sorted_vals[std::max(0, std::min(rank, static_cast<int>(sorted_vals.size()) - 1))];
+}
+bool isInsideImage(const cv::Mat &corners, int img_width, int img_height, int border_size){
+	for(int corner_id = 0; corner_id < 4; ++corner_id){
+		double x = corners.at<double>(0, corner_id), y = corners.at<double>(1, corner_id);
+		if(x < border_size || y < border_size ||
+			x >= img_width - border_size || y >= img_height - border_size){
+			return false;
+		}
+	}
+	return true;
+}
+/**
+generates the frames of the synthetic sequence and their ground truth by applying a random walk
+of warps to the object and writing the warped object patch onto the first frame;
+the perturbations are drawn from a generator seeded with bench_seed so the sequence is reproducible
+*/
+void generateSequence(vector<cv::Mat> &frames, vector<cv::Mat> &gt_corners,
+	const cv::Mat &init_frame, const cv::Mat &init_corners, double obj_size_x, double obj_size_y){
+	//! sample the object at twice its size to avoid holes in the warped patch
+	resx = static_cast<unsigned int>(2 * obj_size_x);
+	resy = static_cast<unsigned int>(2 * obj_size_y);
+
+	mtf::SSM ssm(mtf::getSSM(syn_ssm.c_str()));
+	if(!ssm){
+		throw mtf::utils::InvalidArgument(cv::format("Invalid synthetic sequence SSM: %s", syn_ssm.c_str()));
+	}
+	ssm->initialize(init_corners);
+	mtf::AM am(mtf::getAM("ssd3", "0"));
+	if(!am){
+		throw mtf::utils::LogicError("Appearance model for the synthetic sequence could not be created");
+	}
+	PreProc_ pre_proc(mtf::getPreProc(am->inputType(), "none"));
+	pre_proc->initialize(init_frame);
+	am->setCurrImg(pre_proc->getFrame());
+	am->initializePixVals(ssm->getPts());
+	const mtf::PixValT original_patch = am->getInitPixVals();
+
+	VectorXd state_sigma(ssm->getStateSize());
+	ssm->estimateStateSigma(state_sigma, bench_pix_sigma);
+	VectorXd ssm_perturbation(ssm->getStateSize()), inv_ssm_perturbation(ssm->getStateSize());
+	std::mt19937 rand_gen(static_cast<unsigned int>(bench_seed));
+	std::normal_distribution<double> rand_dist(0, 1);
+	//! used for the noise
+	cv::theRNG() = cv::RNG(static_cast<uint64_t>(bench_seed) + 1);
+
+	const int border_size = 5, max_attempts = 100;
+	cv::Mat curr_corners(2, 4, CV_64FC1), write_mask;
+	frames.resize(bench_n_frames + 1);
+	gt_corners.resize(bench_n_frames + 1);
+	frames[0] = init_frame.clone();
+	gt_corners[0] = init_corners.clone();
+	for(int frame_id = 1; frame_id <= bench_n_frames; ++frame_id){
+		//! perturbations that would move the object out of the image are rejected
+		for(int attempt_id = 0; attempt_id < max_attempts; ++attempt_id){
+			for(unsigned int state_id = 0; state_id < ssm->getStateSize(); ++state_id){
+				ssm_perturbation(state_id) = state_sigma(state_id) * rand_dist(rand_gen);
+			}
+			ssm->compositionalUpdate(ssm_perturbation);
+			ssm->getCorners(curr_corners);
+			if(isInsideImage(curr_corners, init_frame.cols, init_frame.rows, border_size)){ break; }
+			ssm->invertState(inv_ssm_perturbation, ssm_perturbation);
+			ssm->compositionalUpdate(inv_ssm_perturbation);
+			ssm->getCorners(curr_corners);
+		}
+		frames[frame_id] = init_frame.clone();
+		mtf::utils::writePixelsToImage(frames[frame_id], original_patch, ssm->getPts(),
+			am->getNChannels(), write_mask);
+		if(bench_noise_sigma > 0){
+			mtf::utils::addGaussianNoise(frames[frame_id], frames[frame_id], am->getNChannels(),
+				0, bench_noise_sigma);
+		}
+		gt_corners[frame_id] = curr_corners.clone();
+	}
+}
+//! runs one configuration on the sequence; nothing is written to disk or shown while the frames are being timed
+BenchResult runConfig(const vector<cv::Mat> &frames, const vector<cv::Mat> &gt_corners,
+	const std::string &sm, const std::string &am, const std::string &ssm, const std::string &ilm,
+	int res, int n_threads){
+	BenchResult result;
+	result.sm = sm;
+	result.am = am;
+	result.ssm = ssm;
+	result.ilm = ilm;
+	result.res = res;
+	result.n_threads = n_threads;
+
+	resx = resy = static_cast<unsigned int>(res);
+	setNThreads(n_threads);
+	resetPeakRSS();
+
+	Tracker_ tracker;
+	PreProc_ pre_proc;
+	try{
+		tracker.reset(mtf::getTracker(sm.c_str(), am.c_str(), ssm.c_str(), ilm.c_str()));
+		if(!tracker){
+			result.status = "tracker could not be created";
+			return result;
+		}
+		pre_proc = mtf::getPreProc(tracker->inputType(), pre_proc_type);
+		BenchClock::time_point start_time = BenchClock::now();
+		pre_proc->initialize(frames[0], 0, false);
+		for(PreProc_ curr_obj = pre_proc; curr_obj; curr_obj = curr_obj->next){
+			tracker->setImage(curr_obj->getFrame());
+		}
+		tracker->initialize(gt_corners[0]);
+		result.init_time = std::chrono::duration<double, std::milli>(BenchClock::now() - start_time).count();
+	} catch(const mtf::utils::Exception &err){
+		result.status = cv::format("%s in initialization: %s", err.type(), err.what());
+		return result;
+	}
+	result.status = "ok";
+	const int n_frames = static_cast<int>(frames.size()) - 1;
+	vector<double> frame_times;
+	frame_times.reserve(n_frames);
+	int n_successes = 0;
+	double total_err = 0;
+	for(int frame_id = 1; frame_id <= n_frames; ++frame_id){
+		try{
+			BenchClock::time_point start_time = BenchClock::now();
+			pre_proc->update(frames[frame_id], frame_id);
+			tracker->update();
+			frame_times.push_back(std::chrono::duration<double, std::milli>(BenchClock::now() - start_time).count());
+		} catch(const mtf::utils::Exception &err){
+			//! remaining frames are counted as failures
+			result.status = cv::format("%s in frame %d: %s", err.type(), frame_id, err.what());
+			break;
+		}
+		double tracking_err = mtf::utils::getTrackingError(static_cast<TrackErrT>(tracking_err_type),
+			gt_corners[frame_id], tracker->getRegion(), nullptr, frame_id, frames[0].cols, frames[0].rows);
+		if(tracking_err <= bench_err_thresh){ ++n_successes; }
+		total_err += tracking_err;
+	}
+	result.peak_rss = getPeakRSS();
+	result.n_frames = static_cast<int>(frame_times.size());
+	if(frame_times.empty()){ return result; }
+
+	double total_time = std::accumulate(frame_times.begin(), frame_times.end(), 0.0);
+	result.mean_time = total_time / frame_times.size();
+	result.fps = 1000.0 * frame_times.size() / total_time;
+	result.success_rate = static_cast<double>(n_successes) / n_frames;
+	result.mean_err = total_err / frame_times.size();
+	std::sort(frame_times.begin(), frame_times.end());
+	result.p50_time = getPercentile(frame_times, 0.50);
+	result.p90_time = getPercentile(frame_times, 0.90);
+	result.p99_time = getPercentile(frame_times, 0.99);
+	result.max_time = frame_times.back();
+	return result;
+}
+std::string escapeJSON(const std::string &str){
+	std::string escaped;
+	for(char c : str){
+		if(c == '"' || c == '\\'){ escaped += '\\'; }
+		escaped += c;
+	}
+	return escaped;
+}
+bool writeResults(const vector<BenchResult> &results, const std::string &out_path){
+	bool write_json = out_path.size() >= 5 && out_path.compare(out_path.size() - 5, 5, ".json") == 0;
+	std::ofstream out_file(out_path);
+	if(!out_file){ return false; }
+	if(write_json){
+		out_file << "[\n";
+	} else{
+		out_file << "sm,am,ssm,ilm,res,n_threads,status,n_frames,init_ms,mean_ms,p50_ms,p90_ms,p99_ms,max_ms,"
+			"fps,success_rate,mean_err,peak_rss_mb\n";
+	}
+	for(unsigned int result_id = 0; result_id < results.size(); ++result_id){
+		const BenchResult &result = results[result_id];
+		if(write_json){
+			out_file << cv::format("  {\"sm\": \"%s\", \"am\": \"%s\", \"ssm\": \"%s\", \"ilm\": \"%s\", "
+				"\"res\": %d, \"n_threads\": %d, \"status\": \"%s\", \"n_frames\": %d, "
+				"\"init_ms\": %.6f, \"mean_ms\": %.6f, \"p50_ms\": %.6f, \"p90_ms\": %.6f, \"p99_ms\": %.6f, "
+				"\"max_ms\": %.6f, \"fps\": %.6f, \"success_rate\": %.6f, \"mean_err\": %.6f, \"peak_rss_mb\": %.3f}%s\n",
+				escapeJSON(result.sm).c_str(), escapeJSON(result.am).c_str(), escapeJSON(result.ssm).c_str(),
+				escapeJSON(result.ilm).c_str(), result.res, result.n_threads, escapeJSON(result.status).c_str(),
+				result.n_frames, result.init_time, result.mean_time, result.p50_time, result.p90_time,
+				result.p99_time, result.max_time, result.fps, result.success_rate, result.mean_err,
+				result.peak_rss, result_id + 1 < results.size() ? "," : "");
+		} else{
+			std::string status = result.status;
+			std::replace(status.begin(), status.end(), ',', ';');
+			std::replace(status.begin(), status.end(), '\n', ' ');
+			out_file << cv::format("%s,%s,%s,%s,%d,%d,%s,%d,%.6f,%.6f,%.6f,%.6f,%.6f,%.6f,%.6f,%.6f,%.6f,%.3f\n",
+				result.sm.c_str(), result.am.c_str(), result.ssm.c_str(), result.ilm.c_str(),
+				result.res, result.n_threads, status.c_str(), result.n_frames, result.init_time,
+				result.mean_time, result.p50_time, result.p90_time, result.p99_time, result.max_time,
+				result.fps, result.success_rate, result.mean_err, result.peak_rss);
+		}
+	}
+	if(write_json){ out_file << "]\n"; }
+	return static_cast<bool>(out_file);
+}
+
+int main(int argc, char * argv[]) {
+
+	printf("Starting MTF benchmark...\n");
+
+	if(!readParams(argc, argv)){ return EXIT_FAILURE; }
+
+#ifdef ENABLE_PARALLEL
+	Eigen::initParallel();
+#endif
+	if(bench_sm.empty()){ bench_sm.push_back(mtf_sm); }
+	if(bench_am.empty()){ bench_am.push_back(mtf_am); }
+	if(bench_ssm.empty()){ bench_ssm.push_back(mtf_ssm); }
+	if(bench_ilm.empty()){ bench_ilm.push_back(mtf_ilm); }
+	if(bench_res.empty()){ bench_res.push_back(static_cast<int>(resx)); }
+	if(bench_n_threads.empty()){ bench_n_threads.push_back(1); }
+	if(bench_n_frames <= 0){
+		printf("Invalid no. of frames: %d\n", bench_n_frames);
+		return EXIT_FAILURE;
+	}
+	printf("*******************************\n");
+	printf("Using parameters:\n");
+	printf("bench_n_frames: %d\n", bench_n_frames);
+	printf("bench_pix_sigma: %f\n", bench_pix_sigma);
+	printf("bench_noise_sigma: %f\n", bench_noise_sigma);
+	printf("bench_seed: %d\n", bench_seed);
+	printf("bench_err_thresh: %f\n", bench_err_thresh);
+	printf("bench_out_fname: %s\n", bench_out_fname.c_str());
+	printf("syn_ssm: %s\n", syn_ssm.c_str());
+	printf("********************************\n");
+
+	/* initialize pipeline*/
+	Input_ input(mtf::getInput(pipeline));
+	if(!input->initialize()){
+		printf("Pipeline could not be initialized successfully\n");
+		return EXIT_FAILURE;
+	}
+	const cv::Mat init_frame = input->getFrame().clone();
+	input.reset();
+
+	//! object is the centered rectangle with half the size of the image
+	double obj_size_x = init_frame.cols / 2.0, obj_size_y = init_frame.rows / 2.0;
+	cv::Mat init_corners(2, 4, CV_64FC1);
+	init_corners.at<double>(0, 0) = init_corners.at<double>(0, 3) = obj_size_x / 2.0;
+	init_corners.at<double>(0, 1) = init_corners.at<double>(0, 2) = obj_size_x * 1.5 - 1;
+	init_corners.at<double>(1, 0) = init_corners.at<double>(1, 1) = obj_size_y / 2.0;
+	init_corners.at<double>(1, 2) = init_corners.at<double>(1, 3) = obj_size_y * 1.5 - 1;
+
+	vector<cv::Mat> frames, gt_corners;
+	try{
+		generateSequence(frames, gt_corners, init_frame, init_corners, obj_size_x, obj_size_y);
+	} catch(const mtf::utils::Exception &err){
+		printf("Exception of type %s encountered while generating the synthetic sequence: %s\n",
+			err.type(), err.what());
+		return EXIT_FAILURE;
+	}
+	printf("Generated synthetic sequence with %d frames of size %d x %d\n",
+		bench_n_frames, init_frame.cols, init_frame.rows);
+
+	vector<BenchResult> results;
+	for(int n_threads : bench_n_threads){
+		for(int res : bench_res){
+			for(const std::string &sm : bench_sm){
+				for(const std::string &am : bench_am){
+					for(const std::string &ssm : bench_ssm){
+						for(const std::string &ilm : bench_ilm){
+							printf("\nRunning sm: %s am: %s ssm: %s ilm: %s res: %d n_threads: %d\n",
+								sm.c_str(), am.c_str(), ssm.c_str(), ilm.c_str(), res, n_threads);
+							results.push_back(runConfig(frames, gt_corners, sm, am, ssm, ilm, res, n_threads));
+						}
+					}
+				}
+			}
+		}
+	}
+	printf("\n%-8s %-8s %-6s %-4s %5s %3s %10s %10s %10s %10s %8s %7s %9s  %s\n",
+		"sm", "am", "ssm", "ilm", "res", "thr", "mean_ms", "p50_ms", "p99_ms", "fps", "sr", "err", "rss_mb", "status");
+	for(const BenchResult &result : results){
+		printf("%-8s %-8s %-6s %-4s %5d %3d %10.4f %10.4f %10.4f %10.2f %8.4f %7.3f %9.1f  %s\n",
+			result.sm.c_str(), result.am.c_str(), result.ssm.c_str(), result.ilm.c_str(),
+			result.res, result.n_threads, result.mean_time, result.p50_time, result.p99_time,
+			result.fps, result.success_rate, result.mean_err, result.peak_rss, result.status.c_str());
+	}
+	if(!bench_out_fname.empty()){
+		printf("Writing results to: %s\n", bench_out_fname.c_str());
+		if(!writeResults(results, bench_out_fname)){
+			printf("Results could not be written to %s\n", bench_out_fname.c_str());
+			return EXIT_FAILURE;
+		}
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,149 @@
+//! compares the speed and accuracy of the double and single precision variants
+//! of the fixed resolution trackers on the same sequence
+#include "mtf/mtf.h"
+#include "mtf/pipeline.h"
+#include "mtf/Config/parameters.h"
+#include "mtf/Utilities/miscUtils.h"
+#include "mtf/Utilities/excpUtils.h"
+
+#include <vector>
+#include <memory>
+
+using namespace std;
+using namespace mtf::params;
+
+typedef mtf::utils::TrackErrT TrackErrT;
+typedef unique_ptr<mtf::TrackerBase> Tracker_;
+
+//! running statistics of one tracker
+struct PrecisionStats{
+	const char *label;
+	double avg_fps, avg_err, max_err;
+	int fps_count, err_count, failure_count;
+	PrecisionStats(const char *_label) : label(_label), avg_fps(0), avg_err(0), max_err(0),
+		fps_count(0), err_count(0), failure_count(0){}
+	void addTime(double tracking_time){
+		double fps = 1.0 / tracking_time;
+		if(std::isinf(fps) || fps >= 1e6){ return; }
+		++fps_count;
+		avg_fps += (fps - avg_fps) / fps_count;
+	}
+	void addError(double err){
+		++err_count;
+		avg_err += (err - avg_err) / err_count;
+		if(err > max_err){ max_err = err; }
+		if(err > reinit_err_thresh){ ++failure_count; }
+	}
+	void print() const{
+		printf("%s precision:: avg_fps: %12.6f avg_err: %12.6f max_err: %12.6f failures: %d/%d\n",
+			label, avg_fps, avg_err, max_err, failure_count, err_count);
+	}
+};
+
+int main(int argc, char * argv[]) {
+	if(!readParams(argc, argv)){ return EXIT_FAILURE; }
+
+	printf("*******************************\n");
+	printf("Comparing fixed resolution tracker precision with:\n");
+	printf("source_name: %s\n", seq_name.c_str());
+	printf("mtf_sm: %s\n", mtf_sm);
+	printf("mtf_am: %s\n", mtf_am);
+	printf("mtf_ssm: %s\n", mtf_ssm);
+	printf("resolution: %d x %d\n", resx, resy);
+	printf("*******************************\n");
+
+	Input_ input;
+	mtf::utils::ObjUtils obj_utils(obj_cols, img_resize_factor);
+	try{
+		input.reset(mtf::getInput(pipeline));
+		if(!input->initialize()){
+			printf("Pipeline could not be initialized successfully. Exiting...\n");
+			return EXIT_FAILURE;
+		}
+		if(!mtf::getObjectsToTrack(obj_utils, input.get())){
+			printf("Object to be tracked could not be obtained.\n");
+			return EXIT_FAILURE;
+		}
+	} catch(const mtf::utils::Exception &err){
+		printf("Exception of type %s encountered while initializing the input pipeline: %s\n",
+			err.type(), err.what());
+		return EXIT_FAILURE;
+	}
+	bool gt_available = read_obj_from_gt && input->getNFrames() > 0 &&
+		obj_utils.getGTSize() >= input->getNFrames();
+	if(!gt_available){
+		printf("Full ground truth is not available so only the difference between the two variants will be reported\n");
+	}
+	//! the double and single precision trackers are created in this order
+	enable_fixed_res = true;
+	enable_nt = 0;
+	Tracker_ trackers[2];
+	PreProc_ pre_proc;
+	try{
+		for(int tracker_id = 0; tracker_id < 2; ++tracker_id){
+			fixed_res_float = tracker_id == 1;
+			trackers[tracker_id].reset(mtf::getTracker(mtf_sm, mtf_am, mtf_ssm, mtf_ilm));
+			if(!trackers[tracker_id] || trackers[tracker_id]->name != "flk"){
+				printf("Fixed resolution variant is not available for this configuration\n");
+				return EXIT_FAILURE;
+			}
+		}
+		pre_proc = mtf::getPreProc(trackers[0]->inputType(), pre_proc_type);
+		pre_proc->initialize(input->getFrame(), input->getFrameID());
+		for(int tracker_id = 0; tracker_id < 2; ++tracker_id){
+			trackers[tracker_id]->setImage(pre_proc->getFrame());
+			trackers[tracker_id]->initialize(obj_utils.getObj().corners);
+		}
+	} catch(const mtf::utils::Exception &err){
+		printf("Exception of type %s encountered while initializing the trackers: %s\n",
+			err.type(), err.what());
+		return EXIT_FAILURE;
+	}
+	PrecisionStats stats[2] = { PrecisionStats("double"), PrecisionStats("single") };
+	//! mean corner distance between the results of the two variants
+	double avg_diff = 0, max_diff = 0;
+	int diff_count = 0;
+	TrackErrT err_type = static_cast<TrackErrT>(tracking_err_type);
+
+	while(input->getNFrames() <= 0 || input->getFrameID() < input->getNFrames() - 1){
+		if(end_frame_id > 0 && input->getFrameID() >= end_frame_id){ break; }
+		if(!input->update()){
+			printf("Frame %d could not be read from the input pipeline\n", input->getFrameID() + 1);
+			break;
+		}
+		pre_proc->update(input->getFrame(), input->getFrameID());
+		for(int tracker_id = 0; tracker_id < 2; ++tracker_id){
+			double tracking_time;
+			try{
+				mtf_clock_get(start_time);
+				trackers[tracker_id]->update();
+				mtf_clock_get(end_time);
+				mtf_clock_measure(start_time, end_time, tracking_time);
+			} catch(const mtf::utils::Exception &err){
+				printf("Exception of type %s encountered while updating the %s precision tracker in frame %d: %s\n",
+					err.type(), stats[tracker_id].label, input->getFrameID() + 1, err.what());
+				return EXIT_FAILURE;
+			}
+			stats[tracker_id].addTime(tracking_time);
+			if(gt_available){
+				stats[tracker_id].addError(mtf::utils::getTrackingError(err_type,
+					obj_utils.getGT(input->getFrameID()), trackers[tracker_id]->getRegion()));
+			}
+		}
+		double diff = mtf::utils::getTrackingError(TrackErrT::MCD,
+			trackers[0]->getRegion(), trackers[1]->getRegion());
+		++diff_count;
+		avg_diff += (diff - avg_diff) / diff_count;
+		if(diff > max_diff){ max_diff = diff; }
+		if(print_fps){
+			printf("frame_id: %5d double fps: %12.6f single fps: %12.6f diff: %12.6f\n",
+				input->getFrameID() + 1, stats[0].avg_fps, stats[1].avg_fps, diff);
+		}
+	}
+	printf("\nResults over %d frames using %s error:\n", diff_count, mtf::utils::toString(err_type));
+	stats[0].print();
+	stats[1].print();
+	printf("speedup: %12.6f\n", stats[1].avg_fps / stats[0].avg_fps);
+	printf("mean corner difference between the two:: avg: %12.6f max: %12.6f\n", avg_diff, max_diff);
+	return EXIT_SUCCESS;
+}
@@ -31,6 +31,8 @@ VectorXd x_vec, y_vec;
 Diag diag;
 
 const char* getDataTypeName(int data_id, int adt_len, int diag_len);
+int getNWrittenFrames(const std::string &fname, const std::vector<int> &header,
+	long data_offset, long frame_size);
 void generateData(int data_id, int adt_len, int diag_len);
 void generateInverseData(int data_id, int adt_len, int diag_len);
 
@@ -99,6 +101,20 @@ int main(int argc, char * argv[]) {
 		diag_show_data, diag_show_corners, diag_show_patches,
 		diag_enable_validation, diag_validation_prec);
 	diag.reset(new  mtf::Diagnostics(am, ssm, &diag_params));
+	if(diag_n_workers > 1){
+		printf("Generating diagnostics data using %d workers\n", diag_n_workers);
+		std::vector<mtf::AM> worker_ams;
+		std::vector<mtf::SSM> worker_ssms;
+		for(int worker_id = 1; worker_id < diag_n_workers; ++worker_id){
+			worker_ams.push_back(mtf::AM(mtf::getAM(diag_am, diag_ilm)));
+			worker_ssms.push_back(mtf::SSM(mtf::getSSM(diag_ssm)));
+			if(!worker_ams.back() || !worker_ssms.back()){
+				printf("Diagnostics worker %d could not be initialized successfully\n", worker_id);
+				return EXIT_FAILURE;
+			}
+		}
+		diag->setWorkers(worker_ams, worker_ssms);
+	}
 
 	/* initialize frame pre processor*/
 	PreProc_ pre_proc = mtf::getPreProc(diag->inputType(), pre_proc_type);
@@ -183,41 +199,103 @@ int main(int argc, char * argv[]) {
 			diag_out_prefix = cv::format("%s_%s", diag_out_prefix.c_str(), diag_ilm);
 		}
 	}
-	std::string bin_out_fname;
+	std::vector<std::string> bin_out_fnames(diag_len);
 	std::vector<std::shared_ptr<std::ofstream> > out_files;
 	out_files.resize(diag_len);
+	//! time taken to process each frame is written to a separate file so that
+	//! the size of each data file depends only on the no. of frames written to it
+	std::string times_fname = cv::format("%s/%s_%d%s_times_%d_%d_%d.bin",
+		diag_data_dir.c_str(), diag_out_prefix.c_str(), diag_update_type, diag_inv ? "_inv" : "",
+		diag_frame_gap, start_id, end_id);
+	std::ofstream times_file;
+	//! each binary output file has a header, followed by the x and y values for 3D data,
+	//! and then the data for each frame
+	auto getDataLayout = [&](int data_id, long &data_offset, long &frame_size){
+		if(diag_3d){
+			data_offset = sizeof(int) * 4 + sizeof(double) * 2 * diag_res;
+			frame_size = sizeof(double)*diag_res*diag_res;
+		} else{
+			int data_size = data_id == diag_len - 1 ? diag->ssm_state_size : diag->state_size;
+			data_offset = sizeof(int) * 2;
+			frame_size = sizeof(double)*diag_res * 2 * data_size;
+		}
+	};
+	//! no. of frames whose data is already present in all the output files from an earlier run
+	int n_resumed_frames = 0;
 	if(diag_bin){
+		n_resumed_frames = end_id - start_id + 1;
 		for(int data_id = 0; data_id < diag_len; data_id++){
-			if(diag_gen[data_id] - '0'){
-				const char* data_name = getDataTypeName(data_id, adt_len, diag_len);
-				if(diag_inv){
-					bin_out_fname = cv::format("%s/%s_%d_inv_%s_%d_%d_%d.bin",
-						diag_data_dir.c_str(), diag_out_prefix.c_str(), diag_update_type, data_name, 
-						diag_frame_gap, start_id, end_id);
-				} else{
-					bin_out_fname = cv::format("%s/%s_%d_%s_%d_%d_%d.bin",
-						diag_data_dir.c_str(), diag_out_prefix.c_str(), diag_update_type, data_name,
-						diag_frame_gap, start_id, end_id);
-				}
-
-				if(diag_inv){
-					printf("Writing inv_%s data to %s\n", data_name, bin_out_fname.c_str());
-				} else{
-					printf("Writing %s data to %s\n", data_name, bin_out_fname.c_str());
-				}
-				out_files[data_id].reset(new std::ofstream(bin_out_fname, ios::out | ios::binary));
-				if(diag_3d){
-					Vector4i header(start_id - 1, start_id, diag_res, diag_res);
-					out_files[data_id]->write((char*)(header.data()), sizeof(int) * 4);
-				} else{
-					out_files[data_id]->write((char*)(&diag_res), sizeof(int));
-					out_files[data_id]->write((char*)(&(diag->state_size)), sizeof(int));
-				}
+			if(!(diag_gen[data_id] - '0')){ continue; }
+			const char* data_name = getDataTypeName(data_id, adt_len, diag_len);
+			if(diag_inv){
+				bin_out_fnames[data_id] = cv::format("%s/%s_%d_inv_%s_%d_%d_%d.bin",
+					diag_data_dir.c_str(), diag_out_prefix.c_str(), diag_update_type, data_name, 
+					diag_frame_gap, start_id, end_id);
+			} else{
+				bin_out_fnames[data_id] = cv::format("%s/%s_%d_%s_%d_%d_%d.bin",
+					diag_data_dir.c_str(), diag_out_prefix.c_str(), diag_update_type, data_name,
+					diag_frame_gap, start_id, end_id);
+			}
+			if(diag_resume){
+				long data_offset, frame_size;
+				getDataLayout(data_id, data_offset, frame_size);
+				std::vector<int> header = diag_3d ? std::vector<int>{ -1, start_id, diag_res, diag_res } :
+					std::vector<int>{ diag_res, static_cast<int>(diag->state_size) };
+				n_resumed_frames = std::min(n_resumed_frames, getNWrittenFrames(bin_out_fnames[data_id],
+					header, data_offset, frame_size));
+			}
+		}
+		if(diag_resume){
+			//! a frame is complete only if its processing time was written too;
+			//! this also excludes the processing times appended to the data files by older versions
+			n_resumed_frames = std::min(n_resumed_frames, getNWrittenFrames(times_fname,
+				std::vector<int>(), 0, sizeof(double)));
+		}
+		if(!diag_resume){
+			n_resumed_frames = 0;
+		} else if(n_resumed_frames == end_id - start_id + 1){
+			printf("Diagnostics data for all the frames has already been generated\n");
+			return EXIT_SUCCESS;
+		} else if(n_resumed_frames > 0){
+			printf("Resuming from frame %d\n", start_id + n_resumed_frames);
+		}
+		for(int data_id = 0; data_id < diag_len; data_id++){
+			if(!(diag_gen[data_id] - '0')){ continue; }
+			const char* data_name = getDataTypeName(data_id, adt_len, diag_len);
+			if(diag_inv){
+				printf("Writing inv_%s data to %s\n", data_name, bin_out_fnames[data_id].c_str());
+			} else{
+				printf("Writing %s data to %s\n", data_name, bin_out_fnames[data_id].c_str());
+			}
+			if(n_resumed_frames > 0){
+				//! discard any partially written frame along with the data written after the last frame
+				long data_offset, frame_size;
+				getDataLayout(data_id, data_offset, frame_size);
+				fs::resize_file(bin_out_fnames[data_id], data_offset + frame_size*n_resumed_frames);
+				out_files[data_id].reset(new std::ofstream(bin_out_fnames[data_id],
+					ios::in | ios::out | ios::binary));
+				out_files[data_id]->seekp(0, ios_base::end);
+				continue;
 			}
+			out_files[data_id].reset(new std::ofstream(bin_out_fnames[data_id], ios::out | ios::binary));
+			if(diag_3d){
+				Vector4i header(start_id - 1, start_id, diag_res, diag_res);
+				out_files[data_id]->write((char*)(header.data()), sizeof(int) * 4);
+			} else{
+				out_files[data_id]->write((char*)(&diag_res), sizeof(int));
+				out_files[data_id]->write((char*)(&(diag->state_size)), sizeof(int));
+			}
+		}
+		if(n_resumed_frames > 0){
+			fs::resize_file(times_fname, sizeof(double)*n_resumed_frames);
+			times_file.open(times_fname, ios::out | ios::app | ios::binary);
+		} else{
+			times_file.open(times_fname, ios::out | ios::binary);
 		}
 	}
+	int resume_id = start_id + n_resumed_frames;
 
-	for(int i = diag_start_id; i < start_id; i++){
+	for(int i = diag_start_id; i < resume_id; i++){
 		if(!input->update()){
 			printf("Frame %d could not be read from the input pipeline", input->getFrameID() + 1);
 			return EXIT_FAILURE;
@@ -226,9 +304,8 @@ int main(int argc, char * argv[]) {
 	pre_proc->update(input->getFrame(), input->getFrameID());
 
 	printf("frame_id: %d\n", input->getFrameID());
-	vector<double> proc_times;
 	double total_time_taken = 0;
-	for(int frame_id = start_id; frame_id <= end_id; frame_id++){
+	for(int frame_id = resume_id; frame_id <= end_id; frame_id++){
 		printf("Processing frame: %d\n", frame_id);
 		//update diagnostics module
 		diag->update(obj_utils.getGT(frame_id - diag_frame_gap));
@@ -272,7 +349,9 @@ int main(int argc, char * argv[]) {
 		mtf_clock_get(frame_end_time);
 		double frame_time_taken;
 		mtf_clock_measure(frame_start_time, frame_end_time, frame_time_taken);
-		proc_times.push_back(frame_time_taken);
+		if(diag_bin){
+			times_file.write((char*)(&frame_time_taken), sizeof(double));
+		}
 		if(diag_verbose){
 			printf("Done frame %d. Time taken:\t %f\n", frame_id, frame_time_taken);
 		}
@@ -293,11 +372,11 @@ int main(int argc, char * argv[]) {
 	if(diag_bin){
 		for(int data_id = 0; data_id < diag_len; data_id++){
 			if(diag_gen[data_id] - '0'){
-				out_files[data_id]->write((char*)(proc_times.data()), sizeof(double)*proc_times.size());
 				out_files[data_id]->close();
 			}
 		}
 		out_files.clear();
+		times_file.close();
 	}
 	if(diag_verbose){
 		printf("Total Time taken:\t %f\n", total_time_taken);
@@ -361,6 +440,25 @@ void generateInverseData(int data_id, int adt_len, int diag_len){
 	}
 }
 
+//! no. of complete frames in an existing binary output file;
+//! throws if its header does not match the expected one where negative entries are not checked
+int getNWrittenFrames(const std::string &fname, const std::vector<int> &header,
+	long data_offset, long frame_size){
+	if(!fs::exists(fname)){ return 0; }
+	std::vector<int> file_header(header.size());
+	std::ifstream in_file(fname, ios::in | ios::binary);
+	in_file.read((char*)(file_header.data()), sizeof(int)*header.size());
+	if(!in_file){ return 0; }
+	for(unsigned int id = 0; id < header.size(); ++id){
+		if(header[id] >= 0 && file_header[id] != header[id]){
+			throw mtf::utils::InvalidArgument(cv::format(
+				"getNWrittenFrames:: Existing output file %s was generated with different settings", fname.c_str()));
+		}
+	}
+	long file_size = static_cast<long>(fs::file_size(fname));
+	return file_size < data_offset ? 0 : static_cast<int>((file_size - data_offset) / frame_size);
+}
+
 const char* getDataTypeName(int data_id, int adt_len, int diag_len){
 	if(data_id < adt_len){// analytical
 		return diag->toString(static_cast<ADT>(data_id));
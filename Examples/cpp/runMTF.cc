@@ -8,8 +8,11 @@
 #include "mtf/Config/parameters.h"
 //! general utilities for image drawing, etc.
 #include "mtf/Utilities/miscUtils.h"
+#include "mtf/Utilities/profUtils.h"
 //! MTF specific exceptions
 #include "mtf/Utilities/excpUtils.h"
+//! queue for passing frames to the recording thread in pipelined mode
+#include "mtf/Utilities/queueUtils.h"
 
 #include "opencv2/core/core.hpp"
 #include "opencv2/highgui/highgui.hpp"
@@ -19,6 +22,7 @@
 
 #include <vector>
 #include <memory>
+#include <thread>
 /**
 any FPS larger than this is considered meaningless and
 not used for computing the average
@@ -32,6 +36,24 @@ namespace fs = boost::filesystem;
 typedef mtf::utils::TrackErrT TrackErrT;
 typedef unique_ptr<mtf::TrackerBase> Tracker_;
 
+//! output stage of the pipelined frame loop that writes the tracking video in a separate thread
+struct FrameRecorder{
+	FrameRecorder(cv::VideoWriter &output, unsigned int queue_size) :
+		frames(queue_size), record_thread([this, &output](){
+		cv::Mat frame;
+		while(frames.pop(frame)){ output.write(frame); }
+	}){}
+	//! the frames still in the queue are written before returning
+	~FrameRecorder(){
+		frames.close();
+		record_thread.join();
+	}
+	void write(const cv::Mat &frame){ frames.push(frame.clone()); }
+private:
+	mtf::utils::BoundedQueue<cv::Mat> frames;
+	std::thread record_thread;
+};
+
 int main(int argc, char * argv[]) {
 	printf("\nStarting MTF...\n");
 
@@ -40,6 +62,11 @@ int main(int argc, char * argv[]) {
 	// *************************************************************************************************** //
 
 	if(!readParams(argc, argv)){ return EXIT_FAILURE; }
+	if(prof_enable){
+		printf("Writing profiler summaries to %s\n", prof_fname.c_str());
+		mtf::utils::prof::setOutput(prof_fname, prof_interval);
+		mtf::utils::prof::setEnabled(true);
+	}
 
 #ifdef ENABLE_PARALLEL
 	Eigen::initParallel();
@@ -144,6 +171,15 @@ int main(int argc, char * argv[]) {
 	FILE *multi_fid = nullptr;
 	vector<Tracker_> trackers(n_trackers);
 	vector<PreProc_> pre_procs(n_trackers);
+	/**
+	private copies of the pre processors used by the pre processing stage of the pipelined frame loop;
+	these are created alongside those of the trackers since the pre processing type can differ between trackers
+	*/
+	vector<PreProc_> stage_pre_procs(pipeline_queue_size > 0 ? n_trackers : 0);
+	//! the pipelined pre processing stage processes complete frames before the trackers are updated
+	bool pre_proc_roi = pre_proc_roi_margin > 0 && pipeline_queue_size <= 0;
+	//! location of each tracker before its last update used to extend its region by the motion in that update
+	vector<cv::Mat> roi_prev_corners(pre_proc_roi ? n_trackers : 0);
 	for(unsigned int tracker_id = 0; tracker_id < n_trackers; ++tracker_id) {
 		if(n_trackers > 1){ multi_fid = readTrackerParams(multi_fid); }
 		try{
@@ -163,6 +199,11 @@ int main(int argc, char * argv[]) {
 		try{
 			pre_procs[tracker_id] = mtf::getPreProc(pre_procs, trackers[tracker_id]->inputType(), pre_proc_type);
 			pre_procs[tracker_id]->initialize(input->getFrame(), input->getFrameID());
+			if(pre_proc_roi){ pre_procs[tracker_id]->setROIMargin(pre_proc_roi_margin); }
+			if(pipeline_queue_size > 0){
+				stage_pre_procs[tracker_id] = mtf::getPreProc(stage_pre_procs, trackers[tracker_id]->inputType(), pre_proc_type);
+				stage_pre_procs[tracker_id]->initialize(input->getFrame(), input->getFrameID(), false);
+			}
 		} catch(const mtf::utils::Exception &err){
 			printf("Exception of type %s encountered while initializing the pre processor: %s\n",
 				err.type(), err.what());
@@ -454,6 +495,27 @@ int main(int argc, char * argv[]) {
 	bool tracking_error_needed = show_tracking_error || write_tracking_error || reinit_on_failure || write_tracking_sr;
 	bool gt_corners_needed = tracking_error_needed || show_ground_truth;
 
+	/**
+	in pipelined mode, the next frames are read and pre processed in background threads
+	while the current one is being tracked and the output video is written in another one;
+	frames still reach the trackers strictly in order since each stage is a FIFO queue
+	*/
+	unique_ptr<FrameRecorder> recorder;
+	if(pipeline_queue_size > 0){
+		printf("Using pipelined frame loop with queue size %d\n", pipeline_queue_size);
+		try{
+			input.reset(new mtf::PipelinedInput(input.release(), stage_pre_procs, pre_procs, pipeline_queue_size));
+			input->initialize();
+		} catch(const mtf::utils::Exception &err){
+			printf("Exception of type %s encountered while initializing the pipelined input: %s\n",
+				err.type(), err.what());
+			return EXIT_FAILURE;
+		}
+		if(record_frames){
+			recorder.reset(new FrameRecorder(output, pipeline_queue_size));
+		}
+	}
+
 	// ********************************************************************************************** //
 	// *************************************** start tracking ! ************************************* //
 	// ********************************************************************************************** //
@@ -533,6 +595,7 @@ int main(int argc, char * argv[]) {
 							trackers[0]->setImage(curr_obj->getFrame());
 						}
 					}
+					if(pre_proc_roi){ pre_procs[0]->ensureROI(obj_utils.getGT(reinit_frame_id)); }
 					trackers[0]->initialize(obj_utils.getGT(reinit_frame_id));
 					tracker_corners = trackers[0]->getRegion().clone();
 				} catch(const mtf::utils::Exception &err){
@@ -571,6 +634,7 @@ int main(int argc, char * argv[]) {
 							trackers[0]->setImage(pre_proc->getFrame());
 						}
 					}
+					if(pre_proc_roi){ pre_procs[0]->ensureROI(obj_utils.getGT(input->getFrameID())); }
 					trackers[0]->initialize(obj_utils.getGT(input->getFrameID()));
 					tracker_corners = trackers[0]->getRegion().clone();
 					if(resized_images){ tracker_corners /= img_resize_factor; }
@@ -586,6 +650,7 @@ int main(int argc, char * argv[]) {
 				try{
 					cv::Mat reset_location = reset_to_init ? obj_utils.getGT(init_frame_id) :
 						obj_utils.getGT(input->getFrameID());
+					if(pre_proc_roi){ pre_procs[0]->ensureROI(reset_location); }
 					trackers[0]->setRegion(reset_location);
 					tracker_corners = trackers[0]->getRegion().clone();
 					if(resized_images){ tracker_corners /= img_resize_factor; }
@@ -606,7 +671,11 @@ int main(int argc, char * argv[]) {
 
 		if(record_frames || mtf_visualize) {
 			if(record_frames && write_tracking_data){
-				output.write(input->getFrame());
+				if(recorder){
+					recorder->write(input->getFrame());
+				} else{
+					output.write(input->getFrame());
+				}
 			}
 			/**
 			draw tracker positions on OpenCV window
@@ -649,7 +718,11 @@ int main(int argc, char * argv[]) {
 			}
 
 			if(record_frames && !write_tracking_data){
-				output.write(input->getFrame());
+				if(recorder){
+					recorder->write(input->getFrame());
+				} else{
+					output.write(input->getFrame());
+				}
 			}
 			if(mtf_visualize){
 				imshow(cv_win_name, input->getFrame());
@@ -688,6 +761,23 @@ int main(int argc, char * argv[]) {
 				break;
 			}
 		}
+		if(pre_proc_roi){
+			/**
+			all regions must be registered before the first update since pre processors can be shared between trackers;
+			each one covers the current location of the tracker as well as where it would be if it moved as much
+			as in the last frame since the tracker must not sample outside the processed part of the frame
+			*/
+			for(unsigned int tracker_id = 0; tracker_id < n_trackers; ++tracker_id) {
+				cv::Mat curr_corners = trackers[tracker_id]->getRegion().clone();
+				cv::Mat roi_corners = curr_corners;
+				if(!roi_prev_corners[tracker_id].empty()){
+					cv::Mat predicted_corners = 2 * curr_corners - roi_prev_corners[tracker_id];
+					cv::hconcat(curr_corners, predicted_corners, roi_corners);
+				}
+				pre_procs[tracker_id]->setROI(tracker_id, roi_corners);
+				roi_prev_corners[tracker_id] = curr_corners;
+			}
+		}
 		//! update trackers       
 		for(unsigned int tracker_id = 0; tracker_id < n_trackers; ++tracker_id) {
 			//! update pre processor
@@ -705,6 +795,15 @@ int main(int argc, char * argv[]) {
 				mtf_clock_get(end_time);
 				mtf_clock_measure(start_time, end_time, tracking_time);
 				mtf_clock_measure(start_time_with_input, end_time, tracking_time_with_input);
+				if(pre_proc_roi && pre_procs[tracker_id]->ensureROI(trackers[tracker_id]->getRegion())){
+					/**
+					the tracker moved beyond its region so part of this update used pixels that had not been processed;
+					the region is grown to cover its new location but the update is not repeated since trackers
+					with online learning would then learn this frame twice
+					*/
+					printf("Tracker %u moved outside the pre processed region in frame %d so pre_proc_roi_margin should be increased\n",
+						tracker_id, input->getFrameID() + 1);
+				}
 			} catch(const mtf::utils::InvalidTrackerState &err){
 				//! exception thrown by MTF modsules when the tracker ends up in an invalid state 
 				//! due to NaNs or Infs in the result of some numerical computation
@@ -732,6 +831,10 @@ int main(int argc, char * argv[]) {
 	}
 	cv::destroyAllWindows();
 
+	if(prof_enable){
+		mtf::utils::prof::writeSummary(prof_fname);
+		mtf::utils::prof::writeSummary("");
+	}
 	printf("Average FPS: %15.10f\n", avg_fps);
 	printf("Average FPS with Input: %15.10f\n", avg_fps_win);
 	if(show_tracking_error){
@@ -812,6 +915,7 @@ int main(int argc, char * argv[]) {
 		fclose(tracking_error_fid);
 	}
 	if(record_frames){
+		recorder.reset();
 		output.release();
 	}
 	pre_procs.clear();
@@ -70,49 +70,29 @@
 		1e-9*(double)(end_time.tv_nsec - start_time.tv_nsec))
 #endif
 
-#ifdef ENABLE_PROFILING
-#define init_profiling() \
-	timespec _event_start_time, _event_end_time;\
-	double _event_interval; \
-	std::vector<double> proc_times;\
-	std::vector<char*> proc_labels
-#define inherit_profiling(BASE_CLASS) \
-	using BASE_CLASS ::_event_start_time;\
-	using BASE_CLASS ::_event_end_time;\
-	using BASE_CLASS ::_event_interval;\
-	using BASE_CLASS :: proc_times;\
-	using BASE_CLASS :: proc_labels
-#define write_frame_id(frame_id) \
-	utils::printScalarToFile(frame_id, "\n\nframe_id", time_fname, "%6d", "a");
-#define init_timer() \
-	proc_times.clear();\
-	proc_labels.clear();\
-	clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &_event_start_time)
-#define start_timer() \
-	clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &_event_start_time)
-#define end_timer() \
-	clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &_event_end_time);\
-	_event_interval = (double)(_event_end_time.tv_sec - _event_start_time.tv_sec) + 1e-9*(double)(_event_end_time.tv_nsec - _event_start_time.tv_nsec);
-#define write_interval(time_fname, mode) \
-	utils::printScalarToFile(_event_interval, "init_time", time_fname, "%15.9f", mode)
-#define record_event(label) \
-	clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &_event_end_time);\
-	proc_times.push_back((double)(_event_end_time.tv_sec - _event_start_time.tv_sec) + 1e-9*(double)(_event_end_time.tv_nsec - _event_start_time.tv_nsec));\
-	proc_labels.push_back(label);\
-	clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &_event_start_time)
-#define write_data(time_fname) \
-	utils::writeTimesToFile(proc_times, proc_labels, time_fname, i)
-#else
+/**
+stages timed by the runtime profiler in utils::prof that is switched on and off by setEnabled there;
+the files using these must include mtf/Utilities/profUtils.h;
+the time taken by each stage is measured from the previous record_event or init_timer in the same thread
+and the label must be a string literal since it is registered only the first time each call site is reached
+*/
 #define init_profiling()
 #define inherit_profiling(BASE_CLASS)
-#define write_frame_id(frame_id)
-#define init_timer()
-#define start_timer()
-#define end_timer()
+#define write_frame_id(frame_id) \
+	mtf::utils::prof::update()
+#define init_timer() \
+	do{ if(mtf::utils::prof::isEnabled()){ mtf::utils::prof::startTimer(); } } while(false)
+#define start_timer() init_timer()
+#define end_timer() record_event("initialize")
 #define write_interval(time_fname, mode)
-#define record_event(label) 
+#define record_event(label) \
+	do{\
+		if(mtf::utils::prof::isEnabled()){\
+			static const int _prof_stage_id = mtf::utils::prof::getStageId(label);\
+			mtf::utils::prof::recordEvent(_prof_stage_id);\
+		}\
+	} while(false)
 #define write_data(time_fname)
-#endif
 
 #define eig_set_zero(eig_mat, scalar_type) \
 	memset(eig_mat.data(), 0, eig_mat.size()*sizeof(scalar_type))
@@ -6,10 +6,11 @@ option(WITH_REGNET "Enable regression network search method (requires a custom v
 
 set(SEARCH_METHODS "")
 set(SEARCH_METHODS_NT ESM AESM FCLK ICLK FALK IALK FCSD PF NN GNN)
-set(SEARCH_PARAMS FCLK ICLK FALK IALK ESM NN GNN PF Cascade Parallel Pyramidal)
+set(SEARCH_PARAMS FCLK ICLK FALK IALK ESM NN GNN PF Cascade Parallel Pyramidal FixedLK)
 set(COMPOSITE_SEARCH_METHODS CascadeTracker ParallelTracker PyramidalTracker LineTracker)
 if(WITH_TEMPLATED)
-	set(SEARCH_METHODS ${SEARCH_METHODS} ESM FCLK ICLK FALK IALK PF)
+	set(SEARCH_METHODS ${SEARCH_METHODS} ESM FCLK ICLK FALK IALK PF FixedLK BatchTracker)
+	set(SEARCH_PARAMS ${SEARCH_PARAMS} BatchTracker)
 	set(COMPOSITE_SEARCH_METHODS ${COMPOSITE_SEARCH_METHODS} PyramidalSM ParallelSM CascadeSM)
 else(WITH_TEMPLATED)
 	message(STATUS "Templated implementations of SMs are disabled")
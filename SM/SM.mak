@@ -32,8 +32,8 @@ pfomp ?= 0
 SM_INCLUDE_DIR = SM/include
 SM_SRC_DIR = SM/src
 SM_HEADER_DIR = ${SM_INCLUDE_DIR}/mtf/SM
-SM_BASE_HEADERS =  ${SM_HEADER_DIR}/SearchMethod.h ${ROOT_HEADER_DIR}/TrackerBase.h
-SM_NT_BASE_HEADERS =  ${SM_HEADER_DIR}/NT/SearchMethod.h ${ROOT_HEADER_DIR}/TrackerBase.h
+SM_BASE_HEADERS =  ${SM_HEADER_DIR}/SearchMethod.h ${SM_HEADER_DIR}/GNOptimizer.h ${ROOT_HEADER_DIR}/TrackerBase.h
+SM_NT_BASE_HEADERS =  ${SM_HEADER_DIR}/NT/SearchMethod.h ${SM_HEADER_DIR}/GNOptimizer.h ${ROOT_HEADER_DIR}/TrackerBase.h
 COMPOSITE_BASE_HEADERS =  ${SM_HEADER_DIR}/CompositeBase.h
 
 MTF_INCLUDE_DIRS += ${SM_INCLUDE_DIR}
@@ -42,7 +42,7 @@ BASE_HEADERS += ${SM_HEADER_DIR}/SearchMethod.h
 SEARCH_METHODS = 
 COMPOSITE = CascadeTracker ParallelTracker PyramidalTracker LineTracker
 SEARCH_METHODS_NT = FCLK ICLK FALK IALK ESM PF NN GNN FCSD AESM
-SEARCH_PARAMS = FCLK ICLK FALK IALK ESM PF NN GNN Cascade Parallel Pyramidal
+SEARCH_PARAMS = FCLK ICLK FALK IALK ESM PF NN GNN Cascade Parallel Pyramidal FixedLK
 
 SEARCH_OBJS = $(addprefix ${BUILD_DIR}/,$(addsuffix .o, ${SEARCH_METHODS}))
 SEARCH_NT_OBJS = $(addprefix ${BUILD_DIR}/,$(addsuffix _NT.o, ${SEARCH_METHODS_NT}))
@@ -58,7 +58,8 @@ only_nt = 1
 endif
 
 ifeq (${only_nt}, 0)
-	SEARCH_METHODS += FCLK ICLK FALK IALK ESM PF 
+	SEARCH_METHODS += FCLK ICLK FALK IALK ESM PF FixedLK BatchTracker
+	SEARCH_PARAMS += BatchTracker
 	COMPOSITE +=  RKLT CascadeSM  ParallelSM  PyramidalSM
 	COMPOSITE_BASE_HEADERS +=  ${SM_HEADER_DIR}/CompositeSM.h
 	ifeq (${grid}, 1)
@@ -133,14 +134,12 @@ FA_FLAGS =
 NN_FLAGS = 
 
 el ?= 0
-et ?= 0
 ed ?= 0
 emg ?= 1
 icd ?= 0
 icl ?= 0
 ict ?= 0
 fcd ?= 0
-fct ?= 0
 fad ?= 0
 fat ?= 0
 iat ?= 0
@@ -184,14 +183,11 @@ MTF_RUNTIME_FLAGS += -D ENABLE_PARALLEL -fopenmp
 MTF_LIBS += -fopenmp
 endif
 
-ifeq (${et}, 1)
-ESM_FLAGS += -D ENABLE_PROFILING
-endif
 ifeq (${ed}, 1)
 ESM_FLAGS += -D LOG_ESM_DATA
 endif
 ifeq (${el}, 1)
-ESM_FLAGS += -D LOG_ESM_DATA -D ENABLE_PROFILING
+ESM_FLAGS += -D LOG_ESM_DATA
 endif
 ifeq (${emg}, 0)
 ESM_FLAGS += -D DISABLE_MEAN_GRADIENT
@@ -207,9 +203,6 @@ endif
 ifeq (${fcd}, 1)
 FC_FLAGS += -D LOG_FCLK_DATA
 endif
-ifeq (${fct}, 1)
-FC_FLAGS += -D ENABLE_PROFILING 
-endif
 
 ifeq (${fad}, 1)
 FA_FLAGS += -D LOG_FALK_DATA
@@ -220,9 +213,6 @@ endif
 ifeq (${iat}, 1)
 IA_FLAGS += -D LOG_IALK_TIMES 
 endif
-ifeq (${nnt}, 1)
-NN_FLAGS += -D ENABLE_PROFILING
-endif
 
 
 ${BUILD_DIR}/ICLK.o: ${SM_SRC_DIR}/ICLK.cc ${SM_HEADER_DIR}/ICLK.h ${SM_HEADER_DIR}/ICLKParams.h ${APPEARANCE_HEADERS} ${STATE_SPACE_HEADERS} ${SM_BASE_HEADERS} ${UTILITIES_HEADER_DIR}/excpUtils.h  ${UTILITIES_HEADER_DIR}/miscUtils.h ${MACROS_HEADER_DIR}/common.h ${MACROS_HEADER_DIR}/register.h
@@ -249,6 +239,12 @@ ${BUILD_DIR}/ESM.o: ${SM_SRC_DIR}/ESM.cc ${SM_HEADER_DIR}/ESM.h ${SM_HEADER_DIR}
 ${BUILD_DIR}/PF.o: ${SM_SRC_DIR}/PF.cc ${SM_HEADER_DIR}/PF.h ${SM_HEADER_DIR}/PFParams.h ${APPEARANCE_HEADERS} ${STATE_SPACE_HEADERS} ${SM_BASE_HEADERS} ${UTILITIES_HEADER_DIR}/excpUtils.h  ${UTILITIES_HEADER_DIR}/miscUtils.h ${MACROS_HEADER_DIR}/common.h ${MACROS_HEADER_DIR}/register.h
 	${CXX} -c ${MTF_PIC_FLAG} ${WARNING_FLAGS} ${OPT_FLAGS} ${PROF_FLAGS} ${MTF_COMPILETIME_FLAGS} ${MTF_INCLUDE_FLAGS} ${PF_FLAGS} $< ${OPENCV_FLAGS} -o $@
 	
+${BUILD_DIR}/FixedLK.o: ${SM_SRC_DIR}/FixedLK.cc ${SM_HEADER_DIR}/FixedLK.h ${SM_HEADER_DIR}/FixedLKParams.h ${APPEARANCE_HEADERS} ${STATE_SPACE_HEADERS} ${SM_BASE_HEADERS} ${UTILITIES_HEADER_DIR}/excpUtils.h ${MACROS_HEADER_DIR}/common.h
+	${CXX} -c ${MTF_PIC_FLAG} ${WARNING_FLAGS} ${OPT_FLAGS} ${PROF_FLAGS} ${MTF_COMPILETIME_FLAGS} ${MTF_INCLUDE_FLAGS} $< ${OPENCV_FLAGS} -o $@
+	
+${BUILD_DIR}/BatchTracker.o: ${SM_SRC_DIR}/BatchTracker.cc ${SM_HEADER_DIR}/BatchTracker.h ${SM_HEADER_DIR}/BatchTrackerParams.h ${APPEARANCE_HEADERS} ${STATE_SPACE_HEADERS} ${UTILITIES_HEADER_DIR}/excpUtils.h ${UTILITIES_HEADER_DIR}/miscUtils.h ${MACROS_HEADER_DIR}/common.h ${MACROS_HEADER_DIR}/register.h
+	${CXX} -c ${MTF_PIC_FLAG} ${WARNING_FLAGS} ${OPT_FLAGS} ${PROF_FLAGS} ${MTF_COMPILETIME_FLAGS} ${MTF_INCLUDE_FLAGS} $< ${OPENCV_FLAGS} -o $@
+	
 ${BUILD_DIR}/NN.o: ${SM_SRC_DIR}/NN.cc ${SM_HEADER_DIR}/NN.h ${SM_HEADER_DIR}/FGNN.h ${SM_HEADER_DIR}/GNN.h ${SM_HEADER_DIR}/NNParams.h ${SM_HEADER_DIR}/GNNParams.h ${SM_HEADER_DIR}/FLANNParams.h ${APPEARANCE_HEADERS} ${STATE_SPACE_HEADERS} ${SM_BASE_HEADERS} ${UTILITIES_HEADER_DIR}/excpUtils.h  ${UTILITIES_HEADER_DIR}/miscUtils.h ${MACROS_HEADER_DIR}/common.h ${MACROS_HEADER_DIR}/register.h
 	${CXX} -c ${MTF_PIC_FLAG} ${WARNING_FLAGS} ${OPT_FLAGS} ${PROF_FLAGS} ${MTF_COMPILETIME_FLAGS} ${MTF_INCLUDE_FLAGS} ${NN_FLAGS} $< ${OPENCV_FLAGS} -o $@
 	
@@ -366,6 +362,12 @@ ${BUILD_DIR}/NNParams.o: ${SM_SRC_DIR}/NNParams.cc ${SM_HEADER_DIR}/NNParams.h $
 ${BUILD_DIR}/GNNParams.o: ${SM_SRC_DIR}/GNNParams.cc ${SM_HEADER_DIR}/GNNParams.h ${MACROS_HEADER_DIR}/common.h
 	${CXX} -c ${MTF_PIC_FLAG} ${WARNING_FLAGS} ${OPT_FLAGS} ${PROF_FLAGS} ${MTF_COMPILETIME_FLAGS} ${MTF_INCLUDE_FLAGS} $< ${OPENCV_FLAGS} -o $@		
 	
+${BUILD_DIR}/FixedLKParams.o: ${SM_SRC_DIR}/FixedLKParams.cc ${SM_HEADER_DIR}/FixedLKParams.h ${UTILITIES_HEADER_DIR}/excpUtils.h  ${MACROS_HEADER_DIR}/common.h
+	${CXX} -c ${MTF_PIC_FLAG} ${WARNING_FLAGS} ${OPT_FLAGS} ${PROF_FLAGS} ${MTF_COMPILETIME_FLAGS} ${MTF_INCLUDE_FLAGS} $< ${OPENCV_FLAGS} -o $@	
+	
+${BUILD_DIR}/BatchTrackerParams.o: ${SM_SRC_DIR}/BatchTrackerParams.cc ${SM_HEADER_DIR}/BatchTrackerParams.h ${MACROS_HEADER_DIR}/common.h
+	${CXX} -c ${MTF_PIC_FLAG} ${WARNING_FLAGS} ${OPT_FLAGS} ${PROF_FLAGS} ${MTF_COMPILETIME_FLAGS} ${MTF_INCLUDE_FLAGS} $< ${OPENCV_FLAGS} -o $@
+	
 ${BUILD_DIR}/FLANNParams.o: ${SM_SRC_DIR}/FLANNParams.cc ${SM_HEADER_DIR}/FLANNParams.h ${UTILITIES_HEADER_DIR}/excpUtils.h ${MACROS_HEADER_DIR}/common.h
 	${CXX} -c ${MTF_PIC_FLAG} ${WARNING_FLAGS} ${OPT_FLAGS} ${PROF_FLAGS} ${MTF_COMPILETIME_FLAGS} ${MTF_INCLUDE_FLAGS} $< ${OPENCV_FLAGS} -o $@	
 	
@@ -397,6 +399,9 @@ ${BUILD_DIR}/GridTrackerFlowParams.o: ${SM_SRC_DIR}/GridTrackerFlowParams.cc ${S
 # ------------------------------------------------------------------------------------ #
 # ---------------------------------- Obsolete Stuff ---------------------------------- #
 # ------------------------------------------------------------------------------------ #
+# these are not in SEARCH_METHODS and so are not built; HACLK, FESMBase and FESM still use
+# the old relative include paths and profiling types so they do not compile against the current
+# headers even though HACLK and FESMBase have been moved to the shared Gauss-Newton core in GNOptimizer.h
 
 ${BUILD_DIR}/HACLK.o: ${SM_SRC_DIR}/HACLK.cc ${SM_HEADER_DIR}/HACLK.h ${APPEARANCE_HEADERS} ${STATE_SPACE_HEADERS} ${SM_BASE_HEADERS} ${UTILITIES_HEADER_DIR}/excpUtils.h  ${UTILITIES_HEADER_DIR}/miscUtils.h ${MACROS_HEADER_DIR}/common.h ${MACROS_HEADER_DIR}/register.h
 	${CXX} -c ${MTF_PIC_FLAG} ${WARNING_FLAGS} ${OPT_FLAGS} ${PROF_FLAGS} ${MTF_COMPILETIME_FLAGS} ${MTF_INCLUDE_FLAGS} ${HAC_FLAGS} $< ${OPENCV_FLAGS} -o $@	
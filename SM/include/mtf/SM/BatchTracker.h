@@ -0,0 +1,116 @@
+#ifndef MTF_BATCH_TRACKER_H
+#define MTF_BATCH_TRACKER_H
+
+#include "BatchTrackerParams.h"
+#include "mtf/AM/SSD.h"
+#include "opencv2/core/core.hpp"
+
+#include <vector>
+#include <memory>
+
+_MTF_BEGIN_NAMESPACE
+
+//! base class for trackers that follow several objects in the same image sequence
+class BatchTrackerBase{
+public:
+	//! name of the tracker
+	std::string name;
+
+	BatchTrackerBase(){}
+	virtual ~BatchTrackerBase(){}
+	//! set the image on which subsequent calls to initialize/update will operate as in TrackerBase
+	virtual void setImage(const cv::Mat &img) = 0;
+	//! start tracking one object at each of the given locations
+	virtual void initialize(const std::vector<cv::Mat> &corners) = 0;
+	//! find the locations of all the objects in the latest image
+	virtual void update() = 0;
+	/**
+	overloaded variants for convenience
+	*/
+	virtual void initialize(const cv::Mat &img, const std::vector<cv::Mat> &corners){
+		setImage(img);
+		initialize(corners);
+	}
+	virtual void update(const cv::Mat &img){
+		setImage(img);
+		update();
+	}
+	//! current locations of all the objects in the order in which they were provided to initialize
+	virtual const std::vector<cv::Mat>& getRegions(){ return cv_corners; }
+	virtual unsigned int getNObjects() const{ return static_cast<unsigned int>(cv_corners.size()); }
+	//! type of OpenCV Mat image the tracker requires as input
+	virtual int inputType() const = 0;
+
+protected:
+	std::vector<cv::Mat> cv_corners;
+};
+
+/**
+Inverse Compositional Lucas Kanade with the SSD AM for several objects that share the same
+AM and SSM configuration; instead of a separate tracker for each object with its own AM,
+the templates, pixel Jacobians and Gauss Newton solvers of all the objects are stored in
+contiguous matrices with one block per object so that the only per object model is the SSM
+that holds its warp and sampling points;
+since the Hessian of ICLK is constant, the solver of each object is the S x N product of its inverse
+with the transposed pixel Jacobian computed once at initialization so that each iteration
+needs a single matrix vector product besides the sampling and the warp update;
+the objects are distributed dynamically among the worker threads, each of which samples
+the patches of the objects it picks up with its own AM, since they may converge after very different no. of iterations
+*/
+template<class SSM>
+class BatchTracker : public BatchTrackerBase{
+public:
+	typedef BatchTrackerParams ParamType;
+	typedef SSD AM;
+	typedef typename AM::ParamType AMParams;
+	typedef typename SSM::ParamType SSMParams;
+
+	BatchTracker(const ParamType *bt_params = nullptr,
+		const AMParams *am_params = nullptr, const SSMParams *_ssm_params = nullptr);
+	void setImage(const cv::Mat &img) override;
+	void initialize(const std::vector<cv::Mat> &corners) override;
+	void update() override;
+	int inputType() const override{ return am_vec[0]->inputType(); }
+	//! no. of iterations that each object took in the latest frame
+	const VectorXi& getNIters() const{ return n_iters; }
+
+protected:
+	typedef std::unique_ptr<AM> AMPtr;
+	typedef std::unique_ptr<SSM> SSMPtr;
+
+	ParamType params;
+	//! used to create the SSMs of the objects
+	SSMParams ssm_params;
+
+	//! one per worker thread
+	std::vector<AMPtr> am_vec;
+	//! one per object
+	std::vector<SSMPtr> ssm_vec;
+	unsigned int n_workers;
+
+	//! let N = patch_size, S = ssm_state_size and K = n_objs
+	unsigned int n_objs, patch_size, ssm_state_size;
+	//! N x K templates of all the objects
+	MatrixXd I0;
+	//! N x SK pixel Jacobians of all the objects w.r.t. their SSM states at the template
+	MatrixXd dI0_dpssm;
+	//! S x NK Gauss Newton solvers of all the objects
+	MatrixXd ssm_solvers;
+	VectorXi n_iters;
+
+	//! one per worker thread
+	std::vector<MatrixXd> worker_dI0_dpssm;
+	std::vector<VectorXd> worker_I_diff, worker_ssm_update, worker_inv_ssm_update;
+
+	int frame_id;
+
+	void initializeObject(unsigned int obj_id, unsigned int worker_id, const cv::Mat &corners);
+	void updateObject(unsigned int obj_id, unsigned int worker_id);
+	//! calls obj_func(obj_id, worker_id) for all objects with each worker picking up the next one as soon as it is free
+	template<typename ObjFuncT>
+	void runObjects(const ObjFuncT &obj_func);
+};
+
+_MTF_END_NAMESPACE
+
+#endif
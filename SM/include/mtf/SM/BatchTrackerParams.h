@@ -0,0 +1,25 @@
+#ifndef MTF_BATCH_TRACKER_PARAMS_H
+#define MTF_BATCH_TRACKER_PARAMS_H
+
+#include "mtf/Macros/common.h"
+
+_MTF_BEGIN_NAMESPACE
+
+struct BatchTrackerParams{
+	int max_iters; //! maximum iterations to run for each object in each frame
+	double epsilon; //! maximum squared change in the corners of an object at which to stop its iterations
+	/**
+	no. of worker threads that the objects are tracked with in parallel, each one using its own AM
+	to sample the patches of the objects it picks up; 1 tracks all objects serially
+	*/
+	int n_workers;
+	bool debug_mode;
+
+	BatchTrackerParams(int _max_iters, double _epsilon,
+		int _n_workers, bool _debug_mode);
+	BatchTrackerParams(const BatchTrackerParams *params = nullptr);
+};
+
+_MTF_END_NAMESPACE
+
+#endif
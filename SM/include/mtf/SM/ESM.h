@@ -3,6 +3,7 @@
 
 #include "SearchMethod.h"
 #include "ESMParams.h"
+#include "GNOptimizer.h"
 
 _MTF_BEGIN_NAMESPACE
 
@@ -20,6 +21,10 @@ public:
 	using typename SearchMethod<AM, SSM> ::AMParams;
 	using typename SearchMethod<AM, SSM> ::SSMParams;
 	using SearchMethod<AM, SSM> ::cv_corners_mat;
+	using SearchMethod<AM, SSM> ::initializeCoarseToFine;
+	using SearchMethod<AM, SSM> ::coarseToFineEnabled;
+	using SearchMethod<AM, SSM> ::setCoarseLevel;
+	using SearchMethod<AM, SSM> ::setFineLevel;
 	using SearchMethod<AM, SSM> ::name;
 	using SearchMethod<AM, SSM> ::initialize;
 	using SearchMethod<AM, SSM> ::update;	
@@ -34,6 +39,7 @@ public:
 
 protected:
 	ParamType params;
+	GNOptimizer optimizer;
 
 	//! N x S jacobians of the pixel values w.r.t the SSM state vector where N = resx * resy
 	//! is the no. of pixels in the object patch
@@ -44,6 +50,8 @@ protected:
 	RowVectorXd df_dp;
 	//! S x S Hessian of the AM error norm w.r.t. SSM state vector
 	MatrixXd d2f_dp2, init_d2f_dp2;
+	//! initial self Hessian restricted to the coarse level of the coarse to fine schedule
+	MatrixXd c2f_init_d2f_dp2;
 
 	VectorXd state_update, ssm_update, am_update;
 	VectorXd inv_ssm_update, inv_am_update;
@@ -53,6 +61,9 @@ protected:
 
 	Matrix24d prev_corners;
 
+	//! computes the initial self Hessian for the coarse level of the coarse to fine schedule
+	void cmptCoarseInitSelfHessian();
+
 	init_profiling();
 	char *time_fname;
 	char *log_fname;
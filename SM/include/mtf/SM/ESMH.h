@@ -205,6 +205,7 @@ public:
 
 			printf("Using Selective Pixel Integration\n");
 			pix_mask.resize(am.getNPix());
+			pix_mask.fill(true);
 			ssm.setSPIMask(pix_mask.data());
 			am.setSPIMask(pix_mask.data());
 		}
@@ -245,6 +246,8 @@ public:
 			if(params.enable_spi){
 				rel_pix_diff = (am.getInitPixVals() - am.getCurrPixVals()) / max_pix_diff;
 				pix_mask = rel_pix_diff.cwiseAbs().array() < params.spi_thresh;
+				ssm.setSPIMask(pix_mask.data());
+				am.setSPIMask(pix_mask.data());
 			}
 			// compute pixel gradient of the current image warped with the current warp
 			ssm.updateGradPts(am.getGradOffset());
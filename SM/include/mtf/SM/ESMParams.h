@@ -35,6 +35,12 @@ struct ESMParams{
 	SPIType spi_type;
 	SPIParamsType spi_params;
 
+	//! coarse to fine schedule described in SearchMethod.h; c2f_sub_ratio <= 1 disables it
+	int c2f_sub_ratio;
+	double c2f_thresh;
+	//! stop iterating if the similarity has not improved for these many consecutive iterations; 0 disables this
+	int stagnation_iters;
+
 	bool debug_mode; //! decides whether logging data will be printed for debugging purposes; 
 	//! only matters if logging is enabled at compile time
 
@@ -43,7 +49,8 @@ struct ESMParams{
 		JacType _jac_type, HessType _hess_type, bool _sec_ord_hess,
 		bool _chained_warp, bool _leven_marq, double _lm_delta_init,
 		double _lm_delta_update, bool _enable_learning,
-		SPIType spi_type, const SPIParamsType &_spi_params, bool _debug_mode);
+		SPIType spi_type, const SPIParamsType &_spi_params, int _c2f_sub_ratio, double _c2f_thresh,
+		int _stagnation_iters, bool _debug_mode);
 	// default and copy constructor
 	ESMParams(const ESMParams *params = nullptr);
 	static const char* toString(JacType _jac_type);
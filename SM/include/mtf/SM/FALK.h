@@ -3,6 +3,7 @@
 
 #include "SearchMethod.h"
 #include "FALKParams.h"
+#include "GNOptimizer.h"
 
 _MTF_BEGIN_NAMESPACE
 
@@ -19,6 +20,10 @@ public:
 	using typename SearchMethod<AM, SSM> ::AMParams;
 	using typename SearchMethod<AM, SSM> ::SSMParams;
 	using SearchMethod<AM, SSM> ::cv_corners_mat;
+	using SearchMethod<AM, SSM> ::initializeCoarseToFine;
+	using SearchMethod<AM, SSM> ::coarseToFineEnabled;
+	using SearchMethod<AM, SSM> ::setCoarseLevel;
+	using SearchMethod<AM, SSM> ::setFineLevel;
 	using SearchMethod<AM, SSM> ::initialize;
 	using SearchMethod<AM, SSM> ::update;
 
@@ -30,6 +35,7 @@ public:
 
 protected:
 	ParamType params;
+	GNOptimizer optimizer;
 
 	// Let S = size of SSM state vector and N = resx * resy = no. of pixels in the object patch
 
@@ -37,6 +43,8 @@ protected:
 	RowVectorXd jacobian;
 	//! S x S Hessian of the AM similarity function w.r.t. SSM state vector
 	MatrixXd init_self_hessian, hessian;
+	//! initial self Hessian restricted to the coarse level of the coarse to fine schedule
+	MatrixXd c2f_init_self_hessian;
 	//! N x S jacobians of the pixel values w.r.t the SSM state vector 
 	MatrixXd init_pix_jacobian, curr_pix_jacobian;
 	//! N x S x S hessians of the pixel values w.r.t the SSM state vector stored as a (S*S) x N 2D matrix
@@ -46,6 +54,9 @@ protected:
 	VectorXd ssm_update;
 	int frame_id;
 
+	//! computes the initial self Hessian for the coarse level of the coarse to fine schedule
+	void cmptCoarseInitSelfHessian();
+
 	init_profiling();
 	char *log_fname;
 	char *time_fname;
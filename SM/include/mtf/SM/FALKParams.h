@@ -20,6 +20,12 @@ struct FALKParams{
 	bool leven_marq;
 	double lm_delta_init;
 	double lm_delta_update;
+	//! coarse to fine schedule described in SearchMethod.h; c2f_sub_ratio <= 1 disables it
+	int c2f_sub_ratio;
+	double c2f_thresh;
+	//! stop iterating if the similarity has not improved for these many consecutive iterations; 0 disables this
+	int stagnation_iters;
+
 	bool debug_mode; //! decides whether logging data will be printed for debugging purposes; 
 	//! only matters if logging is enabled at compile time
 
@@ -29,7 +35,8 @@ struct FALKParams{
 		double _patch_resize_factor,
 		bool _write_frames,	bool _leven_marq,
 		double _lm_delta_init, double _lm_delta_update,
-		bool _enable_learning, bool _debug_mode);
+		bool _enable_learning, int _c2f_sub_ratio, double _c2f_thresh,
+		int _stagnation_iters, bool _debug_mode);
 	FALKParams(const FALKParams *params = nullptr);
 
 	static const char* toString(HessType hess_type);
@@ -3,6 +3,7 @@
 
 #include "SearchMethod.h"
 #include "FCLKParams.h"
+#include "GNOptimizer.h"
 
 _MTF_BEGIN_NAMESPACE
 
@@ -18,6 +19,10 @@ public:
 	using typename SearchMethod<AM, SSM> ::AMParams;
 	using typename SearchMethod<AM, SSM> ::SSMParams;
 	using SearchMethod<AM, SSM> ::cv_corners_mat;
+	using SearchMethod<AM, SSM> ::initializeCoarseToFine;
+	using SearchMethod<AM, SSM> ::coarseToFineEnabled;
+	using SearchMethod<AM, SSM> ::setCoarseLevel;
+	using SearchMethod<AM, SSM> ::setFineLevel;
 	using SearchMethod<AM, SSM> ::name;
 	using SearchMethod<AM, SSM> ::initialize;
 	using SearchMethod<AM, SSM> ::update;	
@@ -31,6 +36,7 @@ public:
 
 protected:
 	ParamType params;
+	GNOptimizer optimizer;
 
 	// Let S = size of SSM state vector and N = resx * resy = no. of pixels in the object patch
 
@@ -38,6 +44,8 @@ protected:
 	RowVectorXd df_dp;
 	//! S x S Hessian of the appearance model w.r.t. SSM state vector
 	MatrixXd d2f_dp2, init_d2f_dp2;
+	//! initial self Hessian restricted to the coarse level of the coarse to fine schedule
+	MatrixXd c2f_init_d2f_dp2;
 	//! N x S jacobians of the pix values w.r.t the SSM state vector 
 	MatrixXd dI0_dpssm, dIt_dpssm;
 
@@ -53,6 +61,9 @@ protected:
 
 	int frame_id;
 
+	//! computes the initial self Hessian for the coarse level of the coarse to fine schedule
+	void cmptCoarseInitSelfHessian();
+
 	init_profiling();
 	char *log_fname;
 	char *time_fname;
@@ -20,6 +20,12 @@ struct FCLKParams{
 	bool show_grid;
 	bool show_patch;
 	double patch_resize_factor;
+	//! coarse to fine schedule described in SearchMethod.h; c2f_sub_ratio <= 1 disables it
+	int c2f_sub_ratio;
+	double c2f_thresh;
+	//! stop iterating if the similarity has not improved for these many consecutive iterations; 0 disables this
+	int stagnation_iters;
+
 	bool debug_mode; //! decides whether logging data will be printed for debugging purposes; 
 	//! only matters if logging is enabled at compile time
 
@@ -29,7 +35,8 @@ struct FCLKParams{
 		double _lm_delta_init, double _lm_delta_update,
 		bool _enable_learning, bool _write_ssm_updates,
 		bool _show_grid, bool _show_patch,
-		double _patch_resize_factor, bool _debug_mode);
+		double _patch_resize_factor, int _c2f_sub_ratio, double _c2f_thresh,
+		int _stagnation_iters, bool _debug_mode);
 	FCLKParams(const FCLKParams *params = nullptr);
 	static const char* toString(HessType hess_type);
 };
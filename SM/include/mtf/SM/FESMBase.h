@@ -2,10 +2,15 @@
 #define MTF_FESMBASE_H
 
 #include "SearchMethod.h"
+#include "GNOptimizer.h"
 
 #define FESM_MAX_ITERS 10
 #define FESM_UPD_THRESH 0.01
 #define FESM_SEC_ORD_HESS false
+#define FESM_LEVEN_MARQ false
+#define FESM_LM_DELTA_INIT 0.01
+#define FESM_LM_DELTA_UPDATE 10
+#define FESM_STAGNATION_ITERS 0
 #define FESM_ENABLE_SPI false
 #define FESM_SPI_THRESH 10
 #define FESM_DEBUG_MODE false
@@ -23,6 +28,11 @@ struct FESMParams{
 	int max_iters; //! maximum iterations of the FESMBase algorithm to run for each frame
 	double upd_thresh; //! maximum L1 norm of the state update vector at which to stop the iterations
 	bool sec_ord_hess;
+	bool leven_marq;
+	double lm_delta_init;
+	double lm_delta_update;
+	//! stop iterating if the similarity has not improved for these many consecutive iterations; 0 disables this
+	int stagnation_iters;
 
 	bool enable_spi;
 	double spi_thresh;
@@ -31,12 +41,17 @@ struct FESMParams{
 
 	// value constructor
 	FESMParams(int _max_iters, double _upd_thresh,
-		bool _sec_ord_hess,
-		bool _enable_spi, double _spi_thresh,
+		bool _sec_ord_hess, bool _leven_marq,
+		double _lm_delta_init, double _lm_delta_update,
+		int _stagnation_iters, bool _enable_spi, double _spi_thresh,
 		bool _debug_mode){
 		max_iters = _max_iters;
 		upd_thresh = _upd_thresh;
 		sec_ord_hess = _sec_ord_hess;
+		leven_marq = _leven_marq;
+		lm_delta_init = _lm_delta_init;
+		lm_delta_update = _lm_delta_update;
+		stagnation_iters = _stagnation_iters;
 		enable_spi = _enable_spi;
 		spi_thresh = _spi_thresh;
 		debug_mode = _debug_mode;
@@ -46,6 +61,10 @@ struct FESMParams{
 		max_iters(FESM_MAX_ITERS),
 		upd_thresh(FESM_UPD_THRESH),
 		sec_ord_hess(FESM_SEC_ORD_HESS),
+		leven_marq(FESM_LEVEN_MARQ),
+		lm_delta_init(FESM_LM_DELTA_INIT),
+		lm_delta_update(FESM_LM_DELTA_UPDATE),
+		stagnation_iters(FESM_STAGNATION_ITERS),
 		enable_spi(FESM_ENABLE_SPI),
 		spi_thresh(FESM_SPI_THRESH),
 		debug_mode(FESM_DEBUG_MODE){
@@ -53,6 +72,10 @@ struct FESMParams{
 			max_iters = params->max_iters;
 			upd_thresh = params->upd_thresh;
 			sec_ord_hess = params->sec_ord_hess;
+			leven_marq = params->leven_marq;
+			lm_delta_init = params->lm_delta_init;
+			lm_delta_update = params->lm_delta_update;
+			stagnation_iters = params->stagnation_iters;
 			enable_spi = params->enable_spi;
 			spi_thresh = params->spi_thresh;
 			debug_mode = params->debug_mode;
@@ -93,6 +116,7 @@ public:
 
 protected:
 	ParamType params;
+	GNOptimizer optimizer;
 
 	int frame_id;
 	VectorXc pix_mask2;
@@ -109,7 +133,7 @@ protected:
 	MatrixXd init_pix_jacobian, curr_pix_jacobian, mean_pix_jacobian;
 	MatrixXd init_pix_hessian, curr_pix_hessian, mean_pix_hessian;
 
-	VectorXd ssm_update;
+	VectorXd ssm_update, inv_ssm_update;
 
 	//! 1 x S Jacobian of the AM error norm w.r.t. SSM state vector
 	RowVectorXd jacobian;
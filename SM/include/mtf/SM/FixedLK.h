@@ -0,0 +1,83 @@
+#ifndef MTF_FIXED_LK_H
+#define MTF_FIXED_LK_H
+
+#include "SearchMethod.h"
+#include "FixedLKParams.h"
+#include "mtf/AM/SSD.h"
+#include "mtf/SSM/Homography.h"
+
+_MTF_BEGIN_NAMESPACE
+
+/**
+ICLK, FCLK and ESM specialized for the SSD AM with the 8 DOF Homography SSM
+where the sampling resolution of the patch is known at compile time;
+the pixel Jacobians are stored in preallocated buffers that are accessed through fixed size maps
+so that the Jacobian and Hessian products are unrolled and vectorized
+and no heap allocation happens within the iterations;
+ScalarT is the precision of the pixel Jacobians and their products - with float, twice as many values fit
+in each SIMD register and half the memory is read while the S x S normal equations are still solved in double;
+only the first order Gauss Newton Hessian without any illumination model or SPI is supported
+*/
+template<int ResX, int ResY, typename ScalarT = double>
+class FixedLK : public SearchMethod < SSD, Homography > {
+public:
+	typedef FixedLKParams ParamType;
+	typedef ParamType::SMType SMType;
+
+	enum{ NPix = ResX*ResY, SSMStateSize = 8 };
+
+	typedef Matrix<double, SSMStateSize, 1> StateT;
+	typedef Matrix<double, SSMStateSize, SSMStateSize> HessT;
+	typedef Matrix<ScalarT, SSMStateSize, 1> JacProdT;
+	typedef Matrix<ScalarT, SSMStateSize, SSMStateSize> HessProdT;
+	typedef Matrix<ScalarT, Dynamic, SSMStateSize> PixJacStorageT;
+	typedef Map<Matrix<ScalarT, NPix, SSMStateSize>, Aligned> PixJacT;
+	typedef Matrix<ScalarT, Dynamic, 1> PixErrStorageT;
+	typedef Map<const Matrix<ScalarT, NPix, 1>, Aligned> PixErrT;
+
+	using SearchMethod<SSD, Homography> ::am;
+	using SearchMethod<SSD, Homography> ::ssm;
+	using SearchMethod<SSD, Homography> ::cv_corners_mat;
+	using SearchMethod<SSD, Homography> ::name;
+	using SearchMethod<SSD, Homography> ::initialize;
+	using SearchMethod<SSD, Homography> ::update;
+
+	FixedLK(const ParamType *flk_params = nullptr,
+		const AMParams *am_params = nullptr, const SSMParams *ssm_params = nullptr);
+
+	void initialize(const cv::Mat &corners) override;
+	void update() override;
+	void setRegion(const cv::Mat& corners) override;
+	bool supportsSPI() override{ return false; }
+
+protected:
+	ParamType params;
+
+	//! storage for the N x S pixel Jacobians that are accessed through the fixed size maps below
+	PixJacStorageT dI0_dpssm_data, dIt_dpssm_data, mean_dI_dpssm_data;
+	PixJacT dI0_dpssm, dIt_dpssm, mean_dI_dpssm;
+
+	//! single precision copy of It - I0 used only when ScalarT is float
+	PixErrStorageT I_diff_data;
+
+	//! S x 1 gradient and S x S Hessian of the SSD w.r.t. SSM state vector
+	JacProdT df_dp;
+	HessProdT d2f_dp2, init_d2f_dp2;
+	//! double precision copies that the normal equations are solved with
+	StateT df_dp_d;
+	HessT d2f_dp2_d;
+
+	VectorXd ssm_update, inv_ssm_update;
+	Matrix24d prev_corners;
+
+	int frame_id;
+
+	void cmptJacobian(JacProdT &jacobian, const PixJacT &dI_dpssm, const PixErrT &I_diff) const;
+	//! computes only the lower triangle and mirrors it since the Hessian is symmetric
+	void cmptHessian(HessProdT &hessian, const PixJacT &dI_dpssm) const;
+};
+
+_MTF_END_NAMESPACE
+
+#endif
+
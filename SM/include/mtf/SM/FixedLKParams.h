@@ -0,0 +1,29 @@
+#ifndef MTF_FIXED_LK_PARAMS_H
+#define MTF_FIXED_LK_PARAMS_H
+
+#include "mtf/Macros/common.h"
+
+_MTF_BEGIN_NAMESPACE
+
+struct FixedLKParams{
+	//! variant of the Lucas Kanade type algorithm to run
+	enum class SMType{ ICLK, FCLK, ESM };
+	SMType sm_type;
+	int max_iters; //! maximum iterations to run for each frame
+	double epsilon; //! maximum L2 norm of the state update vector at which to stop the iterations
+	bool leven_marq;
+	double lm_delta_init;
+	double lm_delta_update;
+	bool debug_mode;
+
+	FixedLKParams(SMType _sm_type, int _max_iters, double _epsilon,
+		bool _leven_marq, double _lm_delta_init,
+		double _lm_delta_update, bool _debug_mode);
+	FixedLKParams(const FixedLKParams *params = nullptr);
+	static const char*  toString(SMType sm_type);
+};
+
+_MTF_END_NAMESPACE
+
+#endif
+
@@ -84,6 +84,9 @@ namespace gnn{
 			int K, int *gnns_cap);
 
 		void addNode(Node *node_i, int nn);
+		//! insert a neighbour into the list of the max_count nearest ones sorted by distance and then index
+		void insertNeighbor(IndxDist *dists, int &count, int max_count,
+			int idx, double dist) const;
 	};
 }
 _MTF_END_NAMESPACE
@@ -11,9 +11,14 @@ namespace gnn{
 		int max_steps;
 		int cmpt_dist_thresh;
 		bool random_start;
+		//! no. of threads used for building the graph
+		int n_workers;
+		//! no. of nodes processed together by each thread while building the graph
+		int build_block_size;
 		bool verbose;
 		GNNParams(int _dgree, int _max_steps,
 			int _cmpt_dist_thresh, bool _random_start,
+			int _n_workers, int _build_block_size,
 			bool _verbose);
 		GNNParams(const GNNParams *params = nullptr);
 	};
@@ -0,0 +1,182 @@
+#ifndef MTF_GN_OPTIMIZER_H
+#define MTF_GN_OPTIMIZER_H
+
+#include "mtf/Macros/common.h"
+#include <algorithm>
+
+_MTF_BEGIN_NAMESPACE
+
+/**
+Gauss Newton / Levenberg Marquardt core shared by the gradient based SMs;
+each SM computes the Jacobian and Hessian of the similarity with its own recipe
+and applies the resulting update in its own way while this takes care of
+the LM damping and step rejection, solving the normal equations and deciding when to stop;
+all workspaces are allocated once for the given state size so that iterating does not touch the heap
+as long as the Hessian can be factorized with LDLT which is the case whenever it is (semi) definite;
+QR with column pivoting is used as a fallback otherwise;
+the typical usage in each iteration is:
+	if(!optimizer.acceptStep(f)){ undo the last update; continue; }
+	optimizer.solve(state_update, jacobian, hessian);
+	apply the update;
+	if(optimizer.converged(update_norm)){ break; }
+with startFrame called before the first iteration in each frame and startLevel whenever
+the similarity values stop being comparable with those before, e.g. when switching levels of a coarse to fine schedule
+*/
+class GNOptimizer{
+public:
+	enum class SolverType{ LDLT, QR };
+	//! telemetry recorded for each iteration of the current frame
+	struct IterStats{
+		//! similarity at the start of the iteration
+		double f;
+		//! damping used for solving in this iteration
+		double lm_delta;
+		//! norm of the update as passed to converged
+		double update_norm;
+		SolverType solver;
+		//! the last update was undone in this iteration so no new one was computed
+		bool rejected;
+	};
+
+	GNOptimizer(int _max_iters, double _epsilon, bool _leven_marq,
+		double _lm_delta_init, double _lm_delta_update, int _stagnation_iters = 0) :
+		epsilon(_epsilon), leven_marq(_leven_marq),
+		lm_delta_init(_lm_delta_init), lm_delta_update(_lm_delta_update),
+		stagnation_iters(_stagnation_iters), iter_stats(_max_iters > 0 ? _max_iters : 1){
+		startFrame();
+	}
+	//! allocates the workspaces for states of the given size
+	void setStateSize(int state_size){
+		damped_hessian.resize(state_size, state_size);
+		neg_jacobian.resize(state_size);
+		ldlt = Eigen::LDLT<MatrixXd>(state_size);
+		qr = Eigen::ColPivHouseholderQR<MatrixXd>(state_size, state_size);
+	}
+	void startFrame(){
+		lm_delta = lm_delta_init;
+		n_iters = 0;
+		startLevel();
+	}
+	void startLevel(){
+		prev_f = best_f = 0;
+		step_undone = false;
+		n_level_iters = n_stagnant_iters = 0;
+	}
+	/**
+	to be called at the start of each iteration with the similarity at the current state;
+	returns false if LM is enabled and this is worse than at the state before the last update
+	in which case the damping is increased and the caller must undo the last update
+	and move on to the next iteration without computing a new one
+	*/
+	bool acceptStep(double f){
+		++n_iters;
+		IterStats &stats = lastStats();
+		stats.f = f;
+		stats.lm_delta = lm_delta;
+		stats.update_norm = 0;
+		stats.solver = SolverType::LDLT;
+		stats.rejected = false;
+
+		bool accepted = true;
+		if(leven_marq){
+			if(step_undone){
+				//! the state is now the same as the one prev_f was computed at
+				step_undone = false;
+			} else{
+				if(n_level_iters > 0){
+					if(f < prev_f){
+						lm_delta *= lm_delta_update;
+						step_undone = stats.rejected = true;
+						accepted = false;
+					} else if(f > prev_f){
+						lm_delta /= lm_delta_update;
+					}
+				}
+				if(accepted){ prev_f = f; }
+			}
+		}
+		if(accepted && (n_level_iters == 0 || f > best_f)){
+			best_f = f;
+			n_stagnant_iters = 0;
+		} else{
+			++n_stagnant_iters;
+		}
+		++n_level_iters;
+		return accepted;
+	}
+	/**
+	solves the normal equations (H + lm_delta*diag(H))*state_update = -J^T
+	where the damping is only added if LM is enabled;
+	the Hessian itself is not modified
+	*/
+	void solve(VectorXd &state_update, const RowVectorXd &jacobian, const MatrixXd &hessian){
+		damped_hessian = hessian;
+		if(leven_marq){
+			damped_hessian.diagonal() *= 1 + lm_delta;
+		}
+		neg_jacobian = -jacobian.transpose();
+		SolverType solver = SolverType::LDLT;
+		ldlt.compute(damped_hessian);
+		//! Hessians of similarities that are maximized are negative rather than positive definite
+		if(ldlt.info() == Eigen::Success && (ldlt.isPositive() || ldlt.isNegative()) &&
+			ldlt.vectorD().cwiseAbs().minCoeff() >
+			ldlt.vectorD().cwiseAbs().maxCoeff() * Eigen::NumTraits<double>::epsilon() * neg_jacobian.size()){
+			state_update = ldlt.solve(neg_jacobian);
+		} else{
+			qr.compute(damped_hessian);
+			state_update = qr.solve(neg_jacobian);
+			solver = SolverType::QR;
+		}
+		lastStats().solver = solver;
+	}
+	/**
+	to be called after applying the update with the norm of the resulting change in the state;
+	returns true if this is below epsilon or if the similarity has not improved
+	for stagnation_iters consecutive iterations
+	*/
+	bool converged(double update_norm){
+		lastStats().update_norm = update_norm;
+		return update_norm < epsilon ||
+			(stagnation_iters > 0 && n_stagnant_iters >= stagnation_iters);
+	}
+	double getLMDelta() const{ return lm_delta; }
+	//! number of iterations run in the current frame including those where the update was undone
+	int getNIters() const{ return n_iters; }
+	const IterStats& getIterStats(int iter_id) const{ return iter_stats[iter_id]; }
+	void printStats() const{
+		int n_recorded_iters = std::min(n_iters, static_cast<int>(iter_stats.size()));
+		printf("n_iters: %d\n", n_iters);
+		for(int iter_id = 0; iter_id < n_recorded_iters; ++iter_id){
+			const IterStats &stats = iter_stats[iter_id];
+			printf("%d: f: %15.9f lm_delta: %12.6e update_norm: %12.6e solver: %s%s\n",
+				iter_id, stats.f, stats.lm_delta, stats.update_norm,
+				stats.solver == SolverType::LDLT ? "LDLT" : "QR",
+				stats.rejected ? " (rejected)" : "");
+		}
+	}
+
+private:
+	const double epsilon;
+	const bool leven_marq;
+	const double lm_delta_init, lm_delta_update;
+	const int stagnation_iters;
+
+	double lm_delta, prev_f, best_f;
+	bool step_undone;
+	int n_iters, n_level_iters, n_stagnant_iters;
+
+	MatrixXd damped_hessian;
+	VectorXd neg_jacobian;
+	Eigen::LDLT<MatrixXd> ldlt;
+	Eigen::ColPivHouseholderQR<MatrixXd> qr;
+	//! one entry per iteration with any beyond the maximum sharing the last one
+	std::vector<IterStats> iter_stats;
+
+	IterStats& lastStats(){
+		return iter_stats[std::max(std::min(n_iters, static_cast<int>(iter_stats.size())) - 1, 0)];
+	}
+};
+
+_MTF_END_NAMESPACE
+
+#endif
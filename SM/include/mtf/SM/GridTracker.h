@@ -77,8 +77,14 @@ public:
 
 	typedef GridTrackerParams ParamType;
 
+	/**
+	_fb_trackers: optional backward-direction twins of the patch trackers used for
+	forward-backward error estimation; if provided, there must be one for each patch tracker
+	and the backward pass runs in parallel over them instead of swapping images on the patch trackers
+	*/
 	GridTracker(const vector<TrackerBase*> _trackers, const ParamType *grid_params,
-		const EstimatorParams *_est_params, const SSMParams *ssm_params);
+		const EstimatorParams *_est_params, const SSMParams *ssm_params,
+		const vector<TrackerBase*> _fb_trackers = vector<TrackerBase*>());
 	void initialize(const cv::Mat &corners) override;
 	void update() override;
 	void setImage(const cv::Mat &img) override;
@@ -102,7 +108,6 @@ private:
 	std::vector<cv::Point2f> prev_pts;
 	std::vector<cv::Point2f> curr_pts;
 
-	cv::Mat patch_corners;
 	std::vector<uchar> pix_mask;
 	VectorXd ssm_update;
 
@@ -120,10 +125,17 @@ private:
 	std::vector<cv::Point2f> fb_prev_pts;
 	VectorXb fb_err_mask;
 	bool enable_fb_err_est;
+	//! backward-direction twins of the patch trackers
+	const vector<TrackerBase*> fb_trackers;
+	//! the previous frame is kept by alternating between these instead of cloning each frame
+	cv::Mat fb_img_buffers[2];
+	int fb_buffer_id;
 
 	~GridTracker(){}
+	void setTrackerImages(const vector<TrackerBase*> &_trackers, const cv::Mat &img);
 	void resetTrackers(bool reinit=true);
 	void backwardEstimation();
+	void updatePrevImage();
 	void showTrackers();
 
 };
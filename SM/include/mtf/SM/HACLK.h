@@ -2,6 +2,7 @@
 #define MTF_HACLK_H
 
 #include "SearchMethod.h"
+#include "GNOptimizer.h"
 #include <vector>
 
 #define HACLK_MAX_ITERS 10
@@ -9,6 +10,10 @@
 #define HACLK_REC_INIT_ERR_GRAD false
 #define HACLK_DEBUG_MODE false
 #define HACLK_HESS_TYPE 0
+#define HACLK_LEVEN_MARQ false
+#define HACLK_LM_DELTA_INIT 0.01
+#define HACLK_LM_DELTA_UPDATE 10
+#define HACLK_STAGNATION_ITERS 0
 
 _MTF_BEGIN_NAMESPACE
 
@@ -20,16 +25,27 @@ struct HACLKParams{
 	bool debug_mode; //! decides whether logging data will be printed for debugging purposes; 
 	//! only matters if logging is enabled at compile time
 	int hess_type;
+	bool leven_marq;
+	double lm_delta_init;
+	double lm_delta_update;
+	//! stop iterating if the similarity has not improved for these many consecutive iterations; 0 disables this
+	int stagnation_iters;
 	std::vector<cv::Mat> converged_corners;
 
 	HACLKParams(int _max_iters, double _epsilon,
 		bool _rec_init_err_grad, bool _debug_mode,
-		int _hess_type, const std::vector<cv::Mat> &_converged_corners){
+		int _hess_type, bool _leven_marq, double _lm_delta_init,
+		double _lm_delta_update, int _stagnation_iters,
+		const std::vector<cv::Mat> &_converged_corners){
 		this->max_iters = _max_iters;
 		this->epsilon = _epsilon;
 		this->rec_init_err_grad = _rec_init_err_grad;
 		this->debug_mode = _debug_mode;
 		this->hess_type = _hess_type;
+		this->leven_marq = _leven_marq;
+		this->lm_delta_init = _lm_delta_init;
+		this->lm_delta_update = _lm_delta_update;
+		this->stagnation_iters = _stagnation_iters;
 		this->converged_corners = _converged_corners;
 	}
 	HACLKParams(HACLKParams *params = nullptr) :
@@ -37,13 +53,21 @@ struct HACLKParams{
 		epsilon(HACLK_EPSILON),
 		rec_init_err_grad(HACLK_REC_INIT_ERR_GRAD),
 		debug_mode(HACLK_DEBUG_MODE),
-		hess_type(HACLK_HESS_TYPE){
+		hess_type(HACLK_HESS_TYPE),
+		leven_marq(HACLK_LEVEN_MARQ),
+		lm_delta_init(HACLK_LM_DELTA_INIT),
+		lm_delta_update(HACLK_LM_DELTA_UPDATE),
+		stagnation_iters(HACLK_STAGNATION_ITERS){
 		if(params){
 			max_iters = params->max_iters;
 			epsilon = params->epsilon;
 			rec_init_err_grad = params->rec_init_err_grad;
 			debug_mode = params->debug_mode;
 			hess_type = params->hess_type;
+			leven_marq = params->leven_marq;
+			lm_delta_init = params->lm_delta_init;
+			lm_delta_update = params->lm_delta_update;
+			stagnation_iters = params->stagnation_iters;
 			converged_corners = params->converged_corners;
 		}
 	}
@@ -74,6 +98,7 @@ public:
 
 private:
 	ParamType params;
+	GNOptimizer optimizer;
 
 	bool use_newton_method;
 	// Let S = size of SSM state vector and N = resx * resy = no. of pixels in the object patch
@@ -3,6 +3,7 @@
 
 #include "SearchMethod.h"
 #include "IALKParams.h"
+#include "GNOptimizer.h"
 
 _MTF_BEGIN_NAMESPACE
 
@@ -18,6 +19,10 @@ public:
 	using typename SearchMethod<AM, SSM> ::AMParams;
 	using typename SearchMethod<AM, SSM> ::SSMParams;
 	using SearchMethod<AM, SSM> ::cv_corners_mat;
+	using SearchMethod<AM, SSM> ::initializeCoarseToFine;
+	using SearchMethod<AM, SSM> ::coarseToFineEnabled;
+	using SearchMethod<AM, SSM> ::setCoarseLevel;
+	using SearchMethod<AM, SSM> ::setFineLevel;
 	using SearchMethod<AM, SSM> ::name;
 
 	using SearchMethod<AM, SSM> ::initialize;
@@ -32,6 +37,7 @@ public:
 protected:
 
 	ParamType params;
+	GNOptimizer optimizer;
 
 	// Let S = size of SSM state vector and N = resx * resy = no. of pixels in the object patch
 
@@ -39,6 +45,8 @@ protected:
 	RowVectorXd jacobian;
 	//! S x S Hessian of the AM error norm w.r.t. SSM state vector
 	MatrixXd init_self_hessian, hessian;
+	//! initial self Hessian restricted to the coarse level of the coarse to fine schedule
+	MatrixXd c2f_init_self_hessian;
 	//! N x S jacobians of the pix values w.r.t the SSM state vector where N = resx * resy
 	//! is the no. of pixels in the object patch
 	//! N x S jacobians of the pix values w.r.t the SSM state vector 
@@ -51,6 +59,9 @@ protected:
 	Matrix3d warp_update;
 	int frame_id;
 
+	//! computes the initial self Hessian for the coarse level of the coarse to fine schedule
+	void cmptCoarseInitSelfHessian();
+
 
 	init_profiling();
 	char *log_fname;
@@ -14,13 +14,20 @@ struct IALKParams{
 	bool leven_marq;
 	double lm_delta_init;
 	double lm_delta_update;
+	//! coarse to fine schedule described in SearchMethod.h; c2f_sub_ratio <= 1 disables it
+	int c2f_sub_ratio;
+	double c2f_thresh;
+	//! stop iterating if the similarity has not improved for these many consecutive iterations; 0 disables this
+	int stagnation_iters;
+
 	bool debug_mode; //! decides whether logging data will be printed for debugging purposes; 
 	//! only matters if logging is enabled at compile time
 
 	IALKParams(int _max_iters, double _epsilon,
 		HessType _hess_type, bool _sec_ord_hess,
 		bool _leven_marq, double _lm_delta_init, 
-		double _lm_delta_update, bool _debug_mode);
+		double _lm_delta_update, int _c2f_sub_ratio, double _c2f_thresh,
+		int _stagnation_iters, bool _debug_mode);
 	IALKParams(const IALKParams *params = nullptr);
 
 	static const char* toString(HessType hess_type);
@@ -3,6 +3,7 @@
 
 #include "SearchMethod.h"
 #include "ICLKParams.h"
+#include "GNOptimizer.h"
 
 _MTF_BEGIN_NAMESPACE
 
@@ -17,6 +18,10 @@ public:
 	using typename SearchMethod<AM, SSM> ::AMParams;
 	using typename SearchMethod<AM, SSM> ::SSMParams;
 	using SearchMethod<AM, SSM> ::cv_corners_mat;
+	using SearchMethod<AM, SSM> ::initializeCoarseToFine;
+	using SearchMethod<AM, SSM> ::coarseToFineEnabled;
+	using SearchMethod<AM, SSM> ::setCoarseLevel;
+	using SearchMethod<AM, SSM> ::setFineLevel;
 	using SearchMethod<AM, SSM> ::name;
 
 	using SearchMethod<AM, SSM> ::initialize;
@@ -32,12 +37,15 @@ public:
 protected:
 
 	ParamType params;
+	GNOptimizer optimizer;
 
 	// Let S = size of SSM state vector and N = resx * resy = no. of pixels in the object patch
 	//! 1 x S Jacobian of the AM error norm w.r.t. SSM state vector
 	RowVectorXd df_dp;
 	//! S x S Hessian of the AM error norm w.r.t. SSM state vector
 	MatrixXd d2f_dp2_orig, d2f_dp2;
+	//! initial self Hessian restricted to the coarse level of the coarse to fine schedule
+	MatrixXd c2f_d2f_dp2;
 	//! N x S jacobians of the pixel values w.r.t the SSM state vector 
 	MatrixXd dI0_dpssm, dIt_dpssm;
 	//! N x S x S hessians of the pixel values w.r.t the SSM state vector stored as a (S*S) x N 2D matrix
@@ -51,6 +59,9 @@ protected:
 	int state_size, ssm_state_size, am_state_size;
 	int frame_id;
 
+	//! self Hessians at the initial location for both levels of the coarse to fine schedule
+	void cmptInitSelfHessians();
+
 private:
 	init_profiling();
 	char *log_fname;
@@ -35,6 +35,12 @@ struct NNParams{
 	bool save_index;
 	bool load_index;
 	std::string saved_index_dir;
+	/**
+	format in which the dataset and index are saved and loaded:
+	0: separate dataset and graph files read fully into memory
+	1-4: single memory mapped file with the features stored as 64 / 32 / 16 bit floats or 8 bit quantized values
+	*/
+	int db_format;
 
 	//! decides whether logging data will be printed for debugging purposes; 
 	//! only matters if logging is enabled at compile time
@@ -56,6 +62,7 @@ struct NNParams{
 		bool load_index,
 		bool _save_index,
 		std::string _saved_index_dir,
+		int _db_format,
 		bool _debug_mode);
 	NNParams(const NNParams *params = nullptr);
 	/**
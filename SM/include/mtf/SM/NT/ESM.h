@@ -3,6 +3,7 @@
 
 #include "SearchMethod.h"
 #include "mtf/SM/ESMParams.h"
+#include "mtf/SM/GNOptimizer.h"
 
 _MTF_BEGIN_NAMESPACE
 namespace nt{	
@@ -26,6 +27,7 @@ namespace nt{
 	protected:
 
 		ParamType params;
+		GNOptimizer optimizer;
 
 		init_profiling();
 
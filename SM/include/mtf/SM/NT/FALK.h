@@ -3,6 +3,7 @@
 
 #include "SearchMethod.h"
 #include "mtf/SM/FALKParams.h"
+#include "mtf/SM/GNOptimizer.h"
 
 _MTF_BEGIN_NAMESPACE
 namespace nt{
@@ -22,6 +23,7 @@ namespace nt{
 
 	private:
 		ParamType params;
+		GNOptimizer optimizer;
 
 		init_profiling();
 
@@ -30,7 +32,7 @@ namespace nt{
 		//! 1 x S Jacobian of the AM similarity function w.r.t. SSM state vector
 		RowVectorXd jacobian;
 		//! S x S Hessian of the AM similarity function w.r.t. SSM state vector
-		MatrixXd init_self_hessian, hessian;
+		MatrixXd hessian;
 		//! N x S jacobians of the pixel values w.r.t the SSM state vector 
 		MatrixXd init_pix_jacobian, curr_pix_jacobian;
 		//! N x S x S hessians of the pixel values w.r.t the SSM state vector stored as a (S*S) x N 2D matrix
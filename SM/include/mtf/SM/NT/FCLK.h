@@ -3,6 +3,7 @@
 
 #include "SearchMethod.h"
 #include "mtf/SM/FCLKParams.h"
+#include "mtf/SM/GNOptimizer.h"
 
 _MTF_BEGIN_NAMESPACE
 namespace nt{
@@ -28,13 +29,14 @@ namespace nt{
 	protected:
 
 		ParamType params;
+		GNOptimizer optimizer;
 
 		// Let S = size of SSM state vector and N = resx * resy = no. of pixels in the object patch
 
 		//! 1 x S Jacobian of the appearance model w.r.t. SSM state vector
 		RowVectorXd jacobian;
 		//! S x S Hessian of the appearance model w.r.t. SSM state vector
-		MatrixXd hessian, init_self_hessian;
+		MatrixXd hessian;
 		//! N x S jacobians of the pix values w.r.t the SSM state vector 
 		MatrixXd init_pix_jacobian, curr_pix_jacobian;
 		MatrixXd curr_pix_jacobian_new;
@@ -3,6 +3,7 @@
 
 #include "mtf/AM/AppearanceModel.h"
 #include "mtf/SM/GNNParams.h"
+#include "mtf/Utilities/dbUtils.h"
 
 _MTF_BEGIN_NAMESPACE
 namespace nt{
@@ -39,6 +40,13 @@ namespace nt{
 				int *nn_ids, double *nn_dists, int K = 1);
 			void saveGraph(const char* file_name);
 			void loadGraph(const char* file_name);
+			/**
+			search the features and graph stored in the given database instead of the dataset passed to searchGraph
+			and the graph built or loaded here; the database must remain open while this is in use
+			*/
+			void setDatabase(const utils::NNDatabase *_db);
+			//! get the graph in the compressed form stored in NNDatabase
+			void getGraph(std::vector<int64_t> &node_offsets, std::vector<int> &node_nbrs) const;
 
 			void  buildGraph(const double *X, int k);
 			int searchGraph(const double *Xq, const double *X,
@@ -52,6 +60,9 @@ namespace nt{
 			ParamType params;
 			std::vector<Node> nodes;
 			MatrixXd dataset_distances;
+			const utils::NNDatabase *db;
+			//! features of the sample being compared decoded from the database
+			VectorXd sample_buffer;
 
 			int start_node_idx;
 			bool dist_computed;
@@ -72,7 +83,17 @@ namespace nt{
 			void knnSearch2(const double *Q, IndxDist *dists, const double *X,
 				int rows, int cols, int k);
 			void knnSearch11(const double *Q, IndxDist *dists, const double *X, int rows,
-				int cols, int k, int *X_inds);
+				int cols, int k, const int *X_inds);
+
+			int getNodeSize(int node_id) const{
+				return db ? db->getNNbrs(node_id) : nodes[node_id].size;
+			}
+			const int* getNodeNbrs(int node_id) const{
+				return db ? db->getNbrs(node_id) : nodes[node_id].nns_inds.data();
+			}
+			const double* getSample(const double *dataset, int sample_id){
+				return db ? db->getFeatures(sample_id, sample_buffer.data()) : dataset + sample_id*n_dims;
+			}
 
 			int min(int a, int b){ return a < b ? a : b; }
 
@@ -80,6 +101,9 @@ namespace nt{
 				int K, int *gnns_cap);
 
 			void addNode(Node *node_i, int nn);
+			//! insert a neighbour into the list of the max_count nearest ones sorted by distance and then index
+			void insertNeighbor(IndxDist *dists, int &count, int max_count,
+				int idx, double dist) const;
 		};
 	}
 }
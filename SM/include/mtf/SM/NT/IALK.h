@@ -3,6 +3,7 @@
 
 #include "SearchMethod.h"
 #include "mtf/SM/IALKParams.h"
+#include "mtf/SM/GNOptimizer.h"
 
 _MTF_BEGIN_NAMESPACE
 namespace nt{
@@ -24,13 +25,14 @@ namespace nt{
 	protected:
 
 		ParamType params;
+		GNOptimizer optimizer;
 
 		// Let S = size of SSM state vector and N = resx * resy = no. of pixels in the object patch
 
 		//! 1 x S Jacobian of the AM error norm w.r.t. SSM state vector
 		RowVectorXd jacobian;
 		//! S x S Hessian of the AM error norm w.r.t. SSM state vector
-		MatrixXd init_self_hessian, hessian;
+		MatrixXd hessian;
 		//! N x S jacobians of the pix values w.r.t the SSM state vector where N = resx * resy
 		//! is the no. of pixels in the object patch
 		//! N x S jacobians of the pix values w.r.t the SSM state vector 
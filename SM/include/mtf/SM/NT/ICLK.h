@@ -3,6 +3,7 @@
 
 #include "SearchMethod.h"
 #include "mtf/SM/ICLKParams.h"
+#include "mtf/SM/GNOptimizer.h"
 
 
 _MTF_BEGIN_NAMESPACE
@@ -28,11 +29,12 @@ namespace nt{
 	protected:
 
 		ParamType params;
+		GNOptimizer optimizer;
 		// Let S = size of SSM state vector and N = resx * resy = no. of pixels in the object patch
 		//! 1 x S Jacobian of the AM error norm w.r.t. SSM state vector
 		RowVectorXd df_dp;
 		//! S x S Hessian of the AM error norm w.r.t. SSM state vector
-		MatrixXd d2f_dp2, d2f_dp2_orig;
+		MatrixXd d2f_dp2;
 		//! N x S jacobians of the pixel values w.r.t the SSM state vector 
 		MatrixXd dI0_dpssm, dIt_dpssm;
 		//! N x S x S hessians of the pixel values w.r.t the SSM state vector stored as a (S*S) x N 2D matrix
@@ -44,11 +44,14 @@ namespace nt{
 		vector<VectorXd> ssm_perturbations;
 
 		MatrixXdr eig_dataset;
+		//! single file dataset and index used instead of the above when db_format is non zero
+		utils::NNDatabase mapped_db;
+		VectorXd best_perturbation;
 
 		int best_idx;
 		double best_dist;
 
-		string saved_db_path, saved_idx_path;
+		string saved_db_path, saved_idx_path, saved_mapped_db_path;
 		cv::Mat curr_img_uchar;
 		cv::Point2d curr_corners[4];
 
@@ -61,6 +64,8 @@ namespace nt{
 		void generateDataset();
 		void loadDataset();
 		void saveDataset();
+		void loadMappedDatabase();
+		void saveMappedDatabase();
 	};
 }
 _MTF_END_NAMESPACE
@@ -37,12 +37,20 @@ namespace nt{
 		using SearchMethod::initialize;
 		using SearchMethod::update;
 
-		PF(AM _am, SSM _ssm, const ParamType *pf_params = nullptr);
+		/**
+		_worker_am and _worker_ssm must contain pf_params->n_workers - 1 separate instances
+		of the same AM and SSM types as _am and _ssm if particles are to be evaluated in parallel
+		since each worker thread except the first needs its own copies of these
+		*/
+		PF(AM _am, SSM _ssm, const ParamType *pf_params = nullptr,
+			const vector<AM> &_worker_am = vector<AM>(),
+			const vector<SSM> &_worker_ssm = vector<SSM>());
 		~PF(){}
 
 		void initialize(const cv::Mat &corners) override;
 		void update() override;
 		void setRegion(const cv::Mat& corners) override;
+		void setImage(const cv::Mat &img) override;
 
 	private:
 
@@ -96,14 +104,22 @@ namespace nt{
 		VectorXd particle_wts;
 		VectorXd particle_cum_wts;
 
-		VectorXd perturbed_state;
-		VectorXd perturbed_ar;
+		/**
+		AM and SSM used by each worker thread with the first one
+		being the AM and SSM of the tracker itself
+		*/
+		vector<AM> worker_am;
+		vector<SSM> worker_ssm;
+		unsigned int n_workers;
+		//! ID of the distribution that the sampler of each worker's SSM is currently set to
+		vector<int> worker_distr_id;
+		vector<VectorXd> perturbed_state;
+		vector<VectorXd> perturbed_ar;
 
 		vector<VectorXd> state_sigma, state_mean;
 		VectorXi resample_ids, resample_ids_hist;
 		VectorXd uniform_rand_nums;
 
-		double measurement_likelihood;
 		double measurement_factor;
 		cv::Mat curr_img_uchar;
 
@@ -128,6 +144,11 @@ namespace nt{
 		void initializeParticles();
 		void initializeDistributions();
 		void updateMeanCorners();
+		/**
+		propagate the given particle with the dynamic model and set its weight
+		to the likelihood of the corresponding patch using the AM and SSM of the given worker
+		*/
+		void evaluateParticle(int particle_id, unsigned int worker_id);
 	};
 }
 
@@ -7,9 +7,7 @@
 #include <boost/random/uniform_real_distribution.hpp>
 #include "PFParams.h"
 
-#ifdef ENABLE_PARALLEL
 #include <memory>
-#endif
 
 _MTF_BEGIN_NAMESPACE
 
@@ -67,15 +65,19 @@ public:
 	void initialize(const cv::Mat &corners) override;
 	void update() override;
 	void setRegion(const cv::Mat& corners) override;
+	void setImage(const cv::Mat &img) override;
 
 protected:
 
-#ifdef ENABLE_PARALLEL
 	typedef std::unique_ptr<AM> AMPTr;
 	typedef std::unique_ptr<SSM> SSMPTr;
+	/**
+	copies of the AM and SSM used by all worker threads except the first one
+	that uses the AM and SSM of the tracker itself
+	*/
 	std::vector<AMPTr> am_vec;
 	std::vector<SSMPTr> ssm_vec;
-#endif
+	unsigned int n_workers;
 
 	ParamType params;
 
@@ -110,15 +112,15 @@ protected:
 	VectorXd particle_wts;
 	VectorXd particle_cum_wts;
 
-	VectorXd perturbed_state;
-	VectorXd perturbed_ar;
+	//! one per worker
+	std::vector<VectorXd> perturbed_state;
+	std::vector<VectorXd> perturbed_ar;
 
 	VectorXd state_sigma, state_mean;
 	VectorXi resample_ids;
 	VectorXd uniform_rand_nums;
 	bool using_pix_sigma;
 
-	double measurement_likelihood;
 	double measurement_factor;
 	cv::Mat curr_img_uchar;
 
@@ -133,6 +135,11 @@ protected:
 	void binaryMultinomialResampling();
 	void residualResampling();
 	void updateMeanCorners();
+	/**
+	propagate the given particle with the dynamic model and set its weight
+	to the likelihood of the corresponding patch using the AM and SSM of the given worker
+	*/
+	void evaluateParticle(int particle_id, unsigned int worker_id);
 };
 
 _MTF_END_NAMESPACE
@@ -84,6 +84,13 @@ struct PFParams{
 	int show_particles;
 	bool enable_learning;
 	bool jacobian_as_sigma;
+	/**
+	no. of worker threads that the particles are propagated and evaluated with in parallel,
+	each one using its own copy of the AM and SSM on a contiguous block of particles;
+	the weights are accumulated and the particles resampled serially in particle order afterwards;
+	1 evaluates all particles serially using the AM and SSM of the tracker itself
+	*/
+	int n_workers;
 	//! decides whether logging data will be printed for debugging purposes; 
 	bool debug_mode;
 	PFParams(int _max_iters, int _n_particles, double _epsilon,
@@ -96,7 +103,8 @@ struct PFParams{
 		double _adaptive_resampling_thresh,
 		const vectord &_pix_sigma, double _measurement_sigma,
 		int _show_particles, bool _enable_learning,
-		bool _jacobian_as_sigma, bool _debug_mode);
+		bool _jacobian_as_sigma, int _n_workers,
+		bool _debug_mode);
 	PFParams(const PFParams *params = nullptr);
 	/**
 	parse the provided mean and sigma and apply several priors
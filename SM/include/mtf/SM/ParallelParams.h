@@ -8,6 +8,7 @@
 #define PARL_AUTO_REINIT 0
 #define PARL_REINIT_ERR_THRESH 1
 #define PRL_SM_REINIT_FRAME_GAP 1
+#define PRL_N_WORKERS 1
 
 _MTF_BEGIN_NAMESPACE
 
@@ -21,9 +22,15 @@ struct ParallelParams {
 	bool auto_reinit;
 	double reinit_err_thresh;
 	int reinit_frame_gap;
+	/**
+	no. of threads used for updating the trackers when TBB is not enabled;
+	1 or less updates them serially
+	*/
+	int n_workers;
 	static const char* toString(PrlEstMethod _estimation_method);
 	ParallelParams(PrlEstMethod _estimation_method, bool _reset_to_mean,
-		bool _auto_reinit, double _reinit_err_thresh, int _reinit_frame_gap);
+		bool _auto_reinit, double _reinit_err_thresh, int _reinit_frame_gap,
+		int _n_workers);
 	ParallelParams(const ParallelParams *params = nullptr);
 };
 
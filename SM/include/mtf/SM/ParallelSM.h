@@ -52,6 +52,10 @@ protected:
 	int ssm_state_size;
 	std::vector<VectorXd> ssm_states;
 	VectorXd mean_state;
+	//! result of each tracker in the current frame when the mean of corners is used
+	vector<cv::Mat> tracker_corners;
+	//! average time taken by each tracker to update that decides the order in which they are started
+	vector<double> tracker_costs;
 
 };
 
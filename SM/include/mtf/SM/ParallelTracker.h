@@ -30,6 +30,10 @@ protected:
 	bool buffer_filled;
 	cv::Mat curr_img;
 	cv::Mat mean_corners_cv;
+	//! result of each tracker in the current frame
+	vector<cv::Mat> tracker_corners;
+	//! average time taken by each tracker to update that decides the order in which they are started
+	vector<double> tracker_costs;
 };
 
 _MTF_END_NAMESPACE
@@ -3,6 +3,7 @@
 
 #include "CompositeSM.h"
 #include "mtf/SM/PyramidalParams.h"
+#include "mtf/Utilities/cacheUtils.h"
 
 _MTF_BEGIN_NAMESPACE
 
@@ -46,6 +47,8 @@ protected:
 	vector<cv::Mat> img_pyramid;
 	double overall_scale_factor;
 	bool external_img_pyramid;
+	//! shared cache of the input frame, if it has one, so that its pyramid is built only once per frame for all trackers
+	utils::FrameCache::Ptr frame_cache;
 	void updateImagePyramid();
 	void showImagePyramid();
 };
@@ -3,6 +3,7 @@
 
 #include "mtf/TrackerBase.h"
 #include "mtf/Macros/common.h"
+#include "mtf/Utilities/spiUtils.h"
 
 _MTF_BEGIN_NAMESPACE
 
@@ -15,11 +16,11 @@ public:
 
 	SearchMethod(const AMParams *am_params, const SSMParams *ssm_params) :
 		TrackerBase(), am(am_params), ssm(ssm_params),
-		spi_mask(nullptr){
+		spi_mask(nullptr), c2f_sub_ratio(1){
 		cv_corners_mat.create(2, 4, CV_64FC1);
 	}
 	SearchMethod() : TrackerBase(),
-		spi_mask(nullptr){
+		spi_mask(nullptr), c2f_sub_ratio(1){
 		cv_corners_mat.create(2, 4, CV_64FC1);
 	}
 
@@ -77,6 +78,43 @@ protected:
 	AM am;
 	SSM ssm;
 	const bool *spi_mask;
+
+	/**
+	coarse to fine schedule used by the iterative SMs where the first iterations in each frame
+	only use every c2f_sub_ratio-th pixel along each dimension of the patch; these switch to all the pixels
+	once the squared change in the corners falls below their c2f_thresh or half the iterations have been used up;
+	this is done through the SPI masks of the AM and SSM so it is only available if both support SPI
+	*/
+	int c2f_sub_ratio;
+	VectorXb c2f_mask;
+
+	void initializeCoarseToFine(int sub_ratio){
+		c2f_sub_ratio = 1;
+		if(sub_ratio <= 1){ return; }
+#ifdef DISABLE_SPI
+		printf("Coarse to fine schedule cannot be used as SPI is disabled\n");
+#else
+		if(!am.supportsSPI() || !ssm.supportsSPI()){
+			printf("Coarse to fine schedule cannot be used as the AM and/or SSM do not support SPI\n");
+			return;
+		}
+		c2f_sub_ratio = sub_ratio;
+		c2f_mask.resize(am.getNPix());
+		printf("Using coarse to fine schedule with sub sampling ratio: %d\n", c2f_sub_ratio);
+#endif
+	}
+	bool coarseToFineEnabled() const{ return c2f_sub_ratio > 1; }
+	//! restricts the AM and SSM to the pixels of the coarse level that are also in the SPI mask set from outside, if any
+	void setCoarseLevel(){
+		utils::getSubsampledMask(c2f_mask.data(), spi_mask, c2f_sub_ratio,
+			am.getResX(), am.getResY());
+		am.setSPIMask(c2f_mask.data());
+		ssm.setSPIMask(c2f_mask.data());
+	}
+	void setFineLevel(){
+		am.setSPIMask(spi_mask);
+		ssm.setSPIMask(spi_mask);
+	}
 };
 // partial specialization for a SM with a 
 // composite or implicit appearance model that cannot be expressed as a class
@@ -0,0 +1,178 @@
+#include "mtf/SM/BatchTracker.h"
+#include "mtf/Utilities/miscUtils.h"
+#include "mtf/Utilities/excpUtils.h"
+
+#include <atomic>
+
+_MTF_BEGIN_NAMESPACE
+
+template<class SSM>
+BatchTracker<SSM>::BatchTracker(const ParamType *bt_params,
+	const AMParams *am_params, const SSMParams *_ssm_params) :
+	BatchTrackerBase(), params(bt_params), ssm_params(_ssm_params),
+	n_objs(0), frame_id(0){
+
+	n_workers = params.n_workers > 1 ? params.n_workers : 1;
+	for(unsigned int worker_id = 0; worker_id < n_workers; ++worker_id){
+		am_vec.push_back(AMPtr(new AM(am_params)));
+	}
+	AM &am = *am_vec[0];
+	if(am.getStateSize() != 0){
+		throw utils::InvalidArgument("BatchTracker :: Illumination models are not supported");
+	}
+	//! only used to find the state size and the name
+	SSM ssm(&ssm_params);
+
+	printf("\n");
+	printf("Using Batch Tracker with:\n");
+	printf("max_iters: %d\n", params.max_iters);
+	printf("epsilon: %f\n", params.epsilon);
+	printf("n_workers: %d\n", n_workers);
+	printf("debug_mode: %d\n", params.debug_mode);
+	printf("appearance model: %s\n", am.name.c_str());
+	printf("state space model: %s\n", ssm.name.c_str());
+	printf("\n");
+
+	name = "batch";
+	patch_size = am.getPatchSize();
+	ssm_state_size = ssm.getStateSize();
+
+	worker_dI0_dpssm.resize(n_workers);
+	worker_I_diff.resize(n_workers);
+	worker_ssm_update.resize(n_workers);
+	worker_inv_ssm_update.resize(n_workers);
+	for(unsigned int worker_id = 0; worker_id < n_workers; ++worker_id){
+		worker_dI0_dpssm[worker_id].resize(patch_size, ssm_state_size);
+		worker_I_diff[worker_id].resize(patch_size);
+		worker_ssm_update[worker_id].resize(ssm_state_size);
+		worker_inv_ssm_update[worker_id].resize(ssm_state_size);
+	}
+}
+
+template<class SSM>
+void BatchTracker<SSM>::setImage(const cv::Mat &img){
+	for(unsigned int worker_id = 0; worker_id < n_workers; ++worker_id){
+		am_vec[worker_id]->setCurrImg(img);
+	}
+}
+
+template<class SSM>
+void BatchTracker<SSM>::initialize(const std::vector<cv::Mat> &corners){
+	frame_id = 0;
+	n_objs = static_cast<unsigned int>(corners.size());
+
+	//! the SSMs of objects tracked before are reused
+	while(ssm_vec.size() < n_objs){
+		ssm_vec.push_back(SSMPtr(new SSM(&ssm_params)));
+	}
+	ssm_vec.resize(n_objs);
+	cv_corners.resize(n_objs);
+
+	I0.resize(patch_size, n_objs);
+	dI0_dpssm.resize(patch_size, ssm_state_size*n_objs);
+	ssm_solvers.resize(ssm_state_size, patch_size*n_objs);
+	n_iters.setZero(n_objs);
+
+	runObjects([&](unsigned int obj_id, unsigned int worker_id){
+		initializeObject(obj_id, worker_id, corners[obj_id]);
+	});
+	/**
+	objects are handed out dynamically so a worker that did not get any here can still get one in update
+	and the pixel buffers of its AM are only allocated when it first samples a template
+	*/
+	for(unsigned int worker_id = 0; n_objs > 0 && worker_id < n_workers; ++worker_id){
+		AM &am = *am_vec[worker_id];
+		if(am.getCurrPixVals().size() != static_cast<int>(patch_size)){
+			am.initializePixVals(ssm_vec[0]->getPts());
+			am.initializePixGrad(ssm_vec[0]->getPts());
+		}
+	}
+}
+
+template<class SSM>
+void BatchTracker<SSM>::update(){
+	++frame_id;
+	runObjects([&](unsigned int obj_id, unsigned int worker_id){
+		updateObject(obj_id, worker_id);
+	});
+	if(params.debug_mode && n_objs > 0){
+		printf("frame %d :: mean n_iters: %f max n_iters: %d\n", frame_id,
+			static_cast<double>(n_iters.sum()) / n_objs, n_iters.maxCoeff());
+	}
+}
+
+template<class SSM>
+void BatchTracker<SSM>::initializeObject(unsigned int obj_id, unsigned int worker_id,
+	const cv::Mat &corners){
+	AM &am = *am_vec[worker_id];
+	SSM &ssm = *ssm_vec[obj_id];
+	MatrixXd &dI0_dpssm_obj = worker_dI0_dpssm[worker_id];
+
+	ssm.clearInitStatus();
+	ssm.initialize(corners, am.getNChannels());
+
+	am.initializePixVals(ssm.getPts());
+	am.initializePixGrad(ssm.getPts());
+	ssm.cmptWarpedPixJacobian(dI0_dpssm_obj, am.getInitPixGrad());
+
+	I0.col(obj_id) = am.getInitPixVals();
+	dI0_dpssm.middleCols(obj_id*ssm_state_size, ssm_state_size) = dI0_dpssm_obj;
+	//! the Hessian is constant so it is inverted and multiplied with the transposed Jacobian only once
+	MatrixXd d2f_dp2 = dI0_dpssm_obj.transpose() * dI0_dpssm_obj;
+	ssm_solvers.middleCols(obj_id*patch_size, patch_size) =
+		d2f_dp2.ldlt().solve(dI0_dpssm_obj.transpose());
+
+	ssm.getCorners(cv_corners[obj_id]);
+}
+
+template<class SSM>
+void BatchTracker<SSM>::updateObject(unsigned int obj_id, unsigned int worker_id){
+	AM &am = *am_vec[worker_id];
+	SSM &ssm = *ssm_vec[obj_id];
+	VectorXd &I_diff = worker_I_diff[worker_id];
+	VectorXd &ssm_update = worker_ssm_update[worker_id];
+	VectorXd &inv_ssm_update = worker_inv_ssm_update[worker_id];
+
+	assert(am.getCurrPixVals().size() == static_cast<int>(patch_size));
+
+	int iter_id = 0;
+	while(iter_id < params.max_iters){
+		++iter_id;
+		am.updatePixVals(ssm.getPts());
+		I_diff = am.getCurrPixVals() - I0.col(obj_id);
+		/**
+		same Gauss Newton step H^-1*J^T*(It - I0) as ICLK with SSD,
+		applied in the inverse direction
+		*/
+		ssm_update.noalias() = ssm_solvers.middleCols(obj_id*patch_size, patch_size) * I_diff;
+
+		Matrix24d prev_corners = ssm.getCorners();
+		ssm.invertState(inv_ssm_update, ssm_update);
+		ssm.compositionalUpdate(inv_ssm_update);
+		if((prev_corners - ssm.getCorners()).squaredNorm() < params.epsilon){ break; }
+	}
+	n_iters(obj_id) = iter_id;
+	ssm.getCorners(cv_corners[obj_id]);
+}
+
+template<class SSM>
+template<typename ObjFuncT>
+void BatchTracker<SSM>::runObjects(const ObjFuncT &obj_func){
+	if(n_workers <= 1 || n_objs <= 1){
+		for(unsigned int obj_id = 0; obj_id < n_objs; ++obj_id){ obj_func(obj_id, 0); }
+		return;
+	}
+	std::atomic<unsigned int> next_obj_id(0);
+	utils::runWorkers(std::min(n_workers, n_objs), [&](unsigned int worker_id){
+		for(unsigned int obj_id = next_obj_id++; obj_id < n_objs; obj_id = next_obj_id++){
+			obj_func(obj_id, worker_id);
+		}
+	});
+}
+
+_MTF_END_NAMESPACE
+
+#ifndef HEADER_ONLY_MODE
+#include "mtf/Macros/register.h"
+_REGISTER_TRACKERS_SSM(BatchTracker);
+#endif
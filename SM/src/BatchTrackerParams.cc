@@ -0,0 +1,30 @@
+#include "mtf/SM/BatchTrackerParams.h"
+
+#define BT_MAX_ITERS 30
+#define BT_EPSILON 1e-4
+#define BT_N_WORKERS 1
+#define BT_DEBUG_MODE false
+
+_MTF_BEGIN_NAMESPACE
+
+BatchTrackerParams::BatchTrackerParams(int _max_iters, double _epsilon,
+int _n_workers, bool _debug_mode) :
+max_iters(_max_iters),
+epsilon(_epsilon),
+n_workers(_n_workers),
+debug_mode(_debug_mode){}
+
+BatchTrackerParams::BatchTrackerParams(const BatchTrackerParams *params) :
+max_iters(BT_MAX_ITERS),
+epsilon(BT_EPSILON),
+n_workers(BT_N_WORKERS),
+debug_mode(BT_DEBUG_MODE){
+	if(params){
+		max_iters = params->max_iters;
+		epsilon = params->epsilon;
+		n_workers = params->n_workers;
+		debug_mode = params->debug_mode;
+	}
+}
+
+_MTF_END_NAMESPACE
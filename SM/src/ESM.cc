@@ -1,5 +1,6 @@
 #include "mtf/SM/ESM.h"
 #include "mtf/Utilities/miscUtils.h"
+#include "mtf/Utilities/profUtils.h"
 
 _MTF_BEGIN_NAMESPACE
 
@@ -7,7 +8,9 @@ template <class AM, class SSM>
 ESM<AM, SSM >::ESM(const ParamType *esm_params,
 	const AMParams *am_params, const SSMParams *ssm_params) :
 	SearchMethod<AM, SSM>(am_params, ssm_params),
-	params(esm_params){
+	params(esm_params),
+	optimizer(params.max_iters, params.epsilon, params.leven_marq,
+	params.lm_delta_init, params.lm_delta_update, params.stagnation_iters){
 	printf("\n");
 	printf("Using Efficient Second order Minimization SM with:\n");
 	printf("max_iters: %d\n", params.max_iters);
@@ -21,6 +24,11 @@ ESM<AM, SSM >::ESM(const ParamType *esm_params,
 		printf("lm_delta_update: %f\n", params.lm_delta_update);
 	}
 	printf("enable_learning: %d\n", params.enable_learning);
+	printf("c2f_sub_ratio: %d\n", params.c2f_sub_ratio);
+	if(params.c2f_sub_ratio > 1){
+		printf("c2f_thresh: %f\n", params.c2f_thresh);
+	}
+	printf("stagnation_iters: %d\n", params.stagnation_iters);
 	printf("debug_mode: %d\n", params.debug_mode);
 
 	printf("appearance model: %s\n", am.name.c_str());
@@ -54,6 +62,7 @@ ESM<AM, SSM >::ESM(const ParamType *esm_params,
 
 	df_dp.resize(state_size);
 	d2f_dp2.resize(state_size, state_size);
+	optimizer.setStateSize(state_size);
 	if(params.hess_type == HessType::SumOfSelf){
 		init_d2f_dp2.resize(state_size, state_size);
 	}
@@ -73,6 +82,10 @@ ESM<AM, SSM >::ESM(const ParamType *esm_params,
 			}
 		}
 	}
+	initializeCoarseToFine(params.c2f_sub_ratio);
+	if(coarseToFineEnabled()){
+		c2f_init_d2f_dp2.resize(state_size, state_size);
+	}
 }
 
 template <class AM, class SSM>
@@ -106,9 +119,12 @@ void ESM<AM, SSM >::initialize(const cv::Mat &corners){
 		} else{
 			am.cmptSelfHessian(d2f_dp2, dI0_dpssm);
 		}
-		if(params.hess_type == HessType::SumOfSelf){
+		if(params.hess_type == HessType::SumOfSelf || coarseToFineEnabled()){
 			init_d2f_dp2 = d2f_dp2;
 		}
+		if(coarseToFineEnabled()){
+			cmptCoarseInitSelfHessian();
+		}
 	}
 	ssm.getCorners(cv_corners_mat);
 
@@ -116,19 +132,32 @@ void ESM<AM, SSM >::initialize(const cv::Mat &corners){
 	write_interval(time_fname, "w");
 }
 
+template <class AM, class SSM>
+void ESM<AM, SSM >::cmptCoarseInitSelfHessian(){
+	setCoarseLevel();
+	if(params.sec_ord_hess){
+		am.cmptSelfHessian(c2f_init_d2f_dp2, dI0_dpssm, d2I0_dpssm2);
+	} else{
+		am.cmptSelfHessian(c2f_init_d2f_dp2, dI0_dpssm);
+	}
+	setFineLevel();
+}
+
 template <class AM, class SSM>
 void ESM<AM, SSM >::update(){
 	++frame_id;
 	write_frame_id(frame_id);
 
-	double prev_f = 0;
-	double lm_delta = params.lm_delta_init;
-	bool state_reset = false;
-
 	am.setFirstIter();
+	optimizer.startFrame();
+	bool coarse_level = coarseToFineEnabled();
+	if(coarse_level){ setCoarseLevel(); }
+
 	for(int iter_id = 0; iter_id < params.max_iters; ++iter_id){
 		init_timer();
 
+		//! the gradient at the same points is needed in this iteration unless the LM test rejects the last update
+		if(!params.leven_marq){ am.fuseNextPixGrad(); }
 		//! extract pixel values from the current image at the latest known position of the object
 		am.updatePixVals(ssm.getPts());
 		record_event("am.updatePixVals");
@@ -137,27 +166,14 @@ void ESM<AM, SSM >::update(){
 		am.updateSimilarity(false);
 		record_event("am.updateSimilarity");
 
-		if(params.leven_marq && !state_reset){
-			double f = am.getSimilarity();
-			if(iter_id > 0){
-				if(f < prev_f){
-					lm_delta *= params.lm_delta_update;
-					//! undo the last update
-					ssm.invertState(inv_ssm_update, ssm_update);
-					ssm.compositionalUpdate(inv_ssm_update);
-					am.invertState(inv_am_update, am_update);
-					am.updateState(inv_am_update);
-
-					state_reset = true;
-					continue;
-				}
-				if(f > prev_f){
-					lm_delta /= params.lm_delta_update;
-				}
-			}
-			prev_f = f;
+		if(!optimizer.acceptStep(am.getSimilarity())){
+			//! undo the last update
+			ssm.invertState(inv_ssm_update, ssm_update);
+			ssm.compositionalUpdate(inv_ssm_update);
+			am.invertState(inv_am_update, am_update);
+			am.updateState(inv_am_update);
+			continue;
 		}
-		state_reset = false;
 
 		//! update the gradient of f w.r.t. It
 		am.updateCurrGrad();
@@ -202,7 +218,9 @@ void ESM<AM, SSM >::update(){
 		//! compute the Hessian of the similarity w.r.t. SSM parameters
 		switch(params.hess_type){
 		case HessType::InitialSelf:
-			if(params.leven_marq){
+			if(coarse_level){
+				d2f_dp2 = c2f_init_d2f_dp2;
+			} else if(coarseToFineEnabled()){
 				d2f_dp2 = init_d2f_dp2;
 			}
 			break;
@@ -236,7 +254,7 @@ void ESM<AM, SSM >::update(){
 				am.cmptSelfHessian(d2f_dp2, dIt_dpssm);
 				record_event("am.cmptSelfHessian (first order)");
 			}
-			d2f_dp2 = (d2f_dp2 + init_d2f_dp2) * 0.5;
+			d2f_dp2 = (d2f_dp2 + (coarse_level ? c2f_init_d2f_dp2 : init_d2f_dp2)) * 0.5;
 			break;
 		case HessType::CurrentSelf:
 			if(params.sec_ord_hess){
@@ -258,12 +276,7 @@ void ESM<AM, SSM >::update(){
 			break;
 		}
 
-		if(params.leven_marq){
-			MatrixXd diag_hessian = d2f_dp2.diagonal().asDiagonal();
-			d2f_dp2 += lm_delta*diag_hessian;
-		}
-
-		state_update = -d2f_dp2.colPivHouseholderQr().solve(df_dp.transpose());
+		optimizer.solve(state_update, df_dp, d2f_dp2);
 		record_event("state_update");
 
 		ssm_update = state_update.head(ssm_state_size);
@@ -281,10 +294,22 @@ void ESM<AM, SSM >::update(){
 
 		write_data(time_fname);
 
-		if(update_norm < params.epsilon){ break; }
+		bool converged = optimizer.converged(update_norm);
+		if(coarse_level){
+			if(update_norm < params.c2f_thresh || 2 * (iter_id + 1) >= params.max_iters){
+				setFineLevel();
+				coarse_level = false;
+				//! similarity values at different levels are not comparable
+				optimizer.startLevel();
+			}
+		} else if(converged){
+			break;
+		}
 
 		am.clearFirstIter();
 	}
+	if(coarse_level){ setFineLevel(); }
+	if(params.debug_mode){ optimizer.printStats(); }
 	if(params.enable_learning){
 		am.updateModel(ssm.getPts());
 	}
@@ -307,9 +332,12 @@ void ESM<AM, SSM >::setRegion(const cv::Mat& corners){
 		} else{
 			am.cmptSelfHessian(d2f_dp2, dI0_dpssm);
 		}
-		if(params.hess_type == HessType::SumOfSelf){
+		if(params.hess_type == HessType::SumOfSelf || coarseToFineEnabled()){
 			init_d2f_dp2 = d2f_dp2;
 		}
+		if(coarseToFineEnabled()){
+			cmptCoarseInitSelfHessian();
+		}
 	}
 	ssm.getCorners(cv_corners_mat);
 }
@@ -12,6 +12,9 @@
 #define ESM_LM_DELTA_UPDATE 10
 #define ESM_ENABLE_LEARNING false
 #define ESM_SPI_TYPE 0
+#define ESM_C2F_SUB_RATIO 1
+#define ESM_C2F_THRESH 1e-2
+#define ESM_STAGNATION_ITERS 0
 #define ESM_DEBUG_MODE false
 
 _MTF_BEGIN_NAMESPACE
@@ -20,7 +23,8 @@ ESMParams::ESMParams(int _max_iters, double _epsilon,
 JacType _jac_type, HessType _hess_type, bool _sec_ord_hess,
 bool _chained_warp, bool _leven_marq, double _lm_delta_init,
 double _lm_delta_update, bool _enable_learning, 
-SPIType _spi_type, const SPIParamsType &_spi_params, bool _debug_mode) :
+SPIType _spi_type, const SPIParamsType &_spi_params, int _c2f_sub_ratio, double _c2f_thresh,
+int _stagnation_iters, bool _debug_mode) :
 max_iters(_max_iters),
 epsilon(_epsilon),
 jac_type(_jac_type),
@@ -33,6 +37,9 @@ lm_delta_update(_lm_delta_update),
 enable_learning(_enable_learning),
 spi_type(_spi_type),
 spi_params(_spi_params),
+c2f_sub_ratio(_c2f_sub_ratio),
+c2f_thresh(_c2f_thresh),
+stagnation_iters(_stagnation_iters),
 debug_mode(_debug_mode){}
 
 // default and copy constructor
@@ -47,6 +54,9 @@ lm_delta_init(ESM_LM_DELTA_INIT),
 lm_delta_update(ESM_LM_DELTA_UPDATE),
 enable_learning(ESM_ENABLE_LEARNING),
 spi_type(static_cast<SPIType>(ESM_SPI_TYPE)),
+c2f_sub_ratio(ESM_C2F_SUB_RATIO),
+c2f_thresh(ESM_C2F_THRESH),
+stagnation_iters(ESM_STAGNATION_ITERS),
 debug_mode(ESM_DEBUG_MODE){
 	if(params){
 		max_iters = params->max_iters;
@@ -61,6 +71,9 @@ debug_mode(ESM_DEBUG_MODE){
 		enable_learning = params->enable_learning;
 		spi_type = params->spi_type;
 		spi_params = params->spi_params;
+		c2f_sub_ratio = params->c2f_sub_ratio;
+		c2f_thresh = params->c2f_thresh;
+		stagnation_iters = params->stagnation_iters;
 		debug_mode = params->debug_mode;
 	}
 }
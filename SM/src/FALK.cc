@@ -1,5 +1,6 @@
 #include "mtf/SM/FALK.h"
 #include "mtf/Utilities/miscUtils.h"
+#include "mtf/Utilities/profUtils.h"
 
 _MTF_BEGIN_NAMESPACE
 
@@ -7,7 +8,9 @@ template <class AM, class SSM>
 FALK<AM, SSM >::FALK(const ParamType *falk_params,
 	const AMParams *am_params, const SSMParams *ssm_params) :
 	SearchMethod<AM, SSM>(am_params, ssm_params),
-	params(falk_params) {
+	params(falk_params),
+	optimizer(params.max_iters, params.epsilon, params.leven_marq,
+	params.lm_delta_init, params.lm_delta_update, params.stagnation_iters){
 
 	printf("\n");
 	printf("Using Forward Additive Lucas Kanade SM with:\n");
@@ -20,6 +23,11 @@ FALK<AM, SSM >::FALK(const ParamType *falk_params,
 		printf("lm_delta_init: %f\n", params.lm_delta_init);
 		printf("lm_delta_update: %f\n", params.lm_delta_update);
 	}
+	printf("c2f_sub_ratio: %d\n", params.c2f_sub_ratio);
+	if(params.c2f_sub_ratio > 1){
+		printf("c2f_thresh: %f\n", params.c2f_thresh);
+	}
+	printf("stagnation_iters: %d\n", params.stagnation_iters);
 	printf("debug_mode: %d\n", params.debug_mode);
 
 	printf("appearance model: %s\n", am.name.c_str());
@@ -42,6 +50,7 @@ FALK<AM, SSM >::FALK(const ParamType *falk_params,
 	curr_pix_jacobian.resize(am.getPatchSize(), ssm.getStateSize());
 	jacobian.resize(ssm.getStateSize());
 	hessian.resize(ssm.getStateSize(), ssm.getStateSize());
+	optimizer.setStateSize(ssm.getStateSize());
 
 	if(params.hess_type == HessType::InitialSelf){
 		init_pix_jacobian.resize(am.getPatchSize(), ssm.getStateSize());
@@ -51,6 +60,10 @@ FALK<AM, SSM >::FALK(const ParamType *falk_params,
 	} else if(params.sec_ord_hess){
 		curr_pix_hessian.resize(ssm.getStateSize()*ssm.getStateSize(), am.getPatchSize());
 	}
+	initializeCoarseToFine(params.c2f_sub_ratio);
+	if(coarseToFineEnabled()){
+		c2f_init_self_hessian.resize(ssm.getStateSize(), ssm.getStateSize());
+	}
 }
 
 template <class AM, class SSM>
@@ -80,8 +93,11 @@ void FALK<AM, SSM >::initialize(const cv::Mat &corners){
 		} else{
 			am.cmptSelfHessian(hessian, init_pix_jacobian);
 		}
+		if(coarseToFineEnabled()){
+			cmptCoarseInitSelfHessian();
+		}
 	}
-	if(params.leven_marq){
+	if(coarseToFineEnabled()){
 		init_self_hessian = hessian;
 	}
 	ssm.getCorners(cv_corners_mat);
@@ -90,19 +106,33 @@ void FALK<AM, SSM >::initialize(const cv::Mat &corners){
 	write_interval(time_fname, "w");
 }
 
+template <class AM, class SSM>
+void FALK<AM, SSM >::cmptCoarseInitSelfHessian(){
+	setCoarseLevel();
+	if(params.sec_ord_hess){
+		am.cmptSelfHessian(c2f_init_self_hessian, init_pix_jacobian, init_pix_hessian);
+	} else{
+		am.cmptSelfHessian(c2f_init_self_hessian, init_pix_jacobian);
+	}
+	setFineLevel();
+}
+
 template <class AM, class SSM>
 void FALK<AM, SSM >::update(){
 	++frame_id;
 	write_frame_id(frame_id);
 
-	double prev_f = 0;
-	double lm_delta = params.lm_delta_init;
-	bool state_reset = false;
+	optimizer.startFrame();
 
 	am.setFirstIter();
+	bool coarse_level = coarseToFineEnabled();
+	if(coarse_level){ setCoarseLevel(); }
+
 	for(int iter_id = 0; iter_id < params.max_iters; ++iter_id){
 		init_timer();
 
+		//! the gradient at the same points is needed in this iteration unless the LM test rejects the last update
+		if(!params.leven_marq){ am.fuseNextPixGrad(); }
 		am.updatePixVals(ssm.getPts());
 		record_event("am.updatePixVals");
 
@@ -110,25 +140,12 @@ void FALK<AM, SSM >::update(){
 		am.updateSimilarity(false);
 		record_event("am.updateSimilarity");
 
-		if(params.leven_marq && !state_reset){
-			double f = am.getSimilarity();
-			if(iter_id > 0){
-				if(f < prev_f){
-					lm_delta *= params.lm_delta_update;
-					//! undo the last update
-					VectorXd inv_ssm_update = -ssm_update;
-					ssm.additiveUpdate(inv_ssm_update);
-
-					state_reset = true;
-					continue;
-				}
-				if(f > prev_f){
-					lm_delta /= params.lm_delta_update;
-				}
-			}
-			prev_f = f;
+		if(!optimizer.acceptStep(am.getSimilarity())){
+			//! undo the last update
+			ssm_update = -ssm_update;
+			ssm.additiveUpdate(ssm_update);
+			continue;
 		}
-		state_reset = false;
 
 		am.updatePixGrad(ssm.getPts());
 		record_event("am.updatePixGrad");
@@ -153,7 +170,9 @@ void FALK<AM, SSM >::update(){
 		// compute similarity Hessian
 		switch(params.hess_type){
 		case HessType::InitialSelf:
-			if(params.leven_marq){
+			if(coarse_level){
+				hessian = c2f_init_self_hessian;
+			} else if(coarseToFineEnabled()){
 				hessian = init_self_hessian;
 			}
 			break;
@@ -176,12 +195,8 @@ void FALK<AM, SSM >::update(){
 			}
 			break;
 		}
-		if(params.leven_marq){
-			MatrixXd diag_hessian = hessian.diagonal().asDiagonal();
-			hessian += lm_delta*diag_hessian;
-		}
 
-		ssm_update = -hessian.colPivHouseholderQr().solve(jacobian.transpose());
+		optimizer.solve(ssm_update, jacobian, hessian);
 		record_event("ssm_update");
 
 		prev_corners = ssm.getCorners();
@@ -191,9 +206,21 @@ void FALK<AM, SSM >::update(){
 		double update_norm = (prev_corners - ssm.getCorners()).squaredNorm();
 		record_event("update_norm");
 
-		if(update_norm < params.epsilon){ break; }
+		bool converged = optimizer.converged(update_norm);
+		if(coarse_level){
+			if(update_norm < params.c2f_thresh || 2 * (iter_id + 1) >= params.max_iters){
+				setFineLevel();
+				coarse_level = false;
+				//! similarity values at different levels are not comparable
+				optimizer.startLevel();
+			}
+		} else if(converged){
+			break;
+		}
 		am.clearFirstIter();
 	}
+	if(coarse_level){ setFineLevel(); }
+	if(params.debug_mode){ optimizer.printStats(); }
 	if(params.enable_learning){
 		am.updateModel(ssm.getPts());
 	}
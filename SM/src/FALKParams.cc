@@ -12,6 +12,9 @@
 #define FALK_LEVEN_MARQ false
 #define FALK_LM_DELTA_INIT 0.01
 #define FALK_LM_DELTA_UPDATE 10
+#define FALK_C2F_SUB_RATIO 1
+#define FALK_C2F_THRESH 1e-2
+#define FALK_STAGNATION_ITERS 0
 #define FALK_DEBUG_MODE false
 
 _MTF_BEGIN_NAMESPACE
@@ -22,7 +25,8 @@ bool _show_grid, bool _show_patch,
 double _patch_resize_factor,
 bool _write_frames, bool _leven_marq,
 double _lm_delta_init, double _lm_delta_update,
-bool _enable_learning, bool _debug_mode) :
+bool _enable_learning, int _c2f_sub_ratio, double _c2f_thresh,
+int _stagnation_iters, bool _debug_mode) :
 max_iters(_max_iters),
 epsilon(_epsilon),
 hess_type(_hess_type),
@@ -35,6 +39,9 @@ enable_learning(_enable_learning),
 leven_marq(_leven_marq),
 lm_delta_init(_lm_delta_init),
 lm_delta_update(_lm_delta_update),
+c2f_sub_ratio(_c2f_sub_ratio),
+c2f_thresh(_c2f_thresh),
+stagnation_iters(_stagnation_iters),
 debug_mode(_debug_mode){}
 
 FALKParams::FALKParams(const FALKParams *params) :
@@ -50,6 +57,9 @@ enable_learning(FALK_ENABLE_LEARNING),
 leven_marq(FALK_LEVEN_MARQ),
 lm_delta_init(FALK_LM_DELTA_INIT),
 lm_delta_update(FALK_LM_DELTA_UPDATE),
+c2f_sub_ratio(FALK_C2F_SUB_RATIO),
+c2f_thresh(FALK_C2F_THRESH),
+stagnation_iters(FALK_STAGNATION_ITERS),
 debug_mode(FALK_DEBUG_MODE){
 	if(params){
 		max_iters = params->max_iters;
@@ -64,6 +74,9 @@ debug_mode(FALK_DEBUG_MODE){
 		leven_marq = params->leven_marq;
 		lm_delta_init = params->lm_delta_init;
 		lm_delta_update = params->lm_delta_update;
+		c2f_sub_ratio = params->c2f_sub_ratio;
+		c2f_thresh = params->c2f_thresh;
+		stagnation_iters = params->stagnation_iters;
 		debug_mode = params->debug_mode;
 	}
 }
@@ -1,5 +1,6 @@
 #include "mtf/SM/FCLK.h"
 #include "mtf/Utilities/miscUtils.h"
+#include "mtf/Utilities/profUtils.h"
 #include <stdexcept>
 
 _MTF_BEGIN_NAMESPACE
@@ -8,7 +9,9 @@ template <class AM, class SSM>
 FCLK<AM, SSM >::FCLK(const ParamType *fclk_params,
 	const AMParams *am_params, const SSMParams *ssm_params) :
 	SearchMethod<AM, SSM>(am_params, ssm_params),
-	params(fclk_params) {
+	params(fclk_params),
+	optimizer(params.max_iters, params.epsilon, params.leven_marq,
+	params.lm_delta_init, params.lm_delta_update, params.stagnation_iters){
 
 	printf("\n");
 	printf("Using Forward Compositional Lucas Kanade SM with:\n");
@@ -22,6 +25,11 @@ FCLK<AM, SSM >::FCLK(const ParamType *fclk_params,
 		printf("lm_delta_update: %f\n", params.lm_delta_update);
 	}
 	printf("enable_learning: %d\n", params.enable_learning);
+	printf("c2f_sub_ratio: %d\n", params.c2f_sub_ratio);
+	if(params.c2f_sub_ratio > 1){
+		printf("c2f_thresh: %f\n", params.c2f_thresh);
+	}
+	printf("stagnation_iters: %d\n", params.stagnation_iters);
 	printf("debug_mode: %d\n", params.debug_mode);
 	printf("appearance model: %s\n", am.name.c_str());
 	printf("state space model: %s\n", ssm.name.c_str());
@@ -55,6 +63,7 @@ FCLK<AM, SSM >::FCLK(const ParamType *fclk_params,
 	dIt_dpssm.resize(am.getPatchSize(), ssm_state_size);
 	df_dp.resize(state_size);
 	d2f_dp2.resize(state_size, state_size);
+	optimizer.setStateSize(state_size);
 
 	if(params.hess_type == HessType::InitialSelf){
 		dI0_dpssm.resize(am.getPatchSize(), ssm_state_size);
@@ -64,6 +73,10 @@ FCLK<AM, SSM >::FCLK(const ParamType *fclk_params,
 	} else if(params.sec_ord_hess){
 		d2It_dpssm2.resize(ssm_state_size*ssm_state_size, am.getPatchSize());
 	}
+	initializeCoarseToFine(params.c2f_sub_ratio);
+	if(coarseToFineEnabled()){
+		c2f_init_d2f_dp2.resize(state_size, state_size);
+	}
 }
 
 template <class AM, class SSM>
@@ -93,9 +106,12 @@ void FCLK<AM, SSM>::initialize(const cv::Mat &corners){
 		} else{
 			am.cmptSelfHessian(d2f_dp2, dI0_dpssm);
 		}
-		if(params.leven_marq){
+		if(coarseToFineEnabled()){
 			init_d2f_dp2 = d2f_dp2;
 		}
+		if(coarseToFineEnabled()){
+			cmptCoarseInitSelfHessian();
+		}
 	}
 	ssm.getCorners(cv_corners_mat);
 
@@ -103,44 +119,44 @@ void FCLK<AM, SSM>::initialize(const cv::Mat &corners){
 	write_interval(time_fname, "w");
 }
 
+template <class AM, class SSM>
+void FCLK<AM, SSM>::cmptCoarseInitSelfHessian(){
+	setCoarseLevel();
+	if(params.sec_ord_hess){
+		am.cmptSelfHessian(c2f_init_d2f_dp2, dI0_dpssm, d2I0_dpssm2);
+	} else{
+		am.cmptSelfHessian(c2f_init_d2f_dp2, dI0_dpssm);
+	}
+	setFineLevel();
+}
+
 template <class AM, class SSM>
 void FCLK<AM, SSM>::update(){
 
 	++frame_id;
 	write_frame_id(frame_id);
 
-	double prev_f = 0;
-	double lm_delta = params.lm_delta_init;
-	bool state_reset = false;
-
 	am.setFirstIter();
+	optimizer.startFrame();
+	bool coarse_level = coarseToFineEnabled();
+	if(coarse_level){ setCoarseLevel(); }
+
 	for(int iter_id = 0; iter_id < params.max_iters; ++iter_id){
 		init_timer();
 
+		//! the gradient at the same points is needed in this iteration unless the LM test rejects the last update
+		if(!params.leven_marq){ am.fuseNextPixGrad(); }
 		am.updatePixVals(ssm.getPts()); record_event("am.updatePixVals");
 		am.updateSimilarity(false); record_event("am.updateSimilarity");
 
-		if(params.leven_marq && !state_reset){
-			double f = am.getSimilarity();
-			if(iter_id > 0){
-				if(f < prev_f){
-					lm_delta *= params.lm_delta_update;
-					//! undo the last update
-					ssm.invertState(inv_ssm_update, ssm_update);
-					ssm.compositionalUpdate(inv_ssm_update);
-					am.invertState(inv_am_update, am_update);
-					am.updateState(inv_am_update);
-
-					state_reset = true;
-					continue;
-				}
-				if(f > prev_f){
-					lm_delta /= params.lm_delta_update;
-				}
-			}
-			prev_f = f;
+		if(!optimizer.acceptStep(am.getSimilarity())){
+			//! undo the last update
+			ssm.invertState(inv_ssm_update, ssm_update);
+			ssm.compositionalUpdate(inv_ssm_update);
+			am.invertState(inv_am_update, am_update);
+			am.updateState(inv_am_update);
+			continue;
 		}
-		state_reset = false;
 
 		am.updateCurrGrad(); record_event("am.updateCurrGrad");
 
@@ -164,7 +180,9 @@ void FCLK<AM, SSM>::update(){
 		//! compute similarity Hessian
 		switch(params.hess_type){
 		case HessType::InitialSelf:
-			if(params.leven_marq){
+			if(coarse_level){
+				d2f_dp2 = c2f_init_d2f_dp2;
+			} else if(coarseToFineEnabled()){
 				d2f_dp2 = init_d2f_dp2;
 			}
 			break;
@@ -188,12 +206,7 @@ void FCLK<AM, SSM>::update(){
 			break;
 		}
 
-		if(params.leven_marq){
-			MatrixXd diag_d2f_dp2 = d2f_dp2.diagonal().asDiagonal();
-			d2f_dp2 += lm_delta*diag_d2f_dp2;
-		}
-
-		state_update = -d2f_dp2.colPivHouseholderQr().solve(df_dp.transpose());
+		optimizer.solve(state_update, df_dp, d2f_dp2);
 		ssm_update = state_update.head(ssm_state_size);
 		am_update = state_update.tail(am_state_size);
 
@@ -212,11 +225,23 @@ void FCLK<AM, SSM>::update(){
 
 		write_data(time_fname);
 
-		if(update_norm < params.epsilon){ break; }
+		bool converged = optimizer.converged(update_norm);
+		if(coarse_level){
+			if(update_norm < params.c2f_thresh || 2 * (iter_id + 1) >= params.max_iters){
+				setFineLevel();
+				coarse_level = false;
+				//! similarity values at different levels are not comparable
+				optimizer.startLevel();
+			}
+		} else if(converged){
+			break;
+		}
 
 		am.clearFirstIter();
 	}
 
+	if(coarse_level){ setFineLevel(); }
+	if(params.debug_mode){ optimizer.printStats(); }
 	if(params.enable_learning){
 		am.updateModel(ssm.getPts());
 	}
@@ -238,6 +263,12 @@ void FCLK<AM, SSM >::setRegion(const cv::Mat& corners){
 		} else{
 			am.cmptSelfHessian(d2f_dp2, dI0_dpssm);
 		}
+		if(params.leven_marq || coarseToFineEnabled()){
+			init_d2f_dp2 = d2f_dp2;
+		}
+		if(coarseToFineEnabled()){
+			cmptCoarseInitSelfHessian();
+		}
 	}
 	ssm.getCorners(cv_corners_mat);
 }
@@ -14,6 +14,9 @@
 #define FC_SHOW_GRID false
 #define FC_SHOW_PATCH false
 #define FC_PATCH_RESIZE_FACTOR 1.0
+#define FC_C2F_SUB_RATIO 1
+#define FC_C2F_THRESH 1e-2
+#define FC_STAGNATION_ITERS 0
 #define FC_DEBUG_MODE false
 
 _MTF_BEGIN_NAMESPACE
@@ -24,7 +27,8 @@ bool _chained_warp, bool _leven_marq,
 double _lm_delta_init, double _lm_delta_update, 
 bool _enable_learning, bool _write_ssm_updates,
 bool _show_grid, bool _show_patch,
-double _patch_resize_factor, bool _debug_mode) :
+double _patch_resize_factor, int _c2f_sub_ratio, double _c2f_thresh,
+int _stagnation_iters, bool _debug_mode) :
 max_iters(_max_iters),
 epsilon(_epsilon),
 hess_type(_hess_type),
@@ -38,6 +42,9 @@ write_ssm_updates(_write_ssm_updates),
 show_grid(_show_grid),
 show_patch(_show_patch),
 patch_resize_factor(_patch_resize_factor),
+c2f_sub_ratio(_c2f_sub_ratio),
+c2f_thresh(_c2f_thresh),
+stagnation_iters(_stagnation_iters),
 debug_mode(_debug_mode){}
 
 FCLKParams::FCLKParams(const FCLKParams *params) :
@@ -54,6 +61,9 @@ write_ssm_updates(FC_WRITE_SSM_UPDATES),
 show_grid(FC_SHOW_GRID),
 show_patch(FC_SHOW_PATCH),
 patch_resize_factor(FC_PATCH_RESIZE_FACTOR),
+c2f_sub_ratio(FC_C2F_SUB_RATIO),
+c2f_thresh(FC_C2F_THRESH),
+stagnation_iters(FC_STAGNATION_ITERS),
 debug_mode(FC_DEBUG_MODE){
 	if(params){
 		max_iters = params->max_iters;
@@ -69,6 +79,9 @@ debug_mode(FC_DEBUG_MODE){
 		show_grid = params->show_grid;
 		show_patch = params->show_patch;
 		patch_resize_factor = params->patch_resize_factor;
+		c2f_sub_ratio = params->c2f_sub_ratio;
+		c2f_thresh = params->c2f_thresh;
+		stagnation_iters = params->stagnation_iters;
 		debug_mode = params->debug_mode;
 	}
 }
@@ -1,4 +1,5 @@
 #include "FESM.h"
+#include "../Utilities/profUtils.h"
 _MTF_BEGIN_NAMESPACE
 
 // ----------------------------------------------------------------------------------------//
@@ -1,5 +1,6 @@
 #include "FESMBase.h"
 #include "../Utilities/miscUtils.h"
+#include "../Utilities/profUtils.h"
 #include <time.h>
 #include "opencv2/imgproc/imgproc.hpp"
 #include <stdexcept>
@@ -10,12 +11,20 @@ template <class AM, class SSM>
 FESMBase<AM, SSM >::FESMBase(const ParamType *esm_params,
 	const AMParams *am_params, const SSMParams *ssm_params) :
 	SearchMethod<AM, SSM>(am_params, ssm_params),
-	params(esm_params){
+	params(esm_params),
+	optimizer(params.max_iters, params.upd_thresh, params.leven_marq,
+	params.lm_delta_init, params.lm_delta_update, params.stagnation_iters){
 	printf("\n");
 	printf("Using FESM tracker with:\n");
 	printf("max_iters: %d\n", params.max_iters);
-	printf("epsilon: %f\n", params.epsilon);
+	printf("upd_thresh: %f\n", params.upd_thresh);
 	printf("sec_ord_hess: %d\n", params.sec_ord_hess);
+	printf("leven_marq: %d\n", params.leven_marq);
+	if(params.leven_marq){
+		printf("lm_delta_init: %f\n", params.lm_delta_init);
+		printf("lm_delta_update: %f\n", params.lm_delta_update);
+	}
+	printf("stagnation_iters: %d\n", params.stagnation_iters);
 	printf("enable_spi: %d\n", params.enable_spi);
 	printf("spi_thresh: %f\n", params.spi_thresh);
 	printf("debug_mode: %d\n", params.debug_mode);
@@ -34,8 +43,10 @@ FESMBase<AM, SSM >::FESMBase(const ParamType *esm_params,
 	max_pix_diff = 0;
 
 	ssm_update.resize(ssm.getStateSize());
+	inv_ssm_update.resize(ssm.getStateSize());
 	jacobian.resize(ssm.getStateSize());
 	hessian.resize(ssm.getStateSize(), ssm.getStateSize());
+	optimizer.setStateSize(ssm.getStateSize());
 
 	init_pix_jacobian.resize(am.getPixCount(), ssm.getStateSize());
 	curr_pix_jacobian.resize(am.getPixCount(), ssm.getStateSize());
@@ -73,6 +84,7 @@ void FESMBase<AM, SSM >::update(){
 	write_frame_id(frame_id);
 
 	am.setFirstIter();
+	optimizer.startFrame();
 	for(int iter_id = 0; iter_id < params.max_iters; iter_id++){
 		init_timer();
 
@@ -82,12 +94,19 @@ void FESMBase<AM, SSM >::update(){
 
 		if(params.enable_spi){ updateSPIMask(); }
 
-		updatePixJacobian();
-
 		// compute the prerequisites for the gradient functions
 		am.updateSimilarity();
 		record_event("am.update");
 
+		if(!optimizer.acceptStep(am.getSimilarity())){
+			//! undo the last update
+			ssm.invertState(inv_ssm_update, ssm_update);
+			ssm.compositionalUpdate(inv_ssm_update);
+			continue;
+		}
+
+		updatePixJacobian();
+
 		// update the gradient of the error norm w.r.t. current pixel values
 		am.updateCurrGrad();
 		record_event("am.updateCurrGrad");
@@ -99,8 +118,8 @@ void FESMBase<AM, SSM >::update(){
 		updateJacobian();
 		updateHessian();
 
-		ssm_update = -hessian.colPivHouseholderQr().solve(jacobian.transpose());
-		record_event("ssm_update");
+		optimizer.solve(ssm_update, jacobian, hessian);
+		record_event("optimizer.solve");
 
 		prev_corners = ssm.getCorners();
 		updateSSM();
@@ -111,10 +130,7 @@ void FESMBase<AM, SSM >::update(){
 
 		write_data(time_fname);
 
-		if(update_norm < params.epsilon){
-			if(params.debug_mode){
-				printf("n_iters: %d\n", iter_id + 1);
-			}
+		if(optimizer.converged(update_norm)){
 			break;
 		}
 
@@ -122,6 +138,7 @@ void FESMBase<AM, SSM >::update(){
 
 		am.clearFirstIter();
 	}
+	if(params.debug_mode){ optimizer.printStats(); }
 	ssm.getCorners(cv_corners_mat);
 }
 
@@ -205,6 +222,7 @@ void FESMBase<AM, SSM >::initializeSPIMask(){
 
 	printf("Using Selective Pixel Integration\n");
 	pix_mask.resize(am.getPixCount());
+	pix_mask.fill(true);
 	ssm.setSPIMask(pix_mask.data());
 	am.setSPIMask(pix_mask.data());
 
@@ -225,6 +243,9 @@ void FESMBase<AM, SSM >::updateSPIMask(){
 	record_event("rel_pix_diff");
 
 	pix_mask = rel_pix_diff.cwiseAbs().array() < params.spi_thresh;
+	//! the AM and SSM only process the active pixels compacted when the mask is set
+	ssm.setSPIMask(pix_mask.data());
+	am.setSPIMask(pix_mask.data());
 	record_event("pix_mask");
 
 	if(params.debug_mode){
@@ -1153,6 +1153,8 @@ void FeatureTracker<SSM>::matchKeyPoints() {
 	prev_pts.clear();
 	curr_pts.clear();
 	good_indices.clear();
+	//! PROSAC samples the most distinctive matches, i.e. those with the lowest distance ratio, first
+	est_params.pt_costs.clear();
 	if(params.rebuild_index){
 		for(int pt_id = 0; pt_id < n_key_pts; ++pt_id){
 			if(params.max_dist_ratio < 0 ||
@@ -1160,6 +1162,8 @@ void FeatureTracker<SSM>::matchKeyPoints() {
 				curr_pts.push_back(curr_key_pts[best_idices.at<int>(pt_id, 0)].pt);
 				prev_pts.push_back(prev_key_pts[pt_id].pt);
 				good_indices.push_back(pt_id);
+				est_params.pt_costs.push_back(best_distances.at<float>(pt_id, 0) /
+					(best_distances.at<float>(pt_id, 1) + FLT_EPSILON));
 			}
 		}
 	} else{
@@ -1173,6 +1177,8 @@ void FeatureTracker<SSM>::matchKeyPoints() {
 				prev_pts.push_back(prev_key_pts[best_idices.at<int>(pt_id, 0)].pt);
 				curr_pts.push_back(curr_key_pts[pt_id].pt);
 				good_indices.push_back(pt_id);
+				est_params.pt_costs.push_back(best_distances.at<float>(pt_id, 0) /
+					(best_distances.at<float>(pt_id, 1) + FLT_EPSILON));
 			}
 		}
 	}
@@ -0,0 +1,222 @@
+#include "mtf/SM/FixedLK.h"
+#include "mtf/Utilities/excpUtils.h"
+
+#include <type_traits>
+
+_MTF_BEGIN_NAMESPACE
+
+template<int ResX, int ResY, typename ScalarT>
+FixedLK<ResX, ResY, ScalarT>::FixedLK(const ParamType *flk_params,
+	const AMParams *am_params, const SSMParams *ssm_params) :
+	SearchMethod<SSD, Homography>(am_params, ssm_params),
+	params(flk_params),
+	dI0_dpssm(nullptr), dIt_dpssm(nullptr), mean_dI_dpssm(nullptr){
+
+	printf("\n");
+	printf("Using Fixed Resolution %s SM with:\n", ParamType::toString(params.sm_type));
+	printf("resolution: %d x %d\n", ResX, ResY);
+	printf("precision: %s\n", std::is_same<ScalarT, float>::value ? "single" : "double");
+	printf("max_iters: %d\n", params.max_iters);
+	printf("epsilon: %f\n", params.epsilon);
+	printf("leven_marq: %d\n", params.leven_marq);
+	if(params.leven_marq){
+		printf("lm_delta_init: %f\n", params.lm_delta_init);
+		printf("lm_delta_update: %f\n", params.lm_delta_update);
+	}
+	printf("debug_mode: %d\n", params.debug_mode);
+
+	printf("appearance model: %s\n", am.name.c_str());
+	printf("state space model: %s\n", ssm.name.c_str());
+	printf("\n");
+
+	name = "flk";
+	frame_id = 0;
+
+	if(am.getPatchSize() != NPix || am.getNChannels() != 1){
+		throw utils::InvalidArgument(
+			cv::format("FixedLK :: Patch size %d with %d channels does not match the compiled resolution %d x %d",
+			am.getPatchSize(), am.getNChannels(), ResX, ResY));
+	}
+	if(ssm.getStateSize() != SSMStateSize || am.getStateSize() != 0){
+		throw utils::InvalidArgument(
+			cv::format("FixedLK :: Invalid AM / SSM state sizes: %d / %d",
+			am.getStateSize(), ssm.getStateSize()));
+	}
+	dI0_dpssm_data.resize(NPix, SSMStateSize);
+	new (&dI0_dpssm) PixJacT(dI0_dpssm_data.data());
+	if(params.sm_type != SMType::ICLK){
+		dIt_dpssm_data.resize(NPix, SSMStateSize);
+		new (&dIt_dpssm) PixJacT(dIt_dpssm_data.data());
+	}
+	if(params.sm_type == SMType::ESM){
+		mean_dI_dpssm_data.resize(NPix, SSMStateSize);
+		new (&mean_dI_dpssm) PixJacT(mean_dI_dpssm_data.data());
+	}
+	if(!std::is_same<ScalarT, double>::value){
+		I_diff_data.resize(NPix);
+	}
+	ssm_update.resize(SSMStateSize);
+	inv_ssm_update.resize(SSMStateSize);
+}
+
+template<int ResX, int ResY, typename ScalarT>
+void FixedLK<ResX, ResY, ScalarT>::initialize(const cv::Mat &corners){
+	am.clearInitStatus();
+	ssm.clearInitStatus();
+
+	frame_id = 0;
+
+	ssm.initialize(corners, am.getNChannels());
+
+	am.initializePixVals(ssm.getPts());
+	am.initializeSimilarity();
+	am.initializeGrad();
+	am.initializeHess();
+
+	am.initializePixGrad(ssm.getPts());
+	ssm.cmptWarpedPixJacobian(dI0_dpssm, am.getInitPixGrad());
+	if(params.sm_type == SMType::ICLK){
+		cmptHessian(init_d2f_dp2, dI0_dpssm);
+	}
+	ssm.getCorners(cv_corners_mat);
+}
+
+template<int ResX, int ResY, typename ScalarT>
+void FixedLK<ResX, ResY, ScalarT>::setRegion(const cv::Mat& corners){
+	ssm.setCorners(corners);
+	if(params.sm_type == SMType::ICLK){
+		//! the initial points have been reset too so the constant Jacobian and Hessian must be recomputed
+		ssm.cmptWarpedPixJacobian(dI0_dpssm, am.getInitPixGrad());
+		cmptHessian(init_d2f_dp2, dI0_dpssm);
+	}
+	ssm.getCorners(cv_corners_mat);
+}
+
+template<int ResX, int ResY, typename ScalarT>
+void FixedLK<ResX, ResY, ScalarT>::update(){
+	++frame_id;
+
+	am.setFirstIter();
+
+	double prev_f = 0;
+	double lm_delta = params.lm_delta_init;
+	bool state_reset = false;
+
+	for(int iter_id = 0; iter_id < params.max_iters; ++iter_id){
+		am.updatePixVals(ssm.getPts());
+		am.updateSimilarity(false);
+
+		if(params.leven_marq && !state_reset){
+			double f = am.getSimilarity();
+			if(iter_id > 0){
+				if(f < prev_f){
+					lm_delta *= params.lm_delta_update;
+					//! undo the last update
+					if(params.sm_type == SMType::ICLK){
+						ssm.compositionalUpdate(ssm_update);
+					} else{
+						ssm.invertState(inv_ssm_update, ssm_update);
+						ssm.compositionalUpdate(inv_ssm_update);
+					}
+					state_reset = true;
+					continue;
+				}
+				if(f > prev_f){
+					lm_delta /= params.lm_delta_update;
+				}
+			}
+			prev_f = f;
+		}
+		state_reset = false;
+
+		//! the gradient of SSD w.r.t. I0 shares memory with It - I0
+		const ScalarT *I_diff_ptr;
+		if(std::is_same<ScalarT, double>::value){
+			I_diff_ptr = reinterpret_cast<const ScalarT*>(am.getInitGrad().data());
+		} else{
+			I_diff_data = am.getInitGrad().transpose().template cast<ScalarT>();
+			I_diff_ptr = I_diff_data.data();
+		}
+		const PixErrT I_diff(I_diff_ptr);
+		switch(params.sm_type){
+		case SMType::ICLK:
+			cmptJacobian(df_dp, dI0_dpssm, I_diff);
+			d2f_dp2 = init_d2f_dp2;
+			break;
+		case SMType::FCLK:
+			am.updatePixGrad(ssm.getPts());
+			ssm.cmptWarpedPixJacobian(dIt_dpssm, am.getCurrPixGrad());
+			cmptJacobian(df_dp, dIt_dpssm, I_diff);
+			cmptHessian(d2f_dp2, dIt_dpssm);
+			break;
+		case SMType::ESM:
+			am.updatePixGrad(ssm.getPts());
+			ssm.cmptWarpedPixJacobian(dIt_dpssm, am.getCurrPixGrad());
+			mean_dI_dpssm = (dI0_dpssm + dIt_dpssm) * ScalarT(0.5);
+			cmptJacobian(df_dp, mean_dI_dpssm, I_diff);
+			cmptHessian(d2f_dp2, mean_dI_dpssm);
+			break;
+		}
+		df_dp_d = df_dp.template cast<double>();
+		d2f_dp2_d = d2f_dp2.template cast<double>();
+		if(params.leven_marq){
+			d2f_dp2_d.diagonal() *= 1 + lm_delta;
+		}
+		/**
+		df_dp and d2f_dp2 are the derivatives of the positive SSD rather than its negative
+		so the Gauss Newton step is H^-1*J^T*(It - I0) which is applied in the inverse direction
+		by ICLK and in the forward direction by FCLK and ESM after negation
+		*/
+		ssm_update = d2f_dp2_d.colPivHouseholderQr().solve(df_dp_d);
+
+		prev_corners = ssm.getCorners();
+
+		if(params.sm_type == SMType::ICLK){
+			ssm.invertState(inv_ssm_update, ssm_update);
+			ssm.compositionalUpdate(inv_ssm_update);
+		} else{
+			ssm_update = -ssm_update;
+			ssm.compositionalUpdate(ssm_update);
+		}
+		double update_norm = (prev_corners - ssm.getCorners()).squaredNorm();
+		if(update_norm < params.epsilon){
+			if(params.debug_mode){
+				printf("n_iters: %d\n", iter_id + 1);
+			}
+			break;
+		}
+		am.clearFirstIter();
+	}
+	ssm.getCorners(cv_corners_mat);
+}
+
+template<int ResX, int ResY, typename ScalarT>
+void FixedLK<ResX, ResY, ScalarT>::cmptJacobian(JacProdT &jacobian,
+	const PixJacT &dI_dpssm, const PixErrT &I_diff) const{
+	for(int state_id = 0; state_id < SSMStateSize; ++state_id){
+		jacobian(state_id) = dI_dpssm.col(state_id).dot(I_diff);
+	}
+}
+
+template<int ResX, int ResY, typename ScalarT>
+void FixedLK<ResX, ResY, ScalarT>::cmptHessian(HessProdT &hessian,
+	const PixJacT &dI_dpssm) const{
+	for(int col_id = 0; col_id < SSMStateSize; ++col_id){
+		for(int row_id = col_id; row_id < SSMStateSize; ++row_id){
+			hessian(row_id, col_id) = hessian(col_id, row_id) =
+				dI_dpssm.col(row_id).dot(dI_dpssm.col(col_id));
+		}
+	}
+}
+
+_MTF_END_NAMESPACE
+
+#ifndef HEADER_ONLY_MODE
+//! resolutions supported by the fixed resolution mode; these must match the ones in getFixedResTracker
+template class mtf::FixedLK<25, 25>;
+template class mtf::FixedLK<50, 50>;
+template class mtf::FixedLK<100, 100>;
+template class mtf::FixedLK<25, 25, float>;
+template class mtf::FixedLK<50, 50, float>;
+template class mtf::FixedLK<100, 100, float>;
+#endif
@@ -0,0 +1,57 @@
+#include "mtf/SM/FixedLKParams.h"
+#include "mtf/Utilities/excpUtils.h"
+
+#define FLK_SM_TYPE 2
+#define FLK_MAX_ITERS 30
+#define FLK_EPSILON 1e-4
+#define FLK_LEVEN_MARQ false
+#define FLK_LM_DELTA_INIT 0.01
+#define FLK_LM_DELTA_UPDATE 10
+#define FLK_DEBUG_MODE false
+
+_MTF_BEGIN_NAMESPACE
+
+FixedLKParams::FixedLKParams(SMType _sm_type, int _max_iters, double _epsilon,
+bool _leven_marq, double _lm_delta_init,
+double _lm_delta_update, bool _debug_mode) :
+sm_type(_sm_type),
+max_iters(_max_iters),
+epsilon(_epsilon),
+leven_marq(_leven_marq),
+lm_delta_init(_lm_delta_init),
+lm_delta_update(_lm_delta_update),
+debug_mode(_debug_mode){}
+
+FixedLKParams::FixedLKParams(const FixedLKParams *params) :
+sm_type(static_cast<SMType>(FLK_SM_TYPE)),
+max_iters(FLK_MAX_ITERS),
+epsilon(FLK_EPSILON),
+leven_marq(FLK_LEVEN_MARQ),
+lm_delta_init(FLK_LM_DELTA_INIT),
+lm_delta_update(FLK_LM_DELTA_UPDATE),
+debug_mode(FLK_DEBUG_MODE){
+	if(params){
+		sm_type = params->sm_type;
+		max_iters = params->max_iters;
+		epsilon = params->epsilon;
+		leven_marq = params->leven_marq;
+		lm_delta_init = params->lm_delta_init;
+		lm_delta_update = params->lm_delta_update;
+		debug_mode = params->debug_mode;
+	}
+}
+const char*  FixedLKParams::toString(SMType sm_type){
+	switch(sm_type){
+	case SMType::ICLK:
+		return "Inverse Compositional";
+	case SMType::FCLK:
+		return "Forward Compositional";
+	case SMType::ESM:
+		return "Efficient Second order Minimization";
+	default:
+		throw utils::InvalidArgument(
+			cv::format("FixedLKParams :: Invalid SM type provided: %d", sm_type));
+	}
+}
+
+_MTF_END_NAMESPACE
@@ -1,6 +1,7 @@
 #include "mtf/SM/GNN.h"
 #include "mtf/Utilities//miscUtils.h"
 #include <fstream> 
+#include <atomic>
 
 _MTF_BEGIN_NAMESPACE
 namespace gnn{
@@ -22,6 +23,8 @@ namespace gnn{
 		printf("max_steps: %d\n", params.max_steps);
 		printf("cmpt_dist_thresh: %d\n", params.cmpt_dist_thresh);
 		printf("random_start: %d\n", params.random_start);
+		printf("n_workers: %d\n", params.n_workers);
+		printf("build_block_size: %d\n", params.build_block_size);
 		printf("verbose: %d\n", params.verbose);
 
 		dist_computed = false;
@@ -59,60 +62,93 @@ namespace gnn{
 	}
 	template <class DistType>
 	void GNN<DistType>::buildGraph(const double *dataset){
-		if(!dist_computed && n_samples <= params.cmpt_dist_thresh){
+		if(!dist_computed && params.n_workers <= 1 && n_samples <= params.cmpt_dist_thresh){
 			// distance is pre computed and stored only if the no. of samples is not large enough to 
-			// cause a bad_alloc error on attempting to allocate memory for this
+			// cause a bad_alloc error on attempting to allocate memory for this;
+			// this halves the distance computations for symmetrical distances but cannot be done in parallel
 			computeDistances(dataset);
 		}
 		nodes.resize(n_samples);
-		std::vector<IndxDist> dists(params.degree + 1);
 		if(params.verbose){
 			printf("Processing graph nodes...\n");
 		}
+		/**
+		nodes are processed in blocks of rows so that only the neighbour lists of the block being processed
+		by each worker are kept in memory; the distances of each block are computed one tile of columns at a time
+		so that the samples in the tile remain in cache while being compared with all the rows of the block;
+		since neighbours are ordered by distance and then index, the graph is the same irrespective of
+		the no. of workers and the block size
+		*/
+		const int block_size = params.build_block_size > 0 ? params.build_block_size : 1;
+		const int list_size = params.degree + 1;
+		const int n_blocks = (n_samples + block_size - 1) / block_size;
+		const int n_workers = params.n_workers > 1 ? min(params.n_workers, n_blocks) : 1;
+		std::atomic<int> n_done_nodes(0);
 		mtf_clock_get(build_state_time);
-		for(int id1 = 0; id1 < n_samples; ++id1){
-			nodes[id1].nns_inds.resize(params.degree);
-			nodes[id1].capacity = params.degree;
-			nodes[id1].size = 0;
-			int count = 0;
-			for(int id2 = 0; id2 < n_samples; ++id2){
-				double dist = dist_computed ? dataset_distances(id1, id2) :
-					(*dist_func)(dataset + (id1*n_dims), dataset + (id2*n_dims), n_dims);
-				if(count < params.degree + 1){
-					dists[count].idx = id2;
-					dists[count].dist = dist;
-					++count;
-				} else if(dist < dists[count - 1].dist || (dist == dists[count - 1].dist &&
-					id2 < dists[count - 1].idx)) {
-					dists[count - 1].idx = id2;
-					dists[count - 1].dist = dist;
-				} else {
-					continue;
+		utils::runWorkers(n_workers, [&](unsigned int worker_id){
+			std::vector<IndxDist> dists(block_size*list_size);
+			std::vector<int> counts(block_size);
+			for(int block_id = worker_id; block_id < n_blocks; block_id += n_workers){
+				const int row_start = block_id*block_size;
+				const int row_end = min(row_start + block_size, n_samples);
+				std::fill(counts.begin(), counts.end(), 0);
+				for(int col_start = 0; col_start < n_samples; col_start += block_size){
+					const int col_end = min(col_start + block_size, n_samples);
+					for(int id1 = row_start; id1 < row_end; ++id1){
+						IndxDist *row_dists = dists.data() + (id1 - row_start)*list_size;
+						int &count = counts[id1 - row_start];
+						for(int id2 = col_start; id2 < col_end; ++id2){
+							double dist = dist_computed ? dataset_distances(id1, id2) :
+								(*dist_func)(dataset + (id1*n_dims), dataset + (id2*n_dims), n_dims);
+							insertNeighbor(row_dists, count, list_size, id2, dist);
+						}
+					}
 				}
-				int id3 = count - 1;
-				while(id3 >= 1 && (dists[id3].dist < dists[id3 - 1].dist || (dists[id3].dist == dists[id3 - 1].dist &&
-					dists[id3].idx < dists[id3 - 1].idx))){
-					swap<int>(&dists[id3].idx, &dists[id3 - 1].idx);
-					swap<double>(&dists[id3].dist, &dists[id3 - 1].dist);
-					--id3;
+				for(int id1 = row_start; id1 < row_end; ++id1){
+					const IndxDist *row_dists = dists.data() + (id1 - row_start)*list_size;
+					nodes[id1].nns_inds.resize(params.degree);
+					nodes[id1].capacity = params.degree;
+					nodes[id1].size = 0;
+					// the nearest sample is the node itself
+					for(int j = 0; j < counts[id1 - row_start] - 1; j++){
+						addNode(&nodes[id1], row_dists[j + 1].idx);
+					}
 				}
-			}
-			for(int j = 0; j < params.degree; j++){
-				int nns_ind = dists[j + 1].idx;
-				addNode(&nodes[id1], nns_ind);
-			}
-			if(params.verbose){
-				mtf_clock_get(end_time);
-				double elapsed_time;
-				mtf_clock_measure(build_state_time, end_time, elapsed_time);
-				if((id1 + 1) % 100 == 0){
+				int n_done = n_done_nodes += row_end - row_start;
+				if(params.verbose && worker_id == 0){
+					mtf_clock_get(end_time);
+					double elapsed_time;
+					mtf_clock_measure(build_state_time, end_time, elapsed_time);
 					printf("Done %d/%d nodes (%6.2f%%). Time elapsed: %f secs...\n",
-						id1 + 1, n_samples, double(id1 + 1) / double(n_samples) * 100,
+						n_done, n_samples, double(n_done) / double(n_samples) * 100,
 						elapsed_time);
 				}
 			}
+		});
+	}
+
+	template <class DistType>
+	void GNN<DistType>::insertNeighbor(IndxDist *dists, int &count, int max_count,
+		int idx, double dist) const{
+		if(count < max_count){
+			dists[count].idx = idx;
+			dists[count].dist = dist;
+			++count;
+		} else if(dist < dists[count - 1].dist || (dist == dists[count - 1].dist &&
+			idx < dists[count - 1].idx)) {
+			dists[count - 1].idx = idx;
+			dists[count - 1].dist = dist;
+		} else {
+			return;
+		}
+		int id = count - 1;
+		while(id >= 1 && (dists[id].dist < dists[id - 1].dist || (dists[id].dist == dists[id - 1].dist &&
+			dists[id].idx < dists[id - 1].idx))){
+			std::swap(dists[id], dists[id - 1]);
+			--id;
 		}
-	}	
+	}
+
 	template <class DistType>
 	void GNN<DistType>::searchGraph(const double *query, const double *dataset,
 		int *nn_ids, double *nn_dists, int K){
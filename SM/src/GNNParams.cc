@@ -4,6 +4,8 @@
 #define GNN_MAX_STEPS 10
 #define GNN_CMPT_DIST_THRESH 10000
 #define GNN_RANDOM_START 0
+#define GNN_N_WORKERS 1
+#define GNN_BUILD_BLOCK_SIZE 64
 #define GNN_VERBOSE 0
 
 _MTF_BEGIN_NAMESPACE
@@ -11,11 +13,14 @@ _MTF_BEGIN_NAMESPACE
 namespace gnn{
 	GNNParams::GNNParams(int _degree, int _max_steps,
 		int _cmpt_dist_thresh, bool _random_start,
+		int _n_workers, int _build_block_size,
 		bool _verbose) :
 		degree(_degree),
 		max_steps(_max_steps),
 		cmpt_dist_thresh(_cmpt_dist_thresh),
 		random_start(_random_start),
+		n_workers(_n_workers),
+		build_block_size(_build_block_size),
 		verbose(_verbose){}
 
 	GNNParams::GNNParams(const GNNParams *params) :
@@ -23,12 +28,16 @@ namespace gnn{
 		max_steps(GNN_MAX_STEPS),
 		cmpt_dist_thresh(GNN_CMPT_DIST_THRESH),
 		random_start(GNN_RANDOM_START),
+		n_workers(GNN_N_WORKERS),
+		build_block_size(GNN_BUILD_BLOCK_SIZE),
 		verbose(GNN_VERBOSE){
 		if(params){
 			degree = params->degree;
 			max_steps = params->max_steps;
 			cmpt_dist_thresh = params->cmpt_dist_thresh;
 			random_start = params->random_start;
+			n_workers = params->n_workers;
+			build_block_size = params->build_block_size;
 			verbose = params->verbose;
 		}
 	}
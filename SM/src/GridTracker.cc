@@ -95,10 +95,10 @@ void GridTrackerParams::updateRes(){
 template<class SSM>
 GridTracker<SSM>::GridTracker(const vector<TrackerBase*> _trackers,
 	const ParamType *grid_params, const EstimatorParams *_est_params,
-	const SSMParams *_ssm_params) :
+	const SSMParams *_ssm_params, const vector<TrackerBase*> _fb_trackers) :
 	GridBase(_trackers), ssm(_ssm_params),
 	params(grid_params), est_params(_est_params), 
-	enable_fb_err_est(false){
+	enable_fb_err_est(false), fb_trackers(_fb_trackers), fb_buffer_id(0){
 	printf("\n");
 	printf("Using Grid tracker with:\n");
 	printf("grid_size: %d x %d\n", params.grid_size_x, params.grid_size_y);
@@ -147,7 +147,6 @@ GridTracker<SSM>::GridTracker(const vector<TrackerBase*> _trackers,
 	if(params.dyn_patch_size){
 		printf("Using dynamic patch sizes\n");
 	}
-	patch_corners.create(2, 4, CV_64FC1);
 	cv_corners_mat.create(2, 4, CV_64FC1);
 	prev_pts.resize(n_trackers);
 	curr_pts.resize(n_trackers);
@@ -188,6 +187,14 @@ GridTracker<SSM>::GridTracker(const vector<TrackerBase*> _trackers,
 		enable_fb_err_est = true;
 		fb_prev_pts.resize(n_trackers);
 		fb_err_mask.resize(n_trackers);
+		if(!fb_trackers.empty()){
+			if(static_cast<int>(fb_trackers.size()) != n_trackers){
+				throw utils::InvalidArgument(
+					cv::format("GridTracker :: No. of backward trackers: %d does not match the no. of patch trackers: %d",
+					fb_trackers.size(), n_trackers));
+			}
+			printf("Using %d backward trackers\n", n_trackers);
+		}
 	}
 
 	if(params.show_trackers){
@@ -203,14 +210,27 @@ GridTracker<SSM>::GridTracker(const vector<TrackerBase*> _trackers,
 }
 template<class SSM>
 void GridTracker<SSM>::setImage(const cv::Mat &img) {
+	setTrackerImages(trackers, img);
+	if(!fb_trackers.empty()){
+		setTrackerImages(fb_trackers, img);
+	}
+	curr_img = img;
+	if(params.show_trackers && curr_img_disp.empty()){
+		curr_img_disp.create(curr_img.rows, curr_img.cols, CV_8UC3);
+	}
+}
+
+template<class SSM>
+void GridTracker<SSM>::setTrackerImages(const vector<TrackerBase*> &_trackers,
+	const cv::Mat &img) {
 	if(params.enable_pyr){
-		PyramidalTracker *init_pyr_tracker = dynamic_cast<PyramidalTracker*>(trackers[0]);
+		PyramidalTracker *init_pyr_tracker = dynamic_cast<PyramidalTracker*>(_trackers[0]);
 		if(!init_pyr_tracker){
 			throw utils::InvalidArgument("GridTracker:: Patch tracker 0 is not a valid pyramidal tracker");
 		}
-		trackers[0]->setImage(img);
+		_trackers[0]->setImage(img);
 		for(int tracker_id = 1; tracker_id < n_trackers; ++tracker_id){
-			PyramidalTracker *curr_pyr_tracker = dynamic_cast<PyramidalTracker*>(trackers[tracker_id]);
+			PyramidalTracker *curr_pyr_tracker = dynamic_cast<PyramidalTracker*>(_trackers[tracker_id]);
 			if(!curr_pyr_tracker){
 				throw utils::InvalidArgument(cv::format("GridTracker:: Patch tracker %d is not a valid pyramidal tracker", tracker_id));
 			}
@@ -218,15 +238,11 @@ void GridTracker<SSM>::setImage(const cv::Mat &img) {
 		}
 	} else{
 		for(int tracker_id = 0; tracker_id < n_trackers; tracker_id++){
-			if(img.type() == trackers[tracker_id]->inputType()){
-				trackers[tracker_id]->setImage(img);
+			if(img.type() == _trackers[tracker_id]->inputType()){
+				_trackers[tracker_id]->setImage(img);
 			}
 		}
 	}
-	curr_img = img;
-	if(params.show_trackers && curr_img_disp.empty()){
-		curr_img_disp.create(curr_img.rows, curr_img.cols, CV_8UC3);
-	}
 }
 
 template<class SSM>
@@ -239,7 +255,7 @@ void GridTracker<SSM>::initialize(const cv::Mat &corners) {
 	}
 	ssm.getCorners(cv_corners_mat);
 	if(enable_fb_err_est){
-		prev_img = curr_img.clone();
+		updatePrevImage();
 	}
 	if(params.show_trackers){ showTrackers(); }
 }
@@ -264,7 +280,7 @@ void GridTracker<SSM>::update() {
 #endif
 		if(enable_fb_err_est){
 			backwardEstimation();
-			prev_img = curr_img.clone();
+			updatePrevImage();
 		} else{
 			ssm.estimateWarpFromPts(ssm_update, pix_mask, prev_pts, curr_pts, est_params);
 		}
@@ -290,32 +306,91 @@ void GridTracker<SSM>::setRegion(const cv::Mat& corners) {
 	ssm.getCorners(cv_corners_mat);
 }
 
+template<class SSM>
+void GridTracker<SSM>::updatePrevImage(){
+	//! backward trackers keep the buffer they were last given till the next setImage
+	//! so the new copy goes into the other one; copyTo only reallocates if the frame size or type changes
+	cv::Mat &prev_img_buffer = fb_img_buffers[fb_buffer_id];
+	curr_img.copyTo(prev_img_buffer);
+	prev_img = prev_img_buffer;
+	fb_buffer_id = 1 - fb_buffer_id;
+}
+
 template<class SSM>
 void GridTracker<SSM>::backwardEstimation(){
-	for(int tracker_id = 0; tracker_id < n_trackers; ++tracker_id){
-		cv::Mat tracker_location = trackers[tracker_id]->getRegion().clone();
+	if(fb_trackers.empty()){
+		for(int tracker_id = 0; tracker_id < n_trackers; ++tracker_id){
+			cv::Mat tracker_location = trackers[tracker_id]->getRegion().clone();
+			if(params.fb_reinit){
+				trackers[tracker_id]->initialize(tracker_location);
+			}
+			trackers[tracker_id]->setImage(prev_img);
+			trackers[tracker_id]->update();
+			utils::getCentroid(fb_prev_pts[tracker_id], trackers[tracker_id]->getRegion());
+			trackers[tracker_id]->setImage(curr_img);
+			trackers[tracker_id]->setRegion(tracker_location);
+		}
+	} else{
+		//! backward trackers are reinitialized at the forward locations in the current frame
+		//! before being switched to the previous one; they are still on the previous frame
+		//! from the last backward pass since setImage is only called once
 		if(params.fb_reinit){
-			trackers[tracker_id]->initialize(tracker_location);
+			setTrackerImages(fb_trackers, curr_img);
+#ifdef ENABLE_TBB
+			parallel_for(tbb::blocked_range<size_t>(0, n_trackers),
+				[&](const tbb::blocked_range<size_t>& r){
+				for(size_t tracker_id = r.begin(); tracker_id != r.end(); ++tracker_id){
+#else
+#ifdef ENABLE_OMP
+#pragma omp parallel for schedule(GRID_OMP_SCHD)
+#endif	
+			for(int tracker_id = 0; tracker_id < n_trackers; ++tracker_id){
+#endif
+				fb_trackers[tracker_id]->initialize(trackers[tracker_id]->getRegion());
+			}
+#ifdef ENABLE_TBB
+				});
+#endif
 		}
-		trackers[tracker_id]->setImage(prev_img);
-		trackers[tracker_id]->update();
-		utils::getCentroid(fb_prev_pts[tracker_id], trackers[tracker_id]->getRegion());
-		//patch_corners = trackers[tracker_id]->getRegion();
-		trackers[tracker_id]->setImage(curr_img);
-		trackers[tracker_id]->setRegion(tracker_location);
+		setTrackerImages(fb_trackers, prev_img);
+#ifdef ENABLE_TBB
+		parallel_for(tbb::blocked_range<size_t>(0, n_trackers),
+			[&](const tbb::blocked_range<size_t>& r){
+			for(size_t tracker_id = r.begin(); tracker_id != r.end(); ++tracker_id){
+#else
+#ifdef ENABLE_OMP
+#pragma omp parallel for schedule(GRID_OMP_SCHD)
+#endif	
+		for(int tracker_id = 0; tracker_id < n_trackers; ++tracker_id){
+#endif
+			if(!params.fb_reinit){
+				fb_trackers[tracker_id]->setRegion(trackers[tracker_id]->getRegion());
+			}
+			fb_trackers[tracker_id]->update();
+			utils::getCentroid(fb_prev_pts[tracker_id], fb_trackers[tracker_id]->getRegion());
+		}
+#ifdef ENABLE_TBB
+			});
+#endif
 	}
 
 	std::vector<cv::Point2f> prev_pts_masked, curr_pts_masked;
+	//! the forward-backward errors of the points that pass the check decide their PROSAC order
+	std::vector<float> fb_errs(n_trackers);
+	est_params.pt_costs.clear();
 	for(int tracker_id = 0; tracker_id < n_trackers; ++tracker_id){
 		double diff_x = fb_prev_pts[tracker_id].x - prev_pts[tracker_id].x;
 		double diff_y = fb_prev_pts[tracker_id].y - prev_pts[tracker_id].y;
+		double fb_err = diff_x*diff_x + diff_y*diff_y;
+		fb_errs[tracker_id] = static_cast<float>(fb_err);
 
-		if(diff_x*diff_x + diff_y*diff_y > params.fb_err_thresh){
+		if(fb_err > params.fb_err_thresh){
 			fb_err_mask[tracker_id] = false;
 		} else{
 			fb_err_mask[tracker_id] = true;
 			prev_pts_masked.push_back(prev_pts[tracker_id]);
 			curr_pts_masked.push_back(curr_pts[tracker_id]);
+			est_params.pt_costs.push_back(fb_errs[tracker_id]);
 		}
 	}
 	if(static_cast<int>(prev_pts_masked.size()) < est_params.n_model_pts){
@@ -323,6 +398,7 @@ void GridTracker<SSM>::backwardEstimation(){
 			if(fb_err_mask[tracker_id]){ continue; }
 			prev_pts_masked.push_back(prev_pts[tracker_id]);
 			curr_pts_masked.push_back(curr_pts[tracker_id]);
+			est_params.pt_costs.push_back(fb_errs[tracker_id]);
 			fb_err_mask[tracker_id] = true;
 			if(prev_pts_masked.size() == est_params.n_model_pts){
 				break;
@@ -343,6 +419,10 @@ void GridTracker<SSM>::backwardEstimation(){
 
 template<class SSM>
 void GridTracker<SSM>::resetTrackers(bool reinit){
+	if(reinit && !fb_trackers.empty() && !params.fb_reinit){
+		//! backward trackers may still be on the previous frame after the backward pass
+		setTrackerImages(fb_trackers, curr_img);
+	}
 #ifdef ENABLE_TBB
 	parallel_for(tbb::blocked_range<size_t>(0, n_trackers),
 		[&](const tbb::blocked_range<size_t>& r){
@@ -357,6 +437,10 @@ void GridTracker<SSM>::resetTrackers(bool reinit){
 		int row_id = tracker_id / params.grid_size_x;
 		int col_id = tracker_id % params.grid_size_x;
 
+		//! each iteration writes into its own stack buffer so the loop can be run in parallel
+		double patch_corners_data[8];
+		cv::Mat patch_corners(2, 4, CV_64FC1, patch_corners_data);
+
 		patch_corners.at<double>(0, 0) = ssm.getPts()(0, _linear_idx(row_id, col_id));
 		patch_corners.at<double>(1, 0) = ssm.getPts()(1, _linear_idx(row_id, col_id));
 
@@ -374,16 +458,22 @@ void GridTracker<SSM>::resetTrackers(bool reinit){
 			if(params.patch_centroid_inside){
 				utils::getCentroid(patch_centroid, patch_corners);
 			}
-			patch_corners = utils::Corners(cv::Rect_<double>(
-				patch_centroid(0) - centrod_dist_x, patch_centroid(1) - centrod_dist_y,
-				params.patch_size_x, params.patch_size_y)).mat();
+			double min_x = patch_centroid(0) - centrod_dist_x, min_y = patch_centroid(1) - centrod_dist_y;
+			double max_x = min_x + params.patch_size_x, max_y = min_y + params.patch_size_y;
+			patch_corners.at<double>(0, 0) = patch_corners.at<double>(0, 3) = min_x;
+			patch_corners.at<double>(0, 1) = patch_corners.at<double>(0, 2) = max_x;
+			patch_corners.at<double>(1, 0) = patch_corners.at<double>(1, 1) = min_y;
+			patch_corners.at<double>(1, 2) = patch_corners.at<double>(1, 3) = max_y;
 		}
 		if(reinit){
 			trackers[tracker_id]->initialize(patch_corners);
+			//! without fb_reinit, the backward trackers keep the templates of the forward ones
+			if(!fb_trackers.empty() && !params.fb_reinit){
+				fb_trackers[tracker_id]->initialize(patch_corners);
+			}
 		} else{
 			trackers[tracker_id]->setRegion(patch_corners);
 		}
-		//patch_corners = trackers[tracker_id]->getRegion();
 		utils::getCentroid(prev_pts[tracker_id], trackers[tracker_id]->getRegion());
 	}
 #ifdef ENABLE_TBB
@@ -213,6 +213,13 @@ void GridTrackerCV<SSM>::update() {
 	if(enable_fb_err_est){
 		backwardEstimation();
 	} else{
+		if(est_params.method == EstimatorParams::EstType::PROSAC){
+			//! PROSAC samples the points with the smallest LK residuals first
+			est_params.pt_costs.resize(n_pts);
+			for(int pt_id = 0; pt_id < n_pts; ++pt_id){
+				est_params.pt_costs[pt_id] = lk_status[pt_id] ? lk_error[pt_id] : FLT_MAX;
+			}
+		}
 		ssm.estimateWarpFromPts(ssm_update, pix_mask, prev_pts, curr_pts, est_params);
 	}
 
@@ -248,16 +255,22 @@ void GridTrackerCV<SSM>::backwardEstimation(){
 		search_window, params.pyramid_levels,
 		lk_term_criteria, lk_flags, params.min_eig_thresh);
 	std::vector<cv::Point2f> prev_pts_masked, curr_pts_masked;
+	//! the forward-backward errors of the points that pass the check decide their PROSAC order
+	std::vector<float> fb_errs(n_pts);
+	est_params.pt_costs.clear();
 	for(int pt_id = 0; pt_id < n_pts; ++pt_id){
 		double diff_x = fb_prev_pts[pt_id].x - prev_pts[pt_id].x;
 		double diff_y = fb_prev_pts[pt_id].y - prev_pts[pt_id].y;
+		double fb_err = diff_x*diff_x + diff_y*diff_y;
+		fb_errs[pt_id] = static_cast<float>(fb_err);
 
-		if(diff_x*diff_x + diff_y*diff_y > params.fb_err_thresh){
+		if(fb_err > params.fb_err_thresh){
 			fb_err_mask[pt_id] = false;
 		} else{
 			fb_err_mask[pt_id] = true;
 			prev_pts_masked.push_back(prev_pts[pt_id]);
 			curr_pts_masked.push_back(curr_pts[pt_id]);
+			est_params.pt_costs.push_back(fb_errs[pt_id]);
 		}
 	}
 	if(static_cast<int>(prev_pts_masked.size()) < est_params.n_model_pts){
@@ -265,6 +278,7 @@ void GridTrackerCV<SSM>::backwardEstimation(){
 			if(fb_err_mask[pt_id]){ continue; }
 			prev_pts_masked.push_back(prev_pts[pt_id]);
 			curr_pts_masked.push_back(curr_pts[pt_id]);
+			est_params.pt_costs.push_back(fb_errs[pt_id]);
 			fb_err_mask[pt_id] = true;
 			if(prev_pts_masked.size() == est_params.n_model_pts){
 				break;
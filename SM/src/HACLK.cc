@@ -10,7 +10,9 @@ template <class AM, class SSM>
 HACLK<AM, SSM >::HACLK(const ParamType *haclk_params,
 	const AMParams *am_params, const SSMParams *ssm_params) : 
 	SearchMethod<AM, SSM>(am_params, ssm_params),
-	params(haclk_params) {
+	params(haclk_params),
+	optimizer(params.max_iters, params.epsilon, params.leven_marq,
+	params.lm_delta_init, params.lm_delta_update, params.stagnation_iters){
 
 	printf("\n");
 	printf("Using HAC Lucas Kanade tracker with:\n");
@@ -19,6 +21,12 @@ HACLK<AM, SSM >::HACLK(const ParamType *haclk_params,
 	printf("rec_init_err_grad: %d\n", params.rec_init_err_grad);
 	printf("debug_mode: %d\n", params.debug_mode);
 	printf("hess_type: %d\n", params.hess_type);
+	printf("leven_marq: %d\n", params.leven_marq);
+	if(params.leven_marq){
+		printf("lm_delta_init: %f\n", params.lm_delta_init);
+		printf("lm_delta_update: %f\n", params.lm_delta_update);
+	}
+	printf("stagnation_iters: %d\n", params.stagnation_iters);
 	printf("appearance model: %s\n", am.name.c_str());
 	printf("state space model: %s\n", ssm.name.c_str());
 	printf("\n");
@@ -57,6 +65,7 @@ HACLK<AM, SSM >::HACLK(const ParamType *haclk_params,
 	curr_pix_jacobian.resize(am.getNPix(), ssm.getStateSize());
 	similarity_jacobian.resize(ssm.getStateSize());
 	hessian.resize(ssm.getStateSize(), ssm.getStateSize());
+	optimizer.setStateSize(ssm.getStateSize());
 }
 
 template <class AM, class SSM>
@@ -173,6 +182,7 @@ void HACLK<AM, SSM >::update(){
 		}
 	}
 	am.setFirstIter();
+	optimizer.startFrame();
 	for(int i = 0; i < params.max_iters; i++){
 #ifdef LOG_HACLK_TIMES
 		proc_times.clear();
@@ -183,6 +193,15 @@ void HACLK<AM, SSM >::update(){
 #ifdef LOG_HACLK_TIMES
 		RECORD_EVENT(start_time, end_time, "am.updatePixVals", proc_times, proc_labels);
 #endif		
+		am.updateSimilarity();
+#ifdef LOG_HACLK_TIMES
+		RECORD_EVENT(start_time, end_time, "am.update", proc_times, proc_labels);
+#endif
+		if(!optimizer.acceptStep(am.getSimilarity())){
+			//! undo the last update
+			resetSSM(ssm_update);
+			continue;
+		}
 		ssm.updateGradPts(am.getGradOffset());
 #ifdef LOG_HACLK_TIMES
 		RECORD_EVENT(start_time, end_time, "ssm.updateGradPts", proc_times, proc_labels);
@@ -195,10 +214,6 @@ void HACLK<AM, SSM >::update(){
 #ifdef LOG_HACLK_TIMES
 		RECORD_EVENT(start_time, end_time, "ssm.cmptInitPixJacobian", proc_times, proc_labels);
 #endif	
-		am.updateSimilarity();
-#ifdef LOG_HACLK_TIMES
-		RECORD_EVENT(start_time, end_time, "am.update", proc_times, proc_labels);
-#endif
 		am.updateCurrGrad();
 #ifdef LOG_HACLK_TIMES
 		RECORD_EVENT(start_time, end_time, "am.updateCurrGrad", proc_times, proc_labels);
@@ -240,9 +255,9 @@ void HACLK<AM, SSM >::update(){
 #endif
 		}
 
-		ssm_update = -hessian.colPivHouseholderQr().solve(similarity_jacobian.transpose());
+		optimizer.solve(ssm_update, similarity_jacobian, hessian);
 #ifdef LOG_HACLK_TIMES
-		RECORD_EVENT(start_time, end_time, "ssm_update", proc_times, proc_labels);
+		RECORD_EVENT(start_time, end_time, "optimizer.solve", proc_times, proc_labels);
 #endif
 		prev_corners = ssm.getCorners();
 		ssm.compositionalUpdate(ssm_update);
@@ -291,14 +306,12 @@ void HACLK<AM, SSM >::update(){
 			am.iter_id++;
 			}
 #endif
-		if(update_norm < params.epsilon){
-			if(params.debug_mode){
-				printf("n_iters: %d\n", i + 1);
-			}
+		if(optimizer.converged(update_norm)){
 			break;
 		}
 		am.clearFirstIter();
 		}
+	if(params.debug_mode){ optimizer.printStats(); }
 	ssm.getCorners(cv_corners_mat);
 
 	}
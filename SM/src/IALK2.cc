@@ -1,5 +1,6 @@
 #include "mtf/SM/IALK2.h"
 #include "mtf/Utilities/miscUtils.h"
+#include "mtf/Utilities/profUtils.h"
 #include <time.h>
 #include <stdexcept>
 
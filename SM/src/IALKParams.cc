@@ -8,6 +8,9 @@
 #define IALK_LEVEN_MARQ false
 #define IALK_LM_DELTA_INIT 0.01
 #define IALK_LM_DELTA_UPDATE 10
+#define IALK_C2F_SUB_RATIO 1
+#define IALK_C2F_THRESH 1e-2
+#define IALK_STAGNATION_ITERS 0
 #define IALK_DEBUG_MODE false
 
 _MTF_BEGIN_NAMESPACE
@@ -15,7 +18,8 @@ _MTF_BEGIN_NAMESPACE
 IALKParams::IALKParams(int _max_iters, double _epsilon,
 HessType _hess_type, bool _sec_ord_hess,
 bool _leven_marq, double _lm_delta_init,
-double _lm_delta_update, bool _debug_mode) :
+double _lm_delta_update, int _c2f_sub_ratio, double _c2f_thresh,
+int _stagnation_iters, bool _debug_mode) :
 max_iters(_max_iters),
 epsilon(_epsilon),
 hess_type(_hess_type),
@@ -23,6 +27,9 @@ sec_ord_hess(_sec_ord_hess),
 leven_marq(_leven_marq),
 lm_delta_init(_lm_delta_init),
 lm_delta_update(_lm_delta_update),
+c2f_sub_ratio(_c2f_sub_ratio),
+c2f_thresh(_c2f_thresh),
+stagnation_iters(_stagnation_iters),
 debug_mode(_debug_mode){}
 
 IALKParams::IALKParams(const IALKParams *params) :
@@ -33,6 +40,9 @@ sec_ord_hess(IALK_SEC_ORD_HESS),
 leven_marq(IALK_LEVEN_MARQ),
 lm_delta_init(IALK_LM_DELTA_INIT),
 lm_delta_update(IALK_LM_DELTA_UPDATE),
+c2f_sub_ratio(IALK_C2F_SUB_RATIO),
+c2f_thresh(IALK_C2F_THRESH),
+stagnation_iters(IALK_STAGNATION_ITERS),
 debug_mode(IALK_DEBUG_MODE){
 	if(params){
 		max_iters = params->max_iters;
@@ -42,6 +52,9 @@ debug_mode(IALK_DEBUG_MODE){
 		leven_marq = params->leven_marq;
 		lm_delta_init = params->lm_delta_init;
 		lm_delta_update = params->lm_delta_update;
+		c2f_sub_ratio = params->c2f_sub_ratio;
+		c2f_thresh = params->c2f_thresh;
+		stagnation_iters = params->stagnation_iters;
 		debug_mode = params->debug_mode;
 	}
 }
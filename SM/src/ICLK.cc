@@ -1,5 +1,6 @@
 #include "mtf/SM/ICLK.h"
 #include "mtf/Utilities/miscUtils.h"
+#include "mtf/Utilities/profUtils.h"
 #include <stdexcept>
 
 _MTF_BEGIN_NAMESPACE
@@ -8,7 +9,9 @@ template <class AM, class SSM>
 ICLK<AM, SSM >::ICLK(const ParamType *iclk_params,
 	const AMParams *am_params, const SSMParams *ssm_params) :
 	SearchMethod<AM, SSM>(am_params, ssm_params),
-	params(iclk_params){
+	params(iclk_params),
+	optimizer(params.max_iters, params.epsilon, params.leven_marq,
+	params.lm_delta_init, params.lm_delta_update, params.stagnation_iters){
 
 	printf("\n");
 	printf("Using Inverse Compositional Lucas Kanade SM with:\n");
@@ -23,6 +26,11 @@ ICLK<AM, SSM >::ICLK(const ParamType *iclk_params,
 		printf("lm_delta_update: %f\n", params.lm_delta_update);
 	}
 	printf("enable_learning: %d\n", params.enable_learning);
+	printf("c2f_sub_ratio: %d\n", params.c2f_sub_ratio);
+	if(params.c2f_sub_ratio > 1){
+		printf("c2f_thresh: %f\n", params.c2f_thresh);
+	}
+	printf("stagnation_iters: %d\n", params.stagnation_iters);
 	printf("debug_mode: %d\n", params.debug_mode);
 
 	printf("appearance model: %s\n", am.name.c_str());
@@ -53,6 +61,7 @@ ICLK<AM, SSM >::ICLK(const ParamType *iclk_params,
 	}
 	df_dp.resize(state_size);
 	d2f_dp2.resize(state_size, state_size);
+	optimizer.setStateSize(state_size);
 
 	state_update.resize(state_size);
 	ssm_update.resize(ssm_state_size);
@@ -68,6 +77,10 @@ ICLK<AM, SSM >::ICLK(const ParamType *iclk_params,
 			d2I0_dpssm2.resize(ssm_state_size*ssm_state_size, am.getPatchSize());
 		}
 	}
+	initializeCoarseToFine(params.c2f_sub_ratio);
+	if(coarseToFineEnabled() && params.hess_type == HessType::InitialSelf){
+		c2f_d2f_dp2.resize(state_size, state_size);
+	}
 }
 
 template <class AM, class SSM>
@@ -98,14 +111,7 @@ void ICLK<AM, SSM >::initialize(const cv::Mat &corners){
 		}
 	}
 	if(params.hess_type == HessType::InitialSelf){
-		if(params.sec_ord_hess){
-			am.cmptSelfHessian(d2f_dp2, dI0_dpssm, d2I0_dpssm2);
-		} else{
-			am.cmptSelfHessian(d2f_dp2, dI0_dpssm);
-		}
-		if(params.leven_marq){
-			d2f_dp2_orig = d2f_dp2;
-		}
+		cmptInitSelfHessians();
 	}
 	ssm.getCorners(cv_corners_mat);
 
@@ -127,58 +133,60 @@ void ICLK<AM, SSM >::setRegion(const cv::Mat& corners){
 				ssm.cmptWarpedPixHessian(d2I0_dpssm2, am.getInitPixHess(), am.getInitPixGrad());
 			}
 			if(params.hess_type == HessType::InitialSelf){
-				if(params.sec_ord_hess){
-					am.cmptSelfHessian(d2f_dp2, dI0_dpssm, d2I0_dpssm2);
-				} else{
-					am.cmptSelfHessian(d2f_dp2, dI0_dpssm);
-				}
-				if(params.leven_marq){
-					d2f_dp2_orig = d2f_dp2;
-				}
+				cmptInitSelfHessians();
 			}
 		}
 	}
 	ssm.getCorners(cv_corners_mat);
 }
 
+template <class AM, class SSM>
+void ICLK<AM, SSM >::cmptInitSelfHessians(){
+	if(params.sec_ord_hess){
+		am.cmptSelfHessian(d2f_dp2, dI0_dpssm, d2I0_dpssm2);
+	} else{
+		am.cmptSelfHessian(d2f_dp2, dI0_dpssm);
+	}
+	if(coarseToFineEnabled()){
+		d2f_dp2_orig = d2f_dp2;
+		setCoarseLevel();
+		if(params.sec_ord_hess){
+			am.cmptSelfHessian(c2f_d2f_dp2, dI0_dpssm, d2I0_dpssm2);
+		} else{
+			am.cmptSelfHessian(c2f_d2f_dp2, dI0_dpssm);
+		}
+		setFineLevel();
+	}
+}
+
 template <class AM, class SSM>
 void ICLK<AM, SSM >::update(){
 	++frame_id;
 	write_frame_id(frame_id);
 
 	am.setFirstIter();
+	optimizer.startFrame();
 
-	double prev_f = 0;
-	double lm_delta = params.lm_delta_init;
-	bool state_reset = false;
+	bool coarse_level = coarseToFineEnabled();
+	if(coarse_level){ setCoarseLevel(); }
 
 	for(int iter_id = 0; iter_id < params.max_iters; ++iter_id){
 		init_timer();
 
+		//! the gradient at the same points is needed in this iteration unless the LM test rejects the last update
+		if(params.hess_type == HessType::CurrentSelf && !params.leven_marq){ am.fuseNextPixGrad(); }
 		am.updatePixVals(ssm.getPts());
 		record_event("am.updatePixVals");
 
 		am.updateSimilarity(false);
 		record_event("am.updateSimilarity");
 
-		if(params.leven_marq && !state_reset){
-			double f = am.getSimilarity();
-			if(iter_id > 0){
-				if(f < prev_f){
-					lm_delta *= params.lm_delta_update;
-					//! undo the last update
-					ssm.compositionalUpdate(ssm_update);
-					am.updateState(am_update);
-					state_reset = true;
-					continue;
-				}
-				if(f > prev_f){
-					lm_delta /= params.lm_delta_update;
-				}
-			}
-			prev_f = f;
+		if(!optimizer.acceptStep(am.getSimilarity())){
+			//! undo the last update
+			ssm.compositionalUpdate(ssm_update);
+			am.updateState(am_update);
+			continue;
 		}
-		state_reset = false;
 
 		am.updateInitGrad();
 		record_event("am.updateInitGrad");
@@ -188,7 +196,9 @@ void ICLK<AM, SSM >::update(){
 
 		switch(params.hess_type){
 		case HessType::InitialSelf:
-			if(params.leven_marq){
+			if(coarse_level){
+				d2f_dp2 = c2f_d2f_dp2;
+			} else if(coarseToFineEnabled()){
 				d2f_dp2 = d2f_dp2_orig;
 			}
 			break;
@@ -220,13 +230,8 @@ void ICLK<AM, SSM >::update(){
 			}
 			break;
 		}
-		if(params.leven_marq){
-			MatrixXd diag_d2f_dp2 = d2f_dp2.diagonal().asDiagonal();
-			d2f_dp2 += lm_delta*diag_d2f_dp2;
-		}
-
-		state_update = -d2f_dp2.colPivHouseholderQr().solve(df_dp.transpose());
-		record_event("state_update");
+		optimizer.solve(state_update, df_dp, d2f_dp2);
+		record_event("optimizer.solve");
 
 		ssm_update = state_update.head(ssm_state_size);
 		am_update = state_update.tail(am_state_size);
@@ -248,14 +253,21 @@ void ICLK<AM, SSM >::update(){
 		double update_norm = (prev_corners - ssm.getCorners()).squaredNorm();
 		record_event("update_norm");
 
-		if(update_norm < params.epsilon){
-			if(params.debug_mode){
-				printf("n_iters: %d\n", iter_id + 1);
+		bool converged = optimizer.converged(update_norm);
+		if(coarse_level){
+			if(update_norm < params.c2f_thresh || 2 * (iter_id + 1) >= params.max_iters){
+				setFineLevel();
+				coarse_level = false;
+				//! similarity values at different levels are not comparable
+				optimizer.startLevel();
 			}
+		} else if(converged){
 			break;
 		}
 		am.clearFirstIter();
 	}
+	if(coarse_level){ setFineLevel(); }
+	if(params.debug_mode){ optimizer.printStats(); }
 	if(params.enable_learning){
 		am.updateModel(ssm.getPts());
 	}
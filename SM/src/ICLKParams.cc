@@ -11,6 +11,9 @@
 #define IC_LM_DELTA_INIT 0.01
 #define IC_LM_DELTA_UPDATE 10
 #define IC_ENABLE_LEARNING 0
+#define IC_C2F_SUB_RATIO 1
+#define IC_C2F_THRESH 1e-2
+#define IC_STAGNATION_ITERS 0
 #define IC_DEBUG_MODE false
 
 _MTF_BEGIN_NAMESPACE
@@ -20,7 +23,8 @@ HessType _hess_type, bool _sec_ord_hess,
 bool _update_ssm, bool _chained_warp,
 bool _leven_marq, double _lm_delta_init,
 double _lm_delta_update, bool _enable_learning, 
-bool _debug_mode) :
+int _c2f_sub_ratio, double _c2f_thresh,
+int _stagnation_iters, bool _debug_mode) :
 max_iters(_max_iters),
 epsilon(_epsilon),
 hess_type(_hess_type),
@@ -31,6 +35,9 @@ leven_marq(_leven_marq),
 lm_delta_init(_lm_delta_init),
 lm_delta_update(_lm_delta_update),
 enable_learning(_enable_learning),
+c2f_sub_ratio(_c2f_sub_ratio),
+c2f_thresh(_c2f_thresh),
+stagnation_iters(_stagnation_iters),
 debug_mode(_debug_mode){}
 
 ICLKParams::ICLKParams(const ICLKParams *params) :
@@ -44,6 +51,9 @@ leven_marq(IC_LEVEN_MARQ),
 lm_delta_init(IC_LM_DELTA_INIT),
 lm_delta_update(IC_LM_DELTA_UPDATE),
 enable_learning(IC_ENABLE_LEARNING),
+c2f_sub_ratio(IC_C2F_SUB_RATIO),
+c2f_thresh(IC_C2F_THRESH),
+stagnation_iters(IC_STAGNATION_ITERS),
 debug_mode(IC_DEBUG_MODE){
 	if(params){
 		max_iters = params->max_iters;
@@ -56,6 +66,9 @@ debug_mode(IC_DEBUG_MODE){
 		lm_delta_init = params->lm_delta_init;
 		lm_delta_update = params->lm_delta_update;
 		enable_learning = params->enable_learning;
+		c2f_sub_ratio = params->c2f_sub_ratio;
+		c2f_thresh = params->c2f_thresh;
+		stagnation_iters = params->stagnation_iters;
 		debug_mode = params->debug_mode;
 	}
 }
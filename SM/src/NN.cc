@@ -1,5 +1,6 @@
 #include "mtf/SM/NN.h"
 #include "mtf/Utilities/miscUtils.h"
+#include "mtf/Utilities/profUtils.h"
 #include "mtf/Utilities/excpUtils.h"
 #include <fstream> 
 #include "opencv2/highgui/highgui.hpp"
@@ -15,6 +15,7 @@
 #define NN_LOAD_INDEX 0
 #define NN_SAVE_INDEX 0
 #define NN_INDEX_FILE_TEMPLATE "nn_saved_index"
+#define NN_DB_FORMAT 0
 #define NN_DEBUG_MODE false
 
 _MTF_BEGIN_NAMESPACE
@@ -35,6 +36,7 @@ NNParams::NNParams(
 	bool _load_index, 
 	bool _save_index, 
 	string _saved_index_dir,
+	int _db_format,
 	bool _debug_mode) :
 	gnn(_gnn),
 	n_samples(_n_samples),
@@ -51,6 +53,7 @@ NNParams::NNParams(
 	load_index(_load_index),
 	save_index(_save_index),
 	saved_index_dir(_saved_index_dir),
+	db_format(_db_format),
 	debug_mode(_debug_mode){}
 
 NNParams::NNParams(const NNParams *params) :
@@ -65,6 +68,7 @@ remove_samples(NN_REMOVE_SAMPLES),
 load_index(NN_LOAD_INDEX),
 save_index(NN_SAVE_INDEX),
 saved_index_dir(NN_INDEX_FILE_TEMPLATE),
+db_format(NN_DB_FORMAT),
 debug_mode(NN_DEBUG_MODE){
 	if(params){
 		gnn = params->gnn;
@@ -89,6 +93,7 @@ debug_mode(NN_DEBUG_MODE){
 		load_index = params->load_index;
 		save_index = params->save_index;
 		saved_index_dir = params->saved_index_dir;
+		db_format = params->db_format;
 
 		debug_mode = params->debug_mode;
 	}
@@ -1,5 +1,6 @@
 #include "mtf/SM/NT/AESM.h"
 
+#include "mtf/Utilities/profUtils.h"
 _MTF_BEGIN_NAMESPACE
 
 namespace nt{
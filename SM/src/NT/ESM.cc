@@ -1,5 +1,6 @@
 #include "mtf/SM/NT/ESM.h"
 #include "mtf/Utilities/miscUtils.h"
+#include "mtf/Utilities/profUtils.h"
 #include "mtf/Utilities/excpUtils.h"
 #include "opencv2/imgproc/imgproc.hpp"
 #include "opencv2/highgui/highgui.hpp"
@@ -9,7 +10,9 @@ _MTF_BEGIN_NAMESPACE
 namespace nt{
 
 	ESM::ESM(AM _am, SSM _ssm, const ParamType *esm_params) :
-		SearchMethod(_am, _ssm), params(esm_params){
+		SearchMethod(_am, _ssm), params(esm_params),
+		optimizer(params.max_iters, params.epsilon, params.leven_marq,
+		params.lm_delta_init, params.lm_delta_update, params.stagnation_iters){
 		printf("\n");
 		printf("Using Efficient Second order Minimization (NT) SM with:\n");
 		printf("max_iters: %d\n", params.max_iters);
@@ -25,6 +28,7 @@ namespace nt{
 		}
 		printf("enable_learning: %d\n", params.enable_learning);
 		printf("spi_type: %s\n", ParamType::toString(params.spi_type));
+		printf("stagnation_iters: %d\n", params.stagnation_iters);
 		printf("debug_mode: %d\n", params.debug_mode);
 
 		printf("appearance model: %s\n", am->name.c_str());
@@ -86,6 +90,7 @@ namespace nt{
 
 		jacobian.resize(state_size);
 		hessian.resize(state_size, state_size);
+		optimizer.setStateSize(state_size);
 		if(params.hess_type == HessType::SumOfSelf){
 			init_self_hessian.resize(state_size, state_size);
 		}
@@ -171,11 +176,8 @@ namespace nt{
 		++frame_id;
 		write_frame_id(frame_id);
 
-		double prev_similarity = 0;
-		double leven_marq_delta = params.lm_delta_init;
-		bool state_reset = false;
-
 		am->setFirstIter();
+		optimizer.startFrame();
 		for(int iter_id = 0; iter_id < params.max_iters; ++iter_id){
 			init_timer();
 
@@ -186,6 +188,8 @@ namespace nt{
 				ssm->clearSPIMask();
 			}
 #endif	
+			//! the gradient at the same points is needed in this iteration unless the LM test rejects the last update
+			if(params.chained_warp && !params.leven_marq){ am->fuseNextPixGrad(); }
 			//! extract pixel values from the current image at the latest known position of the object
 			am->updatePixVals(ssm->getPts());
 			record_event("am->updatePixVals");
@@ -204,32 +208,14 @@ namespace nt{
 			am->updateSimilarity(false);
 			record_event("am->updateSimilarity");
 
-			if(params.leven_marq && !state_reset){
-				double curr_similarity = am->getSimilarity();
-				if(iter_id > 0){
-					if(curr_similarity < prev_similarity){
-						leven_marq_delta *= params.lm_delta_update;
-						//! undo the last update
-						ssm->invertState(inv_ssm_update, ssm_update);
-						ssm->compositionalUpdate(inv_ssm_update);
-						am->invertState(inv_am_update, am_update);
-						am->updateState(inv_am_update);
-
-						if(params.debug_mode){
-							printf("curr_similarity: %20.14f\t prev_similarity: %20.14f\n",
-								curr_similarity, prev_similarity);
-							utils::printScalar(leven_marq_delta, "leven_marq_delta");
-						}
-						state_reset = true;
-						continue;
-					}
-					if(curr_similarity > prev_similarity){
-						leven_marq_delta /= params.lm_delta_update;
-					}
-				}
-				prev_similarity = curr_similarity;
+			if(!optimizer.acceptStep(am->getSimilarity())){
+				//! undo the last update
+				ssm->invertState(inv_ssm_update, ssm_update);
+				ssm->compositionalUpdate(inv_ssm_update);
+				am->invertState(inv_am_update, am_update);
+				am->updateState(inv_am_update);
+				continue;
 			}
-			state_reset = false;
 #ifdef DISABLE_SPI	
 			//! if pixel gradient is not needed for SPI, it is computed only if the LM test 
 			//! has not rejected the previous update to avoid any unnecessary computations
@@ -254,17 +240,9 @@ namespace nt{
 			cmptJacobian();
 			cmptHessian();
 
-			if(params.leven_marq){
-				//utils::printMatrix(hessian, "original hessian");
-				MatrixXd diag_hessian = hessian.diagonal().asDiagonal();
-				//utils::printMatrix(diag_hessian, "diag_hessian");
-				hessian += leven_marq_delta*diag_hessian;
-				//utils::printMatrix(hessian, "LM hessian");
-			}
-
 			//utils::printMatrix(hessian, "hessian");
 			//utils::printMatrix(jacobian, "jacobian");
-			state_update = -hessian.colPivHouseholderQr().solve(jacobian.transpose());
+			optimizer.solve(state_update, jacobian, hessian);
 			record_event("state_update");
 
 			ssm_update = state_update.head(ssm_state_size);
@@ -279,10 +257,7 @@ namespace nt{
 
 			write_data(time_fname);
 
-			if(update_norm < params.epsilon){
-				if(params.debug_mode){
-					printf("n_iters: %d\n", iter_id + 1);
-				}
+			if(optimizer.converged(update_norm)){
 				break;
 			}
 #ifndef DISABLE_SPI		
@@ -290,6 +265,7 @@ namespace nt{
 #endif
 			am->clearFirstIter();
 		}
+		if(params.debug_mode){ optimizer.printStats(); }
 		if(params.enable_learning){
 			am->updateModel(ssm->getPts());
 		}
@@ -316,9 +292,6 @@ namespace nt{
 	void ESM::cmptHessian(){
 		switch(params.hess_type){
 		case HessType::InitialSelf:
-			if(params.leven_marq){
-				hessian = init_self_hessian;
-			}
 			break;
 		case HessType::Original:
 			if(params.sec_ord_hess){
@@ -1,5 +1,6 @@
 #include "mtf/SM/NT/FALK.h"
 #include "mtf/Utilities/miscUtils.h"
+#include "mtf/Utilities/profUtils.h"
 #include <time.h>
 #include "opencv2/highgui/highgui.hpp"
 #include "opencv2/imgproc/imgproc.hpp"
@@ -10,7 +11,9 @@ namespace nt{
 	FALK::FALK(AM _am, SSM _ssm,
 	 const ParamType *falk_params) :
 		SearchMethod(_am, _ssm),
-		params(falk_params) {
+		params(falk_params),
+		optimizer(params.max_iters, params.epsilon, params.leven_marq,
+		params.lm_delta_init, params.lm_delta_update, params.stagnation_iters) {
 
 		printf("\n");
 		printf("Using Forward Additive Lucas Kanade (NT) SM with:\n");
@@ -27,6 +30,7 @@ namespace nt{
 		printf("show_patch: %d\n", params.show_patch);
 		printf("patch_resize_factor: %f\n", params.patch_resize_factor);
 		printf("write_frames: %d\n", params.write_frames);
+		printf("stagnation_iters: %d\n", params.stagnation_iters);
 		printf("debug_mode: %d\n", params.debug_mode);
 
 		printf("appearance model: %s\n", am->name.c_str());
@@ -49,6 +53,7 @@ namespace nt{
 		curr_pix_jacobian.resize(am->getPatchSize(), ssm->getStateSize());
 		jacobian.resize(ssm->getStateSize());
 		hessian.resize(ssm->getStateSize(), ssm->getStateSize());
+		optimizer.setStateSize(ssm->getStateSize());
 
 		if(params.hess_type == HessType::InitialSelf){
 			init_pix_jacobian.resize(am->getPatchSize(), ssm->getStateSize());
@@ -117,9 +122,6 @@ namespace nt{
 				am->cmptSelfHessian(hessian, init_pix_jacobian);
 			}
 		}
-		if(params.leven_marq){
-			init_self_hessian = hessian;
-		}
 
 		ssm->getCorners(cv_corners_mat);
 
@@ -133,14 +135,13 @@ namespace nt{
 		++frame_id;
 		write_frame_id(frame_id);
 
-		double prev_f = 0;
-		double lm_delta = params.lm_delta_init;
-		bool state_reset = false;
-
 		am->setFirstIter();
+		optimizer.startFrame();
 		for(int iter_id = 0; iter_id < params.max_iters; iter_id++){
 			init_timer();
 
+			//! the gradient at the same points is needed in this iteration unless the LM test rejects the last update
+			if(!params.leven_marq){ am->fuseNextPixGrad(); }
 			am->updatePixVals(ssm->getPts());
 			record_event("am->updatePixVals");
 
@@ -148,30 +149,12 @@ namespace nt{
 			am->updateSimilarity(false);
 			record_event("am->updateSimilarity");
 
-			if(params.leven_marq && !state_reset){
-				double f = am->getSimilarity();
-				if(iter_id > 0){
-					if(f < prev_f){
-						lm_delta *= params.lm_delta_update;
-						//! undo the last update
-						VectorXd inv_ssm_update = -ssm_update;
-						ssm->additiveUpdate(inv_ssm_update);
-
-						if(params.debug_mode){
-							printf("curr_similarity: %20.14f\t prev_similarity: %20.14f\n",
-								f, prev_f);
-							utils::printScalar(lm_delta, "leven_marq_delta");
-						}
-						state_reset = true;
-						continue;
-					}
-					if(f > prev_f){
-						lm_delta /= params.lm_delta_update;
-					}
-				}
-				prev_f = f;
+			if(!optimizer.acceptStep(am->getSimilarity())){
+				//! undo the last update
+				VectorXd inv_ssm_update = -ssm_update;
+				ssm->additiveUpdate(inv_ssm_update);
+				continue;
 			}
-			state_reset = false;
 
 			am->updatePixGrad(ssm->getPts());
 			record_event("am->updatePixGrad");
@@ -196,9 +179,6 @@ namespace nt{
 			// compute similarity Hessian
 			switch(params.hess_type){
 			case HessType::InitialSelf:
-				if(params.leven_marq){
-					hessian = init_self_hessian;
-				}
 				break;
 			case HessType::CurrentSelf:
 				if(params.sec_ord_hess){
@@ -219,14 +199,7 @@ namespace nt{
 				}
 				break;
 			}
-			if(params.leven_marq){
-				//utils::printMatrix(hessian, "original hessian");
-				MatrixXd diag_hessian = hessian.diagonal().asDiagonal();
-				//utils::printMatrix(diag_hessian, "diag_hessian");
-				hessian += lm_delta*diag_hessian;
-				//utils::printMatrix(hessian, "LM hessian");
-			}
-			ssm_update = -hessian.colPivHouseholderQr().solve(jacobian.transpose());
+			optimizer.solve(ssm_update, jacobian, hessian);
 			record_event("ssm_update");
 			//utils::printMatrix(curr_pix_hessian, "curr_pix_hessian");
 			//utils::printMatrix(hessian, "hessian");
@@ -240,14 +213,12 @@ namespace nt{
 			double update_norm = (prev_corners - ssm->getCorners()).squaredNorm();
 			record_event("update_norm");
 
-			if(update_norm < params.epsilon){
-				if(params.debug_mode){
-					printf("n_iters: %d\n", iter_id + 1);
-				}
+			if(optimizer.converged(update_norm)){
 				break;
 			}
 			am->clearFirstIter();
 		}
+		if(params.debug_mode){ optimizer.printStats(); }
 		if(params.enable_learning){
 			am->updateModel(ssm->getPts());
 		}
@@ -1,5 +1,6 @@
 #include "mtf/SM/NT/FCLK.h"
 #include "mtf/Utilities/miscUtils.h"
+#include "mtf/Utilities/profUtils.h"
 #include "opencv2/highgui/highgui.hpp"
 #include "opencv2/imgproc/imgproc.hpp"
 #include <stdexcept>
@@ -9,13 +10,16 @@ namespace nt{
 	FCLK::FCLK(AM _am, SSM _ssm,
 	 const ParamType *fclk_params) :
 		SearchMethod(_am, _ssm),
-		params(fclk_params) {
+		params(fclk_params),
+		optimizer(params.max_iters, params.epsilon, params.leven_marq,
+		params.lm_delta_init, params.lm_delta_update, params.stagnation_iters){
 		printf("\n");
 		printf("Using Forward Compositional Lucas Kanade (NT) SM with:\n");
 		printf("max_iters: %d\n", params.max_iters);
 		printf("epsilon: %f\n", params.epsilon);
 		printf("hess_type: %d\n", params.hess_type);
 		printf("sec_ord_hess: %d\n", params.sec_ord_hess);
+		printf("stagnation_iters: %d\n", params.stagnation_iters);
 		printf("chained_warp: %d\n", params.chained_warp);
 		printf("leven_marq: %d\n", params.leven_marq);
 		if(params.leven_marq){
@@ -63,6 +67,7 @@ namespace nt{
 		curr_pix_jacobian_new.resize(am->getPatchSize(), ssm_state_size);
 		jacobian.resize(state_size);
 		hessian.resize(state_size, state_size);
+		optimizer.setStateSize(state_size);
 
 		if(params.hess_type == HessType::InitialSelf){
 			init_pix_jacobian.resize(am->getPatchSize(), ssm_state_size);
@@ -144,9 +149,6 @@ namespace nt{
 			} else{
 				am->cmptSelfHessian(hessian, init_pix_jacobian);
 			}
-			if(params.leven_marq){
-				init_self_hessian = hessian;
-			}
 		}
 		ssm->getCorners(cv_corners_mat);
 
@@ -174,10 +176,8 @@ namespace nt{
 		write_frame_id(frame_id);
 
 		am->setFirstIter();
+		optimizer.startFrame();
 		int iter_id = 0;
-		double prev_similarity = 0;
-		double leven_marq_delta = params.lm_delta_init;
-		bool state_reset = false;
 
 		if(params.write_ssm_updates){
 			ssm->getIdentityWarp(frame_ssm_update);
@@ -187,35 +187,19 @@ namespace nt{
 		while(iter_id < params.max_iters){
 			init_timer();
 
+			//! the gradient at the same points is needed in this iteration unless the LM test rejects the last update
+			if(params.chained_warp && !params.leven_marq){ am->fuseNextPixGrad(); }
 			am->updatePixVals(ssm->getPts()); record_event("am->updatePixVals");
 			am->updateSimilarity(false); record_event("am->updateSimilarity");
 
-			if(params.leven_marq && !state_reset){
-				double curr_similarity = am->getSimilarity();
-				if(iter_id > 0){
-					if(curr_similarity < prev_similarity){
-						leven_marq_delta *= params.lm_delta_update;
-						//! undo the last update
-						ssm->invertState(inv_ssm_update, ssm_update);
-						ssm->compositionalUpdate(inv_ssm_update);
-						am->invertState(inv_am_update, am_update);
-						am->updateState(inv_am_update);
-
-						if(params.debug_mode){
-							printf("curr_similarity: %20.14f\t prev_similarity: %20.14f\n", 
-								curr_similarity, prev_similarity);
-							utils::printScalar(leven_marq_delta, "leven_marq_delta");
-						}
-						state_reset = true;
-						continue;
-					}
-					if(curr_similarity > prev_similarity){
-						leven_marq_delta /= params.lm_delta_update;
-					}
-				}
-				prev_similarity = curr_similarity;
+			if(!optimizer.acceptStep(am->getSimilarity())){
+				//! undo the last update
+				ssm->invertState(inv_ssm_update, ssm_update);
+				ssm->compositionalUpdate(inv_ssm_update);
+				am->invertState(inv_am_update, am_update);
+				am->updateState(inv_am_update);
+				continue;
 			}
-			state_reset = false;
 
 			am->updateCurrGrad(); record_event("am->updateCurrGrad");
 
@@ -263,9 +247,6 @@ namespace nt{
 			//! compute similarity Hessian
 			switch(params.hess_type){
 			case HessType::InitialSelf:
-				if(params.leven_marq){
-					hessian = init_self_hessian;
-				}
 				break;
 			case HessType::CurrentSelf:
 				if(params.sec_ord_hess){
@@ -287,15 +268,7 @@ namespace nt{
 				break;
 			}
 
-			if(params.leven_marq){
-				//utils::printMatrix(hessian, "original hessian");
-				MatrixXd diag_hessian = hessian.diagonal().asDiagonal();
-				//utils::printMatrix(diag_hessian, "diag_hessian");
-				hessian += leven_marq_delta*diag_hessian;				
-				//utils::printMatrix(hessian, "LM hessian");
-			}
-
-			state_update = -hessian.colPivHouseholderQr().solve(jacobian.transpose());
+			optimizer.solve(state_update, jacobian, hessian);
 			ssm_update = state_update.head(ssm_state_size);
 			am_update = state_update.tail(am_state_size);
 
@@ -334,7 +307,7 @@ namespace nt{
 					"%e", "a", "\t", "\n");
 			}
 
-			if(update_norm < params.epsilon){
+			if(optimizer.converged(update_norm)){
 				break;
 			}
 			am->clearFirstIter();
@@ -346,9 +319,7 @@ namespace nt{
 				"%d", "a", "\t", "\t");
 			utils::printMatrixToFile(frame_ssm_update.transpose(), nullptr, "log/fc_frame_ssm_updates.txt");
 		}
-		if(params.debug_mode){
-			printf("n_iters: %d\n", iter_id + 1);
-		}
+		if(params.debug_mode){ optimizer.printStats(); }
 		if(params.enable_learning){
 			am->updateModel(ssm->getPts());
 		}
@@ -1,5 +1,6 @@
 #include "mtf/SM/NT/FCSD.h"
 #include "mtf/Utilities/miscUtils.h"
+#include "mtf/Utilities/profUtils.h"
 
 _MTF_BEGIN_NAMESPACE
 
@@ -1,6 +1,8 @@
 #include "mtf/SM/NT/GNN.h"
+#include "mtf/Utilities/miscUtils.h"
 
 #include <fstream> 
+#include <atomic>
 
 _MTF_BEGIN_NAMESPACE
 namespace nt{
@@ -11,7 +13,8 @@ namespace nt{
 			n_samples(_n_samples),
 			n_dims(_n_dims),
 			is_symmetrical(_is_symmetrical),
-			params(gnn_params)	{
+			params(gnn_params),
+			db(nullptr){
 			if(params.degree == 0 || params.degree > n_samples){
 				params.degree = n_samples;
 			} else if(params.degree < 0){
@@ -22,6 +25,8 @@ namespace nt{
 			printf("max_steps: %d\n", params.max_steps);
 			printf("cmpt_dist_thresh: %d\n", params.cmpt_dist_thresh);
 			printf("random_start: %d\n", params.random_start);
+			printf("n_workers: %d\n", params.n_workers);
+			printf("build_block_size: %d\n", params.build_block_size);
 			printf("verbose: %d\n", params.verbose);
 
 			dist_computed = false;
@@ -57,60 +62,91 @@ namespace nt{
 		}
 
 		void GNN::buildGraph(const double *dataset){
-			if(!dist_computed && n_samples <= params.cmpt_dist_thresh){
+			if(!dist_computed && params.n_workers <= 1 && n_samples <= params.cmpt_dist_thresh){
 				// distance is pre computed and stored only if the no. of samples is not large enough to 
-				// cause a bad_alloc error on attempting to allocate memory for this
+				// cause a bad_alloc error on attempting to allocate memory for this;
+				// this halves the distance computations for symmetrical distances but cannot be done in parallel
 				computeDistances(dataset);
 			}
 			nodes.resize(n_samples);
-			std::vector<IndxDist> dists(params.degree + 1);
 			if(params.verbose){
 				printf("Processing graph nodes...\n");
 			}
+			/**
+			nodes are processed in blocks of rows so that only the neighbour lists of the block being processed
+			by each worker are kept in memory; the distances of each block are computed one tile of columns at a time
+			so that the samples in the tile remain in cache while being compared with all the rows of the block;
+			since neighbours are ordered by distance and then index, the graph is the same irrespective of
+			the no. of workers and the block size
+			*/
+			const int block_size = params.build_block_size > 0 ? params.build_block_size : 1;
+			const int list_size = params.degree + 1;
+			const int n_blocks = (n_samples + block_size - 1) / block_size;
+			const int n_workers = params.n_workers > 1 ? min(params.n_workers, n_blocks) : 1;
+			std::atomic<int> n_done_nodes(0);
 			mtf_clock_get(build_state_time);
-			for(int id1 = 0; id1 < n_samples; ++id1){
-				nodes[id1].nns_inds.resize(params.degree);
-				nodes[id1].capacity = params.degree;
-				nodes[id1].size = 0;
-				int count = 0;
-				for(int id2 = 0; id2 < n_samples; ++id2){
-					double dist = dist_computed ? dataset_distances(id1, id2) :
-						(*dist_func)(dataset + (id1*n_dims), dataset + (id2*n_dims), n_dims);
-					if(count < params.degree + 1){
-						dists[count].idx = id2;
-						dists[count].dist = dist;
-						++count;
-					} else if(dist < dists[count - 1].dist || (dist == dists[count - 1].dist &&
-						id2 < dists[count - 1].idx)) {
-						dists[count - 1].idx = id2;
-						dists[count - 1].dist = dist;
-					} else {
-						continue;
+			utils::runWorkers(n_workers, [&](unsigned int worker_id){
+				std::vector<IndxDist> dists(block_size*list_size);
+				std::vector<int> counts(block_size);
+				for(int block_id = worker_id; block_id < n_blocks; block_id += n_workers){
+					const int row_start = block_id*block_size;
+					const int row_end = min(row_start + block_size, n_samples);
+					std::fill(counts.begin(), counts.end(), 0);
+					for(int col_start = 0; col_start < n_samples; col_start += block_size){
+						const int col_end = min(col_start + block_size, n_samples);
+						for(int id1 = row_start; id1 < row_end; ++id1){
+							IndxDist *row_dists = dists.data() + (id1 - row_start)*list_size;
+							int &count = counts[id1 - row_start];
+							for(int id2 = col_start; id2 < col_end; ++id2){
+								double dist = dist_computed ? dataset_distances(id1, id2) :
+									(*dist_func)(dataset + (id1*n_dims), dataset + (id2*n_dims), n_dims);
+								insertNeighbor(row_dists, count, list_size, id2, dist);
+							}
+						}
 					}
-					int id3 = count - 1;
-					while(id3 >= 1 && (dists[id3].dist < dists[id3 - 1].dist || (dists[id3].dist == dists[id3 - 1].dist &&
-						dists[id3].idx < dists[id3 - 1].idx))){
-						swap<int>(&dists[id3].idx, &dists[id3 - 1].idx);
-						swap<double>(&dists[id3].dist, &dists[id3 - 1].dist);
-						--id3;
+					for(int id1 = row_start; id1 < row_end; ++id1){
+						const IndxDist *row_dists = dists.data() + (id1 - row_start)*list_size;
+						nodes[id1].nns_inds.resize(params.degree);
+						nodes[id1].capacity = params.degree;
+						nodes[id1].size = 0;
+						// the nearest sample is the node itself
+						for(int j = 0; j < counts[id1 - row_start] - 1; j++){
+							addNode(&nodes[id1], row_dists[j + 1].idx);
+						}
 					}
-				}
-				for(int j = 0; j < params.degree; j++){
-					int nns_ind = dists[j + 1].idx;
-					addNode(&nodes[id1], nns_ind);
-				}
-				if(params.verbose){
-					mtf_clock_get(end_time);
-					double elapsed_time;
-					mtf_clock_measure(build_state_time, end_time, elapsed_time);
-					if((id1 + 1) % 100 == 0){
+					int n_done = n_done_nodes += row_end - row_start;
+					if(params.verbose && worker_id == 0){
+						mtf_clock_get(end_time);
+						double elapsed_time;
+						mtf_clock_measure(build_state_time, end_time, elapsed_time);
 						printf("Done %d/%d nodes (%6.2f%%). Time elapsed: %f secs...\n",
-							id1 + 1, n_samples, double(id1 + 1) / double(n_samples) * 100,
+							n_done, n_samples, double(n_done) / double(n_samples) * 100,
 							elapsed_time);
 					}
 				}
+			});
+		}
+
+		void GNN::insertNeighbor(IndxDist *dists, int &count, int max_count,
+			int idx, double dist) const{
+			if(count < max_count){
+				dists[count].idx = idx;
+				dists[count].dist = dist;
+				++count;
+			} else if(dist < dists[count - 1].dist || (dist == dists[count - 1].dist &&
+				idx < dists[count - 1].idx)) {
+				dists[count - 1].idx = idx;
+				dists[count - 1].dist = dist;
+			} else {
+				return;
 			}
-		}
+			int id = count - 1;
+			while(id >= 1 && (dists[id].dist < dists[id - 1].dist || (dists[id].dist == dists[id - 1].dist &&
+				dists[id].idx < dists[id - 1].idx))){
+				std::swap(dists[id], dists[id - 1]);
+				--id;
+			}
+		}
 
 		void GNN::searchGraph(const double *query, const double *dataset,
 			int *nn_ids, double *nn_dists, int K){
@@ -125,22 +161,22 @@ namespace nt{
 			}
 
 			int r = start_node_idx;
-			double parent_dist = (*dist_func)(query, &dataset[r*n_dims], n_dims);
+			double parent_dist = (*dist_func)(query, getSample(dataset, r), n_dims);
 
 			visited_nodes[0].idx = r;
 			visited_nodes[0].dist = parent_dist;
 			visited++;
 			bool nn_found = false;
 			for(int step_id = 0; step_id < params.max_steps; ++step_id){
-				if(nodes[r].size > gnns_cap) {
-					gnns_cap = nodes[r].size;
+				if(getNodeSize(r) > gnns_cap) {
+					gnns_cap = getNodeSize(r);
 					gnn_dists = static_cast<IndxDist*>(realloc(gnn_dists, gnns_cap * sizeof(IndxDist)));
 				}
 				int count = 0;
 				//printf("Nodes[%d].size: %d\n", r, Nodes[r].size);
-				for(int id1 = 0; id1 < nodes[r].size; id1++){
+				for(int id1 = 0; id1 < getNodeSize(r); id1++){
 					//printf("Nodes[%d].nns_inds[%d]: %d\n", r, id1, Nodes[r].nns_inds[id1]);
-					const double *point = dataset + nodes[r].nns_inds[id1] * n_dims;
+					const double *point = getSample(dataset, getNodeNbrs(r)[id1]);
 					double dist = (*dist_func)(query, point, n_dims);
 					if(count < K){
 						gnn_dists[count].idx = id1; // the ids stored in gnn_dists are w.r.t. the current parent node
@@ -163,7 +199,7 @@ namespace nt{
 						id2--;
 					}
 				}
-				int m = min(K, nodes[r].size); // no. of connected nodes visited for the current parent node
+				int m = min(K, getNodeSize(r)); // no. of connected nodes visited for the current parent node
 				if((visited + m) > visited_cap){
 					do {
 						visited_cap *= 2;
@@ -172,7 +208,7 @@ namespace nt{
 				}
 				// add the visited nodes of the current parent node to the list of visited nodes
 				for(int i = 0; i < m; i++){
-					visited_nodes[visited + i].idx = nodes[r].nns_inds[gnn_dists[i].idx];
+					visited_nodes[visited + i].idx = getNodeNbrs(r)[gnn_dists[i].idx];
 					visited_nodes[visited + i].dist = gnn_dists[i].dist;
 				}
 				visited = visited + m;
@@ -181,8 +217,8 @@ namespace nt{
 					nn_found = true;
 					break;
 				}
-				r = nodes[r].nns_inds[gnn_dists[0].idx]; // move to the nearest neighbor of the current parent node
-				parent_dist = (*dist_func)(query, &dataset[r*n_dims], n_dims);
+				r = getNodeNbrs(r)[gnn_dists[0].idx]; // move to the nearest neighbor of the current parent node
+				parent_dist = (*dist_func)(query, getSample(dataset, r), n_dims);
 			}
 			if(params.verbose && !nn_found){
 				printf("GNN::Maximum steps reached\n");
@@ -240,6 +276,25 @@ namespace nt{
 			}
 		}
 
+		void GNN::setDatabase(const utils::NNDatabase *_db){
+			db = _db;
+			sample_buffer.resize(n_dims);
+			nodes.clear();
+		}
+
+		void GNN::getGraph(std::vector<int64_t> &node_offsets, std::vector<int> &node_nbrs) const{
+			node_offsets.resize(n_samples + 1);
+			node_offsets[0] = 0;
+			for(int node_id = 0; node_id < n_samples; ++node_id){
+				node_offsets[node_id + 1] = node_offsets[node_id] + getNodeSize(node_id);
+			}
+			node_nbrs.resize(node_offsets[n_samples]);
+			for(int node_id = 0; node_id < n_samples; ++node_id){
+				std::copy(getNodeNbrs(node_id), getNodeNbrs(node_id) + getNodeSize(node_id),
+					node_nbrs.begin() + node_offsets[node_id]);
+			}
+		}
+
 		void GNN::buildGraph(const double *X, int k){
 			nodes.resize(n_samples);
 			for(int i = 0; i < n_samples; i++){
@@ -286,7 +341,7 @@ namespace nt{
 			depth = 0;
 			dist_cnt = 0;
 			int r = start_node_idx;
-			parent_dist = (*dist_func)(query, &X[r*n_dims], n_dims);
+			parent_dist = (*dist_func)(query, getSample(X, r), n_dims);
 			// parent_dist = my_dist(query, x_row, n_dims);
 
 			visited_nodes[0].idx = r;
@@ -295,19 +350,19 @@ namespace nt{
 
 			while(true){
 				//      X1 = sample_X(Nodes, r, X); //contains the neighbors of node r
-				if(nodes[r].size > gnns_cap) //Nodes[r].size != gnns_size)
+				if(getNodeSize(r) > gnns_cap) //Nodes[r].size != gnns_size)
 				{
-					gnns_cap = nodes[r].size;
+					gnns_cap = getNodeSize(r);
 					gnn_dists = static_cast<IndxDist*>(realloc(gnn_dists, gnns_cap * sizeof(IndxDist)));
 				}
 
 				// knn_search(query, gnn_dists, X1, Nodes[r].size, n_dims);
 				// knn_search1(query, gnn_dists, X, Nodes[r].size, n_dims, Nodes[r].nns_inds);
-				knnSearch11(query, gnn_dists, X, nodes[r].size, n_dims, K, nodes[r].nns_inds.data());
+				knnSearch11(query, gnn_dists, X, getNodeSize(r), n_dims, K, getNodeNbrs(r));
 
 				//      free(X1); 
 
-				int m = min(K, nodes[r].size);
+				int m = min(K, getNodeSize(r));
 				if((visited + m) > visited_cap){
 					do {
 						visited_cap *= 2;
@@ -315,7 +370,7 @@ namespace nt{
 					visited_nodes = static_cast<IndxDist*>(realloc(visited_nodes, visited_cap *sizeof(IndxDist)));
 				}
 				for(int i = 0; i < m; i++){
-					visited_nodes[visited + i].idx = nodes[r].nns_inds[gnn_dists[i].idx];
+					visited_nodes[visited + i].idx = getNodeNbrs(r)[gnn_dists[i].idx];
 					visited_nodes[visited + i].dist = gnn_dists[i].dist;
 				}
 				visited = visited + m;
@@ -325,11 +380,11 @@ namespace nt{
 				else
 					dd = gnn_dists[0].dist;
 
-				r = nodes[r].nns_inds[gnn_dists[0].idx];
+				r = getNodeNbrs(r)[gnn_dists[0].idx];
 				depth++;
-				dist_cnt += nodes[r].size;
+				dist_cnt += getNodeSize(r);
 				// parent_dist = my_dist(query, x_row, n_dims);
-				parent_dist = (*dist_func)(query, &X[r*n_dims], n_dims);
+				parent_dist = (*dist_func)(query, getSample(X, r), n_dims);
 			}
 			//gnns_size = K;
 			//gnn_dists = realloc(gnn_dists, gnns_size * sizeof(struct indx_dist));
@@ -417,7 +472,7 @@ namespace nt{
 			}
 		}
 		void GNN::knnSearch11(const double *Q, IndxDist *dists, const double *X,
-			int rows, int cols, int k, int *X_inds){
+			int rows, int cols, int k, const int *X_inds){
 			// Faster version of knn_search1
 			// Calculates the distance of query to all data points in X and returns the sorted dist array
 
@@ -428,7 +483,7 @@ namespace nt{
 				//	if(dists[j].idx == j) continue; //return false;
 				//}
 				//printf("X_inds[%d]: %d\n", i, X_inds[i]);
-				const double *point = X + X_inds[i] * cols;
+				const double *point = getSample(X, X_inds[i]);
 				double dist = (*dist_func)(Q, point, cols);
 				if(count < k){
 					dists[count].idx = i;
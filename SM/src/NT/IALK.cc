@@ -1,5 +1,6 @@
 #include "mtf/SM/NT/IALK.h"
 #include "mtf/Utilities/miscUtils.h"
+#include "mtf/Utilities/profUtils.h"
 
 _MTF_BEGIN_NAMESPACE
 
@@ -7,7 +8,9 @@ namespace nt{
 
 	IALK::IALK(AM _am, SSM _ssm, const ParamType *ialk_params) :
 		SearchMethod(_am, _ssm),
-		params(ialk_params) {
+		params(ialk_params),
+		optimizer(params.max_iters, params.epsilon, params.leven_marq,
+		params.lm_delta_init, params.lm_delta_update, params.stagnation_iters) {
 		printf("\n");
 		printf("Using Inverse Additive Lucas Kanade (NT) SM with:\n");
 		printf("max_iters: %d\n", params.max_iters);
@@ -18,6 +21,7 @@ namespace nt{
 			printf("lm_delta_init: %f\n", params.lm_delta_init);
 			printf("lm_delta_update: %f\n", params.lm_delta_update);
 		}
+		printf("stagnation_iters: %d\n", params.stagnation_iters);
 		printf("debug_mode: %d\n", params.debug_mode);
 		printf("appearance model: %s\n", am->name.c_str());
 		printf("state space model: %s\n", ssm->name.c_str());
@@ -39,6 +43,7 @@ namespace nt{
 		curr_pix_jacobian.resize(am->getPatchSize(), ssm->getStateSize());
 		jacobian.resize(ssm->getStateSize());
 		hessian.resize(ssm->getStateSize(), ssm->getStateSize());
+		optimizer.setStateSize(ssm->getStateSize());
 		if(params.hess_type == HessType::InitialSelf){
 			init_pix_jacobian.resize(am->getPatchSize(), ssm->getStateSize());
 		}
@@ -76,9 +81,6 @@ namespace nt{
 			} else{
 				am->cmptSelfHessian(hessian, init_pix_jacobian);
 			}
-			if(params.leven_marq){
-				init_self_hessian = hessian;
-			}
 		}
 
 		ssm->getCorners(cv_corners_mat);
@@ -91,10 +93,7 @@ namespace nt{
 		++frame_id;
 		write_frame_id(frame_id);
 
-		double prev_similarity = 0;
-		double leven_marq_delta = params.lm_delta_init;
-		bool state_reset = false;
-
+		optimizer.startFrame();
 		for(int iter_id = 0; iter_id < params.max_iters; ++iter_id){
 			init_timer();
 
@@ -104,30 +103,12 @@ namespace nt{
 			am->updateSimilarity(false);
 			record_event("am->updateSimilarity");
 
-			if(params.leven_marq && !state_reset){
-				double curr_similarity = am->getSimilarity();
-				if(iter_id > 0){
-					if(curr_similarity < prev_similarity){
-						leven_marq_delta *= params.lm_delta_update;
-						//! undo the last update
-						VectorXd inv_ssm_update = -ssm_update;
-						ssm->additiveUpdate(inv_ssm_update);
-
-						if(params.debug_mode){
-							printf("curr_similarity: %20.14f\t prev_similarity: %20.14f\n",
-								curr_similarity, prev_similarity);
-							utils::printScalar(leven_marq_delta, "leven_marq_delta");
-						}
-						state_reset = true;
-						continue;
-					}
-					if(curr_similarity > prev_similarity){
-						leven_marq_delta /= params.lm_delta_update;
-					}
-				}
-				prev_similarity = curr_similarity;
+			if(!optimizer.acceptStep(am->getSimilarity())){
+				//! undo the last update
+				VectorXd inv_ssm_update = -ssm_update;
+				ssm->additiveUpdate(inv_ssm_update);
+				continue;
 			}
-			state_reset = false;
 
 			ssm->cmptApproxPixJacobian(curr_pix_jacobian, am->getInitPixGrad());
 			record_event("am->cmptApproxPixJacobian");
@@ -146,9 +127,6 @@ namespace nt{
 			}
 			switch(params.hess_type){
 			case HessType::InitialSelf:
-				if(params.leven_marq){
-					hessian = init_self_hessian;
-				}
 				break;
 			case HessType::CurrentSelf:
 				if(params.sec_ord_hess){
@@ -169,15 +147,7 @@ namespace nt{
 				}
 				break;
 			}
-			if(params.leven_marq){
-				//utils::printMatrix(hessian, "original hessian");
-				MatrixXd diag_hessian = hessian.diagonal().asDiagonal();
-				//utils::printMatrix(diag_hessian, "diag_hessian");
-				hessian += leven_marq_delta*diag_hessian;
-				//utils::printMatrix(hessian, "LM hessian");
-			}
-
-			ssm_update = -hessian.colPivHouseholderQr().solve(jacobian.transpose());
+			optimizer.solve(ssm_update, jacobian, hessian);
 			record_event("ssm_update");
 
 			prev_corners = ssm->getCorners();
@@ -187,14 +157,12 @@ namespace nt{
 			double update_norm = (prev_corners - ssm->getCorners()).squaredNorm();
 			record_event("update_norm");
 
-			if(update_norm < params.epsilon){
-				if(params.debug_mode){
-					printf("n_iters: %d\n", iter_id + 1);
-				}
+			if(optimizer.converged(update_norm)){
 				break;
 			}
 			am->clearFirstIter();
 		}
+		if(params.debug_mode){ optimizer.printStats(); }
 		ssm->getCorners(cv_corners_mat);
 	}
 }
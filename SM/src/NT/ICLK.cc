@@ -1,12 +1,15 @@
 #include "mtf/SM/NT/ICLK.h"
 #include "mtf/Utilities/miscUtils.h"
+#include "mtf/Utilities/profUtils.h"
 #include <stdexcept>
 
 _MTF_BEGIN_NAMESPACE
 namespace nt{
 	
 	ICLK::ICLK(AM _am, SSM _ssm, const ParamType *iclk_params) :
-		SearchMethod(_am, _ssm), params(iclk_params){
+		SearchMethod(_am, _ssm), params(iclk_params),
+		optimizer(params.max_iters, params.epsilon, params.leven_marq,
+		params.lm_delta_init, params.lm_delta_update, params.stagnation_iters){
 		printf("\n");
 		printf("Using Inverse Compositional Lucas Kanade (NT) SM with:\n");
 		printf("max_iters: %d\n", params.max_iters);
@@ -21,6 +24,7 @@ namespace nt{
 		printf("enable_learning: %d\n", params.enable_learning);
 		printf("hess_type: %d\n", params.hess_type);
 		printf("sec_ord_hess: %d\n", params.sec_ord_hess);
+		printf("stagnation_iters: %d\n", params.stagnation_iters);
 		printf("debug_mode: %d\n", params.debug_mode);
 
 		printf("appearance model: %s\n", am->name.c_str());
@@ -50,6 +54,7 @@ namespace nt{
 		}
 		df_dp.resize(state_size);
 		d2f_dp2.resize(state_size, state_size);
+		optimizer.setStateSize(state_size);
 
 		state_update.resize(state_size);
 		ssm_update.resize(ssm_state_size);
@@ -118,9 +123,6 @@ namespace nt{
 			} else{
 				am->cmptSelfHessian(d2f_dp2, dI0_dpssm);
 			}
-			if(params.leven_marq){
-				d2f_dp2_orig = d2f_dp2;
-			}
 		}
 		ssm->getCorners(cv_corners_mat);
 
@@ -147,9 +149,6 @@ namespace nt{
 					} else{
 						am->cmptSelfHessian(d2f_dp2, dI0_dpssm);
 					}
-					if(params.leven_marq){
-						d2f_dp2_orig = d2f_dp2;
-					}
 				}
 			}
 		}
@@ -161,11 +160,8 @@ namespace nt{
 		++frame_id;
 		write_frame_id(frame_id);
 
-		double prev_similarity = 0;
-		double leven_marq_delta = params.lm_delta_init;
-		bool state_reset = false;
-
 		am->setFirstIter();
+		optimizer.startFrame();
 		for(int iter_id = 0; iter_id < params.max_iters; iter_id++){
 			init_timer();
 
@@ -175,24 +171,12 @@ namespace nt{
 			am->updateSimilarity(false);
 			record_event("am->updateSimilarity");
 
-			if(params.leven_marq && !state_reset){
-				double curr_similarity = am->getSimilarity();
-				if(iter_id > 0){
-					if(curr_similarity < prev_similarity){
-						leven_marq_delta *= params.lm_delta_update;
-						//! undo the last update
-						ssm->compositionalUpdate(ssm_update);
-						am->updateState(am_update);
-						state_reset = true;
-						continue;
-					}
-					if(curr_similarity > prev_similarity){
-						leven_marq_delta /= params.lm_delta_update;
-					}
-				}
-				prev_similarity = curr_similarity;
+			if(!optimizer.acceptStep(am->getSimilarity())){
+				//! undo the last update
+				ssm->compositionalUpdate(ssm_update);
+				am->updateState(am_update);
+				continue;
 			}
-			state_reset = false;
 
 			am->updateInitGrad();
 			record_event("am->updateInitGrad");
@@ -202,9 +186,6 @@ namespace nt{
 
 			switch(params.hess_type){
 			case HessType::InitialSelf:
-				if(params.leven_marq){
-					d2f_dp2 = d2f_dp2_orig;
-				}
 				break;
 			case HessType::CurrentSelf:
 				if(params.chained_warp){
@@ -253,15 +234,7 @@ namespace nt{
 				break;
 			}
 
-			if(params.leven_marq){
-				//utils::printMatrix(hessian, "original hessian");
-				MatrixXd diag_d2f_dp2 = d2f_dp2.diagonal().asDiagonal();
-				//utils::printMatrix(diag_hessian, "diag_hessian");
-				d2f_dp2 += leven_marq_delta*diag_d2f_dp2;
-				//utils::printMatrix(hessian, "LM hessian");
-			}
-
-			state_update = -d2f_dp2.colPivHouseholderQr().solve(df_dp.transpose());
+			optimizer.solve(state_update, df_dp, d2f_dp2);
 			record_event("ssm_update");
 
 			ssm_update = state_update.head(ssm_state_size);
@@ -284,14 +257,12 @@ namespace nt{
 			double update_norm = (prev_corners - ssm->getCorners()).squaredNorm();
 			record_event("update_norm");
 
-			if(update_norm < params.epsilon){
-				if(params.debug_mode){
-					printf("n_iters: %d\n", iter_id + 1);
-				}
+			if(optimizer.converged(update_norm)){
 				break;
 			}
 			am->clearFirstIter();
 		}
+		if(params.debug_mode){ optimizer.printStats(); }
 		if(params.enable_learning){
 			am->updateModel(ssm->getPts());
 		}
@@ -1,5 +1,7 @@
 #include "mtf/SM/NT/NN.h"
 #include "mtf/Utilities/miscUtils.h"
+#include "mtf/Utilities/profUtils.h"
+#include "mtf/Utilities/excpUtils.h"
 #include <fstream> 
 #include "opencv2/highgui/highgui.hpp"
 
@@ -17,6 +19,7 @@ namespace nt{
 		printf("additive_update: %d\n", params.additive_update);
 		printf("show_samples: %d\n", params.show_samples);
 		printf("save_index: %d\n", params.save_index);
+		printf("db_format: %d\n", params.db_format);
 		printf("debug_mode: %d\n", params.debug_mode);
 
 		printf("appearance model: %s\n", am->name.c_str());
@@ -42,15 +45,19 @@ namespace nt{
 			distr_n_samples, n_distr, ssm_state_size);
 		printf("n_distr: %d\n", n_distr);
 
-		eig_dataset.resize(params.n_samples, am_dist_size);
-		ssm_perturbations.resize(params.n_samples);
+		if(params.db_format < 0 || params.db_format > 4){
+			throw utils::InvalidArgument(cv::format("NN :: Invalid database format: %d", params.db_format));
+		}
 		inv_state_update.resize(ssm_state_size);
+		best_perturbation.resize(ssm_state_size);
 
 		string fname_template = cv::format("%s_%s_%d_%d", am->name.c_str(), ssm->name.c_str(),
 			params.n_samples, am_dist_size);
 		saved_db_path = cv::format("%s/%s.db", params.saved_index_dir.c_str(), fname_template.c_str());
 		saved_idx_path = cv::format("%s/%s_gnn.idx", params.saved_index_dir.c_str(),
 			fname_template.c_str());
+		saved_mapped_db_path = cv::format("%s/%s.mdb", params.saved_index_dir.c_str(),
+			fname_template.c_str());
 	}
 
 
@@ -92,12 +99,21 @@ namespace nt{
 			am->getCurrImg().convertTo(curr_img_uchar, CV_8UC1);
 		}
 
-		if(params.load_index){ loadDataset(); }
+		if(params.load_index){
+			if(params.db_format > 0){
+				loadMappedDatabase();
+			} else{
+				loadDataset();
+			}
+		}
 
 		if(!dataset_loaded){
 			printf("building feature dataset...\n");
 			mtf_clock_get(db_start_time);
 
+			//! the dataset is allocated only when it is generated since it is not needed with a mapped database
+			eig_dataset.resize(params.n_samples, am_dist_size);
+			ssm_perturbations.resize(params.n_samples);
 			generateDataset();
 
 			double db_time;
@@ -105,11 +121,13 @@ namespace nt{
 			mtf_clock_measure(db_start_time, db_end_time, db_time);
 			printf("Time taken: %f secs\n", db_time);
 
-			if(params.save_index){ saveDataset(); }
+			if(params.save_index && params.db_format == 0){ saveDataset(); }
 		}
 		double idx_time;
 		mtf_clock_get(idx_start_time);
-		if(params.load_index){
+		if(mapped_db.isOpen()){
+			gnn_index->setDatabase(&mapped_db);
+		} else if(params.load_index){
 			gnn_index->loadGraph(saved_idx_path.c_str());
 		} else{
 			printf("building GNN graph...\n");
@@ -120,7 +138,11 @@ namespace nt{
 		printf("Time taken: %f secs\n", idx_time);
 
 		if(params.save_index){
-			gnn_index->saveGraph(saved_idx_path.c_str());
+			if(params.db_format > 0){
+				saveMappedDatabase();
+			} else{
+				gnn_index->saveGraph(saved_idx_path.c_str());
+			}
 		}
 		ssm->getCorners(cv_corners_mat);
 
@@ -195,6 +217,8 @@ namespace nt{
 		if(in_file.good()){
 			printf("Loading feature dataset from: %s\n", saved_db_path.c_str());
 			mtf_clock_get(db_start_time);
+			eig_dataset.resize(params.n_samples, am_dist_size);
+			ssm_perturbations.resize(params.n_samples);
 			in_file.read((char*)(eig_dataset.data()), sizeof(double)*eig_dataset.size());
 			for(int sample_id = 0; sample_id < params.n_samples; ++sample_id){
 				ssm_perturbations[sample_id].resize(ssm_state_size);
@@ -232,6 +256,44 @@ namespace nt{
 			printf("Failed to save dataset to: %s\n", saved_db_path.c_str());
 		}
 	}
+
+	void NN::loadMappedDatabase(){
+		printf("Loading feature dataset and index from: %s\n", saved_mapped_db_path.c_str());
+		mtf_clock_get(db_start_time);
+		if(mapped_db.open(saved_mapped_db_path) && mapped_db.hasGraph() &&
+			mapped_db.getNSamples() == params.n_samples &&
+			mapped_db.getFeatSize() == static_cast<int>(am_dist_size) &&
+			mapped_db.getStateSize() == static_cast<int>(ssm_state_size)){
+			double db_time;
+			mtf_clock_get(db_end_time);
+			mtf_clock_measure(db_start_time, db_end_time, db_time);
+			printf("Time taken: %f secs\n", db_time);
+			printf("feature type: %s\n", utils::toString(mapped_db.getFeatType()));
+			dataset_loaded = true;
+			params.save_index = false;
+		} else{
+			printf("Failed to load feature dataset and index from: %s\n", saved_mapped_db_path.c_str());
+			mapped_db.close();
+			// dataset and index must be rebuilt
+			params.load_index = false;
+		}
+	}
+
+	void NN::saveMappedDatabase(){
+		printf("Saving dataset and index to: %s\n", saved_mapped_db_path.c_str());
+		MatrixXdr perturbations(params.n_samples, ssm_state_size);
+		for(int sample_id = 0; sample_id < params.n_samples; ++sample_id){
+			perturbations.row(sample_id) = ssm_perturbations[sample_id].transpose();
+		}
+		std::vector<int64_t> node_offsets;
+		std::vector<int> node_nbrs;
+		gnn_index->getGraph(node_offsets, node_nbrs);
+		if(!utils::NNDatabase::write(saved_mapped_db_path, static_cast<utils::DBFeatType>(params.db_format - 1),
+			eig_dataset.data(), params.n_samples, am_dist_size, perturbations.data(), ssm_state_size,
+			node_offsets, node_nbrs)){
+			printf("Failed to save dataset and index to: %s\n", saved_mapped_db_path.c_str());
+		}
+	}
 
 	void NN::update(){
 		++frame_id;
@@ -250,13 +312,18 @@ namespace nt{
 			gnn_index->searchGraph(am->getDistFeat(), eig_dataset.data(),
 				&best_idx, &best_dist);
 
+			if(mapped_db.isOpen()){
+				best_perturbation = Map<const VectorXd>(mapped_db.getPerturbation(best_idx), ssm_state_size);
+			} else{
+				best_perturbation = ssm_perturbations[best_idx];
+			}
 			prev_corners = ssm->getCorners();
 
 			if(params.additive_update){
-				ssm->additiveUpdate(ssm_perturbations[best_idx]);
+				ssm->additiveUpdate(best_perturbation);
 				record_event("ssm->additiveUpdate");
 			} else{
-				ssm->compositionalUpdate(ssm_perturbations[best_idx]);
+				ssm->compositionalUpdate(best_perturbation);
 				record_event("ssm->compositionalUpdate");
 			}
 
@@ -1,5 +1,6 @@
 #include "mtf/SM/NT/PF.h"
 #include "mtf/Utilities/miscUtils.h" 
+#include "mtf/Utilities/excpUtils.h"
 #include <boost/random/random_device.hpp>
 #include <boost/random/seed_seq.hpp>
 #include "opencv2/highgui/highgui.hpp"
@@ -13,7 +14,8 @@
 
 _MTF_BEGIN_NAMESPACE
 namespace nt{
-	PF::PF(AM _am, SSM _ssm, const ParamType *pf_params) :
+	PF::PF(AM _am, SSM _ssm, const ParamType *pf_params,
+		const vector<AM> &_worker_am, const vector<SSM> &_worker_ssm) :
 		SearchMethod(_am, _ssm), params(pf_params), max_wt_id(0), 
 		enable_adaptive_resampling(false), min_eff_particles(0){
 		printf("\n");
@@ -34,6 +36,7 @@ namespace nt{
 		printf("show_particles: %d\n", params.show_particles);
 		printf("enable_learning: %d\n", params.enable_learning);
 		printf("jacobian_as_sigma: %d\n", params.jacobian_as_sigma);
+		printf("n_workers: %d\n", params.n_workers);
 		printf("debug_mode: %d\n", params.debug_mode);
 		printf("appearance model: %s\n", am->name.c_str());
 		printf("state space model: %s\n", ssm->name.c_str());
@@ -89,8 +92,6 @@ namespace nt{
 		distr_wts.resize(n_distr);
 		distr_n_particles.resize(n_distr);
 
-		perturbed_state.resize(ssm_state_size);
-		perturbed_ar.resize(ssm_state_size);
 		mean_state.resize(ssm_state_size);
 
 		state_sigma.resize(n_distr);
@@ -125,6 +126,33 @@ namespace nt{
 			resample_ids_hist.resize(params.n_particles);
 			uniform_rand_nums.resize(params.n_particles);
 		}
+		//! particles are drawn one at a time on the same image when they are shown
+		n_workers = params.n_workers > 1 && !params.show_particles ? params.n_workers : 1;
+		if(n_workers > static_cast<unsigned int>(params.n_particles)){
+			n_workers = params.n_particles;
+		}
+		if(_worker_am.size() + 1 < n_workers || _worker_ssm.size() + 1 < n_workers){
+			throw utils::InvalidArgument(
+				cv::format("PF :: %d workers need %d copies of the AM and SSM but only %d and %d were provided",
+				n_workers, n_workers - 1, _worker_am.size(), _worker_ssm.size()));
+		}
+		worker_am.push_back(am);
+		worker_ssm.push_back(ssm);
+		for(unsigned int worker_id = 1; worker_id < n_workers; ++worker_id){
+			worker_am.push_back(_worker_am[worker_id - 1]);
+			worker_ssm.push_back(_worker_ssm[worker_id - 1]);
+		}
+		worker_distr_id.assign(n_workers, 0);
+		perturbed_state.resize(n_workers);
+		perturbed_ar.resize(n_workers);
+		for(unsigned int worker_id = 0; worker_id < n_workers; ++worker_id){
+			perturbed_state[worker_id].resize(ssm_state_size);
+			perturbed_ar[worker_id].resize(ssm_state_size);
+		}
+		if(n_workers > 1){
+			printf("Evaluating particles in parallel using %d workers\n", n_workers);
+		}
+
 		if(params.show_particles){
 			reset_file(state_fname);
 			reset_file(corners_fname);
@@ -164,6 +192,17 @@ namespace nt{
 			am->cmptSelfHessian(d2f_dp2, dI_dp);
 		}
 
+		//! the other workers start from the same template, region and sampler
+		for(unsigned int worker_id = 1; worker_id < n_workers; ++worker_id){
+			worker_am[worker_id]->clearInitStatus();
+			worker_ssm[worker_id]->clearInitStatus();
+			worker_ssm[worker_id]->initialize(corners, am->getNChannels());
+			worker_ssm[worker_id]->initializeSampler(state_sigma[0], state_mean[0]);
+			worker_am[worker_id]->initializePixVals(ssm->getPts());
+			worker_am[worker_id]->initializeSimilarity();
+		}
+		std::fill(worker_distr_id.begin(), worker_distr_id.end(), 0);
+
 		initializeParticles();
 		initializeDistributions();
 
@@ -209,7 +248,9 @@ namespace nt{
 		if(params.debug_mode){
 			utils::printScalarToFile(frame_id, "\n\n-------------------\nframe_id", log_fname, "%d");
 		}
-		am->setFirstIter();
+		for(unsigned int worker_id = 0; worker_id < n_workers; ++worker_id){
+			worker_am[worker_id]->setFirstIter();
+		}
 		int pause_after_show = 1;
 		if(params.jacobian_as_sigma){
 			am->updatePixVals(ssm->getPts());
@@ -224,7 +265,9 @@ namespace nt{
 			am->cmptCurrJacobian(df_dp, dI_dp);
 			state_sigma[0] = -d2f_dp2.colPivHouseholderQr().solve(df_dp.transpose());
 
-			ssm->setSampler(state_sigma[0], state_mean[0]);
+			for(unsigned int worker_id = 0; worker_id < n_workers; ++worker_id){
+				worker_ssm[worker_id]->setSampler(state_sigma[0], state_mean[0]);
+			}
 		}
 		if(params.show_particles){
 			utils::printScalarToFile(frame_id, "frame_id", state_fname, "%d");
@@ -232,7 +275,6 @@ namespace nt{
 			utils::printMatrixToFile(ssm->getState().transpose(), nullptr, state_fname);
 			utils::printMatrixToFile(ssm->getCorners(), nullptr, corners_fname);
 		}
-		int distr_id = 0;
 		for(int iter_id = 0; iter_id < params.max_iters; ++iter_id){
 			if(params.show_particles){
 				am->getCurrImg().convertTo(curr_img_uchar, CV_8UC1);
@@ -256,93 +298,55 @@ namespace nt{
 					distr_n_particles[i] = 0;
 				}
 			}
-			double max_wt = std::numeric_limits<double>::lowest();
+			/**
+			the distributions are drawn serially in particle order so that the same sequence
+			is obtained irrespective of the no. of workers
+			*/
 			for(int particle_id = 0; particle_id < params.n_particles; ++particle_id){
-				if(n_distr > 1){
-					int new_distr_id = distr_id_dist(distr_id_gen);
-					if(new_distr_id != distr_id){
-						distr_id = new_distr_id;
-						//! need to reset SSM sampler only if multiple distributions are in use
-						ssm->setSampler(state_sigma[distr_id], state_mean[distr_id]);
-					}
-				}
-				particle_distr[curr_set_id][particle_id] = distr_id;
-				switch(params.dynamic_model){
-				case DynamicModel::AutoRegression1:
-					switch(params.update_type){
-					case UpdateType::Additive:
-						ssm->additiveAutoRegression1(perturbed_state, perturbed_ar,
-							particle_states[curr_set_id][particle_id], particle_ar[curr_set_id][particle_id]);
-						break;
-					case UpdateType::Compositional:
-						ssm->compositionalAutoRegression1(perturbed_state, perturbed_ar,
-							particle_states[curr_set_id][particle_id], particle_ar[curr_set_id][particle_id]);
-						break;
-					}
-					particle_ar[curr_set_id][particle_id] = perturbed_ar;
-					break;
-				case DynamicModel::RandomWalk:
-					switch(params.update_type){
-					case UpdateType::Additive:
-						ssm->additiveRandomWalk(perturbed_state, particle_states[curr_set_id][particle_id]);
-						break;
-					case UpdateType::Compositional:
-						ssm->compositionalRandomWalk(perturbed_state, particle_states[curr_set_id][particle_id]);
-						break;
+				particle_distr[curr_set_id][particle_id] = n_distr > 1 ? distr_id_dist(distr_id_gen) : 0;
+			}
+			if(n_workers > 1){
+				//! each worker handles a contiguous block of particles
+				utils::runWorkers(n_workers, [&](unsigned int worker_id){
+					int start_id = worker_id*params.n_particles / n_workers;
+					int end_id = (worker_id + 1)*params.n_particles / n_workers;
+					for(int particle_id = start_id; particle_id < end_id; ++particle_id){
+						evaluateParticle(particle_id, worker_id);
 					}
-					break;
-				}
-				particle_states[curr_set_id][particle_id] = perturbed_state;
-
-				//printf("PF:: calling setState for particle %d set %d with: \n", particle_id, curr_set_id);
-				//utils::printMatrix(perturbed_state.transpose(), "perturbed_state");
-				//utils::printMatrix(particle_states[curr_set_id][particle_id].transpose(), "ssm_state");
-
-				ssm->setState(particle_states[curr_set_id][particle_id]);
-				am->updatePixVals(ssm->getPts());
-				am->updateSimilarity(false);
-				/**
-				a positive number that measures the dissimilarity between the
-				template and the patch corresponding to this particle
-				*/
-				double measuremnt_val = max_similarity - am->getSimilarity();
-
-				// convert this dissimilarity to a likelihood proportional to the dissimilarity
-				switch(params.likelihood_func){
-				case LikelihoodFunc::AM:
-					measurement_likelihood = am->getLikelihood();
-					break;
-				case LikelihoodFunc::Gaussian:
-					measurement_likelihood = measurement_factor * exp(-0.5*measuremnt_val / params.measurement_sigma);
-					break;
-				case LikelihoodFunc::Reciprocal:
-					measurement_likelihood = 1.0 / (1.0 + measuremnt_val);
-					break;
-				}
-				if(params.show_particles){
-					cv::Point2d corners[4];
-					ssm->getCorners(corners);
-					utils::drawCorners(curr_img_uchar, corners,
-						cv::Scalar(0, 0, 255), cv::format("%d: %5.3e", particle_id + 1, measurement_likelihood));
-					//printf("measurement_likelihood: %e\n", measurement_likelihood);
-					if((particle_id + 1) % params.show_particles == 0){
-						cv::imshow("Particles", curr_img_uchar);
-						int key = cv::waitKey(1 - pause_after_show);
-						if(key == 27){
-							cv::destroyWindow("Particles");
-							params.show_particles = 0;
-						} else if(key == 32){
-							pause_after_show = 1 - pause_after_show;
+				});
+			} else{
+				for(int particle_id = 0; particle_id < params.n_particles; ++particle_id){
+					evaluateParticle(particle_id, 0);
+					if(params.show_particles){
+						double measurement_likelihood = particle_wts[particle_id];
+						cv::Point2d corners[4];
+						ssm->getCorners(corners);
+						utils::drawCorners(curr_img_uchar, corners,
+							cv::Scalar(0, 0, 255), cv::format("%d: %5.3e", particle_id + 1, measurement_likelihood));
+						//printf("measurement_likelihood: %e\n", measurement_likelihood);
+						if((particle_id + 1) % params.show_particles == 0){
+							cv::imshow("Particles", curr_img_uchar);
+							int key = cv::waitKey(1 - pause_after_show);
+							if(key == 27){
+								cv::destroyWindow("Particles");
+								params.show_particles = 0;
+							} else if(key == 32){
+								pause_after_show = 1 - pause_after_show;
+							}
+							am->getCurrImg().convertTo(curr_img_uchar, CV_8UC1);
 						}
-						am->getCurrImg().convertTo(curr_img_uchar, CV_8UC1);
+						utils::printMatrixToFile(ssm->getState().transpose(), nullptr, state_fname);
+						utils::printMatrixToFile(ssm->getCorners(), nullptr, corners_fname);
 					}
-					utils::printMatrixToFile(ssm->getState().transpose(), nullptr, state_fname);
-					utils::printMatrixToFile(ssm->getCorners(), nullptr, corners_fname);
 				}
-				particle_wts[particle_id] = measurement_likelihood;				
+			}
+			//! the weights are accumulated serially in particle order so that resampling does not depend on the no. of workers
+			double max_wt = std::numeric_limits<double>::lowest();
+			for(int particle_id = 0; particle_id < params.n_particles; ++particle_id){
 				particle_cum_wts[particle_id] = particle_id == 0 ? particle_wts[particle_id] :
 					particle_wts[particle_id] + particle_cum_wts[particle_id - 1];
 				if(params.update_distr_wts){
+					int distr_id = static_cast<int>(particle_distr[curr_set_id][particle_id]);
 					distr_wts[distr_id] += particle_wts[particle_id];
 					distr_n_particles[distr_id] += 1;
 				}
@@ -427,13 +431,17 @@ namespace nt{
 				}
 				break;
 			}
-			am->clearFirstIter();
+			for(unsigned int worker_id = 0; worker_id < n_workers; ++worker_id){
+				worker_am[worker_id]->clearFirstIter();
+			}
 		}
 		if(params.reset_to_mean){
 			initializeParticles();
 		}
 		if(params.enable_learning){
-			am->updateModel(ssm->getPts());
+			for(unsigned int worker_id = 0; worker_id < n_workers; ++worker_id){
+				worker_am[worker_id]->updateModel(ssm->getPts());
+			}
 			max_similarity = am->getSimilarity();
 		}
 		ssm->getCorners(cv_corners_mat);
@@ -583,8 +591,78 @@ namespace nt{
 		}
 	}
 
+	void PF::evaluateParticle(int particle_id, unsigned int worker_id){
+		const AM &am = worker_am[worker_id];
+		const SSM &ssm = worker_ssm[worker_id];
+		VectorXd &perturbed_state = this->perturbed_state[worker_id];
+		VectorXd &perturbed_ar = this->perturbed_ar[worker_id];
+
+		int distr_id = static_cast<int>(particle_distr[curr_set_id][particle_id]);
+		if(distr_id != worker_distr_id[worker_id]){
+			worker_distr_id[worker_id] = distr_id;
+			//! need to reset SSM sampler only if multiple distributions are in use
+			ssm->setSampler(state_sigma[distr_id], state_mean[distr_id]);
+		}
+		switch(params.dynamic_model){
+		case DynamicModel::AutoRegression1:
+			switch(params.update_type){
+			case UpdateType::Additive:
+				ssm->additiveAutoRegression1(perturbed_state, perturbed_ar,
+					particle_states[curr_set_id][particle_id], particle_ar[curr_set_id][particle_id]);
+				break;
+			case UpdateType::Compositional:
+				ssm->compositionalAutoRegression1(perturbed_state, perturbed_ar,
+					particle_states[curr_set_id][particle_id], particle_ar[curr_set_id][particle_id]);
+				break;
+			}
+			particle_ar[curr_set_id][particle_id] = perturbed_ar;
+			break;
+		case DynamicModel::RandomWalk:
+			switch(params.update_type){
+			case UpdateType::Additive:
+				ssm->additiveRandomWalk(perturbed_state, particle_states[curr_set_id][particle_id]);
+				break;
+			case UpdateType::Compositional:
+				ssm->compositionalRandomWalk(perturbed_state, particle_states[curr_set_id][particle_id]);
+				break;
+			}
+			break;
+		}
+		particle_states[curr_set_id][particle_id] = perturbed_state;
+
+		ssm->setState(particle_states[curr_set_id][particle_id]);
+		am->updatePixVals(ssm->getPts());
+		am->updateSimilarity(false);
+		/**
+		a positive number that measures the dissimilarity between the
+		template and the patch corresponding to this particle
+		*/
+		double measuremnt_val = max_similarity - am->getSimilarity();
+
+		// convert this dissimilarity to a likelihood proportional to the dissimilarity
+		switch(params.likelihood_func){
+		case LikelihoodFunc::AM:
+			particle_wts[particle_id] = am->getLikelihood();
+			break;
+		case LikelihoodFunc::Gaussian:
+			particle_wts[particle_id] = measurement_factor * exp(-0.5*measuremnt_val / params.measurement_sigma);
+			break;
+		case LikelihoodFunc::Reciprocal:
+			particle_wts[particle_id] = 1.0 / (1.0 + measuremnt_val);
+			break;
+		}
+	}
+
+	void PF::setImage(const cv::Mat &img){
+		for(unsigned int worker_id = 0; worker_id < n_workers; ++worker_id){
+			worker_am[worker_id]->setCurrImg(img);
+		}
+	}
+
 	void PF::setRegion(const cv::Mat& corners){
-		ssm->setCorners(corners);
+		for(unsigned int worker_id = 0; worker_id < n_workers; ++worker_id){
+			worker_ssm[worker_id]->setCorners(corners);
+		}
 		ssm->getCorners(cv_corners_mat);
 		initializeParticles();
 	}
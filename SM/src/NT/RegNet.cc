@@ -1,5 +1,6 @@
 #include "mtf/SM/NT/RegNet.h"
 #include "mtf/Utilities/miscUtils.h"
+#include "mtf/Utilities/profUtils.h"
 #include "mtf/Utilities/imgUtils.h"
 
 #include <fstream> 
@@ -3,11 +3,6 @@
 #include <boost/random/random_device.hpp>
 #include <boost/random/seed_seq.hpp>
 #include "opencv2/highgui/highgui.hpp"
-
-//! OpenMP scheduler
-#ifndef PF_OMP_SCHD
-#define PF_OMP_SCHD auto
-#endif
 
 _MTF_BEGIN_NAMESPACE
 
@@ -42,6 +37,7 @@ PF<AM, SSM >::PF(const ParamType *pf_params,
 	printf("measurement_sigma: %f\n", params.measurement_sigma);
 	printf("show_particles: %d\n", params.show_particles);
 	printf("enable_learning: %d\n", params.enable_learning);
+	printf("n_workers: %d\n", params.n_workers);
 	printf("debug_mode: %d\n", params.debug_mode);
 	printf("appearance model: %s\n", am.name.c_str());
 	printf("state space model: %s\n", ssm.name.c_str());
@@ -68,8 +64,6 @@ PF<AM, SSM >::PF(const ParamType *pf_params,
 	particle_wts.resize(params.n_particles);
 	particle_cum_wts.setZero(params.n_particles);
 
-	perturbed_state.resize(ssm_state_size);
-	perturbed_ar.resize(ssm_state_size);
 	mean_state.resize(ssm_state_size);
 	state_sigma.resize(ssm_state_size);
 	state_mean.resize(ssm_state_size);
@@ -116,15 +110,24 @@ PF<AM, SSM >::PF(const ParamType *pf_params,
 		uniform_rand_nums.resize(params.n_particles);
 	}
 
-#ifdef ENABLE_PARALLEL
-	for(int particle_id = 0; particle_id < params.n_particles; particle_id++){
+	//! particles are drawn one at a time on the same image when they are shown
+	n_workers = params.n_workers > 1 && !params.show_particles ? params.n_workers : 1;
+	if(n_workers > static_cast<unsigned int>(params.n_particles)){
+		n_workers = params.n_particles;
+	}
+	for(unsigned int worker_id = 1; worker_id < n_workers; ++worker_id){
 		am_vec.push_back(AMPTr(new AM(am_params)));
 		ssm_vec.push_back(SSMPTr(new SSM(ssm_params)));
 	}
-#endif
-#if defined ENABLE_OMP
-printf(" ******* Parallelization is enabled using OpenMP ******* \n");
-#endif
+	perturbed_state.resize(n_workers);
+	perturbed_ar.resize(n_workers);
+	for(unsigned int worker_id = 0; worker_id < n_workers; ++worker_id){
+		perturbed_state[worker_id].resize(ssm_state_size);
+		perturbed_ar[worker_id].resize(ssm_state_size);
+	}
+	if(n_workers > 1){
+		printf("Evaluating particles in parallel using %d workers\n", n_workers);
+	}
 }
 
 template <class AM, class SSM>
@@ -157,14 +160,13 @@ void PF<AM, SSM >::initialize(const cv::Mat &corners){
 
 	prev_corners = ssm.getCorners();
 	ssm.getCorners(cv_corners_mat);
-#ifdef ENABLE_PARALLEL
-	for(int particle_id = 0; particle_id < params.n_particles; particle_id++){
-		ssm_vec[particle_id]->initialize(corners, am.getNChannels());
-		ssm_vec[particle_id]->initializeSampler(state_sigma, VectorXd::Zero(ssm_state_size));
-		am_vec[particle_id]->initializePixVals(ssm.getPts());
-		am_vec[particle_id]->initializeSimilarity();
+	//! the other workers start from the same template, region and sampler
+	for(unsigned int worker_id = 1; worker_id < n_workers; ++worker_id){
+		ssm_vec[worker_id - 1]->initialize(corners, am.getNChannels());
+		ssm_vec[worker_id - 1]->initializeSampler(state_sigma, state_mean);
+		am_vec[worker_id - 1]->initializePixVals(ssm.getPts());
+		am_vec[worker_id - 1]->initializeSimilarity();
 	}
-#endif
 }
 
 template <class AM, class SSM>
@@ -186,90 +188,54 @@ template <class AM, class SSM>
 void PF<AM, SSM >::update(){
 	++frame_id;
 	am.setFirstIter();
+	for(unsigned int worker_id = 1; worker_id < n_workers; ++worker_id){
+		am_vec[worker_id - 1]->setFirstIter();
+	}
 	int pause_after_show = 1;
 	for(int i = 0; i < params.max_iters; i++){
 		if(params.show_particles){
 			am.getCurrImg().convertTo(curr_img_uchar, CV_8UC1);
 		}
-		double max_wt = std::numeric_limits<double>::lowest();
-#ifdef ENABLE_OMP
-#pragma omp parallel for schedule(PF_OMP_SCHD)
-#endif	
-		for(int particle_id = 0; particle_id < params.n_particles; ++particle_id){
-#ifdef ENABLE_PARALLEL
-			SSM &ssm = *ssm_vec[particle_id];
-			AM &am = *am_vec[particle_id];
-#endif
-			switch(params.dynamic_model){
-			case DynamicModel::AutoRegression1:
-				switch(params.update_type){
-				case UpdateType::Additive:
-					ssm.additiveAutoRegression1(perturbed_state, perturbed_ar,
-						particle_states[curr_set_id][particle_id], particle_ar[curr_set_id][particle_id]);
-					break;
-				case UpdateType::Compositional:
-					ssm.compositionalAutoRegression1(perturbed_state, perturbed_ar,
-						particle_states[curr_set_id][particle_id], particle_ar[curr_set_id][particle_id]);
-					break;
-				}
-				particle_ar[curr_set_id][particle_id] = perturbed_ar;
-				break;
-			case DynamicModel::RandomWalk:
-				switch(params.update_type){
-				case UpdateType::Additive:
-					ssm.additiveRandomWalk(perturbed_state, particle_states[curr_set_id][particle_id]);
-					break;
-				case UpdateType::Compositional:
-					ssm.compositionalRandomWalk(perturbed_state, particle_states[curr_set_id][particle_id]);
-					break;
-				}
-				break;
-			}
-			particle_states[curr_set_id][particle_id] = perturbed_state;
-
-			ssm.setState(particle_states[curr_set_id][particle_id]);
-			am.updatePixVals(ssm.getPts());
-			am.updateSimilarity(false);
-
-			// a positive number that measures the dissimilarity between the
-			// template and the patch corresponding to this particle
-			double measuremnt_val = max_similarity - am.getSimilarity();
-
-			// convert this dissimilarity to a likelihood proportional to the dissimilarity
-			switch(params.likelihood_func){
-			case LikelihoodFunc::AM:
-				measurement_likelihood = am.getLikelihood();
-				break;
-			case LikelihoodFunc::Gaussian:
-				measurement_likelihood = measurement_factor * exp(-0.5*measuremnt_val / params.measurement_sigma);
-				break;
-			case LikelihoodFunc::Reciprocal:
-				measurement_likelihood = 1.0 / (1.0 + measuremnt_val);
-				break;
-			}
-			if(params.show_particles){
-				cv::Point2d corners[4];
-				ssm.getCorners(corners);
-				utils::drawCorners(curr_img_uchar, corners,
-					cv::Scalar(0, 0, 255), cv::format("%d: %5.3e", particle_id + 1, measurement_likelihood));
-				//printf("measurement_likelihood: %e\n", measurement_likelihood);
-				if((particle_id + 1) % params.show_particles == 0){
-					cv::imshow("Particles", curr_img_uchar);
-					int key = cv::waitKey(1 - pause_after_show);
-					if(key == 27){
-						cv::destroyWindow("Particles");
-						params.show_particles = 0;
-					} else if(key == 32){
-						pause_after_show = 1 - pause_after_show;
-					}
-					am.getCurrImg().convertTo(curr_img_uchar, CV_8UC1);
+		if(n_workers > 1){
+			//! each worker handles a contiguous block of particles
+			utils::runWorkers(n_workers, [&](unsigned int worker_id){
+				int start_id = worker_id*params.n_particles / n_workers;
+				int end_id = (worker_id + 1)*params.n_particles / n_workers;
+				for(int particle_id = start_id; particle_id < end_id; ++particle_id){
+					evaluateParticle(particle_id, worker_id);
+				}
+			});
+		} else{
+			for(int particle_id = 0; particle_id < params.n_particles; ++particle_id){
+				evaluateParticle(particle_id, 0);
+				if(params.show_particles){
+					double measurement_likelihood = particle_wts[particle_id];
+					cv::Point2d corners[4];
+					ssm.getCorners(corners);
+					utils::drawCorners(curr_img_uchar, corners,
+						cv::Scalar(0, 0, 255), cv::format("%d: %5.3e", particle_id + 1, measurement_likelihood));
+					//printf("measurement_likelihood: %e\n", measurement_likelihood);
+					if((particle_id + 1) % params.show_particles == 0){
+						cv::imshow("Particles", curr_img_uchar);
+						int key = cv::waitKey(1 - pause_after_show);
+						if(key == 27){
+							cv::destroyWindow("Particles");
+							params.show_particles = 0;
+						} else if(key == 32){
+							pause_after_show = 1 - pause_after_show;
+						}
+						am.getCurrImg().convertTo(curr_img_uchar, CV_8UC1);
+					}
 				}
 			}
-			particle_wts[particle_id] = measurement_likelihood;
-			if(particle_id > 0){
+		}
+		//! the weights are accumulated serially in particle order so that resampling does not depend on the no. of workers
+		double max_wt = std::numeric_limits<double>::lowest();
+		for(int particle_id = 0; particle_id < params.n_particles; ++particle_id){
+			if(particle_id > 0){
 				particle_cum_wts[particle_id] = particle_wts[particle_id] + particle_cum_wts[particle_id - 1];
-			} else{
-				particle_cum_wts[particle_id] = particle_wts[particle_id];
+			} else{
+				particle_cum_wts[particle_id] = particle_wts[particle_id];
 			}
 			if(particle_wts[particle_id] >= max_wt){
 				max_wt = particle_wts[particle_id];
@@ -327,12 +293,18 @@ void PF<AM, SSM >::update(){
 			break;
 		}
 		am.clearFirstIter();
+		for(unsigned int worker_id = 1; worker_id < n_workers; ++worker_id){
+			am_vec[worker_id - 1]->clearFirstIter();
+		}
 	}
 	if(params.reset_to_mean){
 		initializeParticles();
 	}
 	if(params.enable_learning){
 		am.updateModel(ssm.getPts());
+		for(unsigned int worker_id = 1; worker_id < n_workers; ++worker_id){
+			am_vec[worker_id - 1]->updateModel(ssm.getPts());
+		}
 	}
 	ssm.getCorners(cv_corners_mat);
 }
@@ -479,10 +451,77 @@ void PF<AM, SSM >::updateMeanCorners(){
 	}
 }
 template <class AM, class SSM>
-void PF<AM, SSM >::setRegion(const cv::Mat& corners){
-	ssm.setCorners(corners);
-	ssm.getCorners(cv_corners_mat);
-	initializeParticles();
+void PF<AM, SSM >::evaluateParticle(int particle_id, unsigned int worker_id){
+	AM &am = worker_id == 0 ? this->am : *am_vec[worker_id - 1];
+	SSM &ssm = worker_id == 0 ? this->ssm : *ssm_vec[worker_id - 1];
+	VectorXd &perturbed_state = this->perturbed_state[worker_id];
+	VectorXd &perturbed_ar = this->perturbed_ar[worker_id];
+
+	switch(params.dynamic_model){
+	case DynamicModel::AutoRegression1:
+		switch(params.update_type){
+		case UpdateType::Additive:
+			ssm.additiveAutoRegression1(perturbed_state, perturbed_ar,
+				particle_states[curr_set_id][particle_id], particle_ar[curr_set_id][particle_id]);
+			break;
+		case UpdateType::Compositional:
+			ssm.compositionalAutoRegression1(perturbed_state, perturbed_ar,
+				particle_states[curr_set_id][particle_id], particle_ar[curr_set_id][particle_id]);
+			break;
+		}
+		particle_ar[curr_set_id][particle_id] = perturbed_ar;
+		break;
+	case DynamicModel::RandomWalk:
+		switch(params.update_type){
+		case UpdateType::Additive:
+			ssm.additiveRandomWalk(perturbed_state, particle_states[curr_set_id][particle_id]);
+			break;
+		case UpdateType::Compositional:
+			ssm.compositionalRandomWalk(perturbed_state, particle_states[curr_set_id][particle_id]);
+			break;
+		}
+		break;
+	}
+	particle_states[curr_set_id][particle_id] = perturbed_state;
+
+	ssm.setState(particle_states[curr_set_id][particle_id]);
+	am.updatePixVals(ssm.getPts());
+	am.updateSimilarity(false);
+
+	// a positive number that measures the dissimilarity between the
+	// template and the patch corresponding to this particle
+	double measuremnt_val = max_similarity - am.getSimilarity();
+
+	// convert this dissimilarity to a likelihood proportional to the dissimilarity
+	switch(params.likelihood_func){
+	case LikelihoodFunc::AM:
+		particle_wts[particle_id] = am.getLikelihood();
+		break;
+	case LikelihoodFunc::Gaussian:
+		particle_wts[particle_id] = measurement_factor * exp(-0.5*measuremnt_val / params.measurement_sigma);
+		break;
+	case LikelihoodFunc::Reciprocal:
+		particle_wts[particle_id] = 1.0 / (1.0 + measuremnt_val);
+		break;
+	}
+}
+
+template <class AM, class SSM>
+void PF<AM, SSM >::setImage(const cv::Mat &img){
+	am.setCurrImg(img);
+	for(unsigned int worker_id = 1; worker_id < n_workers; ++worker_id){
+		am_vec[worker_id - 1]->setCurrImg(img);
+	}
+}
+
+template <class AM, class SSM>
+void PF<AM, SSM >::setRegion(const cv::Mat& corners){
+	ssm.setCorners(corners);
+	for(unsigned int worker_id = 1; worker_id < n_workers; ++worker_id){
+		ssm_vec[worker_id - 1]->setCorners(corners);
+	}
+	ssm.getCorners(cv_corners_mat);
+	initializeParticles();
 }
 
 _MTF_END_NAMESPACE
@@ -19,6 +19,7 @@
 #define PF_SHOW_PARTICLES 0
 #define PF_ENABLE_LEARNING 0
 #define PF_JACOBIAN_AS_SIGMA false
+#define PF_N_WORKERS 1
 #define PF_DEBUG_MODE false
 
 _MTF_BEGIN_NAMESPACE
@@ -33,7 +34,8 @@ PFParams::PFParams(int _max_iters, int _n_particles, double _epsilon,
 	double _adaptive_resampling_thresh,
 	const vectord &_pix_sigma, double _measurement_sigma,
 	int _show_particles, bool _enable_learning,
-	bool _jacobian_as_sigma, bool _debug_mode) :
+	bool _jacobian_as_sigma, int _n_workers,
+	bool _debug_mode) :
 	max_iters(_max_iters),
 	n_particles(_n_particles),
 	epsilon(_epsilon),
@@ -50,6 +52,7 @@ PFParams::PFParams(int _max_iters, int _n_particles, double _epsilon,
 	show_particles(_show_particles),
 	enable_learning(_enable_learning),
 	jacobian_as_sigma(_jacobian_as_sigma),
+	n_workers(_n_workers),
 	debug_mode(_debug_mode){
 	ssm_sigma = _ssm_sigma;
 	ssm_mean = _ssm_mean;
@@ -73,6 +76,7 @@ measurement_sigma(PF_MEASUREMENT_SIGMA),
 show_particles(PF_SHOW_PARTICLES),
 enable_learning(PF_ENABLE_LEARNING),
 jacobian_as_sigma(PF_JACOBIAN_AS_SIGMA),
+n_workers(PF_N_WORKERS),
 debug_mode(PF_DEBUG_MODE){
 	if(params){
 		max_iters = params->max_iters;
@@ -94,6 +98,7 @@ debug_mode(PF_DEBUG_MODE){
 		enable_learning = params->enable_learning;
 		measurement_sigma = params->measurement_sigma;
 		jacobian_as_sigma = params->jacobian_as_sigma;
+		n_workers = params->n_workers;
 		debug_mode = params->debug_mode;
 	}
 }
@@ -13,25 +13,29 @@ const char* ParallelParams::toString(PrlEstMethod _estimation_method){
 	}
 }
 ParallelParams::ParallelParams(PrlEstMethod _estimation_method, bool _reset_to_mean,
-	bool _auto_reinit, double _reinit_err_thresh, int _reinit_frame_gap) {
+	bool _auto_reinit, double _reinit_err_thresh, int _reinit_frame_gap,
+	int _n_workers) {
 	estimation_method = _estimation_method;
 	reset_to_mean = _reset_to_mean;
 	auto_reinit = _auto_reinit;
 	reinit_err_thresh = _reinit_err_thresh;
 	reinit_frame_gap = _reinit_frame_gap;
+	n_workers = _n_workers;
 }
 ParallelParams::ParallelParams(const ParallelParams *params) :
 estimation_method(static_cast<PrlEstMethod>(PARL_ESTIMATION_METHOD)),
 reset_to_mean(PARL_RESET_TO_MEAN),
 auto_reinit(PARL_AUTO_REINIT),
 reinit_err_thresh(PARL_REINIT_ERR_THRESH),
-reinit_frame_gap(PRL_SM_REINIT_FRAME_GAP){
+reinit_frame_gap(PRL_SM_REINIT_FRAME_GAP),
+n_workers(PRL_N_WORKERS){
 	if(params) {
 		estimation_method = params->estimation_method;
 		reset_to_mean = params->reset_to_mean;
 		auto_reinit = params->auto_reinit;
 		reinit_err_thresh = params->reinit_err_thresh;
 		reinit_frame_gap = params->reinit_frame_gap;
+		n_workers = params->n_workers;
 	}
 }
 
@@ -1,7 +1,4 @@
 #include "mtf/SM/ParallelSM.h"
-#ifdef ENABLE_TBB
-#include "tbb/tbb.h" 
-#endif
 #include "mtf/Utilities/miscUtils.h"
 
 _MTF_BEGIN_NAMESPACE
@@ -23,6 +20,7 @@ ParallelSM<AM, SSM>::ParallelSM(const vector<SM*> _trackers,
 	printf("auto_reinit: %d\n", params.auto_reinit);
 	printf("reinit_err_thresh: %f\n", params.reinit_err_thresh);
 	printf("reinit_frame_gap: %d\n", params.reinit_frame_gap);
+	printf("n_workers: %d\n", params.n_workers);
 
 	printf("n_trackers: %d\n", n_trackers);
 	printf("Search methods: ");
@@ -38,6 +36,7 @@ ParallelSM<AM, SSM>::ParallelSM(const vector<SM*> _trackers,
 	switch(params.estimation_method) {
 	case PrlEstMethod::MeanOfCorners:
 		mean_corners_cv.create(2, 4, CV_64FC1);
+		tracker_corners.resize(n_trackers);
 		break;
 	case PrlEstMethod::MeanOfState:
 		ssm_state_size = ssm.getStateSize();
@@ -48,6 +47,7 @@ ParallelSM<AM, SSM>::ParallelSM(const vector<SM*> _trackers,
 		mean_state.resize(ssm_state_size);
 		break;
 	}
+	tracker_costs.assign(n_trackers, 0);
 	failure_detected = false;
 	buffer_id = 0;
 	buffer_filled = false;
@@ -90,85 +90,81 @@ void ParallelSM<AM, SSM>::initialize(const cv::Mat &corners)  {
 }
 template<class AM, class SSM>
 void ParallelSM<AM, SSM>::update()  {
-	mean_corners_cv.setTo(cv::Scalar(0));
-#ifdef ENABLE_TBB
-	parallel_for(tbb::blocked_range<size_t>(0, n_trackers),
-		[&](const tbb::blocked_range<size_t>& r) {
-		for(size_t tracker_id = r.begin(); tracker_id != r.end(); ++tracker_id) {
-#else
-	for(int tracker_id = 0; tracker_id < n_trackers; ++tracker_id) {
-#endif
+	//! each tracker only writes to its own result slot so that they can be updated in any order
+	utils::runTasksByCost(params.n_workers, tracker_costs, [&](int tracker_id){
 		trackers[tracker_id]->update();
 		switch(params.estimation_method) {
 		case PrlEstMethod::MeanOfCorners:
-			mean_corners_cv += (trackers[tracker_id]->getRegion() - mean_corners_cv) / (tracker_id + 1);
+			trackers[tracker_id]->getRegion().copyTo(tracker_corners[tracker_id]);
 			break;
 		case PrlEstMethod::MeanOfState:
 			ssm_states[tracker_id] = trackers[tracker_id]->getSSM().getState();
 			break;
 		}
-	}
-#ifdef ENABLE_TBB
-		});
-#endif
-		switch(params.estimation_method) {
-		case PrlEstMethod::MeanOfCorners:
-			ssm.setCorners(mean_corners_cv);
-			break;
-		case PrlEstMethod::MeanOfState:
-			ssm.estimateMeanOfSamples(mean_state, ssm_states, n_trackers);
-			ssm.setState(mean_state);
-			ssm.getCorners(mean_corners_cv);
-			break;
+	});
+	switch(params.estimation_method) {
+	case PrlEstMethod::MeanOfCorners:
+		//! the mean is computed in tracker order after all of them are done so that it is the same in every run
+		mean_corners_cv.setTo(cv::Scalar(0));
+		for(int tracker_id = 0; tracker_id < n_trackers; ++tracker_id) {
+			mean_corners_cv += (tracker_corners[tracker_id] - mean_corners_cv) / (tracker_id + 1);
 		}
-		if(params.auto_reinit){
+		ssm.setCorners(mean_corners_cv);
+		break;
+	case PrlEstMethod::MeanOfState:
+		ssm.estimateMeanOfSamples(mean_state, ssm_states, n_trackers);
+		ssm.setState(mean_state);
+		ssm.getCorners(mean_corners_cv);
+		break;
+	}
+	if(params.auto_reinit){
+		if(failure_detected){
+			failure_detected = false;
+		} else{
+			ssm.getCorners(cv_corners_mat);
+			for(int tracker_id = 0; tracker_id < n_trackers; ++tracker_id) {
+				double corner_error = utils::getTrackingError<utils::TrackErrT::MCD>(
+					trackers[tracker_id]->getRegion(), cv_corners_mat);
+				if(corner_error > params.reinit_err_thresh){
+					failure_detected = true;
+					break;
+				}
+			}
 			if(failure_detected){
-				failure_detected = false;
-			} else{
-				ssm.getCorners(cv_corners_mat);
+				printf("Reinitializing trackers...\n");
+				int reinit_buffer_id = buffer_filled ? buffer_id : 0;
 				for(int tracker_id = 0; tracker_id < n_trackers; ++tracker_id) {
-					double corner_error = utils::getTrackingError<utils::TrackErrT::MCD>(
-						trackers[tracker_id]->getRegion(), cv_corners_mat);
-					if(corner_error > params.reinit_err_thresh){
-						failure_detected = true;
-						break;
+					// initialize tracker on the oldest image in the buffer;
+					trackers[tracker_id]->initialize(img_buffer[reinit_buffer_id],
+						corners_buffer[reinit_buffer_id]);
+					// update tracker on the remaining images in the buffer;
+					int current_buffer_id = (reinit_buffer_id + 1) % params.reinit_frame_gap;
+					while(current_buffer_id != buffer_id){
+						trackers[tracker_id]->update(img_buffer[current_buffer_id]);
+						current_buffer_id = (current_buffer_id + 1) % params.reinit_frame_gap;
 					}
+					// restore the current image
+					trackers[tracker_id]->setImage(curr_img);
 				}
-				if(failure_detected){
-					printf("Reinitializing trackers...\n");
-					int reinit_buffer_id = buffer_filled ? buffer_id : 0;
-					for(int tracker_id = 0; tracker_id < n_trackers; ++tracker_id) {
-						// initialize tracker on the oldest image in the buffer;
-						trackers[tracker_id]->initialize(img_buffer[reinit_buffer_id],
-							corners_buffer[reinit_buffer_id]);
-						// update tracker on the remaining images in the buffer;
-						int current_buffer_id = (reinit_buffer_id + 1) % params.reinit_frame_gap;
-						while(current_buffer_id != buffer_id){
-							trackers[tracker_id]->update(img_buffer[current_buffer_id]);
-							current_buffer_id = (current_buffer_id + 1) % params.reinit_frame_gap;
-						}
-						// restore the current image
-						trackers[tracker_id]->setImage(curr_img);
-					}
-					update();
-					return;
-				}
+				update();
+				return;
 			}
 		}
-		if(params.reset_to_mean) {
-			for(int tracker_id = 0; tracker_id < n_trackers; ++tracker_id) {
-				trackers[tracker_id]->setRegion(mean_corners_cv);
-			}
+	}
+	if(params.reset_to_mean) {
+		for(int tracker_id = 0; tracker_id < n_trackers; ++tracker_id) {
+			trackers[tracker_id]->setRegion(mean_corners_cv);
 		}
-		ssm.getCorners(cv_corners_mat);
-		if(params.auto_reinit){
-			curr_img.copyTo(img_buffer[buffer_id]);
-			cv_corners_mat.copyTo(corners_buffer[buffer_id]);
-			if(buffer_id == params.reinit_frame_gap - 1){
-				buffer_filled = true;
-			}
-			buffer_id = (buffer_id + 1) % params.reinit_frame_gap;
+	}
+	ssm.getCorners(cv_corners_mat);
+	if(params.auto_reinit){
+		curr_img.copyTo(img_buffer[buffer_id]);
+		cv_corners_mat.copyTo(corners_buffer[buffer_id]);
+		if(buffer_id == params.reinit_frame_gap - 1){
+			buffer_filled = true;
 		}
+		buffer_id = (buffer_id + 1) % params.reinit_frame_gap;
+	}
 }
 
 template<class AM, class SSM>
@@ -1,10 +1,6 @@
 #include "mtf/SM/ParallelTracker.h"
 #include "mtf/Utilities/miscUtils.h"
 
-#ifdef ENABLE_TBB
-#include "tbb/tbb.h" 
-#endif
-
 _MTF_BEGIN_NAMESPACE
 
 ParallelTracker::ParallelTracker(const vector<TrackerBase*> _trackers,
@@ -17,6 +13,7 @@ ParallelTracker::ParallelTracker(const vector<TrackerBase*> _trackers,
 	printf("auto_reinit: %d\n", params.auto_reinit);
 	printf("reinit_err_thresh: %f\n", params.reinit_err_thresh);
 	printf("reinit_frame_gap: %d\n", params.reinit_frame_gap);
+	printf("n_workers: %d\n", params.n_workers);
 	printf("n_trackers: %d\n", n_trackers);
 	printf("trackers: ");
 	name = "prl: ";
@@ -27,6 +24,8 @@ ParallelTracker::ParallelTracker(const vector<TrackerBase*> _trackers,
 	printf("\n");
 
 	mean_corners_cv.create(2, 4, CV_64FC1);
+	tracker_corners.resize(n_trackers);
+	tracker_costs.assign(n_trackers, 0);
 	if(params.auto_reinit){
 		if(input_type==HETEROGENEOUS_INPUT){
 			printf("Reinitialization is currently not supported for trackers requiring heterogeneous inputs so disabling it...\n");
@@ -64,70 +63,66 @@ void ParallelTracker::initialize(const cv::Mat &corners)  {
 }
 
 void ParallelTracker::update()  {
+	//! each tracker only writes to its own result slot so that they can be updated in any order
+	utils::runTasksByCost(params.n_workers, tracker_costs, [&](int tracker_id){
+		trackers[tracker_id]->update();
+		trackers[tracker_id]->getRegion().copyTo(tracker_corners[tracker_id]);
+	});
+	//! the mean is computed in tracker order after all of them are done so that it is the same in every run
 	mean_corners_cv.setTo(cv::Scalar(0));
-#ifdef ENABLE_TBB
-	parallel_for(tbb::blocked_range<size_t>(0, n_trackers),
-		[&](const tbb::blocked_range<size_t>& r) {
-		for(size_t tracker_id = r.begin(); tracker_id != r.end(); ++tracker_id) {
-#else
 	for(int tracker_id = 0; tracker_id < n_trackers; ++tracker_id) {
-#endif
-		trackers[tracker_id]->update();
-		mean_corners_cv += (trackers[tracker_id]->getRegion() - mean_corners_cv) / (tracker_id + 1);
+	mean_corners_cv += (tracker_corners[tracker_id] - mean_corners_cv) / (tracker_id + 1);
 	}
-#ifdef ENABLE_TBB
-		});
-#endif
-		if(params.auto_reinit){
-			if(failure_detected){
-				failure_detected = false;
-			} else{
-				for(int tracker_id = 0; tracker_id < n_trackers; ++tracker_id) {
-					double corner_error = utils::getTrackingError<utils::TrackErrT::MCD>(
-						trackers[tracker_id]->getRegion(), mean_corners_cv);
-					if(corner_error > params.reinit_err_thresh){
-						failure_detected = true;
-						break;
-					}
+	if(params.auto_reinit){
+		if(failure_detected){
+			failure_detected = false;
+		} else{
+			for(int tracker_id = 0; tracker_id < n_trackers; ++tracker_id) {
+				double corner_error = utils::getTrackingError<utils::TrackErrT::MCD>(
+					trackers[tracker_id]->getRegion(), mean_corners_cv);
+				if(corner_error > params.reinit_err_thresh){
+					failure_detected = true;
+					break;
 				}
-				if(failure_detected){
-					printf("Reinitializing trackers...\n");
+			}
+			if(failure_detected){
+				printf("Reinitializing trackers...\n");
 
-					int reinit_buffer_id = buffer_filled ? buffer_id  : 0;
-					for(int tracker_id = 0; tracker_id < n_trackers; ++tracker_id) {
-						// initialize tracker on the oldest image in the buffer;
-						trackers[tracker_id]->setImage(img_buffer[reinit_buffer_id]);
-						trackers[tracker_id]->initialize(corners_buffer[reinit_buffer_id]);
+				int reinit_buffer_id = buffer_filled ? buffer_id  : 0;
+				for(int tracker_id = 0; tracker_id < n_trackers; ++tracker_id) {
+					// initialize tracker on the oldest image in the buffer;
+					trackers[tracker_id]->setImage(img_buffer[reinit_buffer_id]);
+					trackers[tracker_id]->initialize(corners_buffer[reinit_buffer_id]);
 
-						// update tracker on the remaining images in the buffer;
-						int current_buffer_id = (reinit_buffer_id + 1) % params.reinit_frame_gap;
-						while(current_buffer_id != buffer_id){
-							trackers[tracker_id]->setImage(img_buffer[current_buffer_id]);
-							trackers[tracker_id]->update();
-							current_buffer_id = (current_buffer_id + 1) % params.reinit_frame_gap;
-						}
-						// restore the current image
-						trackers[tracker_id]->setImage(curr_img);
+					// update tracker on the remaining images in the buffer;
+					int current_buffer_id = (reinit_buffer_id + 1) % params.reinit_frame_gap;
+					while(current_buffer_id != buffer_id){
+						trackers[tracker_id]->setImage(img_buffer[current_buffer_id]);
+						trackers[tracker_id]->update();
+						current_buffer_id = (current_buffer_id + 1) % params.reinit_frame_gap;
 					}
-					update();
-					return;
+					// restore the current image
+					trackers[tracker_id]->setImage(curr_img);
 				}
+				update();
+				return;
 			}
 		}
+	}
 
-		if(params.reset_to_mean) {
-			for(int tracker_id = 0; tracker_id < n_trackers; tracker_id++) {
-				trackers[tracker_id]->setRegion(mean_corners_cv);
-			}
+	if(params.reset_to_mean) {
+		for(int tracker_id = 0; tracker_id < n_trackers; tracker_id++) {
+			trackers[tracker_id]->setRegion(mean_corners_cv);
 		}
-		if(params.auto_reinit){
-			curr_img.copyTo(img_buffer[buffer_id]);
-			mean_corners_cv.copyTo(corners_buffer[buffer_id]);
-			if(buffer_id == params.reinit_frame_gap - 1){
-				buffer_filled = true;
-			}
-			buffer_id = (buffer_id + 1) % params.reinit_frame_gap;
+	}
+	if(params.auto_reinit){
+		curr_img.copyTo(img_buffer[buffer_id]);
+		mean_corners_cv.copyTo(corners_buffer[buffer_id]);
+		if(buffer_id == params.reinit_frame_gap - 1){
+			buffer_filled = true;
 		}
+		buffer_id = (buffer_id + 1) % params.reinit_frame_gap;
+	}
 }
 void ParallelTracker::setRegion(const cv::Mat& corners)   {
 	for(int tracker_id = 1; tracker_id < n_trackers; tracker_id++) {
@@ -36,6 +36,16 @@ params(parl_params), external_img_pyramid(false){
 	overall_scale_factor = pow(params.scale_factor, params.no_of_levels - 1);
 }
 void PyramidalTracker::setImage(const cv::Mat &img){
+	utils::FrameCache::Entry cache_entry = utils::FrameCache::find(img);
+	if(frame_cache && !(cache_entry.cache && cache_entry.level == 0)){
+		//! the current levels belong to the previous cache and must not be overwritten
+		for(int pyr_level = 1; pyr_level < params.no_of_levels; ++pyr_level){
+			img_pyramid[pyr_level].release();
+		}
+	}
+	//! levels of an image that is itself a pyramid level are built locally
+	frame_cache = cache_entry.level == 0 ? cache_entry.cache : nullptr;
+
 	if(img_pyramid[0].empty()){
 		img_sizes[0] = cv::Size(img.cols, img.rows);
 		printf("Level %d: size: %dx%d\n",
@@ -45,11 +55,17 @@ void PyramidalTracker::setImage(const cv::Mat &img){
 	img_pyramid[0] = img;
 	trackers[0]->setImage(img_pyramid[0]);
 	for(int pyr_level = 1; pyr_level < params.no_of_levels; ++pyr_level){
-		if(img_pyramid[pyr_level].empty()){
+		bool new_level = img_pyramid[pyr_level].empty();
+		if(frame_cache){
+			img_pyramid[pyr_level] = frame_cache->getPyramidLevel(pyr_level, params.scale_factor);
+			img_sizes[pyr_level] = img_pyramid[pyr_level].size();
+		} else if(new_level){
 			int n_rows = static_cast<int>(img_pyramid[pyr_level - 1].rows*params.scale_factor);
 			int n_cols = static_cast<int>(img_pyramid[pyr_level - 1].cols*params.scale_factor);
 			img_sizes[pyr_level] = cv::Size(n_cols, n_rows);
 			img_pyramid[pyr_level].create(img_sizes[pyr_level], img.type());
+		}
+		if(new_level){
 			printf("Level %d: size: %dx%d\n",
 				pyr_level, img_sizes[pyr_level].width, img_sizes[pyr_level].height);
 		}
@@ -71,10 +87,18 @@ void PyramidalTracker::setImagePyramid(const vector<cv::Mat> &_img_pyramid){
 		img_sizes[pyr_level] = cv::Size(img_pyramid[pyr_level].cols, img_pyramid[pyr_level].rows);
 		trackers[pyr_level]->setImage(img_pyramid[pyr_level]);
 	}
+	frame_cache = nullptr;
 	external_img_pyramid = true;
 }
 
 void PyramidalTracker::updateImagePyramid(){
+	if(frame_cache){
+		//! builds all the levels only if no other tracker sharing the cache has done so for this frame
+		if(params.no_of_levels > 1){
+			frame_cache->getPyramidLevel(params.no_of_levels - 1, params.scale_factor);
+		}
+		return;
+	}
 	for(int pyr_level = 1; pyr_level < params.no_of_levels; ++pyr_level){
 		if(params.scale_factor == 0.5){
 			cv::pyrDown(img_pyramid[pyr_level - 1], img_pyramid[pyr_level], img_sizes[pyr_level]);
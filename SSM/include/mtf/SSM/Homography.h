@@ -32,6 +32,11 @@ public:
 	void cmptPixJacobian(MatrixXd &jacobian_prod, const PixGradT &am_jacobian) override;
 	void cmptWarpedPixJacobian(MatrixXd &jacobian_prod,
 		const PixGradT &pix_jacobian) override;
+	//! fixed size variant for single channel patches whose resolution is known at compile time;
+	//! the Jacobian is computed in double and can be stored in single precision
+	template<int NPts, typename ScalarT>
+	void cmptWarpedPixJacobian(Map<Matrix<ScalarT, NPts, 8>, Aligned> &jacobian_prod,
+		const PixGradT &pix_jacobian);
 
 	void cmptApproxPixJacobian(MatrixXd &jacobian_prod,
 		const PixGradT &pix_jacobian) override;
@@ -83,6 +88,46 @@ private:
 	CornersT disturbed_corners;
 };
 
+template<int NPts, typename ScalarT>
+void Homography::cmptWarpedPixJacobian(Map<Matrix<ScalarT, NPts, 8>, Aligned> &dI_dp,
+	const PixGradT &dI_dw){
+	assert(n_pts == NPts && n_channels == 1);
+	assert(dI_dw.rows() == NPts);
+
+	const double a00 = curr_warp(0, 0);
+	const double a01 = curr_warp(0, 1);
+	const double a10 = curr_warp(1, 0);
+	const double a11 = curr_warp(1, 1);
+	const double a20 = curr_warp(2, 0);
+	const double a21 = curr_warp(2, 1);
+
+	for(int pt_id = 0; pt_id < NPts; ++pt_id) {
+		const double w_x = curr_pts(0, pt_id);
+		const double w_y = curr_pts(1, pt_id);
+		const double inv_det = 1.0 / curr_pts_hm(2, pt_id);
+
+		const double Ix = ((a00 - a20*w_x)*dI_dw(pt_id, 0) + (a10 - a20*w_y)*dI_dw(pt_id, 1))*inv_det;
+		const double Iy = ((a01 - a21*w_x)*dI_dw(pt_id, 0) + (a11 - a21*w_y)*dI_dw(pt_id, 1))*inv_det;
+
+		const double x = init_pts(0, pt_id);
+		const double y = init_pts(1, pt_id);
+
+		const double Ixx = Ix * x;
+		const double Ixy = Ix * y;
+		const double Iyy = Iy * y;
+		const double Iyx = Iy * x;
+
+		dI_dp(pt_id, 0) = static_cast<ScalarT>(Ixx);
+		dI_dp(pt_id, 1) = static_cast<ScalarT>(Ixy);
+		dI_dp(pt_id, 2) = static_cast<ScalarT>(Ix);
+		dI_dp(pt_id, 3) = static_cast<ScalarT>(Iyx);
+		dI_dp(pt_id, 4) = static_cast<ScalarT>(Iyy);
+		dI_dp(pt_id, 5) = static_cast<ScalarT>(Iy);
+		dI_dp(pt_id, 6) = static_cast<ScalarT>(-x*Ixx - y*Iyx);
+		dI_dp(pt_id, 7) = static_cast<ScalarT>(-x*Ixy - y*Iyy);
+	}
+}
+
 _MTF_END_NAMESPACE
 
 #endif
@@ -2,6 +2,8 @@
 #define MTF_SSM_ESTIMATOR_H
 
 #include "mtf/Macros/common.h"
+#include "SSMEstimatorParams.h"
+#include "mtf/Utilities/miscUtils.h"
 
 #include <boost/random/mersenne_twister.hpp>
 
@@ -23,6 +25,15 @@ public:
 	virtual bool runRANSAC(const CvMat* m1, const CvMat* m2, CvMat* model,
 		CvMat* mask, double threshold, double confidence = 0.99, int maxIters = 2000,
 		int maxAttempts=300);
+	/**
+	PROSAC variant of RANSAC: minimal samples are drawn from a progressively growing
+	set of the points with the lowest params.pt_costs (uniformly if no costs are given);
+	hypotheses are generated and scored in batches spread over params.n_workers threads and,
+	if params.sprt is enabled, each one is abandoned as soon as the SPRT decides it is bad
+	so that most of them are verified against only a small fraction of the points
+	*/
+	virtual bool runPROSAC(const CvMat* m1, const CvMat* m2, CvMat* model,
+		CvMat* mask, const SSMEstimatorParams &params);
 	virtual bool refine(const CvMat*, const CvMat*, CvMat*, int) { return true; }
 	virtual void setSeed(int64 seed);
 
@@ -35,6 +46,8 @@ protected:
 	virtual bool getSubset(const CvMat* m1, const CvMat* m2,
 		CvMat* ms1, CvMat* ms2, int maxAttempts = 1000);
 	virtual bool checkSubset(const CvMat* ms1, int count);
+	//! random index in [0, n) from the selected RNG
+	int getRandInt(int n);
 
 	typedef boost::mt19937 BoostRNG;
 
@@ -46,6 +59,8 @@ protected:
 	int maxBasicSolutions;
 	bool checkPartialSubsets;
 	const bool use_boost_rng;
+	//! threads that score the PROSAC hypotheses, kept alive between batches and calls
+	utils::WorkerPool worker_pool;
 };
 
 
@@ -8,7 +8,7 @@ _MTF_BEGIN_NAMESPACE
 
 struct SSMEstimatorParams{
 
-	enum class EstType { RANSAC, LeastMedian, LeastSquares };
+	enum class EstType { RANSAC, LeastMedian, LeastSquares, PROSAC };
 
 	static const char* toString(EstType est_type);
 	static int toCV(EstType est_type);
@@ -23,10 +23,18 @@ struct SSMEstimatorParams{
 	double confidence;
 	bool refine;
 	int lm_max_iters;
+	//! no. of threads used to generate and score hypotheses in parallel - only used by PROSAC
+	int n_workers;
+	//! reject hypotheses early using Wald's sequential probability ratio test - only used by PROSAC
+	bool sprt;
+	//! optional per point matching costs (lower is better) that PROSAC uses to order the points;
+	//! filled in by the tracker before each call and ignored unless there is one cost per point
+	std::vector<float> pt_costs;
 	
 	SSMEstimatorParams(EstType _method, double _ransac_reproj_thresh, 
 		int _n_model_pts, bool _refine, int _max_iters, int _max_subset_attempts,
-		bool  _use_boost_rng, double _confidence, int _lm_max_iters);
+		bool  _use_boost_rng, double _confidence, int _lm_max_iters,
+		int _n_workers, bool _sprt);
 	SSMEstimatorParams(const SSMEstimatorParams *params = nullptr);
 
 	void print() const;
@@ -95,7 +95,12 @@ protected:
 	//! no. of pts that lie on the region boundary
 	int n_bounding_pts;
 	VectorXd dist_norm_x, dist_norm_y;
-	MatrixXd norm_dist_x, norm_dist_y, interp_wts;
+	//! interpolation weights are stored column wise for each point over a fixed support
+	//! of at most max_interp_wts control points found when the weights are initialized
+	MatrixXd interp_wts;
+	MatrixXi interp_ctrl_ids;
+	VectorXi n_pt_interp_wts;
+	int max_interp_wts;
 	Matrix2Xd ssm_grad;
 	double max_dist_x, max_dist_y;
 	void initInterpolationWeights();
@@ -3,6 +3,7 @@
 
 #include "mtf/Macros/common.h"
 #include "mtf/Utilities/excpUtils.h"
+#include "mtf/Utilities/spiUtils.h"
 #include "SSMEstimatorParams.h"
 
 #define ssm_func_not_implemeted(func_name) \
@@ -60,6 +61,7 @@ public:
 		}
 		init_pts.resize(Eigen::NoChange, n_pts);
 		curr_pts.resize(Eigen::NoChange, n_pts);
+		utils::spi::getActiveIDs(spi_pt_ids, nullptr, n_pts);
 	}
 	virtual ~StateSpaceModel(){}
 
@@ -361,8 +363,17 @@ public:
 	//should be called after the first iteration on a new frame is done
 	virtual void clearFirstIter(){ first_iter = false; }
 
-	virtual void setSPIMask(const bool *_spi_mask){ spi_mask = _spi_mask; }
-	virtual void clearSPIMask(){ spi_mask = nullptr; }
+	/**
+	must be called again whenever the contents of the mask change since the kernels only
+	process the points in the list of active ones that is compacted here
+	*/
+	virtual void setSPIMask(const bool *_spi_mask){
+		spi_mask = _spi_mask;
+#ifndef DISABLE_SPI
+		utils::spi::getActiveIDs(spi_pt_ids, spi_mask, n_pts);
+#endif
+	}
+	virtual void clearSPIMask(){ setSPIMask(nullptr); }
 	virtual bool supportsSPI(){ return false; }// should be overridden by an implementing class once 
 	// it implements SPI functionality for all functions where it makes logical sense
 
@@ -397,6 +408,8 @@ protected:
 	*/
 	bool first_iter;
 	const bool *spi_mask;
+	//! IDs of the points that are active in the SPI mask or of all the points if there is no mask
+	std::vector<unsigned int> spi_pt_ids;
 
 private:
 	unsigned int getResX(const SSMParams *params){
@@ -155,9 +155,8 @@ void ASRT::cmptInitPixJacobian(MatrixXd &dI_dp,
 	const PixGradT &dI_dx){
 	validate_ssm_jacobian(dI_dp, dI_dx);
 
-	unsigned int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		unsigned int ch_pt_id = pt_id*n_channels;
 
 		double x = init_pts(0, pt_id);
 		double y = init_pts(1, pt_id);
@@ -181,9 +180,8 @@ void ASRT::cmptWarpedPixJacobian(MatrixXd &dI_dp,
 	double a = curr_state(2) + 1, b = -curr_state(3);
 	double c = curr_state(3), d = curr_state(4) + 1;
 
-	unsigned int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		unsigned int ch_pt_id = pt_id*n_channels;
 
 		double x = init_pts(0, pt_id);
 		double y = init_pts(1, pt_id);
@@ -207,9 +205,8 @@ void ASRT::cmptApproxPixJacobian(MatrixXd &dI_dp, const PixGradT &dI_dx) {
 	double a_plus_1 = curr_state(2) + 1, b = curr_state(3), c_plus_1 = curr_state(4) + 1;
 	double inv_det = 1.0 / (a_plus_1*c_plus_1 + b*b);
 
-	unsigned int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		unsigned int ch_pt_id = pt_id*n_channels;
 
 		double x = init_pts(0, pt_id);
 		double y = init_pts(1, pt_id);
@@ -232,9 +229,8 @@ void ASRT::cmptInitPixHessian(MatrixXd &d2I_dp2, const PixHessT &d2I_dw2,
 	const PixGradT &dI_dw){
 	validate_ssm_hessian(d2I_dp2, d2I_dw2, dI_dw);
 
-	unsigned int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts; pt_id++){
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		unsigned int ch_pt_id = pt_id*n_channels;
 
 		double x = init_pts(0, pt_id);
 		double y = init_pts(1, pt_id);
@@ -258,9 +254,8 @@ void ASRT::cmptWarpedPixHessian(MatrixXd &d2I_dp2, const PixHessT &d2I_dw2,
 		a2, -a3,
 		a3, a4;
 
-	unsigned int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id) {
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		unsigned int ch_pt_id = pt_id*n_channels;
 
 		double x = init_pts(0, pt_id);
 		double y = init_pts(1, pt_id);
@@ -302,8 +297,7 @@ void ASRT::updateGradPts(double grad_eps){
 	Vector2d diff_vec_x_warped = curr_warp.topRows<2>().col(0) * grad_eps;
 	Vector2d diff_vec_y_warped = curr_warp.topRows<2>().col(1) * grad_eps;
 
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
-		spi_pt_check(spi_mask, pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
 
 		grad_pts(0, pt_id) = curr_pts(0, pt_id) + diff_vec_x_warped(0);
 		grad_pts(1, pt_id) = curr_pts(1, pt_id) + diff_vec_x_warped(1);
@@ -328,9 +322,7 @@ void ASRT::updateHessPts(double hess_eps){
 	Vector2d diff_vec_xy_warped = (curr_warp.topRows<2>().col(0) + curr_warp.topRows<2>().col(1)) * hess_eps;
 	Vector2d diff_vec_yx_warped = (curr_warp.topRows<2>().col(0) - curr_warp.topRows<2>().col(1)) * hess_eps;
 
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
-
-		spi_pt_check(spi_mask, pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
 
 		hess_pts(0, pt_id) = curr_pts(0, pt_id) + diff_vec_xx_warped(0);
 		hess_pts(1, pt_id) = curr_pts(1, pt_id) + diff_vec_xx_warped(1);
@@ -472,6 +464,8 @@ int	ASRT::estimateASRT(const CvMat* in_pts, const CvMat* out_pts,
 	if(method == CV_LMEDS)
 		result = estimator.runLMeDS(in_pts_hm, out_pts_hm, &matH, tempMask, params.confidence,
 		params.max_iters, params.max_subset_attempts);
+	else if(method == CV_RANSAC && params.method == SSMEstimatorParams::EstType::PROSAC)
+		result = estimator.runPROSAC(in_pts_hm, out_pts_hm, &matH, tempMask, params);
 	else if(method == CV_RANSAC)
 		result = estimator.runRANSAC(in_pts_hm, out_pts_hm, &matH, tempMask, params.ransac_reproj_thresh,
 		params.confidence, params.max_iters, params.max_subset_attempts);
@@ -96,9 +96,8 @@ void AST::cmptInitPixJacobian(MatrixXd &dI_dp,
 	const PixGradT &dI_dx){
 	validate_ssm_jacobian(dI_dp, dI_dx);
 
-	unsigned int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts; pt_id++){
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		unsigned int ch_pt_id = pt_id*n_channels;
 
 		double x = init_pts(0, pt_id);
 		double y = init_pts(1, pt_id);
@@ -120,9 +119,8 @@ void AST::cmptApproxPixJacobian(MatrixXd &dI_dp,
 	validate_ssm_jacobian(dI_dp, dI_dx);
 	double sx_plus_1_inv = 1.0 / (curr_state(2) + 1);
 	double sy_plus_1_inv = 1.0 / (curr_state(3) + 1);
-	unsigned int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		unsigned int ch_pt_id = pt_id*n_channels;
 
 		double x = init_pts(0, pt_id);
 		double y = init_pts(1, pt_id);
@@ -146,9 +144,8 @@ void AST::cmptWarpedPixJacobian(MatrixXd &dI_dp,
 	double sx = curr_state(2) + 1;
 	double sy = curr_state(3) + 1;
 
-	unsigned int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		unsigned int ch_pt_id = pt_id*n_channels;
 
 		double x = init_pts(0, pt_id);
 		double y = init_pts(1, pt_id);
@@ -170,9 +167,8 @@ void AST::cmptInitPixHessian(MatrixXd &d2I_dp2, const PixHessT &d2I_dw2,
 	const PixGradT &dI_dw){
 	validate_ssm_hessian(d2I_dp2, d2I_dw2, dI_dw);
 
-	unsigned int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		unsigned int ch_pt_id = pt_id*n_channels;
 
 		double x = init_pts(0, pt_id);
 		double y = init_pts(1, pt_id);
@@ -192,9 +188,8 @@ void AST::cmptWarpedPixHessian(MatrixXd &d2I_dp2, const PixHessT &d2I_dw2,
 	double s = curr_state(2) + 1;
 	double s2 = s*s;
 
-	unsigned int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id) {
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		unsigned int ch_pt_id = pt_id*n_channels;
 
 		double x = init_pts(0, pt_id);
 		double y = init_pts(1, pt_id);
@@ -234,8 +229,7 @@ void AST::updateGradPts(double grad_eps){
 	double scaled_eps_x = curr_warp(0, 0) * grad_eps;
 	double scaled_eps_y = curr_warp(1, 1) * grad_eps;
 
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
-		spi_pt_check(spi_mask, pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
 
 		grad_pts(0, pt_id) = curr_pts(0, pt_id) + scaled_eps_x;
 		grad_pts(1, pt_id) = curr_pts(1, pt_id);
@@ -259,9 +253,7 @@ void AST::updateHessPts(double hess_eps){
 	double scaled_eps_y2 = 2 * scaled_eps_y;
 
 
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
-
-		spi_pt_check(spi_mask, pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
 
 		hess_pts(0, pt_id) = curr_pts(0, pt_id) + scaled_eps_x2;
 		hess_pts(1, pt_id) = curr_pts(1, pt_id);
@@ -358,6 +350,8 @@ int	AST::estimateAST(const CvMat* in_pts, const CvMat* out_pts,
 	if(method == CV_LMEDS)
 		result = estimator.runLMeDS(in_pts_hm, out_pts_hm, &matH, tempMask, params.confidence,
 		params.max_iters, params.max_subset_attempts);
+	else if(method == CV_RANSAC && params.method == SSMEstimatorParams::EstType::PROSAC)
+		result = estimator.runPROSAC(in_pts_hm, out_pts_hm, &matH, tempMask, params);
 	else if(method == CV_RANSAC)
 		result = estimator.runRANSAC(in_pts_hm, out_pts_hm, &matH, tempMask, params.ransac_reproj_thresh,
 		params.confidence, params.max_iters, params.max_subset_attempts);
@@ -160,9 +160,8 @@ void Affine::getInitPixGrad(Matrix2Xd &ssm_grad, int pix_id) {
 void Affine::cmptInitPixJacobian(MatrixXd &dI_dp,
 	const PixGradT &dI_dx){
 	validate_ssm_jacobian(dI_dp, dI_dx);
-	unsigned int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		unsigned int ch_pt_id = pt_id*n_channels;
 
 		double x = init_pts(0, pt_id);
 		double y = init_pts(1, pt_id);
@@ -186,9 +185,8 @@ void Affine::cmptApproxPixJacobian(MatrixXd &dI_dp,
 	double a = curr_state(2) + 1, b = curr_state(3);
 	double c = curr_state(4), d = curr_state(5) + 1;
 	double inv_det = 1.0 / (a*d - b*c);
-	unsigned int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		unsigned int ch_pt_id = pt_id*n_channels;
 
 		double x = init_pts(0, pt_id);
 		double y = init_pts(1, pt_id);
@@ -216,9 +214,8 @@ void Affine::cmptWarpedPixJacobian(MatrixXd &dI_dp,
 	double a = curr_state(2) + 1, b = curr_state(3);
 	double c = curr_state(4), d = curr_state(5) + 1;
 
-	unsigned int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		unsigned int ch_pt_id = pt_id*n_channels;
 
 		double x = init_pts(0, pt_id);
 		double y = init_pts(1, pt_id);
@@ -244,9 +241,8 @@ void Affine::cmptInitPixHessian(MatrixXd &d2I_dp2, const PixHessT &d2I_dw2,
 	const PixGradT &dI_dw){
 	validate_ssm_hessian(d2I_dp2, d2I_dw2, dI_dw);
 
-	unsigned int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		unsigned int ch_pt_id = pt_id*n_channels;
 
 		double x = init_pts(0, pt_id);
 		double y = init_pts(1, pt_id);
@@ -271,9 +267,8 @@ void Affine::cmptWarpedPixHessian(MatrixXd &d2I_dp2, const PixHessT &d2I_dw2,
 		a2, a3,
 		a4, a5;
 
-	unsigned int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id) {
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		unsigned int ch_pt_id = pt_id*n_channels;
 
 		double x = init_pts(0, pt_id);
 		double y = init_pts(1, pt_id);
@@ -294,8 +289,7 @@ void Affine::updateGradPts(double grad_eps){
 	Vector2d diff_vec_x_warped = curr_warp.topRows<2>().col(0) * grad_eps;
 	Vector2d diff_vec_y_warped = curr_warp.topRows<2>().col(1) * grad_eps;
 
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
-		spi_pt_check(spi_mask, pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
 
 		grad_pts(0, pt_id) = curr_pts(0, pt_id) + diff_vec_x_warped(0);
 		grad_pts(1, pt_id) = curr_pts(1, pt_id) + diff_vec_x_warped(1);
@@ -320,8 +314,7 @@ void Affine::updateHessPts(double hess_eps){
 	Vector2d diff_vec_xy_warped = (curr_warp.topRows<2>().col(0) + curr_warp.topRows<2>().col(1)) * hess_eps;
 	Vector2d diff_vec_yx_warped = (curr_warp.topRows<2>().col(0) - curr_warp.topRows<2>().col(1)) * hess_eps;
 
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
-		spi_pt_check(spi_mask, pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
 
 		hess_pts(0, pt_id) = curr_pts(0, pt_id) + diff_vec_xx_warped(0);
 		hess_pts(1, pt_id) = curr_pts(1, pt_id) + diff_vec_xx_warped(1);
@@ -159,6 +159,8 @@ int	estimateAffine(const CvMat* in_pts, const CvMat* out_pts,
 	if(method == CV_LMEDS)
 		result = estimator.runLMeDS(in_pts_hm, out_pts_hm, &matH, tempMask, params.confidence, 
 		params.max_iters, params.max_subset_attempts);
+	else if(method == CV_RANSAC && params.method == SSMEstimatorParams::EstType::PROSAC)
+		result = estimator.runPROSAC(in_pts_hm, out_pts_hm, &matH, tempMask, params);
 	else if(method == CV_RANSAC)
 		result = estimator.runRANSAC(in_pts_hm, out_pts_hm, &matH, tempMask, params.ransac_reproj_thresh,
 		params.confidence, params.max_iters, params.max_subset_attempts);
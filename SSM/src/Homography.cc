@@ -158,10 +158,8 @@ void Homography::cmptInitPixJacobian(MatrixXd &dI_dp,
 	const PixGradT &dI_dw){
 	validate_ssm_jacobian(dI_dp, dI_dw);
 
-	int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts;  ++pt_id){
-
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		int ch_pt_id = pt_id*n_channels;
 		
 		double x = init_pts(0, pt_id);
 		double y = init_pts(1, pt_id);
@@ -193,9 +191,8 @@ void Homography::cmptInitPixJacobian(MatrixXd &dI_dp,
 void Homography::cmptPixJacobian(MatrixXd &dI_dp,
 	const PixGradT &dI_dw){
 	validate_ssm_jacobian(dI_dp, dI_dw);
-	int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts;  ++pt_id){
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		int ch_pt_id = pt_id*n_channels;
 
 		double x = init_pts(0, pt_id);
 		double y = init_pts(1, pt_id);
@@ -239,9 +236,8 @@ void Homography::cmptWarpedPixJacobian(MatrixXd &dI_dp,
 	double a20 = curr_warp(2, 0);
 	double a21 = curr_warp(2, 1);
 
-	int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts;  ++pt_id) {
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		int ch_pt_id = pt_id*n_channels;
 
 		double w_x = curr_pts(0, pt_id);
 		double w_y = curr_pts(1, pt_id);
@@ -304,9 +300,8 @@ void Homography::cmptApproxPixJacobian(MatrixXd &dI_dp,
 	double h20 = curr_warp(2, 0);
 	double h21 = curr_warp(2, 1);
 
-	int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts;  ++pt_id){
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		int ch_pt_id = pt_id*n_channels;
 
 		double curr_x = curr_pts(0, pt_id);
 		double curr_y = curr_pts(1, pt_id);
@@ -360,9 +355,8 @@ void Homography::cmptApproxPixJacobian(MatrixXd &dI_dp,
 void Homography::cmptInitPixHessian(MatrixXd &_d2I_dp2, const PixHessT &d2I_dw2,
 	const PixGradT &dI_dw){
 	validate_ssm_hessian(_d2I_dp2, d2I_dw2, dI_dw);
-	int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts;  ++pt_id){
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		int ch_pt_id = pt_id*n_channels;
 
 		double x = init_pts(0, pt_id);
 		double y = init_pts(1, pt_id);
@@ -426,9 +420,8 @@ void Homography::cmptPixHessian(MatrixXd &_d2I_dp2, const PixHessT &d2I_dw2,
 	const PixGradT &dI_dw){
 	validate_ssm_hessian(_d2I_dp2, d2I_dw2, dI_dw);
 
-	int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts;  ++pt_id){
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		int ch_pt_id = pt_id*n_channels;
 
 		double x = init_pts(0, pt_id);
 		double y = init_pts(1, pt_id);
@@ -524,9 +517,8 @@ void Homography::cmptWarpedPixHessian(MatrixXd &_d2I_dp2, const PixHessT &d2I_dw
 	double a20 = curr_warp(2, 0);
 	double a21 = curr_warp(2, 1);
 
-	int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts;  ++pt_id) {
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		int ch_pt_id = pt_id*n_channels;
 
 		Matrix2d dw_dX, d2wx_dX2, d2wy_dX2;
 
@@ -628,9 +620,8 @@ void Homography::cmptWarpedPixHessian2(MatrixXd &d2I_dp2, const PixHessT &d2I_dw
 	double h20 = curr_warp(2, 0);
 	double h21 = curr_warp(2, 1);
 
-	int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts;  ++pt_id) {
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		int ch_pt_id = pt_id*n_channels;
 
 		double curr_x = curr_pts(0, pt_id);
 		double curr_y = curr_pts(1, pt_id);
@@ -704,9 +695,8 @@ void Homography::cmptApproxPixHessian(MatrixXd &pix_hess_ssm, const PixHessT &pi
 	double h20 = curr_warp(2, 0);
 	double h21 = curr_warp(2, 1);
 	
-	int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts;  ++pt_id) {
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		int ch_pt_id = pt_id*n_channels;
 
 		double curr_x = curr_pts(0, pt_id);
 		double curr_y = curr_pts(1, pt_id);
@@ -805,8 +795,7 @@ void Homography::updateGradPts(double grad_eps){
 	Vector3d diff_vec_y_warped = curr_warp.col(1) * grad_eps;
 
 	Vector3d pt_inc_warped, pt_dec_warped;
-	for(unsigned int pt_id = 0; pt_id < n_pts;  ++pt_id){
-		spi_pt_check(spi_mask, pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
 
 		pt_inc_warped = curr_pts_hm.col(pt_id) + diff_vec_x_warped;
 		grad_pts(0, pt_id) = pt_inc_warped(0) / pt_inc_warped(2);
@@ -836,9 +825,7 @@ void Homography::updateHessPts(double hess_eps){
 
 	Vector3d pt_inc_warped, pt_dec_warped;
 
-	for(unsigned int pt_id = 0; pt_id < n_pts;  ++pt_id){
-
-		spi_pt_check(spi_mask, pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
 
 		pt_inc_warped = curr_pts_hm.col(pt_id) + diff_vec_xx_warped;
 		hess_pts(0, pt_id) = pt_inc_warped(0) / pt_inc_warped(2);
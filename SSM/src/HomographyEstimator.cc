@@ -197,6 +197,8 @@ int estimateHomography(const CvMat* objectPoints, const CvMat* imagePoints,
 	if(method == CV_LMEDS)
 		result = estimator.runLMeDS(M, m, &matH, tempMask, params.confidence, 
 		params.max_iters, params.max_subset_attempts);
+	else if(method == CV_RANSAC && params.method == SSMEstimatorParams::EstType::PROSAC)
+		result = estimator.runPROSAC(M, m, &matH, tempMask, params);
 	else if(method == CV_RANSAC)
 		result = estimator.runRANSAC(M, m, &matH, tempMask, params.ransac_reproj_thresh,
 		params.confidence, params.max_iters, params.max_subset_attempts);
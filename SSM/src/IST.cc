@@ -94,9 +94,8 @@ void IST::cmptInitPixJacobian(MatrixXd &dI_dp,
 	const PixGradT &dI_dx){
 	validate_ssm_jacobian(dI_dp, dI_dx);
 
-	unsigned int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		unsigned int ch_pt_id = pt_id*n_channels;
 
 		double x = init_pts(0, pt_id);
 		double y = init_pts(1, pt_id);
@@ -116,9 +115,8 @@ void IST::cmptApproxPixJacobian(MatrixXd &dI_dp,
 	const PixGradT &dI_dx){
 	validate_ssm_jacobian(dI_dp, dI_dx);
 	double s_plus_1_inv = 1.0 / (curr_state(2) + 1);
-	unsigned int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		unsigned int ch_pt_id = pt_id*n_channels;
 
 		double x = init_pts(0, pt_id);
 		double y = init_pts(1, pt_id);
@@ -140,9 +138,8 @@ void IST::cmptWarpedPixJacobian(MatrixXd &dI_dp,
 	validate_ssm_jacobian(dI_dp, dI_dx);
 	double s = curr_state(2) + 1;
 
-	unsigned int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		unsigned int ch_pt_id = pt_id*n_channels;
 
 		double x = init_pts(0, pt_id);
 		double y = init_pts(1, pt_id);
@@ -163,9 +160,8 @@ void IST::cmptInitPixHessian(MatrixXd &d2I_dp2, const PixHessT &d2I_dw2,
 	const PixGradT &dI_dw){
 	validate_ssm_hessian(d2I_dp2, d2I_dw2, dI_dw);
 
-	unsigned int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		unsigned int ch_pt_id = pt_id*n_channels;
 
 		double x = init_pts(0, pt_id);
 		double y = init_pts(1, pt_id);
@@ -185,9 +181,8 @@ void IST::cmptWarpedPixHessian(MatrixXd &d2I_dp2, const PixHessT &d2I_dw2,
 	double s = curr_state(2) + 1;
 	double s2 = s*s;
 
-	unsigned int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id) {
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		unsigned int ch_pt_id = pt_id*n_channels;
 
 		double x = init_pts(0, pt_id);
 		double y = init_pts(1, pt_id);
@@ -223,8 +218,7 @@ void IST::estimateWarpFromPts(VectorXd &state_update, vector<uchar> &mask,
 
 void IST::updateGradPts(double grad_eps){
 	double scaled_eps = curr_warp(0, 0) * grad_eps;
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
-		spi_pt_check(spi_mask, pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
 
 		grad_pts(0, pt_id) = curr_pts(0, pt_id) + scaled_eps;
 		grad_pts(1, pt_id) = curr_pts(1, pt_id);
@@ -245,9 +239,7 @@ void IST::updateHessPts(double hess_eps){
 	double scaled_eps = curr_warp(0, 0) * hess_eps;
 	double scaled_eps2 = 2 * scaled_eps;
 
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
-
-		spi_pt_check(spi_mask, pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
 
 		hess_pts(0, pt_id) = curr_pts(0, pt_id) + scaled_eps2;
 		hess_pts(1, pt_id) = curr_pts(1, pt_id);
@@ -435,6 +427,8 @@ int	IST::estimateIST(const CvMat* in_pts, const CvMat* out_pts,
 	if(method == CV_LMEDS)
 		result = estimator.runLMeDS(in_pts_hm, out_pts_hm, &matH, tempMask, params.confidence,
 		params.max_iters, params.max_subset_attempts);
+	else if(method == CV_RANSAC && params.method == SSMEstimatorParams::EstType::PROSAC)
+		result = estimator.runPROSAC(in_pts_hm, out_pts_hm, &matH, tempMask, params);
 	else if(method == CV_RANSAC)
 		result = estimator.runRANSAC(in_pts_hm, out_pts_hm, &matH, tempMask, params.ransac_reproj_thresh,
 		params.confidence, params.max_iters, params.max_subset_attempts);
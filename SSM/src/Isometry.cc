@@ -116,9 +116,8 @@ void Isometry::cmptInitPixJacobian(MatrixXd &dI_dp,
 	const PixGradT &dI_dx){
 	validate_ssm_jacobian(dI_dp, dI_dx);
 
-	unsigned int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		unsigned int ch_pt_id = pt_id*n_channels;
 
 		double x = init_pts(0, pt_id);
 		double y = init_pts(1, pt_id);
@@ -138,9 +137,8 @@ void Isometry::cmptPixJacobian(MatrixXd &dI_dp,
 	const PixGradT &dI_dx){
 	validate_ssm_jacobian(dI_dp, dI_dx);
 
-	unsigned int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		unsigned int ch_pt_id = pt_id*n_channels;
 		//double x = init_pts(0, i);
 		//double y = init_pts(1, i);
 
@@ -165,9 +163,8 @@ void Isometry::cmptWarpedPixJacobian(MatrixXd &dI_dp,
 	double cos_theta = curr_warp(0, 0);
 	double sin_theta = curr_warp(1, 0);
 
-	unsigned int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		unsigned int ch_pt_id = pt_id*n_channels;
 
 		double x = init_pts(0, pt_id);
 		double y = init_pts(1, pt_id);
@@ -190,9 +187,8 @@ void Isometry::cmptApproxPixJacobian(MatrixXd &dI_dp,
 	double cos_theta = curr_warp(0, 0);
 	double sin_theta = curr_warp(1, 0);
 
-	unsigned int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		unsigned int ch_pt_id = pt_id*n_channels;
 
 		double curr_x = curr_pts(0, pt_id);
 		double curr_y = curr_pts(1, pt_id);
@@ -213,9 +209,8 @@ void Isometry::cmptInitPixHessian(MatrixXd &d2I_dp2, const PixHessT &d2I_dx2,
 	const PixGradT &dI_dx){
 	validate_ssm_hessian(d2I_dp2, d2I_dx2, dI_dx);
 
-	unsigned int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		unsigned int ch_pt_id = pt_id*n_channels;
 
 		double x = init_pts(0, pt_id);
 		double y = init_pts(1, pt_id);
@@ -235,9 +230,8 @@ void Isometry::cmptPixHessian(MatrixXd &d2I_dp2, const PixHessT &d2I_dx2,
 	const PixGradT &dI_dx){
 	validate_ssm_hessian(d2I_dp2, d2I_dx2, dI_dx);
 
-	unsigned int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		unsigned int ch_pt_id = pt_id*n_channels;
 
 		double curr_x = curr_pts(0, pt_id);
 		double curr_y = curr_pts(1, pt_id);
@@ -266,9 +260,8 @@ void Isometry::cmptWarpedPixHessian(MatrixXd &d2I_dp2, const PixHessT &d2I_dw2,
 		cos_theta, -sin_theta,
 		sin_theta, cos_theta;
 
-	unsigned int ch_pt_id = 0;
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id) {
-		spi_pt_check_mc(spi_mask, pt_id, ch_pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
+		unsigned int ch_pt_id = pt_id*n_channels;
 
 		double x = init_pts(0, pt_id);
 		double y = init_pts(1, pt_id);
@@ -349,8 +342,7 @@ void Isometry::updateGradPts(double grad_eps){
 	Vector2d diff_vec_x_warped = curr_warp.topRows<2>().col(0) * grad_eps;
 	Vector2d diff_vec_y_warped = curr_warp.topRows<2>().col(1) * grad_eps;
 
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
-		spi_pt_check(spi_mask, pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
 
 		grad_pts(0, pt_id) = curr_pts(0, pt_id) + diff_vec_x_warped(0);
 		grad_pts(1, pt_id) = curr_pts(1, pt_id) + diff_vec_x_warped(1);
@@ -375,8 +367,7 @@ void Isometry::updateHessPts(double hess_eps){
 	Vector2d diff_vec_xy_warped = (curr_warp.topRows<2>().col(0) + curr_warp.topRows<2>().col(1)) * hess_eps;
 	Vector2d diff_vec_yx_warped = (curr_warp.topRows<2>().col(0) - curr_warp.topRows<2>().col(1)) * hess_eps;
 
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
-		spi_pt_check(spi_mask, pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
 
 		hess_pts(0, pt_id) = curr_pts(0, pt_id) + diff_vec_xx_warped(0);
 		hess_pts(1, pt_id) = curr_pts(1, pt_id) + diff_vec_xx_warped(1);
@@ -531,6 +522,8 @@ int	Isometry::estimateIsometry(const CvMat* in_pts, const CvMat* out_pts,
 	if(method == CV_LMEDS)
 		result = estimator.runLMeDS(in_pts_hm, out_pts_hm, &matH, tempMask, params.confidence,
 		params.max_iters, params.max_subset_attempts);
+	else if(method == CV_RANSAC && params.method == SSMEstimatorParams::EstType::PROSAC)
+		result = estimator.runPROSAC(in_pts_hm, out_pts_hm, &matH, tempMask, params);
 	else if(method == CV_RANSAC)
 		result = estimator.runRANSAC(in_pts_hm, out_pts_hm, &matH, tempMask, params.ransac_reproj_thresh,
 		params.confidence, params.max_iters, params.max_subset_attempts);
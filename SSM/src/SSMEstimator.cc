@@ -8,6 +8,7 @@
 //#endif
 #include <boost/random/random_device.hpp>
 #include <boost/random/uniform_int_distribution.hpp>
+#include <algorithm>
 
 
 _MTF_BEGIN_NAMESPACE
@@ -216,6 +217,267 @@ CvMat* mask, double confidence, int maxIters, int maxAttempts) {
 }
 
 
+namespace{
+	//! no. of hypotheses generated and scored by each worker in each PROSAC batch
+	const int prosac_batch_size = 8;
+	//! no. of points whose reprojection errors are computed together while the SPRT is running
+	const int sprt_block_size = 16;
+	//! time taken to generate a hypothesis in units of the time taken to verify one point
+	const double sprt_model_time = 200;
+	//! initial estimates of the inlier ratio and of the probability of a point
+	//! being consistent with a bad model; both are updated as hypotheses are scored
+	const double sprt_init_epsilon = 0.1;
+	const double sprt_init_delta = 0.01;
+
+	//! SPRT decision threshold A computed by the fixed point iteration in Chum & Matas,
+	//! "Optimal Randomized RANSAC", PAMI 2008
+	double getSPRTThreshold(double epsilon, double delta){
+		double C = (1 - delta)*log((1 - delta) / (1 - epsilon)) + delta*log(delta / epsilon);
+		double A0 = sprt_model_time*C + 1, A = A0;
+		for(int iter_id = 0; iter_id < 10; ++iter_id){
+			double A_new = A0 + log(A);
+			if(fabs(A_new - A) < 1e-5){ return A_new; }
+			A = A_new;
+		}
+		return A;
+	}
+	//! same as cvRANSACUpdateNumIters except that an all-inlier sample is only
+	//! counted as found with the probability that its model survives the SPRT
+	int updatePROSACNumIters(double confidence, double inlier_ratio,
+		int model_points, double accept_prob, int max_iters){
+		double good_prob = pow(inlier_ratio, model_points)*accept_prob;
+		if(good_prob <= DBL_MIN){ return max_iters; }
+		if(good_prob >= 1){ return 1; }
+		double n_iters = log(MAX(1. - confidence, DBL_MIN)) / log(1. - good_prob);
+		return n_iters >= max_iters ? max_iters : MAX(cvRound(n_iters), 1);
+	}
+}
+
+bool SSMEstimator::runPROSAC(const CvMat* m1, const CvMat* m2, CvMat* model,
+	CvMat* mask0, const SSMEstimatorParams &params) {
+	const int count = m1->rows * m1->cols;
+	CV_Assert(CV_ARE_SIZES_EQ(m1, m2) && CV_ARE_SIZES_EQ(m1, mask0) &&
+		CV_MAT_TYPE(m1->type) == CV_64FC2 && CV_MAT_TYPE(m2->type) == CV_64FC2 &&
+		CV_IS_MAT_CONT(m1->type & m2->type));
+
+	if(count < modelPoints)
+		return false;
+
+	const CvPoint2D64f *pts1 = (const CvPoint2D64f*)m1->data.ptr;
+	const CvPoint2D64f *pts2 = (const CvPoint2D64f*)m2->data.ptr;
+
+	//! samples are drawn from the points sorted by cost while hypotheses are scored
+	//! against a random permutation since the SPRT assumes that the points it sees
+	//! first are representative of the rest
+	std::vector<int> sample_order(count), score_order(count);
+	for(int pt_id = 0; pt_id < count; ++pt_id){
+		sample_order[pt_id] = score_order[pt_id] = pt_id;
+	}
+	if(static_cast<int>(params.pt_costs.size()) == count){
+		std::stable_sort(sample_order.begin(), sample_order.end(), [&](int pt1, int pt2){
+			return params.pt_costs[pt1] < params.pt_costs[pt2];
+		});
+	}
+	for(int pt_id = count - 1; pt_id > 0; --pt_id){
+		std::swap(score_order[pt_id], score_order[getRandInt(pt_id + 1)]);
+	}
+	//! 2 x N column major matrices have the same layout as CV_64FC2 so CvMat headers
+	//! over their columns can be passed directly to runKernel and computeReprojError
+	Matrix2Xd sample_pts1(2, count), sample_pts2(2, count);
+	Matrix2Xd score_pts1(2, count), score_pts2(2, count);
+	for(int pt_id = 0; pt_id < count; ++pt_id){
+		sample_pts1.col(pt_id) << pts1[sample_order[pt_id]].x, pts1[sample_order[pt_id]].y;
+		sample_pts2.col(pt_id) << pts2[sample_order[pt_id]].x, pts2[sample_order[pt_id]].y;
+		score_pts1.col(pt_id) << pts1[score_order[pt_id]].x, pts1[score_order[pt_id]].y;
+		score_pts2.col(pt_id) << pts2[score_order[pt_id]].x, pts2[score_order[pt_id]].y;
+	}
+
+	const int n_workers = MAX(params.n_workers, 1);
+	const int batch_size = n_workers*prosac_batch_size;
+	const int model_size = modelSize.height*modelSize.width;
+	const double thresh_sq = params.ransac_reproj_thresh*params.ransac_reproj_thresh;
+
+	Matrix2Xd batch_pts1(2, batch_size*modelPoints), batch_pts2(2, batch_size*modelPoints);
+	std::vector<int> sample_idx(modelPoints);
+
+	struct WorkerState{
+		std::vector<double> models, best_model;
+		std::vector<float> err;
+		std::vector<uchar> inliers, best_inliers;
+		int best_count, best_hyp_id, n_rejected;
+		double rejected_consistency;
+	};
+	std::vector<WorkerState> worker_states(n_workers);
+	for(WorkerState &state : worker_states){
+		state.models.resize(model_size*maxBasicSolutions);
+		state.best_model.resize(model_size);
+		state.err.resize(count);
+		state.inliers.resize(count);
+		state.best_inliers.resize(count);
+	}
+
+	//! PROSAC growth function: the T_n' th hypothesis is the first one drawn from the n best points
+	int sample_size = modelPoints, T_n_prime = 1;
+	double T_n = MAX(params.max_iters, 1);
+	for(int pt_id = 0; pt_id < modelPoints; ++pt_id){
+		T_n *= static_cast<double>(modelPoints - pt_id) / (count - pt_id);
+	}
+
+	int n_iters = MAX(params.max_iters, 1), hyp_count = 0, best_count = 0;
+	int n_rejected = 0;
+	double rejected_consistency = 0;
+	double epsilon = sprt_init_epsilon, delta = sprt_init_delta;
+	double sprt_thresh = getSPRTThreshold(epsilon, delta);
+	std::vector<double> best_model(model_size);
+	std::vector<uchar> best_inliers(count);
+	bool subset_found = true;
+
+	while(hyp_count < n_iters && subset_found){
+		//! samples are drawn serially so that the result depends only on the seed and not on the no. of workers
+		int n_hyps = 0;
+		for(; n_hyps < batch_size && hyp_count + n_hyps < n_iters; ++n_hyps){
+			int hyp_num = hyp_count + n_hyps + 1;
+			if(hyp_num > T_n_prime && sample_size < count){
+				double T_n_next = T_n*(sample_size + 1) / (sample_size + 1 - modelPoints);
+				++sample_size;
+				T_n_prime += static_cast<int>(ceil(T_n_next - T_n));
+				T_n = T_n_next;
+			}
+			//! until T_n' hypotheses are drawn, each sample includes the newest point in the set
+			bool include_last = hyp_num <= T_n_prime;
+			int pool_size = include_last ? sample_size - 1 : sample_size;
+			Map<Matrix2Xd> ms1_pts(batch_pts1.data() + 2 * n_hyps*modelPoints, 2, modelPoints);
+			Map<Matrix2Xd> ms2_pts(batch_pts2.data() + 2 * n_hyps*modelPoints, 2, modelPoints);
+			CvMat ms1 = cvMat(1, modelPoints, CV_64FC2, ms1_pts.data());
+			CvMat ms2 = cvMat(1, modelPoints, CV_64FC2, ms2_pts.data());
+			subset_found = false;
+			for(int attempt_id = 0; attempt_id < params.max_subset_attempts && !subset_found; ++attempt_id){
+				int n_drawn = 0;
+				if(include_last){ sample_idx[n_drawn++] = sample_size - 1; }
+				while(n_drawn < modelPoints){
+					int idx = getRandInt(pool_size);
+					if(std::find(sample_idx.begin(), sample_idx.begin() + n_drawn, idx) ==
+						sample_idx.begin() + n_drawn){
+						sample_idx[n_drawn++] = idx;
+					}
+				}
+				for(int pt_id = 0; pt_id < modelPoints; ++pt_id){
+					ms1_pts.col(pt_id) = sample_pts1.col(sample_idx[pt_id]);
+					ms2_pts.col(pt_id) = sample_pts2.col(sample_idx[pt_id]);
+				}
+				subset_found = true;
+				for(int n_checked = checkPartialSubsets ? 3 : modelPoints;
+					subset_found && n_checked <= modelPoints; ++n_checked){
+					subset_found = checkSubset(&ms1, n_checked) && checkSubset(&ms2, n_checked);
+				}
+			}
+			if(!subset_found){ break; }
+		}
+		if(n_hyps == 0){ break; }
+
+		const double lambda_inlier = delta / epsilon, lambda_outlier = (1 - delta) / (1 - epsilon);
+		auto score_hypotheses = [&](unsigned int worker_id){
+			WorkerState &state = worker_states[worker_id];
+			state.best_count = MAX(best_count, modelPoints - 1);
+			state.best_hyp_id = -1;
+			state.n_rejected = 0;
+			state.rejected_consistency = 0;
+			CvMat models = cvMat(modelSize.height*maxBasicSolutions, modelSize.width,
+				CV_64FC1, state.models.data());
+			for(int hyp_id = worker_id; hyp_id < n_hyps; hyp_id += n_workers){
+				CvMat ms1 = cvMat(1, modelPoints, CV_64FC2, batch_pts1.data() + 2 * hyp_id*modelPoints);
+				CvMat ms2 = cvMat(1, modelPoints, CV_64FC2, batch_pts2.data() + 2 * hyp_id*modelPoints);
+				int nmodels = runKernel(&ms1, &ms2, &models);
+				for(int model_id = 0; model_id < nmodels; ++model_id){
+					CvMat model_i;
+					cvGetRows(&models, &model_i, model_id*modelSize.height, (model_id + 1)*modelSize.height);
+					int n_inliers = 0, n_tested = 0;
+					double lambda = 1;
+					bool rejected = false;
+					while(n_tested < count && !rejected){
+						int block_size = params.sprt ? MIN(sprt_block_size, count - n_tested) : count;
+						CvMat block1 = cvMat(1, block_size, CV_64FC2, score_pts1.data() + 2 * n_tested);
+						CvMat block2 = cvMat(1, block_size, CV_64FC2, score_pts2.data() + 2 * n_tested);
+						CvMat block_err = cvMat(1, block_size, CV_32FC1, state.err.data() + n_tested);
+						computeReprojError(&block1, &block2, &model_i, &block_err);
+						for(int block_end = n_tested + block_size; n_tested < block_end; ++n_tested){
+							bool is_inlier = state.err[n_tested] <= thresh_sq;
+							state.inliers[n_tested] = is_inlier;
+							n_inliers += is_inlier;
+							if(params.sprt){
+								lambda *= is_inlier ? lambda_inlier : lambda_outlier;
+								if(lambda > sprt_thresh){
+									rejected = true;
+									++n_tested;
+									break;
+								}
+							}
+						}
+					}
+					if(rejected){
+						++state.n_rejected;
+						state.rejected_consistency += static_cast<double>(n_inliers) / n_tested;
+					} else if(n_inliers > state.best_count){
+						state.best_count = n_inliers;
+						state.best_hyp_id = hyp_id;
+						std::copy(model_i.data.db, model_i.data.db + model_size, state.best_model.begin());
+						state.best_inliers.swap(state.inliers);
+					}
+				}
+			}
+		};
+		worker_pool.run(n_workers, score_hypotheses);
+		hyp_count += n_hyps;
+
+		//! ties are broken by the order in which the hypotheses were drawn
+		const WorkerState *batch_best = nullptr;
+		for(const WorkerState &state : worker_states){
+			n_rejected += state.n_rejected;
+			rejected_consistency += state.rejected_consistency;
+			if(state.best_hyp_id < 0){ continue; }
+			if(!batch_best || state.best_count > batch_best->best_count ||
+				(state.best_count == batch_best->best_count && state.best_hyp_id < batch_best->best_hyp_id)){
+				batch_best = &state;
+			}
+		}
+		if(n_rejected > 0){
+			delta = rejected_consistency / n_rejected;
+		}
+		if(batch_best){
+			best_count = batch_best->best_count;
+			best_model = batch_best->best_model;
+			best_inliers = batch_best->best_inliers;
+			epsilon = static_cast<double>(best_count) / count;
+		}
+		epsilon = MIN(MAX(epsilon, 0.01), 0.99);
+		delta = MIN(MAX(delta, 1e-3), 0.5*epsilon);
+		sprt_thresh = getSPRTThreshold(epsilon, delta);
+		if(batch_best){
+			n_iters = updatePROSACNumIters(params.confidence, static_cast<double>(best_count) / count,
+				modelPoints, params.sprt ? 1 - 1 / sprt_thresh : 1, n_iters);
+		}
+	}
+
+	if(best_count <= 0)
+		return false;
+
+	CvMat best_model_mat = cvMat(modelSize.height, modelSize.width, CV_64FC1, best_model.data());
+	cvCopy(&best_model_mat, model);
+	for(int pt_id = 0; pt_id < count; ++pt_id){
+		mask0->data.ptr[score_order[pt_id]] = best_inliers[pt_id];
+	}
+	return true;
+}
+
+int SSMEstimator::getRandInt(int n){
+	if(use_boost_rng){
+		boost::random::uniform_int_distribution<int> uni(0, n - 1);
+		return uni(boost_rng);
+	}
+	return cvRandInt(&cv_rng) % n;
+}
+
+
 bool SSMEstimator::getSubset(const CvMat* m1, const CvMat* m2,
 	CvMat* ms1, CvMat* ms2, int maxAttempts) {
 	cv::AutoBuffer<int> _idx(modelPoints);
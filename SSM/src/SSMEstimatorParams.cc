@@ -11,6 +11,8 @@
 #define SSM_EST_REFINE true
 #define SSM_EST_LM_MAX_ITERS 10
 #define SSM_EST_CONFIDENCE 0.995
+#define SSM_EST_N_WORKERS 1
+#define SSM_EST_SPRT true
 
 _MTF_BEGIN_NAMESPACE
 
@@ -22,6 +24,8 @@ const char* SSMEstimatorParams::toString(EstType est_type){
 		return "RANSAC";
 	case EstType::LeastMedian:
 		return "LeastMedian";
+	case EstType::PROSAC:
+		return "PROSAC";
 	default:
 		throw utils::InvalidArgument("Invalid estimation method specified");
 	}
@@ -31,6 +35,7 @@ int SSMEstimatorParams::toCV(EstType est_type){
 	case EstType::LeastSquares:
 		return 0;
 	case EstType::RANSAC:
+	case EstType::PROSAC:
 		return CV_RANSAC;
 	case EstType::LeastMedian:
 		return CV_LMEDS;
@@ -41,7 +46,8 @@ int SSMEstimatorParams::toCV(EstType est_type){
 
 SSMEstimatorParams::SSMEstimatorParams(EstType _method, double _ransac_reproj_thresh,
 	int _n_model_pts, bool _refine, int _max_iters, int _max_subset_attempts,
-	bool  _use_boost_rng, double _confidence, int _lm_max_iters) :
+	bool  _use_boost_rng, double _confidence, int _lm_max_iters,
+	int _n_workers, bool _sprt) :
 method(_method),
 ransac_reproj_thresh(_ransac_reproj_thresh),
 n_model_pts(_n_model_pts),
@@ -50,7 +56,9 @@ max_subset_attempts(_max_subset_attempts),
 use_boost_rng(_use_boost_rng),
 confidence(_confidence),
 refine(_refine),
-lm_max_iters(_lm_max_iters){
+lm_max_iters(_lm_max_iters),
+n_workers(_n_workers),
+sprt(_sprt){
 	if(ransac_reproj_thresh <= 0){
 		ransac_reproj_thresh = 3;
 	}
@@ -66,7 +74,9 @@ max_subset_attempts(SSM_MAX_SUBSET_ATTEMPTS),
 use_boost_rng(SSM_USE_BOOST_RNG),
 confidence(SSM_EST_CONFIDENCE),
 refine(SSM_EST_REFINE),
-lm_max_iters(SSM_EST_LM_MAX_ITERS){
+lm_max_iters(SSM_EST_LM_MAX_ITERS),
+n_workers(SSM_EST_N_WORKERS),
+sprt(SSM_EST_SPRT){
 	if(params){
 		method = params->method;
 		ransac_reproj_thresh = params->ransac_reproj_thresh;
@@ -77,6 +87,9 @@ lm_max_iters(SSM_EST_LM_MAX_ITERS){
 		confidence = params->confidence;
 		refine = params->refine;
 		lm_max_iters = params->lm_max_iters;
+		n_workers = params->n_workers;
+		sprt = params->sprt;
+		pt_costs = params->pt_costs;
 	}
 	if(ransac_reproj_thresh <= 0){
 		ransac_reproj_thresh = 3;
@@ -93,5 +106,7 @@ void SSMEstimatorParams::print() const{
 	printf("confidence: %f\n", confidence);
 	printf("refine: %d\n", refine);
 	printf("lm_max_iters: %d\n", lm_max_iters);
+	printf("n_workers: %d\n", n_workers);
+	printf("sprt: %d\n", sprt);
 }
 _MTF_END_NAMESPACE
@@ -97,10 +97,8 @@ Spline::Spline(
 
 	dist_norm_x.resize(n_control_pts);
 	dist_norm_y.resize(n_control_pts);
-
-	norm_dist_x.resize(n_pts, n_control_pts);
-	norm_dist_y.resize(n_pts, n_control_pts);
-	interp_wts.resize(n_pts, n_control_pts);
+	n_pt_interp_wts.resize(n_pts);
+	max_interp_wts = 0;
 
 	curr_state.resize(state_size);
 	norm_pts.resize(Eigen::NoChange, n_pts);
@@ -140,8 +138,8 @@ void Spline::setCorners(const CornersT& corners){
 		utils::printMatrix(curr_control_pts, "curr_control_pts");
 		utils::printMatrix(dist_norm_x, "dist_norm_x");
 		utils::printMatrix(dist_norm_y, "dist_norm_y");
-		utils::printMatrix(norm_dist_x, "norm_dist_x");
-		utils::printMatrix(norm_dist_y, "norm_dist_y");
+		utils::printMatrix(n_pt_interp_wts, "n_pt_interp_wts");
+		utils::printMatrix(interp_ctrl_ids, "interp_ctrl_ids");
 		utils::printMatrix(interp_wts, "interp_wts");
 	}
 
@@ -160,10 +158,10 @@ void Spline::compositionalUpdate(const VectorXd& state_update){
 	validate_ssm_state(state_update);
 	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
 		double pt_disp_x = 0, pt_disp_y = 0;
-		int state_id = -1;
-		for(unsigned int ctrl_pt_id = 0; ctrl_pt_id < n_control_pts; ++ctrl_pt_id){
-			pt_disp_x += interp_wts(pt_id, ctrl_pt_id)*state_update(++state_id);
-			pt_disp_y += interp_wts(pt_id, ctrl_pt_id)*state_update(++state_id);
+		for(int wt_id = 0; wt_id < n_pt_interp_wts(pt_id); ++wt_id){
+			int state_id = 2 * interp_ctrl_ids(wt_id, pt_id);
+			pt_disp_x += interp_wts(wt_id, pt_id)*state_update(state_id);
+			pt_disp_y += interp_wts(wt_id, pt_id)*state_update(state_id + 1);
 		}
 		curr_pts(0, pt_id) += pt_disp_x;
 		curr_pts(1, pt_id) += pt_disp_y;
@@ -191,15 +189,48 @@ void Spline::initInterpolationWeights(){
 		int max_pt_id_y = ctrl_pt_id_y*params.control_size_y;
 		dist_norm_x(ctrl_pt_id) = abs(max_pt_id_x - ctrl_idx(ctrl_pt_id_x)) + params.control_overlap;
 		dist_norm_y(ctrl_pt_id) = abs(max_pt_id_y - ctrl_idy(ctrl_pt_id_y)) + params.control_overlap;
-		for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
-			int pt_id_x = pt_id % resx;
-			int pt_id_y = pt_id / resx;
-			norm_dist_x(pt_id, ctrl_pt_id) = (pt_id_x - ctrl_idx(ctrl_pt_id_x)) / dist_norm_x(ctrl_pt_id);
-			norm_dist_y(pt_id, ctrl_pt_id) = (pt_id_y - ctrl_idy(ctrl_pt_id_y)) / dist_norm_y(ctrl_pt_id);
-			interp_wts(pt_id, ctrl_pt_id) = getWeight(norm_dist_x(pt_id, ctrl_pt_id), norm_dist_y(pt_id, ctrl_pt_id));
+	}
+	//! the influence region of a control point is separable so the ones reaching each
+	//! column and row of the sampling grid are found first and then combined for each point
+	std::vector<std::vector<int> > supp_ids_x(resx), supp_ids_y(resy);
+	unsigned int max_supp_x = 0, max_supp_y = 0;
+	for(unsigned int pt_id_x = 0; pt_id_x < resx; ++pt_id_x){
+		for(unsigned int ctrl_pt_id_x = 0; ctrl_pt_id_x < control_res_x; ++ctrl_pt_id_x){
+			if(abs(pt_id_x - ctrl_idx(ctrl_pt_id_x)) <= dist_norm_x(ctrl_pt_id_x)){
+				supp_ids_x[pt_id_x].push_back(ctrl_pt_id_x);
+			}
+		}
+		max_supp_x = std::max<unsigned int>(max_supp_x, supp_ids_x[pt_id_x].size());
+	}
+	for(unsigned int pt_id_y = 0; pt_id_y < resy; ++pt_id_y){
+		for(unsigned int ctrl_pt_id_y = 0; ctrl_pt_id_y < control_res_y; ++ctrl_pt_id_y){
+			if(abs(pt_id_y - ctrl_idy(ctrl_pt_id_y)) <= dist_norm_y(ctrl_pt_id_y*control_res_x)){
+				supp_ids_y[pt_id_y].push_back(ctrl_pt_id_y);
+			}
+		}
+		max_supp_y = std::max<unsigned int>(max_supp_y, supp_ids_y[pt_id_y].size());
+	}
+	max_interp_wts = max_supp_x*max_supp_y;
+	interp_wts.setZero(max_interp_wts, n_pts);
+	interp_ctrl_ids.setZero(max_interp_wts, n_pts);
+
+	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
+		int pt_id_x = pt_id % resx;
+		int pt_id_y = pt_id / resx;
+		int wt_id = 0;
+		for(int ctrl_pt_id_y : supp_ids_y[pt_id_y]){
+			for(int ctrl_pt_id_x : supp_ids_x[pt_id_x]){
+				int ctrl_pt_id = ctrl_pt_id_y*control_res_x + ctrl_pt_id_x;
+				double norm_dist_x = (pt_id_x - ctrl_idx(ctrl_pt_id_x)) / dist_norm_x(ctrl_pt_id);
+				double norm_dist_y = (pt_id_y - ctrl_idy(ctrl_pt_id_y)) / dist_norm_y(ctrl_pt_id);
+				interp_ctrl_ids(wt_id, pt_id) = ctrl_pt_id;
+				interp_wts(wt_id, pt_id) = getWeight(norm_dist_x, norm_dist_y);
+				++wt_id;
+			}
 		}
+		n_pt_interp_wts(pt_id) = wt_id;
+		interp_wts.col(pt_id) /= interp_wts.col(pt_id).sum();
 	}
-	interp_wts = (interp_wts.array().colwise() / interp_wts.rowwise().sum().array()).matrix();
 }
 
 void Spline::updateInterpolationWeights(){
@@ -211,13 +242,17 @@ void Spline::updateInterpolationWeights(){
 		int max_pt_id = max_pt_id_y*resx + max_pt_id_x;
 		dist_norm_x(ctrl_pt_id) = abs(curr_pts(0, max_pt_id) - curr_control_pts(0, ctrl_pt_id)) + params.control_overlap;
 		dist_norm_y(ctrl_pt_id) = abs(curr_pts(1, max_pt_id) - curr_control_pts(1, ctrl_pt_id)) + params.control_overlap;
-		for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
-			norm_dist_x(pt_id, ctrl_pt_id) = (curr_pts(0, pt_id) - curr_control_pts(0, ctrl_pt_id)) / dist_norm_x(ctrl_pt_id);
-			norm_dist_y(pt_id, ctrl_pt_id) = (curr_pts(1, pt_id) - curr_control_pts(1, ctrl_pt_id)) / dist_norm_y(ctrl_pt_id);
-			interp_wts(pt_id, ctrl_pt_id) = getWeight(norm_dist_x(pt_id, ctrl_pt_id), norm_dist_y(pt_id, ctrl_pt_id));
+	}
+	//! the support found in initInterpolationWeights is retained as the points move
+	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
+		for(int wt_id = 0; wt_id < n_pt_interp_wts(pt_id); ++wt_id){
+			int ctrl_pt_id = interp_ctrl_ids(wt_id, pt_id);
+			double norm_dist_x = (curr_pts(0, pt_id) - curr_control_pts(0, ctrl_pt_id)) / dist_norm_x(ctrl_pt_id);
+			double norm_dist_y = (curr_pts(1, pt_id) - curr_control_pts(1, ctrl_pt_id)) / dist_norm_y(ctrl_pt_id);
+			interp_wts(wt_id, pt_id) = getWeight(norm_dist_x, norm_dist_y);
 		}
+		interp_wts.col(pt_id) /= interp_wts.col(pt_id).sum();
 	}
-	interp_wts = (interp_wts.array().colwise() / interp_wts.rowwise().sum().array()).matrix();
 }
 
 double Spline::getWeight(double x, double y){
@@ -252,30 +287,30 @@ void Spline::invertState(VectorXd& inv_state, const VectorXd& state){
 void Spline::cmptInitPixJacobian(MatrixXd &jacobian_prod,
 	const PixGradT &pix_jacobian){
 	validate_ssm_jacobian(jacobian_prod, pix_jacobian);
-
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
-		getInitPixGrad(ssm_grad, pt_id);
-		jacobian_prod.row(pt_id) = pix_jacobian.row(pt_id)*ssm_grad;
-	}
+	//! getInitPixGrad uses the current weights as well
+	cmptPixJacobian(jacobian_prod, pix_jacobian);
 }
 
 void Spline::cmptPixJacobian(MatrixXd &jacobian_prod,
 	const PixGradT &pix_jacobian){
 	validate_ssm_jacobian(jacobian_prod, pix_jacobian);
 
+	jacobian_prod.setZero();
 	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id){
-		getCurrPixGrad(ssm_grad, pt_id);
-		jacobian_prod.row(pt_id) = pix_jacobian.row(pt_id)*ssm_grad;
+		for(int wt_id = 0; wt_id < n_pt_interp_wts(pt_id); ++wt_id){
+			int state_id = 2 * interp_ctrl_ids(wt_id, pt_id);
+			jacobian_prod(pt_id, state_id) = pix_jacobian(pt_id, 0)*interp_wts(wt_id, pt_id);
+			jacobian_prod(pt_id, state_id + 1) = pix_jacobian(pt_id, 1)*interp_wts(wt_id, pt_id);
+		}
 	}
-	//jacobian_prod.array().colwise() /= curr_pts_hm.array().row(2).transpose();
 }
 
 void Spline::cmptWarpedPixJacobian(MatrixXd &jacobian_prod,
 	const PixGradT &pix_grad) {
 	validate_ssm_jacobian(jacobian_prod, pix_grad);
-	for(unsigned int pt_id = 0; pt_id < n_pts; ++pt_id) {
-
-	}
+	//! updates displace each point by the interpolated control point displacements
+	//! so the warped gradient is mapped through the same weights
+	cmptPixJacobian(jacobian_prod, pix_grad);
 }
 
 void Spline::cmptWarpedPixHessian(MatrixXd &pix_hess_ssm, const PixHessT &pix_hess_coord,
@@ -293,10 +328,10 @@ void Spline::getInitPixGrad(Matrix2Xd &ssm_grad, int pt_id) {
 
 void Spline::getCurrPixGrad(Matrix2Xd &_ssm_grad, int pt_id) {
 	_ssm_grad.setZero();
-	int state_id = -1;
-	for(unsigned int ctrl_pt_id = 0; ctrl_pt_id < n_control_pts; ++ctrl_pt_id){
-		_ssm_grad(0, ++state_id) += interp_wts(pt_id, ctrl_pt_id);
-		_ssm_grad(1, ++state_id) += interp_wts(pt_id, ctrl_pt_id);
+	for(int wt_id = 0; wt_id < n_pt_interp_wts(pt_id); ++wt_id){
+		int state_id = 2 * interp_ctrl_ids(wt_id, pt_id);
+		_ssm_grad(0, state_id) = interp_wts(wt_id, pt_id);
+		_ssm_grad(1, state_id + 1) = interp_wts(wt_id, pt_id);
 	}
 
 }
@@ -3,12 +3,6 @@
 #include "mtf/Utilities/miscUtils.h"
 #include "opencv2/calib3d/calib3d.hpp"
 
-#ifndef DISABLE_SPI
-#define hom_spi(pt_id) if(spi_mask && !spi_mask[pt_id]){continue;}
-#else
-#define hom_spi() 
-#endif
-
 _MTF_BEGIN_NAMESPACE
 
 TPSParams::TPSParams(const SSMParams *ssm_params, 
@@ -115,9 +109,7 @@ void TPS::cmptInitPixJacobian(MatrixXd &jacobian_prod,
 	const PixGradT &pix_jacobian){
 	validate_ssm_jacobian(jacobian_prod, pix_jacobian);
 
-	for(int pt_id = 0; pt_id < n_pts; pt_id++){
-
-		hom_spi(pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
 
 		double x = init_pts(0, pt_id);
 		double y = init_pts(1, pt_id);
@@ -145,8 +137,7 @@ void TPS::cmptPixJacobian(MatrixXd &jacobian_prod,
 	const PixGradT &pix_jacobian){
 	validate_ssm_jacobian(jacobian_prod, pix_jacobian);
 
-	for(int pt_id = 0; pt_id < n_pts; pt_id++){
-		hom_spi(pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
 
 		double x = init_pts(0, pt_id);
 		double y = init_pts(1, pt_id);
@@ -186,8 +177,7 @@ void TPS::cmptWarpedPixJacobian(MatrixXd &jacobian_prod,
 	double h20 = curr_warp(2, 0);
 	double h21 = curr_warp(2, 1);
 
-	for(int pt_id = 0; pt_id < n_pts; pt_id++) {
-		hom_spi(pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
 
 		double curr_x = curr_pts(0, pt_id);
 		double curr_y = curr_pts(1, pt_id);
@@ -250,8 +240,7 @@ void TPS::cmptWarpedPixHessian(MatrixXd &pix_hess_ssm, const PixHessT &pix_hess_
 	Matrix2d ssm_pt_jac, ssm_pt_hess_x, ssm_pt_hess_y;
 
 	Matrix28d ssm_jacobian;
-	for(int pt_id = 0; pt_id < n_pts; pt_id++) {
-		hom_spi(pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
 
 		double curr_x = curr_pts(0, pt_id);
 		double curr_y = curr_pts(1, pt_id);
@@ -364,8 +353,7 @@ void TPS::cmptApproxPixJacobian(MatrixXd &jacobian_prod,
 	double h20 = curr_warp(2, 0);
 	double h21 = curr_warp(2, 1);
 
-	for(int pt_id = 0; pt_id < n_pts; pt_id++){
-		hom_spi(pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
 		double curr_x = curr_pts(0, pt_id);
 		double curr_y = curr_pts(1, pt_id);
 		double D = curr_pts_hm(2, pt_id);
@@ -426,8 +414,7 @@ void TPS::cmptApproxPixHessian(MatrixXd &pix_hess_ssm, const PixHessT &pix_hess_
 	Matrix2d ssm_pt_hess_x, ssm_pt_hess_y;
 
 	Matrix28d ssm_jacobian;
-	for(int pt_id = 0; pt_id < n_pts; pt_id++) {
-		hom_spi(pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
 
 		double curr_x = curr_pts(0, pt_id);
 		double curr_y = curr_pts(1, pt_id);
@@ -516,8 +503,7 @@ void TPS::cmptInitPixHessian(MatrixXd &pix_hess_ssm, const PixHessT &pix_hess_co
 	const PixGradT &pix_grad){
 	validate_ssm_hessian(pix_hess_ssm, pix_hess_coord, pix_grad);
 	Matrix28d ssm_jacobian;
-	for(int pt_id = 0; pt_id < n_pts; pt_id++){
-		hom_spi(pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
 
 		double x = init_pts(0, pt_id);
 		double y = init_pts(1, pt_id);
@@ -572,8 +558,7 @@ void TPS::cmptPixHessian(MatrixXd &pix_hess_ssm, const PixHessT &pix_hess_coord,
 	validate_ssm_hessian(pix_hess_ssm, pix_hess_coord, pix_grad);
 
 	Matrix28d ssm_jacobian;
-	for(int pt_id = 0; pt_id < n_pts; pt_id++){
-		hom_spi(pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
 
 		double x = init_pts(0, pt_id);
 		double y = init_pts(1, pt_id);
@@ -632,8 +617,7 @@ void TPS::updateGradPts(double grad_eps){
 	Vector3d diff_vec_y_warped = curr_warp.col(1) * grad_eps;
 
 	Vector3d pt_inc_warped, pt_dec_warped;
-	for(int pt_id = 0; pt_id < n_pts; pt_id++){
-		hom_spi(pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
 
 		pt_inc_warped = curr_pts_hm.col(pt_id) + diff_vec_x_warped;
 		grad_pts(0, pt_id) = pt_inc_warped(0) / pt_inc_warped(2);
@@ -663,9 +647,7 @@ void TPS::updateHessPts(double hess_eps){
 
 	Vector3d pt_inc_warped, pt_dec_warped;
 
-	for(int pt_id = 0; pt_id < n_pts; ++pt_id){
-
-		hom_spi(pt_id);
+	for(unsigned int pt_id : spi_pt_ids){
 
 		pt_inc_warped = curr_pts_hm.col(pt_id) + diff_vec_xx_warped;
 		hess_pts(0, pt_id) = pt_inc_warped(0) / pt_inc_warped(2);
@@ -205,6 +205,7 @@ void Translation::estimateWarpFromPts(VectorXd &state_update, vector<uchar> &mas
 		case EstType::LeastMedian:
 			throw utils::FunctonNotImplemented("translation::Least median estimator is not implemented yet");
 		case EstType::RANSAC:
+		case EstType::PROSAC:
 			for(int test_pt_id = 0; test_pt_id < n_pts; ++test_pt_id){
 				float tx = out_pts[test_pt_id].x - in_pts[test_pt_id].x;
 				float ty = out_pts[test_pt_id].y - in_pts[test_pt_id].y;
@@ -382,6 +383,8 @@ int	Translation::estimateTranslation(const CvMat* in_pts, const CvMat* out_pts,
 	if(method == CV_LMEDS)
 		result = estimator.runLMeDS(in_pts_hm, out_pts_hm, &matH, tempMask, params.confidence,
 		params.max_iters, params.max_subset_attempts);
+	else if(method == CV_RANSAC && params.method == SSMEstimatorParams::EstType::PROSAC)
+		result = estimator.runPROSAC(in_pts_hm, out_pts_hm, &matH, tempMask, params);
 	else if(method == CV_RANSAC)
 		result = estimator.runRANSAC(in_pts_hm, out_pts_hm, &matH, tempMask, params.ransac_reproj_thresh,
 		params.confidence, params.max_iters, params.max_subset_attempts);
@@ -4,7 +4,7 @@ DSST_INCLUDE_DIR = ${DSST_ROOT_DIR}/include
 DSST_HEADER_DIR = ${DSST_INCLUDE_DIR}/mtf/${DSST_ROOT_DIR}
 
 THIRD_PARTY_TRACKERS += DSST
-DSST_HEADERS = $(addprefix  ${DSST_HEADER_DIR}/, DSST.h wrappers.h HOG.h Params.h sse.hpp)
+DSST_HEADERS = $(addprefix  ${DSST_HEADER_DIR}/, DSST.h wrappers.h HOG.h Params.h sse.hpp FFT.h)
 
 THIRD_PARTY_HEADERS += ${DSST_HEADERS}
 THIRD_PARTY_INCLUDE_DIRS += ${DSST_INCLUDE_DIR}
@@ -0,0 +1,67 @@
+#ifndef MTF_CF_FFT_H
+#define MTF_CF_FFT_H
+
+#include <opencv2/core/core.hpp>
+
+//! Fourier transforms and parallel loops shared by the correlation filter trackers (DSST and KCF)
+namespace cf_fft{
+
+	template<class LoopBodyT>
+	class ParallelLoop : public cv::ParallelLoopBody{
+	public:
+		ParallelLoop(const LoopBodyT &_body) : body(_body){}
+		void operator()(const cv::Range &range) const override{
+			for(int id = range.start; id < range.end; ++id){
+				body(id);
+			}
+		}
+	private:
+		const LoopBodyT &body;
+	};
+	//! runs body(id) for id in [start, end) using the OpenCV thread pool
+	template<class LoopBodyT>
+	inline void parallelFor(int start, int end, const LoopBodyT &body){
+		if(end <= start){ return; }
+		cv::parallel_for_(cv::Range(start, end), ParallelLoop<LoopBodyT>(body));
+	}
+
+	/**
+	full CV_64FC2 spectrum of a single channel real matrix computed with a real input transform
+	instead of a complex one over a zero imaginary plane;
+	CV_32F inputs are transformed in single precision and only the spectrum is widened
+	so that it can be used with the existing double precision models
+	*/
+	inline void dft(const cv::Mat &real, cv::Mat &spectrum, int flags = 0){
+		CV_Assert(real.channels() == 1);
+		if(real.depth() == CV_32F){
+			cv::Mat spectrum_32f;
+			cv::dft(real, spectrum_32f, flags | cv::DFT_COMPLEX_OUTPUT);
+			spectrum_32f.convertTo(spectrum, CV_64F);
+		} else if(real.depth() == CV_64F){
+			cv::dft(real, spectrum, flags | cv::DFT_COMPLEX_OUTPUT);
+		} else{
+			cv::Mat real_64f;
+			real.convertTo(real_64f, CV_64F);
+			cv::dft(real_64f, spectrum, flags | cv::DFT_COMPLEX_OUTPUT);
+		}
+	}
+	inline cv::Mat dft(const cv::Mat &real, int flags = 0){
+		cv::Mat spectrum;
+		dft(real, spectrum, flags);
+		return spectrum;
+	}
+	//! transforms each of the n_chns feature channels in parallel
+	inline void dft(const cv::Mat *real, cv::Mat *spectrum, int n_chns, int flags = 0){
+		parallelFor(0, n_chns, [&](int ch){ dft(real[ch], spectrum[ch], flags); });
+	}
+	/**
+	smallest size not less than the given one whose number of cells, when divided into bins of the given size,
+	has only small prime factors so that the corresponding DFTs are fast
+	*/
+	inline int getOptimalSize(int size, int bin_size = 1){
+		int n_cells = (size + bin_size - 1) / bin_size;
+		return cv::getOptimalDFTSize(n_cells) * bin_size;
+	}
+}
+
+#endif
@@ -11,6 +11,7 @@
 #include <iostream>
 #include <math.h>
 #include "mtf/ThirdParty/DSST/HOG.h"
+#include "mtf/ThirdParty/DSST/FFT.h"
 #include "mtf/Utilities/miscUtils.h"
 #include "opencv2/calib3d/calib3d.hpp"
 
@@ -433,11 +434,7 @@ cv::Mat DSST::inverseFourier(cv::Mat original, int flag)
 
 cv::Mat DSST::createFourier(cv::Mat original, int flag)
 {
-	cv::Mat planes[] = { cv::Mat_<double>(original), cv::Mat::zeros(original.size(), CV_64F) };
-	cv::Mat complexI;
-	cv::merge(planes, 2, complexI);
-	cv::dft(complexI, complexI, flag);  // Applying DFT without padding
-	return complexI;
+	return cf_fft::dft(original, flag);
 }
 
 cv::Mat DSST::hann(int size)
@@ -544,12 +541,7 @@ double DSST::computeCorrelationVariance(double *arr, int arrW, int arrH)
 		featureMap[i] = featureMap[i].mul(tSetup.trans_cos_win);
 
 	cv::Mat *feature_map_fourier = new cv::Mat[nDims];
-	for(int i = 0; i < nDims; i++)
-	{
-		cv::Mat feature_map_double(featureMap[i].rows, featureMap[i].cols, CV_64FC1);
-		featureMap[i].convertTo(feature_map_double, CV_64FC1);
-		feature_map_fourier[i] = createFourier(feature_map_double);
-	}
+	cf_fft::dft(featureMap, feature_map_fourier, nDims);
 
 	cv::Mat* temp = new cv::Mat[nDims];
 	for(int i = 0; i < nDims; i++)
@@ -669,19 +661,14 @@ cv::Mat *DSST::create_feature_map(cv::Mat& patch, int full, int &nChns, cv::Mat&
 	//imshow("Patch testing", patch8U);
 	//waitKey();
 	//cout<<"After Computing Gradients"<<endl;
-	if(!scaling)
-	{
-		hParams.binSize = tParams.bin_size;//1;
-	} else
-	{
-		hParams.binSize = 4;
-	}
-	int hb = h / hParams.binSize; int wb = w / hParams.binSize;
+	//kept local so that scale samples can be extracted in parallel
+	int binSize = scaling ? 4 : tParams.bin_size;
+	int hb = h / binSize; int wb = w / binSize;
 
 	nChns = hParams.nOrients * 3 + 5;
 	float *H = (float*)calloc(hb*wb*nChns, sizeof(float));
 	//cout<<"Before FHOG SSE"<<endl;
-	fhogSSE(M, O, H, h, w, hParams.binSize, hParams.nOrients, hParams.softBin, hParams.clipHog);
+	fhogSSE(M, O, H, h, w, binSize, hParams.nOrients, hParams.softBin, hParams.clipHog);
 	//cout<<"After FHOG SSE"<<endl;
 	cv::Mat GrayRes;
 	if(!scaling)
@@ -924,10 +911,7 @@ cv::Mat DSST::get_rot_sample(cv::Mat img, trackingSetup tSetup, DSSTParams tPara
 			cv::waitKey();
 		}
 	}
-	cv::Mat featureMapTempDouble;
-	featureMapRot.convertTo(featureMapTempDouble, CV_64FC1);
-
-	cv::Mat feature_map_rot_fourier_temp = createFourier(featureMapTempDouble, cv::DFT_ROWS);
+	cv::Mat feature_map_rot_fourier_temp = createFourier(featureMapRot, cv::DFT_ROWS);
 
 	nDims = tParams.number_rots;
 
@@ -941,9 +925,10 @@ cv::Mat DSST::get_scale_sample(cv::Mat img, trackingSetup tSetup, DSSTParams tPa
 	CvRect patchSize;
 
 	cv::Mat roiGray;
-	cv::Mat roiResized;
 	cv::Mat feature_map_scale_fourier;
-	for(int i = 0; i < tParams.number_scales; i++)
+	//each scale fills its own column of the samples so all but the first one,
+	//which allocates them, are extracted in parallel
+	auto getScaleSample = [&](int i)
 	{
 		float pw = tSetup.scaleFactors[i] * tSetup.current_scale_factor*tSetup.original.width;
 		float ph = tSetup.scaleFactors[i] * tSetup.current_scale_factor*tSetup.original.height;
@@ -971,6 +956,7 @@ cv::Mat DSST::get_scale_sample(cv::Mat img, trackingSetup tSetup, DSSTParams tPa
 			interpolation = cv::INTER_LINEAR;
 		else
 			interpolation = cv::INTER_AREA;
+		cv::Mat roiResized;
 		resize(roi, roiResized, cv::Size(tSetup.scale_model_sz.width, tSetup.scale_model_sz.height), 0, 0, interpolation);
 		int nChns;
 		cv::Mat m = cv::Mat();
@@ -1000,11 +986,17 @@ cv::Mat DSST::get_scale_sample(cv::Mat img, trackingSetup tSetup, DSSTParams tPa
 			imshow("roi", roi);
 			cv::waitKey();
 		}
+	};
+	getScaleSample(0);
+	if(display)
+	{
+		for(int i = 1; i < tParams.number_scales; i++)
+			getScaleSample(i);
+	} else
+	{
+		cf_fft::parallelFor(1, tParams.number_scales, getScaleSample);
 	}
-	cv::Mat featureMapTempDouble;
-	featureMapScale.convertTo(featureMapTempDouble, CV_64FC1);
-
-	cv::Mat feature_map_scale_fourier_temp = createFourier(featureMapTempDouble, cv::DFT_ROWS);
+	cv::Mat feature_map_scale_fourier_temp = createFourier(featureMapScale, cv::DFT_ROWS);
 
 	nDims = tParams.number_scales;
 
@@ -1085,11 +1077,9 @@ void DSST::train(bool first, cv::Mat img, bool original)//false when called from
 	den = cv::Mat::zeros(feature_map[0].rows, feature_map[0].cols, CV_64FC2);
 
 //	cout<<"Feature Map Fourier Translation"<<endl;
+	cf_fft::dft(feature_map, feature_map_fourier, nDims);
 	for(int i = 0; i < nDims; i++)
 	{
-		cv::Mat feature_map_double(feature_map[i].rows, feature_map[i].cols, CV_64FC1);
-		feature_map[i].convertTo(feature_map_double, CV_64FC1);
-		feature_map_fourier[i] = createFourier(feature_map_double);
 		mulSpectrums(tSetup.transFourier, feature_map_fourier[i], num[i], 0, true);
 
 		cv::Mat temp;
@@ -1331,13 +1321,7 @@ cv::RotatedRect DSST::processFrame(cv::Mat img, bool enableScaling, bool enableR
 	int nDims = 0;
 	cv::Mat *feature_map = get_translation_sample(img, tSetup, nDims);
 	cv::Mat *feature_map_fourier = new cv::Mat[nDims];
-
-	for(int i = 0; i < nDims; i++)
-	{
-		cv::Mat feature_map_double(feature_map[i].rows, feature_map[i].cols, CV_64FC1);
-		feature_map[i].convertTo(feature_map_double, CV_64FC1);
-		feature_map_fourier[i] = createFourier(feature_map_double);
-	}
+	cf_fft::dft(feature_map, feature_map_fourier, nDims);
 
 	cv::Mat* temp = new cv::Mat[nDims];
 	for(int i = 0; i < nDims; i++)
@@ -1505,8 +1489,9 @@ void DSST::preprocess(cv::Mat img, cv::RotatedRect bb)
     tSetup.original_rot= bb.angle;
 	//0- Preprocessing
 	//A- Create Translation Gaussian Filters
-	tSetup.padded.width = floor(tSetup.original.width * (1 + tParams.padding));
-	tSetup.padded.height = floor(tSetup.original.height * (1 + tParams.padding));
+	//the padded window is enlarged to the nearest size that the DFT handles efficiently
+	tSetup.padded.width = cf_fft::getOptimalSize(floor(tSetup.original.width * (1 + tParams.padding)), tParams.bin_size);
+	tSetup.padded.height = cf_fft::getOptimalSize(floor(tSetup.original.height * (1 + tParams.padding)), tParams.bin_size);
 	int szPadding_w = tSetup.padded.width / tParams.bin_size;
 	int szPadding_h = tSetup.padded.height / tParams.bin_size;
 
@@ -9,5 +9,5 @@ THIRD_PARTY_TRACKERS += KCF
 THIRD_PARTY_HEADERS += ${KCF_HEADERS}
 THIRD_PARTY_INCLUDE_DIRS += ${KCF_INCLUDE_DIR}
 
-${BUILD_DIR}/KCF.o: ${KCF_SRC_DIR}/KCF.cc ${KCF_HEADERS} ${DSST_HEADER_DIR}/HOG.h ${DSST_HEADER_DIR}/sse.hpp ${DSST_HEADER_DIR}/wrappers.h ${UTILITIES_HEADER_DIR}/miscUtils.h ${MACROS_HEADER_DIR}/common.h ${ROOT_HEADER_DIR}/TrackerBase.h
+${BUILD_DIR}/KCF.o: ${KCF_SRC_DIR}/KCF.cc ${KCF_HEADERS} ${DSST_HEADER_DIR}/HOG.h ${DSST_HEADER_DIR}/FFT.h ${DSST_HEADER_DIR}/sse.hpp ${DSST_HEADER_DIR}/wrappers.h ${UTILITIES_HEADER_DIR}/miscUtils.h ${MACROS_HEADER_DIR}/common.h ${ROOT_HEADER_DIR}/TrackerBase.h
 	${CXX} -c ${MTF_PIC_FLAG} ${WARNING_FLAGS} ${OPT_FLAGS_DSST} ${MTF_COMPILETIME_FLAGS} $< ${OPENCV_FLAGS} -I${KCF_INCLUDE_DIR} -I${DSST_INCLUDE_DIR} -I${UTILITIES_INCLUDE_DIR} -I${MACROS_INCLUDE_DIR} -I${ROOT_INCLUDE_DIR} -o $@
\ No newline at end of file
@@ -14,6 +14,7 @@
 #include "mtf/ThirdParty/KCF/KCF.h"
 #include "mtf/ThirdParty/KCF/defines.h"
 #include "mtf/ThirdParty/DSST//HOG.h"
+#include "mtf/ThirdParty/DSST/FFT.h"
 
 #include "mtf/Utilities/miscUtils.h"
 
@@ -260,12 +261,7 @@ Point KCF::displayFloat(Mat img)
 
 void KCF::createFourier(cv::Mat original, cv::Mat& complexI, int flag)
 {
-	Mat planes[] =
-	{ Mat_<double>(original), Mat::zeros(original.size(), CV_64F) };
-
-	cv::merge(planes, 2, complexI);
-	cv::dft(complexI, complexI, flag);  // Applying DFT without padding
-	//cout << "Fourier" << endl;
+	cf_fft::dft(original, complexI, flag);
 }
 void KCF::gaussian_shaped_labels(double sigma, int sz_w, int sz_h, Mat& shiftedFilter)
 {
@@ -433,29 +429,21 @@ void KCF::gaussian_correlation(Mat* xf, Mat* yf, int nChns, double sigma, Mat &
 	xx /= (w * h);
 	yy /= (w * h);
 	//cout << xx << "  " << yy << endl;
-	Mat *xyf = new Mat[nChns];
-	Mat corr = cv::Mat::zeros(h, w, CV_64FC1);
+	// the inverse transform is linear so the cross spectra of all channels are summed first
+	// and only their sum is transformed back
+	Mat xyf_sum = cv::Mat::zeros(h, w, CV_64FC2), xyf;
 	for (int ch = 0; ch < nChns; ch++)
 	{
-		mulSpectrums(xf[ch], yf[ch], xyf[ch], 0, true);
-		inverseFourier(xyf[ch], xyf[ch]);
+		mulSpectrums(xf[ch], yf[ch], xyf, 0, true);
+		xyf_sum += xyf;
 	}
-	/*
-	 for (int i = 0; i < nChns; i++)
-	 for (int k = 0; k < w; k++)
-	 for (int j = 0; j < h; j++)
-	 fout << fixed << setprecision(4) << xyf[i].at<double>(j, k) << endl;*/
-
-	for (int i = 0; i < nChns; i++)
-		corr += xyf[i];
-	/*	for (int k = 0; k < w; k++)
-	 for (int j = 0; j < h; j++)
-	 fout << fixed << setprecision(4) << corr.at<double>(j, k) << endl;*/
+	Mat corr;
+	inverseFourier(xyf_sum, corr);
 
 	corr *= -2;
 	corr += xx + yy;
 	corr /= (w * h * nChns);
-	max(corr, 0);
+	corr = cv::max(corr, 0);
 	corr *= (-1 / (sigma * sigma));
 	exp(corr, corr);
 
@@ -477,7 +465,6 @@ void KCF::gaussian_correlation(Mat* xf, Mat* yf, int nChns, double sigma, Mat &
 	 }
 	 }
 	 fout.close();*/
-	delete[] xyf;
 }
 void KCF::train(Mat img, bool first)
 {
@@ -524,7 +511,7 @@ void KCF::train(Mat img, bool first)
 	feature_map_fourier = new Mat[nChns];
 //cout<<"Feature Map Fourier Translation"<<endl;
 	double trainFourier;
-	timeOfBlock( for (int i = 0; i < nChns; i++) createFourier(feature_map[i],feature_map_fourier[i] );, trainFourier);
+	timeOfBlock( cf_fft::dft(feature_map, feature_map_fourier, nChns);, trainFourier);
 	trainTime += trainFourier;
 
 	/*freopen("log.txt", "wt", stdout);
@@ -687,9 +674,10 @@ Mat KCF::get_scale_sample(Mat img, int &nDims, bool display)
 	CvRect patchSize;
 
 	Mat roiGray;
-	Mat roiResized;
 	Mat feature_map_scale_fourier;
-	for (int i = 0; i < tParams.number_scales; i++)
+	// each scale writes its own column of the samples matrix so all but the first,
+	// which allocates the matrix, are extracted in parallel
+	auto getScaleSample = [&](int i)
 	{
 		//Create Patch
 		float pw = tSetup.scaleFactors[i] * tSetup.current_scale_factor * tSetup.original.width;
@@ -720,6 +708,7 @@ Mat KCF::get_scale_sample(Mat img, int &nDims, bool display)
 			interpolation = INTER_LINEAR;
 		else
 			interpolation = INTER_AREA;
+		Mat roiResized;
 		resize(roi, roiResized, cv::Size(tSetup.scale_model_sz.width, tSetup.scale_model_sz.height), 0, 0, interpolation);
 		if (display)
 		{
@@ -751,6 +740,16 @@ Mat KCF::get_scale_sample(Mat img, int &nDims, bool display)
 		}
 		delete[] featureMap;
 
+	};
+	getScaleSample(0);
+	if (display)
+	{
+		for (int i = 1; i < tParams.number_scales; i++)
+			getScaleSample(i);
+	}
+	else
+	{
+		cf_fft::parallelFor(1, tParams.number_scales, getScaleSample);
 	}
 
 	Mat feature_map_scale_fourier_temp;
@@ -770,8 +769,9 @@ void KCF::preprocess(Mat img, Point centroid, int w, int h)
 	tSetup.centroid.y = centroid.y;
 	tSetup.original = Size(w, h);
 
-	tSetup.padded.width = floor(tSetup.original.width * (1.0 + tParams.padding));
-	tSetup.padded.height = floor(tSetup.original.height * (1.0 + tParams.padding));
+	// the padded window is enlarged to the nearest size that the DFT handles efficiently
+	tSetup.padded.width = cf_fft::getOptimalSize(floor(tSetup.original.width * (1.0 + tParams.padding)), hParams.binSize);
+	tSetup.padded.height = cf_fft::getOptimalSize(floor(tSetup.original.height * (1.0 + tParams.padding)), hParams.binSize);
 
 	////////////////Localization Parameters/////////////////
 
@@ -879,7 +879,7 @@ Rect KCF::processFrame(cv::Mat img)
 	Mat *feature_map_fourier = new Mat[nChns];
 	double featuresFourier;
 	//cout<<"Feature Map Fourier Translation"<<endl;
-	timeOfBlock(for (int i = 0; i < nChns; i++) createFourier(feature_map[i], feature_map_fourier[i]) ;, featuresFourier);
+	timeOfBlock(cf_fft::dft(feature_map, feature_map_fourier, nChns);, featuresFourier);
 	totTime += featuresFourier;
 
 	double corrTime;
@@ -1,4 +1,4 @@
-set(MTF_UTILITIES histUtils warpUtils imgUtils miscUtils graphUtils spiUtils inputUtils preprocUtils objUtils)
+set(MTF_UTILITIES histUtils warpUtils imgUtils miscUtils graphUtils spiUtils inputUtils preprocUtils objUtils dbUtils profUtils cacheUtils)
 addPrefixAndSuffix("${MTF_UTILITIES}" "Utilities/src/" ".cc" MTF_UTILITIES_SRC)
 set(MTF_SRC ${MTF_SRC} ${MTF_UTILITIES_SRC})
 set(MTF_INCLUDE_DIRS ${MTF_INCLUDE_DIRS} Utilities/include)
@@ -7,8 +7,8 @@ UTILITIES_HEADER_DIR = ${UTILITIES_INCLUDE_DIR}/mtf/Utilities
 
 MTF_INCLUDE_DIRS += ${UTILITIES_INCLUDE_DIR}
 
-UTILITIES = imgUtils warpUtils histUtils miscUtils spiUtils inputUtils preprocUtils objUtils
-UTILITIES_HEADER_ONLY = excpUtils mexUtils
+UTILITIES = imgUtils warpUtils histUtils miscUtils spiUtils inputUtils preprocUtils objUtils dbUtils profUtils cacheUtils
+UTILITIES_HEADER_ONLY = excpUtils mexUtils queueUtils
 MTF_UTIL_OBJS = $(addprefix ${BUILD_DIR}/,$(addsuffix .o, ${UTILITIES}))
 MTF_UTIL_HEADERS = $(addprefix ${UTILITIES_HEADER_DIR}/, $(addsuffix .h, ${UTILITIES} ${UTILITIES_HEADER_ONLY}))
 
@@ -103,9 +103,18 @@ ${BUILD_DIR}/spiUtils.o: ${UTILITIES_SRC_DIR}/spiUtils.cc ${UTILITIES_HEADER_DIR
 ${BUILD_DIR}/inputUtils.o: ${UTILITIES_SRC_DIR}/inputUtils.cc ${UTILITIES_HEADER_DIR}/inputUtils.h  ${UTILITIES_HEADER_DIR}/excpUtils.h ${MACROS_HEADER_DIR}/common.h
 	${CXX} -c ${MTF_PIC_FLAG} ${WARNING_FLAGS} ${OPT_FLAGS} ${PROF_FLAGS} ${MTF_COMPILETIME_FLAGS} ${MTF_RUNTIME_FLAGS} ${MTF_INCLUDE_FLAGS} $< -o $@
 	
-${BUILD_DIR}/preprocUtils.o: ${UTILITIES_SRC_DIR}/preprocUtils.cc ${UTILITIES_HEADER_DIR}/preprocUtils.h ${UTILITIES_HEADER_DIR}/imgUtils.h  ${UTILITIES_HEADER_DIR}/excpUtils.h ${MACROS_HEADER_DIR}/common.h
+${BUILD_DIR}/preprocUtils.o: ${UTILITIES_SRC_DIR}/preprocUtils.cc ${UTILITIES_HEADER_DIR}/preprocUtils.h ${UTILITIES_HEADER_DIR}/cacheUtils.h ${UTILITIES_HEADER_DIR}/imgUtils.h  ${UTILITIES_HEADER_DIR}/excpUtils.h ${MACROS_HEADER_DIR}/common.h
 	${CXX} -c ${MTF_PIC_FLAG} ${WARNING_FLAGS} ${OPT_FLAGS} ${PROF_FLAGS} ${MTF_COMPILETIME_FLAGS} ${MTF_RUNTIME_FLAGS} ${MTF_INCLUDE_FLAGS} $< -o $@
 	
 ${BUILD_DIR}/objUtils.o: ${UTILITIES_SRC_DIR}/objUtils.cc ${UTILITIES_HEADER_DIR}/objUtils.h ${UTILITIES_HEADER_DIR}/inputUtils.h ${UTILITIES_HEADER_DIR}/excpUtils.h ${MACROS_HEADER_DIR}/common.h
 	${CXX} -c ${MTF_PIC_FLAG} ${WARNING_FLAGS} ${OPT_FLAGS} ${PROF_FLAGS} ${MTF_COMPILETIME_FLAGS}  ${MTF_RUNTIME_FLAGS} ${MTF_INCLUDE_FLAGS} $< -o $@
+	
+${BUILD_DIR}/dbUtils.o: ${UTILITIES_SRC_DIR}/dbUtils.cc ${UTILITIES_HEADER_DIR}/dbUtils.h ${MACROS_HEADER_DIR}/common.h
+	${CXX} -c ${MTF_PIC_FLAG} ${WARNING_FLAGS} ${OPT_FLAGS} ${PROF_FLAGS} ${MTF_COMPILETIME_FLAGS} ${MTF_RUNTIME_FLAGS} ${MTF_INCLUDE_FLAGS} $< -o $@
+
+${BUILD_DIR}/profUtils.o: ${UTILITIES_SRC_DIR}/profUtils.cc ${UTILITIES_HEADER_DIR}/profUtils.h ${UTILITIES_HEADER_DIR}/miscUtils.h ${MACROS_HEADER_DIR}/common.h
+	${CXX} -c ${MTF_PIC_FLAG} ${WARNING_FLAGS} ${OPT_FLAGS} ${PROF_FLAGS} ${MTF_COMPILETIME_FLAGS} ${MTF_RUNTIME_FLAGS} ${MTF_INCLUDE_FLAGS} $< -o $@
+
+${BUILD_DIR}/cacheUtils.o: ${UTILITIES_SRC_DIR}/cacheUtils.cc ${UTILITIES_HEADER_DIR}/cacheUtils.h ${UTILITIES_HEADER_DIR}/excpUtils.h ${MACROS_HEADER_DIR}/common.h
+	${CXX} -c ${MTF_PIC_FLAG} ${WARNING_FLAGS} ${OPT_FLAGS} ${PROF_FLAGS} ${MTF_COMPILETIME_FLAGS} ${MTF_INCLUDE_FLAGS} $< -o $@
 	
\ No newline at end of file
@@ -0,0 +1,83 @@
+#ifndef MTF_CACHE_UTILS_H
+#define MTF_CACHE_UTILS_H
+
+/**
+frame scoped cache of image pyramid levels and dense gradient images that are
+built lazily, at most once per frame, and shared by all the trackers, pyramidal composites
+and appearance models that are passed the frame or one of its levels
+*/
+
+#include "mtf/Macros/common.h"
+#include "opencv2/core/core.hpp"
+
+#include <memory>
+#include <mutex>
+#include <map>
+#include <vector>
+#include <string>
+
+_MTF_BEGIN_NAMESPACE
+namespace utils{
+	/**
+	the producer of the frame, e.g. PreProcBase, owns the cache and calls update whenever the contents
+	of the frame change while consumers find it from the cv::Mat passed to their setImage
+	using the data pointer that the frame and each pyramid level keep for the lifetime of the cache;
+	since every preprocessor with a distinct type owns its own cache, entries are effectively keyed
+	on the frame ID, pyramid level and preprocessing type
+	*/
+	class FrameCache : public std::enable_shared_from_this<FrameCache>{
+	public:
+		typedef std::shared_ptr<FrameCache> Ptr;
+		//! location of an image within a cache where level 0 is the frame itself
+		struct Entry{
+			Ptr cache;
+			double scale_factor;
+			int level;
+			Entry() : cache(nullptr), scale_factor(1), level(0){}
+		};
+		/**
+		the cache holds a reference to the frame so its data buffer remains valid as long as
+		any consumer holds the cache; the producer must write subsequent frames into the same buffer
+		*/
+		static Ptr create(const cv::Mat &frame, const std::string &type = "");
+		~FrameCache();
+		//! invalidates all the pyramid levels and gradients built for the previous frame
+		void update(int frame_id = -1);
+		int getFrameID() const{ return frame_id; }
+		const std::string& type() const{ return _type; }
+		/**
+		returns the given level of the pyramid whose successive levels are scaled by scale_factor,
+		building it along with all the ones below it if this has not been done for the current frame;
+		the returned image keeps its data buffer for the lifetime of the cache so it can be passed to setImage once
+		*/
+		const cv::Mat& getPyramidLevel(int level, double scale_factor);
+		/**
+		horizontal and vertical central difference gradients of the given level with replicated borders,
+		computed at the same time for both directions; only single channel floating point frames are supported
+		*/
+		void getGradient(cv::Mat &grad_x, cv::Mat &grad_y, int level = 0, double scale_factor = 1);
+		//! returns the cache and level that the image belongs to or an entry with a null cache if it does not belong to any
+		static Entry find(const cv::Mat &img);
+
+	private:
+		struct Level{
+			cv::Mat img, grad_x, grad_y;
+			//! generation of the frame for which the image and the gradients were last built
+			unsigned int img_gen, grad_gen;
+			Level() : img_gen(0), grad_gen(0){}
+		};
+		std::mutex mutex;
+		std::string _type;
+		int frame_id;
+		unsigned int generation;
+		Level base;
+		//! levels above the base indexed by their scale factor
+		std::map<double, std::vector<std::unique_ptr<Level>>> pyramids;
+
+		FrameCache(const cv::Mat &frame, const std::string &type);
+		Level& getLevel(int level, double scale_factor);
+		void registerImage(const cv::Mat &img, double scale_factor, int level);
+	};
+}
+_MTF_END_NAMESPACE
+#endif
@@ -0,0 +1,84 @@
+#ifndef MTF_DB_UTILS_H
+#define MTF_DB_UTILS_H
+
+/**
+single file on-disk format for the sample databases and graph indexes used by the NN search methods
+*/
+
+#include "mtf/Macros/common.h"
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+_MTF_BEGIN_NAMESPACE
+namespace utils{
+	//! precision in which the distance features are stored in the database
+	enum class DBFeatType{ Float64, Float32, Float16, UInt8 };
+	const char* toString(DBFeatType feat_type);
+
+	/**
+	database of the distance features of the samples, the SSM perturbations used for generating them
+	and the neighbours of each sample in the search graph, all stored in a single file
+	in 64 byte aligned sections that is memory mapped when opened rather than read into memory
+	so that loading is almost instant and the pages are shared between all trackers and processes using it;
+	the features can be stored in half or single precision or quantized to 8 bits per dimension
+	using a per dimension offset and scale to reduce the file size, in which case they are decoded on access;
+	all values are stored in the byte order of the machine that wrote the file
+	*/
+	class NNDatabase{
+	public:
+		NNDatabase();
+		~NNDatabase();
+		NNDatabase(const NNDatabase&) = delete;
+		NNDatabase& operator=(const NNDatabase&) = delete;
+		/**
+		features and perturbations have one row per sample in row major order;
+		the neighbours of sample i in the graph are node_nbrs[node_offsets[i]] to node_nbrs[node_offsets[i+1] - 1]
+		and the graph is not written if node_offsets is empty;
+		returns false if the file could not be written
+		*/
+		static bool write(const std::string &file_path, DBFeatType feat_type,
+			const double *features, int n_samples, int feat_size,
+			const double *perturbations, int state_size,
+			const std::vector<int64_t> &node_offsets, const std::vector<int> &node_nbrs);
+		//! returns false if the file does not exist or is not a valid database
+		bool open(const std::string &file_path);
+		void close();
+		bool isOpen() const{ return header != nullptr; }
+
+		int getNSamples() const;
+		int getFeatSize() const;
+		int getStateSize() const;
+		DBFeatType getFeatType() const;
+		bool hasGraph() const;
+		/**
+		returns the features of the given sample which point directly into the mapped file
+		if these are stored in double precision and are otherwise decoded into the provided buffer
+		that must have space for getFeatSize() values
+		*/
+		const double* getFeatures(int sample_id, double *buffer) const;
+		const double* getPerturbation(int sample_id) const;
+		int getNNbrs(int sample_id) const;
+		const int* getNbrs(int sample_id) const;
+
+	private:
+		struct Header;
+		const Header *header;
+		const unsigned char *data;
+		size_t data_size;
+#ifdef _WIN32
+		//! memory mapping is not supported on Windows so the file is read into this instead
+		std::vector<unsigned char> file_data;
+#endif
+		//! offset and scale for each dimension of quantized features
+		const double *quant_offset, *quant_scale;
+		const double *perturbations;
+		const int64_t *node_offsets;
+		const int *node_nbrs;
+		const unsigned char *features;
+		size_t feat_stride;
+	};
+}
+_MTF_END_NAMESPACE
+#endif
@@ -5,6 +5,9 @@
 
 #include "mtf/Macros/common.h"
 #include "mtf/Utilities/excpUtils.h"
+#include "mtf/Utilities/miscUtils.h"
+
+#include <vector>
 
 // precomputed constants for BSpl function
 #define _1_BY_3 0.33333333333
@@ -303,6 +306,223 @@ namespace utils{
 		val = -(diff * temp) / 3;
 	}
 	/**
+	B Spline weights of degree 3 and their derivatives for all the bins that a pixel contributes to
+	precomputed for normalized pixel values quantized to n_steps levels per bin so that histograms can be
+	computed by looking these up instead of evaluating the spline for each bin of each pixel;
+	both ordinary and cumulative weights are stored along with the range of the contributing bins;
+	if n_steps is 0, the weights are computed exactly in the same way as the ordinary histogram functions;
+	*/
+	class BSpl3Table{
+	public:
+		BSpl3Table() : n_steps(0), max_entry_id(0){}
+		/**
+		std_bspl_ids(i, 0) and std_bspl_ids(i, 1) must be the first and last bins
+		contributed to by pixel values with integral part i
+		*/
+		void initialize(const MatrixX2i &_std_bspl_ids, int _n_steps);
+		bool isExact() const{ return n_steps <= 0; }
+		//! fill column pix_id of hist_mat and hist_grad with the weights and derivatives for pix_val
+		//! and row pix_id of bspl_ids with the range of the bins these are filled for
+		void getWeights(MatrixXd &hist_mat, MatrixXd &hist_grad, MatrixX2i &bspl_ids,
+			unsigned int pix_id, double pix_val) const{
+			if(isExact()){
+				bspl_ids.row(pix_id) = std_bspl_ids.row(static_cast<int>(pix_val));
+				double curr_diff = bspl_ids(pix_id, 0) - pix_val;
+				for(int bin_id = bspl_ids(pix_id, 0); bin_id <= bspl_ids(pix_id, 1); ++bin_id) {
+					bSpl3WithGrad(hist_mat(bin_id, pix_id), hist_grad(bin_id, pix_id), curr_diff);
+					++curr_diff;
+				}
+				return;
+			}
+			const Entry &entry = getEntry(pix_val);
+			bspl_ids(pix_id, 0) = entry.start_id;
+			bspl_ids(pix_id, 1) = entry.end_id;
+			for(int bin_id = entry.start_id, wt_id = 0; bin_id <= entry.end_id; ++bin_id, ++wt_id) {
+				hist_mat(bin_id, pix_id) = entry.val[wt_id];
+				hist_grad(bin_id, pix_id) = entry.grad[wt_id];
+			}
+		}
+		//! same as above without the derivatives
+		void getWeights(MatrixXd &hist_mat, MatrixX2i &bspl_ids,
+			unsigned int pix_id, double pix_val) const{
+			if(isExact()){
+				bspl_ids.row(pix_id) = std_bspl_ids.row(static_cast<int>(pix_val));
+				double curr_diff = bspl_ids(pix_id, 0) - pix_val;
+				for(int bin_id = bspl_ids(pix_id, 0); bin_id <= bspl_ids(pix_id, 1); ++bin_id) {
+					hist_mat(bin_id, pix_id) = bSpl3(curr_diff);
+					++curr_diff;
+				}
+				return;
+			}
+			const Entry &entry = getEntry(pix_val);
+			bspl_ids(pix_id, 0) = entry.start_id;
+			bspl_ids(pix_id, 1) = entry.end_id;
+			for(int bin_id = entry.start_id, wt_id = 0; bin_id <= entry.end_id; ++bin_id, ++wt_id) {
+				hist_mat(bin_id, pix_id) = entry.val[wt_id];
+			}
+		}
+		/**
+		weights along with the second derivatives of the cumulative weights;
+		the latter are the negated first derivatives of the weights so the table does not need to store them separately
+		*/
+		void getWeightsWithCumHess(MatrixXd &hist_mat, MatrixXd &cum_hist_hess, MatrixX2i &bspl_ids,
+			unsigned int pix_id, double pix_val) const{
+			if(isExact()){
+				bspl_ids.row(pix_id) = std_bspl_ids.row(static_cast<int>(pix_val));
+				double curr_diff = bspl_ids(pix_id, 0) - pix_val;
+				for(int bin_id = bspl_ids(pix_id, 0); bin_id <= bspl_ids(pix_id, 1); ++bin_id) {
+					hist_mat(bin_id, pix_id) = bSpl3(curr_diff);
+					cum_hist_hess(bin_id, pix_id) = cumBSpl3Hess(curr_diff);
+					++curr_diff;
+				}
+				return;
+			}
+			const Entry &entry = getEntry(pix_val);
+			bspl_ids(pix_id, 0) = entry.start_id;
+			bspl_ids(pix_id, 1) = entry.end_id;
+			for(int bin_id = entry.start_id, wt_id = 0; bin_id <= entry.end_id; ++bin_id, ++wt_id) {
+				hist_mat(bin_id, pix_id) = entry.val[wt_id];
+				cum_hist_hess(bin_id, pix_id) = -entry.grad[wt_id];
+			}
+		}
+		//! second derivatives of the cumulative weights without the weights themselves
+		void getCumHess(MatrixXd &cum_hist_hess, MatrixX2i &bspl_ids,
+			unsigned int pix_id, double pix_val) const{
+			if(isExact()){
+				bspl_ids.row(pix_id) = std_bspl_ids.row(static_cast<int>(pix_val));
+				double curr_diff = bspl_ids(pix_id, 0) - pix_val;
+				for(int bin_id = bspl_ids(pix_id, 0); bin_id <= bspl_ids(pix_id, 1); ++bin_id) {
+					cum_hist_hess(bin_id, pix_id) = cumBSpl3Hess(curr_diff);
+					++curr_diff;
+				}
+				return;
+			}
+			const Entry &entry = getEntry(pix_val);
+			bspl_ids(pix_id, 0) = entry.start_id;
+			bspl_ids(pix_id, 1) = entry.end_id;
+			for(int bin_id = entry.start_id, wt_id = 0; bin_id <= entry.end_id; ++bin_id, ++wt_id) {
+				cum_hist_hess(bin_id, pix_id) = -entry.grad[wt_id];
+			}
+		}
+		//! cumulative counterpart of getWeights that leaves the bins outside the range unchanged
+		void getCumWeights(MatrixXd &cum_hist_mat, MatrixXd &cum_hist_grad, MatrixX2i &bspl_ids,
+			unsigned int pix_id, double pix_val) const{
+			if(isExact()){
+				bspl_ids.row(pix_id) = std_bspl_ids.row(static_cast<int>(pix_val));
+				double curr_diff = bspl_ids(pix_id, 0) - pix_val;
+				for(int bin_id = bspl_ids(pix_id, 0); bin_id <= bspl_ids(pix_id, 1); ++bin_id) {
+					cumBSpl3WithGrad(cum_hist_mat(bin_id, pix_id), cum_hist_grad(bin_id, pix_id), curr_diff);
+					++curr_diff;
+				}
+				return;
+			}
+			const Entry &entry = getEntry(pix_val);
+			bspl_ids(pix_id, 0) = entry.start_id;
+			bspl_ids(pix_id, 1) = entry.end_id;
+			for(int bin_id = entry.start_id, wt_id = 0; bin_id <= entry.end_id; ++bin_id, ++wt_id) {
+				cum_hist_mat(bin_id, pix_id) = entry.cum_val[wt_id];
+				cum_hist_grad(bin_id, pix_id) = entry.cum_grad[wt_id];
+			}
+		}
+		//! same as above without the derivatives
+		void getCumWeights(MatrixXd &cum_hist_mat, MatrixX2i &bspl_ids,
+			unsigned int pix_id, double pix_val) const{
+			if(isExact()){
+				bspl_ids.row(pix_id) = std_bspl_ids.row(static_cast<int>(pix_val));
+				double curr_diff = bspl_ids(pix_id, 0) - pix_val;
+				for(int bin_id = bspl_ids(pix_id, 0); bin_id <= bspl_ids(pix_id, 1); ++bin_id) {
+					cum_hist_mat(bin_id, pix_id) = cumBSpl3(curr_diff);
+					++curr_diff;
+				}
+				return;
+			}
+			const Entry &entry = getEntry(pix_val);
+			bspl_ids(pix_id, 0) = entry.start_id;
+			bspl_ids(pix_id, 1) = entry.end_id;
+			for(int bin_id = entry.start_id, wt_id = 0; bin_id <= entry.end_id; ++bin_id, ++wt_id) {
+				cum_hist_mat(bin_id, pix_id) = entry.cum_val[wt_id];
+			}
+		}
+	private:
+		struct Entry{
+			int start_id, end_id;
+			double val[4], grad[4], cum_val[4], cum_grad[4];
+		};
+		int n_steps, max_entry_id;
+		MatrixX2i std_bspl_ids;
+		std::vector<Entry> entries;
+		const Entry& getEntry(double pix_val) const{
+			int entry_id = static_cast<int>(pix_val*n_steps + 0.5);
+			return entries[entry_id < 0 ? 0 : entry_id > max_entry_id ? max_entry_id : entry_id];
+		}
+	};
+	/**
+	splits the pixels into contiguous blocks that are processed in parallel by runWorkers
+	with each block accumulating into its own copies of the two outputs, e.g. a histogram and a joint histogram,
+	that are added to the actual outputs in block order after all the blocks are done so that
+	the result does not depend on the timing of the threads and there is no contention between them;
+	with a single block, everything is done serially directly in the actual outputs;
+	the blocks are run on a WorkerPool owned by the accumulator so that the threads are not created
+	on every call but waking them up still has a fixed cost so the number of blocks is limited
+	to ensure that each one has at least min_block_size pixels
+	*/
+	template<typename AccT1, typename AccT2>
+	class BlockAccumulator{
+	public:
+		BlockAccumulator() : n_blocks(1), block_starts(2, 0){}
+		static const unsigned int min_block_size = 1024;
+		void initialize(unsigned int n_pix, int _n_blocks){
+			n_blocks = _n_blocks > 1 ? std::min(static_cast<unsigned int>(_n_blocks), n_pix / min_block_size) : 1;
+			if(n_blocks < 1){ n_blocks = 1; }
+			block_starts.resize(n_blocks + 1);
+			for(int block_id = 0; block_id <= n_blocks; ++block_id){
+				block_starts[block_id] = static_cast<unsigned int>(
+					(static_cast<unsigned long long>(n_pix) * block_id) / n_blocks);
+			}
+			block_acc1.resize(n_blocks > 1 ? n_blocks : 0);
+			block_acc2.resize(n_blocks > 1 ? n_blocks : 0);
+		}
+		int getNBlocks() const{ return n_blocks; }
+		/**
+		calls proc(start_id, end_id, acc1, acc2) for the pixels in [start_id, end_id) of each block
+		where acc1 and acc2 are zero initialized copies of out1 and out2 that are added to these afterwards
+		*/
+		template<typename ProcT>
+		void accumulate(AccT1 &out1, AccT2 &out2, const ProcT &proc){
+			if(n_blocks <= 1){
+				proc(block_starts[0], block_starts[1], out1, out2);
+				return;
+			}
+			worker_pool.run(n_blocks, [&](unsigned int block_id){
+				block_acc1[block_id].setZero(out1.rows(), out1.cols());
+				block_acc2[block_id].setZero(out2.rows(), out2.cols());
+				proc(block_starts[block_id], block_starts[block_id + 1],
+					block_acc1[block_id], block_acc2[block_id]);
+			});
+			for(int block_id = 0; block_id < n_blocks; ++block_id){
+				out1 += block_acc1[block_id];
+				out2 += block_acc2[block_id];
+			}
+		}
+		//! calls proc(start_id, end_id) for each block for loops whose outputs are all per pixel
+		template<typename ProcT>
+		void run(const ProcT &proc){
+			if(n_blocks <= 1){
+				proc(block_starts[0], block_starts[1]);
+				return;
+			}
+			worker_pool.run(n_blocks, [&](unsigned int block_id){
+				proc(block_starts[block_id], block_starts[block_id + 1]);
+			});
+		}
+	private:
+		int n_blocks;
+		std::vector<unsigned int> block_starts;
+		std::vector<AccT1> block_acc1;
+		std::vector<AccT2> block_acc2;
+		WorkerPool worker_pool;
+	};
+	/**
 	computes histogram using the Dirac delta function to determine the bins to which each pixel contributes,
 	i.e. each pixel has a unit contribution to the bin corresponding to the floor (or nearest integer) of its value;
 	this method of computing histograms is fast but not differentiable
@@ -458,6 +678,13 @@ namespace utils{
 		const VectorXd &pix_vals, const MatrixX2i &std_bspl_ids,
 		double pre_seed, int n_pix, double hist_norm_mult
 		);
+	//! same as above with the weights of each pixel obtained from a precomputed table
+	void getBSplHistWithGrad(
+		VectorXd &hist, MatrixXd &hist_mat,
+		MatrixXd &hist_grad, MatrixX2i &bspl_ids,
+		const VectorXd &pix_vals, const BSpl3Table &bspl_table,
+		double pre_seed, int n_pix, double hist_norm_mult
+		);
 	//! computes both the histogram and gradient of the first image as well as the joint histogram and its gradient
 	//! w.r.t. the first image assuming that the histogram of the second image has already been computed
 	void getBSplJointHistWithGrad(
@@ -160,6 +160,15 @@ namespace utils{
 		unsigned int frame_count, double alpha, bool use_running_avg, unsigned int n_pix,
 		unsigned int h, unsigned int w, double norm_mult, double norm_add);
 
+	/**
+	extracts the pixel values together with the warp of the image gradient, both at the given points, in a single pass;
+	when the whole patch lies inside the image, all the samples for each pixel are bilinearly interpolated 
+	without any border checks and the 4 offset samples used for the gradient are processed together
+	*/
+	void getPixValsWithGrad(VectorXd &pix_vals, PixGradT &img_grad,
+		const EigImgT &img, const PtsT &pts, double grad_eps, unsigned int n_pix,
+		unsigned int h, unsigned int w, double norm_mult = 1, double norm_add = 0);
+
 	/************ functions for image gradient and Hessian ************/
 	void getWarpedImgGrad(PixGradT &warped_img_grad,
 		const EigImgT &img, const Matrix8Xd &warped_offset_pts,
@@ -178,6 +187,11 @@ namespace utils{
 		const EigImgT &img, const PtsT &pts,
 		double grad_eps, unsigned int n_pix, unsigned int h, unsigned int w,
 		double pix_mult_factor = 1.0);
+	//! warp of the image gradient interpolated at the given points from precomputed dense gradient images
+	//! of the same size as the image so that only 2 samples are needed for each pixel instead of 4
+	void getImgGrad(PixGradT &img_grad, const EigImgT &grad_x, const EigImgT &grad_y,
+		const PtsT &pts, unsigned int n_pix, unsigned int h, unsigned int w,
+		double pix_mult_factor = 1.0);
 	// mapping enabled version
 	template<InterpType mapping_type>
 	void getImgGrad(PixGradT &img_grad, const EigImgT &img,
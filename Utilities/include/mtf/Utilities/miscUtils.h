@@ -3,6 +3,21 @@
 
 #include "mtf/Macros/common.h"
 
+#include <exception>
+#include <vector>
+#include <atomic>
+#include <numeric>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#ifdef ENABLE_TBB
+#include "tbb/parallel_for.h"
+#include "tbb/blocked_range.h"
+#include "tbb/partitioner.h"
+#endif
+
 #ifndef DISABLE_VISP
 #include <visp3/core/vpImage.h>
 #include <visp3/core/vpColor.h>
@@ -530,6 +545,188 @@ namespace utils{
 	//! stack_order :: 0: row major 1 : column major
 	cv::Mat stackImages(const std::vector<cv::Mat> &img_list, int stack_order = 0);
 	std::string getDateTime();
+	/**
+	calls worker(worker_id) for each worker_id in [0, n_workers) concurrently and returns
+	when all of them have finished; OpenMP is used if it is enabled and std::thread otherwise
+	with the calling thread running the first worker;
+	any exception thrown by a worker is rethrown in the calling thread
+	*/
+	template<typename WorkerT>
+	inline void runWorkers(unsigned int n_workers, const WorkerT &worker){
+		std::vector<std::exception_ptr> worker_excp(n_workers);
+		auto run_worker = [&](unsigned int worker_id){
+			try{
+				worker(worker_id);
+			} catch(...){
+				worker_excp[worker_id] = std::current_exception();
+			}
+		};
+#ifdef ENABLE_OMP
+#pragma omp parallel for schedule(static, 1) num_threads(n_workers)
+		for(int worker_id = 0; worker_id < static_cast<int>(n_workers); ++worker_id){
+			run_worker(worker_id);
+		}
+#else
+		std::vector<std::thread> worker_threads;
+		for(unsigned int worker_id = 1; worker_id < n_workers; ++worker_id){
+			worker_threads.emplace_back(run_worker, worker_id);
+		}
+		if(n_workers > 0){ run_worker(0); }
+		for(auto &worker_thread : worker_threads){ worker_thread.join(); }
+#endif
+		for(unsigned int worker_id = 0; worker_id < n_workers; ++worker_id){
+			if(worker_excp[worker_id]){ std::rethrow_exception(worker_excp[worker_id]); }
+		}
+	}
+	/**
+	calls task(task_id) for each task_id in [0, task_costs.size()) with the tasks picked up by the threads
+	one at a time as they become free in decreasing order of their costs so that expensive tasks are
+	started first and the cheap ones fill in the gaps at the end instead of leaving threads idle;
+	task_costs is updated with a running average of the measured time of each task so it can be passed
+	unchanged to the next call for tasks that are run repeatedly like the component trackers of a composite;
+	TBB work stealing is used if it is enabled and runWorkers with n_workers threads otherwise
+	with the tasks being run serially in their natural order if n_workers is 1 or less
+	*/
+	template<typename TaskT>
+	inline void runTasksByCost(unsigned int n_workers, std::vector<double> &task_costs, const TaskT &task){
+		const int n_tasks = static_cast<int>(task_costs.size());
+		auto run_task = [&](int task_id){
+			//! wall time since the process CPU time used by mtf_clock_get includes the other threads
+			auto task_start_time = std::chrono::steady_clock::now();
+			task(task_id);
+			double task_time = std::chrono::duration<double>(
+				std::chrono::steady_clock::now() - task_start_time).count();
+			task_costs[task_id] = task_costs[task_id] > 0 ? (task_costs[task_id] + task_time) / 2.0 : task_time;
+		};
+#ifndef ENABLE_TBB
+		if(n_workers <= 1 || n_tasks <= 1){
+			for(int task_id = 0; task_id < n_tasks; ++task_id){ run_task(task_id); }
+			return;
+		}
+#endif
+		std::vector<int> task_order(n_tasks);
+		std::iota(task_order.begin(), task_order.end(), 0);
+		//! tasks with the same cost, as in the first call, are started in their natural order
+		std::stable_sort(task_order.begin(), task_order.end(), [&](int task_id1, int task_id2){
+			return task_costs[task_id1] > task_costs[task_id2];
+		});
+#ifdef ENABLE_TBB
+		tbb::parallel_for(tbb::blocked_range<int>(0, n_tasks, 1),
+			[&](const tbb::blocked_range<int> &range){
+			for(int order_id = range.begin(); order_id != range.end(); ++order_id){
+				run_task(task_order[order_id]);
+			}
+		}, tbb::simple_partitioner());
+#else
+		std::atomic<int> next_order_id(0);
+		runWorkers(std::min(n_workers, static_cast<unsigned int>(n_tasks)), [&](unsigned int){
+			for(int order_id = next_order_id++; order_id < n_tasks; order_id = next_order_id++){
+				run_task(task_order[order_id]);
+			}
+		});
+#endif
+	}
+	/**
+	runs workers like runWorkers but, unless OpenMP is enabled, on threads that are created
+	the first time they are needed and then kept waiting for the next call instead of being
+	created and joined every time, which is only affordable for calls that do a lot of work each;
+	the calling thread runs the first worker as before;
+	copies get their own threads and run must not be called concurrently on the same pool
+	*/
+	class WorkerPool{
+	public:
+		WorkerPool() : n_active(0), n_pending(0), generation(0), stop(false),
+			task_ctx(nullptr), task_fn(nullptr){}
+		WorkerPool(const WorkerPool&) : WorkerPool(){}
+		WorkerPool& operator=(const WorkerPool&){ return *this; }
+		~WorkerPool(){
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				stop = true;
+			}
+			start_cv.notify_all();
+			for(auto &worker_thread : worker_threads){ worker_thread.join(); }
+		}
+		template<typename WorkerT>
+		void run(unsigned int n_workers, const WorkerT &worker){
+#ifdef ENABLE_OMP
+			runWorkers(n_workers, worker);
+#else
+			if(n_workers <= 1){
+				if(n_workers == 1){ worker(0); }
+				return;
+			}
+			worker_excp.assign(n_workers, nullptr);
+			auto run_worker = [&](unsigned int worker_id){
+				try{
+					worker(worker_id);
+				} catch(...){
+					worker_excp[worker_id] = std::current_exception();
+				}
+			};
+			typedef decltype(run_worker) RunWorkerT;
+			while(worker_threads.size() < n_workers - 1){
+				unsigned int thread_id = static_cast<unsigned int>(worker_threads.size());
+				worker_threads.emplace_back([this, thread_id]{ threadLoop(thread_id + 1); });
+			}
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				task_ctx = &run_worker;
+				task_fn = [](const void *ctx, unsigned int worker_id){
+					(*static_cast<const RunWorkerT*>(ctx))(worker_id);
+				};
+				n_active = n_workers;
+				n_pending = n_workers - 1;
+				++generation;
+			}
+			start_cv.notify_all();
+			run_worker(0);
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				done_cv.wait(lock, [this]{ return n_pending == 0; });
+				task_ctx = nullptr;
+				task_fn = nullptr;
+			}
+			for(unsigned int worker_id = 0; worker_id < n_workers; ++worker_id){
+				if(worker_excp[worker_id]){ std::rethrow_exception(worker_excp[worker_id]); }
+			}
+#endif
+		}
+	private:
+		std::vector<std::thread> worker_threads;
+		std::vector<std::exception_ptr> worker_excp;
+		std::mutex mutex;
+		std::condition_variable start_cv, done_cv;
+		unsigned int n_active, n_pending;
+		unsigned long long generation;
+		bool stop;
+		//! type erased reference to the current call's worker so that running it does not allocate
+		const void *task_ctx;
+		void(*task_fn)(const void*, unsigned int);
+
+		void threadLoop(unsigned int worker_id){
+			unsigned long long seen_generation = 0;
+			for(;;){
+				const void *ctx;
+				void(*fn)(const void*, unsigned int);
+				{
+					std::unique_lock<std::mutex> lock(mutex);
+					start_cv.wait(lock, [&]{ return stop || generation != seen_generation; });
+					if(stop){ return; }
+					seen_generation = generation;
+					if(worker_id >= n_active){ continue; }
+					ctx = task_ctx;
+					fn = task_fn;
+				}
+				fn(ctx, worker_id);
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					--n_pending;
+				}
+				done_cv.notify_one();
+			}
+		}
+	};
 
 }
 _MTF_END_NAMESPACE
@@ -9,8 +9,12 @@ before using it for tracking
 
 #include "mtf/Utilities/excpUtils.h"
 #include "mtf/Utilities/imgUtils.h"
+#include "mtf/Utilities/cacheUtils.h"
 #include "opencv2/imgproc/imgproc.hpp"
 #include <memory>
+#include <map>
+#include <cmath>
+#include <algorithm>
 
 _MTF_BEGIN_NAMESPACE
 namespace utils{
@@ -33,9 +37,21 @@ namespace utils{
 		virtual void update(const cv::Mat &frame_raw, int _frame_id = -1){
 			if(_frame_id > 0 && frame_id == _frame_id){ return; }// this frame has already been processed
 			frame_id = _frame_id;
-			processFrame(frame_raw);
+			curr_frame_raw = frame_raw;
+			if(roiMode()){
+				processROIs();
+			} else{
+				processFrame(frame_raw);
+				valid_rois.assign(1, cv::Rect(0, 0, frame_raw.cols, frame_raw.rows));
+			}
+			if(frame_cache){ frame_cache->update(frame_id); }
 			if(next.get()){ next->update(frame_raw, _frame_id); }
 		}
+		/**
+		replaces the processed frame with one produced by an identical pre processor elsewhere,
+		e.g. in a separate thread, with the same effect as calling update with the corresponding raw frame
+		*/
+		virtual void setProcessedFrame(const cv::Mat &processed, int _frame_id);
 		virtual const cv::Mat& getFrame(){
 			return resize_images ? frame_resized : rgb_output ? frame_rgb : frame_gs;
 		}
@@ -46,6 +62,31 @@ namespace utils{
 		virtual int getFrameID() const{ return frame_id; }
 		virtual int getWidth() { return getFrame().cols; }
 		virtual int getHeight() { return getFrame().rows; }
+		//! pyramid levels and gradients of the processed frame shared by all trackers using it
+		const FrameCache::Ptr& getFrameCache() const{ return frame_cache; }
+		/**
+		ROI restricted processing:
+		once at least one region has been registered, subsequent frames are only processed
+		within the bounding boxes of the registered regions expanded by roi_margin times their size on each side;
+		pixels outside these are left over from earlier frames and must not be sampled;
+		registering a region with an ID that already exists replaces it;
+		these apply to all the pre processors in the linked list
+		*/
+		void setROI(int roi_id, const cv::Mat &corners);
+		void removeROI(int roi_id);
+		void setROIMargin(double _roi_margin);
+		/**
+		makes sure that the region spanned by the given corners is valid in the current frame
+		by processing the missing part on demand;
+		returns true if anything had to be processed in which case any cached gradients or pyramids are also invalidated
+		*/
+		bool ensureROI(const cv::Mat &corners);
+		//! true if only the registered regions of the current frame have been processed
+		bool roiMode() const{
+			return !rois.empty() && !hist_eq && !resize_images && filterBorder() >= 0;
+		}
+		//! processes the entire current frame irrespective of the registered regions, e.g. for display
+		void processFullFrame();
 
 	protected:
 		cv::Mat frame_rgb, frame_gs, frame_rgb_uchar;
@@ -58,9 +99,25 @@ namespace utils{
 		const bool hist_eq;
 		//! unique ID to prevent creating duplicate pre processors with identical processing
 		std::string _type;
+		FrameCache::Ptr frame_cache;
+		//! header of the raw frame that is being processed so that regions can be added to it on demand
+		cv::Mat curr_frame_raw;
+		std::map<int, cv::Rect> rois;
+		std::vector<cv::Rect> valid_rois;
+		double roi_margin;
 
 		virtual void apply(cv::Mat &img_gs) const = 0;
 		virtual void processFrame(const cv::Mat &frame_raw);
+		/**
+		number of pixels on each side of a region that the filter reads to produce it;
+		a negative value means that the filter only supports processing the full frame
+		*/
+		virtual int filterBorder() const{ return 0; }
+		//! bounding box of the given corners expanded by the ROI margin and clipped to the frame
+		cv::Rect getROI(const cv::Mat &corners) const;
+		void processROIs();
+		//! processes a padded copy of the region in isolation and writes back only its interior
+		void processROI(const cv::Rect &roi);
 		void release();
 	};
 
@@ -71,6 +128,12 @@ namespace utils{
 		void apply(cv::Mat &img_gs) const override{
 			cv::GaussianBlur(img_gs, img_gs, kernel_size, sigma_x, sigma_y);
 		}
+	protected:
+		//! OpenCV derives the kernel size from sigma when it is not specified
+		int filterBorder() const override{
+			return std::max(std::max(kernel_size.width, kernel_size.height) / 2,
+				static_cast<int>(std::ceil(4 * std::max(sigma_x, sigma_y))));
+		}
 	private:
 		cv::Size kernel_size;
 		double sigma_x;
@@ -83,6 +146,8 @@ namespace utils{
 		void apply(cv::Mat &img_gs) const override{
 			cv::medianBlur(img_gs, img_gs, kernel_size);
 		}
+	protected:
+		int filterBorder() const override{ return kernel_size / 2; }
 	private:
 		int kernel_size;
 	};
@@ -93,6 +158,8 @@ namespace utils{
 		void apply(cv::Mat &img_gs) const override{
 			cv::blur(img_gs, img_gs, kernel_size);
 		}
+	protected:
+		int filterBorder() const override{ return std::max(kernel_size.width, kernel_size.height) / 2; }
 	private:
 		cv::Size kernel_size;
 	};
@@ -106,6 +173,11 @@ namespace utils{
 			//img_gs.copyTo(orig_img);
 			cv::bilateralFilter(orig_img, img_gs, diameter, sigma_col, sigma_space);
 		}
+	protected:
+		//! the radius is computed from sigma_space for non positive diameters
+		int filterBorder() const override{
+			return diameter > 0 ? diameter / 2 : static_cast<int>(std::round(sigma_space * 1.5));
+		}
 	private:
 		int diameter;
 		double sigma_col;
@@ -123,6 +195,9 @@ namespace utils{
 		}
 		void showFrame(std::string window_name) override;
 
+	protected:
+		//! the output has its own buffers so it is always processed in full
+		int filterBorder() const override{ return -1; }
 	private:
 		cv::Mat frame_out, frame_in;
 		cv::Mat grad_x, grad_y, grad;
@@ -137,6 +212,9 @@ namespace utils{
 		void apply(cv::Mat &img_gs) const override{
 			mtf::utils::anisotropicDiffusion(img_gs, lambda, k, n_iters);
 		}
+	protected:
+		//! each iteration uses the 8 neighbours of every pixel
+		int filterBorder() const override{ return static_cast<int>(n_iters); }
 	private:
 		double lambda;
 		double k;
@@ -162,6 +240,7 @@ namespace utils{
 				throw mtf::utils::InvalidArgument("NoPreProcessing::update : Input image location in memory has changed");
 			}
 			frame_id = _frame_id;
+			if(frame_cache){ frame_cache->update(frame_id); }
 		}
 		void apply(cv::Mat &img_gs) const override{}
 		const cv::Mat& getFrame() override{
@@ -0,0 +1,72 @@
+#ifndef MTF_PROF_UTILS_H
+#define MTF_PROF_UTILS_H
+
+/**
+stage profiler used by the init_timer / record_event macros in the search methods;
+it is always compiled in and switched on and off at runtime and, when off, the cost of
+each instrumented stage is a single relaxed atomic load
+*/
+
+#include "mtf/Macros/common.h"
+
+#include <atomic>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+_MTF_BEGIN_NAMESPACE
+namespace utils{
+	namespace prof{
+		//! maximum no. of distinct stage labels; stages registered after this are silently ignored
+		const int max_stages = 128;
+		/**
+		no. of bins in the latency histogram of each stage: the first one holds all intervals
+		shorter than 256 ns and each of the remaining ones a quarter of a power of two
+		so the relative error in the reported percentiles is at most 25 %
+		*/
+		const int n_bins = 128;
+
+		struct StageSummary{
+			std::string label;
+			uint64_t count;
+			//! all times are in seconds
+			double total, mean, p50, p90, p99, max;
+		};
+
+		//! exposed only so that isEnabled can be inlined at each instrumented stage
+		extern std::atomic<bool> _enabled;
+
+		inline bool isEnabled(){ return _enabled.load(std::memory_order_relaxed); }
+		/**
+		intervals that were being timed by any thread when the profiler is switched on
+		are discarded rather than being attributed to the next stage recorded by it
+		*/
+		void setEnabled(bool enabled);
+		//! returns the ID of the stage with this label, registering it if needed, or -1 if there are too many stages
+		int getStageId(const char *label);
+		//! starts timing a new sequence of stages in the calling thread
+		void startTimer();
+		/**
+		adds the time since the last call to startTimer or recordEvent in the calling thread
+		to the histogram of the given stage and restarts the timer;
+		each thread records into its own preallocated histograms so no locking is needed
+		*/
+		void recordEvent(int stage_id);
+
+		//! summary of all stages with at least one recorded interval in the order of their registration
+		std::vector<StageSummary> getSummary();
+		//! clears all the histograms without unregistering the stages
+		void reset();
+		/**
+		summaries are appended to this file every interval_secs seconds by update
+		if the profiler is enabled; an empty path or a non positive interval disables the periodic output
+		*/
+		void setOutput(const std::string &file_path, double interval_secs);
+		//! writes the summary to the file set by setOutput if the interval since the last write has elapsed
+		void update();
+		//! appends the summary to the given file or prints it to the terminal if this is empty
+		void writeSummary(const std::string &file_path);
+	}
+}
+_MTF_END_NAMESPACE
+#endif
@@ -0,0 +1,297 @@
+#ifndef MTF_QUEUE_UTILS_H
+#define MTF_QUEUE_UTILS_H
+
+/**
+thread safe containers for passing data between the stages of a pipeline
+running in separate threads
+*/
+
+#include "mtf/Macros/common.h"
+
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <thread>
+#include <memory>
+#include <climits>
+
+_MTF_BEGIN_NAMESPACE
+namespace utils{
+	/**
+	FIFO queue with a fixed capacity where push blocks while the queue is full
+	so that a fast producer is held back by a slow consumer and pop blocks while it is empty;
+	closing the queue wakes up all waiting threads after which push always fails
+	while pop keeps returning the remaining items before failing too
+	*/
+	template<typename ItemT>
+	class BoundedQueue{
+	public:
+		explicit BoundedQueue(unsigned int _capacity) :
+			capacity(_capacity > 0 ? _capacity : 1), closed(false){}
+		//! returns false without adding the item if the queue has been closed
+		bool push(ItemT item){
+			std::unique_lock<std::mutex> lock(mutex);
+			not_full.wait(lock, [this]{ return closed || items.size() < capacity; });
+			if(closed){ return false; }
+			items.push_back(std::move(item));
+			not_empty.notify_one();
+			return true;
+		}
+		//! returns false if the queue has been closed and no items are left in it
+		bool pop(ItemT &item){
+			std::unique_lock<std::mutex> lock(mutex);
+			not_empty.wait(lock, [this]{ return closed || !items.empty(); });
+			if(items.empty()){ return false; }
+			item = std::move(items.front());
+			items.pop_front();
+			not_full.notify_one();
+			return true;
+		}
+		void close(){
+			std::lock_guard<std::mutex> lock(mutex);
+			closed = true;
+			not_full.notify_all();
+			not_empty.notify_all();
+		}
+		unsigned int size(){
+			std::lock_guard<std::mutex> lock(mutex);
+			return static_cast<unsigned int>(items.size());
+		}
+		bool isClosed(){
+			std::lock_guard<std::mutex> lock(mutex);
+			return closed;
+		}
+	private:
+		const unsigned int capacity;
+		bool closed;
+		std::deque<ItemT> items;
+		std::mutex mutex;
+		std::condition_variable not_full, not_empty;
+	};
+	/**
+	fixed size ring of slots written by a single producer and read concurrently by multiple consumers
+	without any locks; every published item gets a sequence number and each slot is reference counted
+	so that the producer never overwrites an item that a consumer is still using;
+	when all the slots hold items that have not been read yet, the producer either overwrites the oldest
+	unreferenced one (DropOldest) so that consumers always get the latest item, or waits till every
+	registered consumer has read it (Block) so that consumers get every item in order;
+	waiting is done by yielding the thread so this is best suited to producers and consumers
+	that do a non trivial amount of work per item like reading and tracking frames
+	*/
+	template<typename ItemT>
+	class FrameRing{
+	public:
+		enum class Policy{ DropOldest, Block };
+		typedef long long SeqT;
+
+		//! reference to an item in the ring that keeps its slot from being overwritten till released
+		class Ref{
+		public:
+			Ref() : ring(nullptr), slot_id(0), seq(-1){}
+			Ref(Ref &&other) : ring(other.ring), slot_id(other.slot_id), seq(other.seq){
+				other.ring = nullptr;
+			}
+			Ref& operator=(Ref &&other){
+				if(this != &other){
+					release();
+					ring = other.ring;
+					slot_id = other.slot_id;
+					seq = other.seq;
+					other.ring = nullptr;
+				}
+				return *this;
+			}
+			Ref(const Ref&) = delete;
+			Ref& operator=(const Ref&) = delete;
+			~Ref(){ release(); }
+			const ItemT& get() const{ return ring->slots[slot_id].item; }
+			const ItemT* operator->() const{ return &get(); }
+			//! sequence number of the referenced item
+			SeqT getSeq() const{ return seq; }
+			bool isValid() const{ return ring != nullptr; }
+			void release(){
+				if(ring){
+					ring->slots[slot_id].ref_count.fetch_sub(1, std::memory_order_release);
+					ring = nullptr;
+				}
+			}
+		private:
+			friend class FrameRing;
+			const FrameRing *ring;
+			unsigned int slot_id;
+			SeqT seq;
+		};
+
+		FrameRing(unsigned int _n_slots, Policy _policy, unsigned int _max_consumers) :
+			n_slots(_n_slots > 2 ? _n_slots : 2), policy(_policy),
+			max_consumers(_max_consumers > 0 ? _max_consumers : 1),
+			slots(new Slot[n_slots]), cursors(new std::atomic<SeqT>[max_consumers]),
+			latest_seq(-1), latest_slot_id(0), closed(false){
+			for(unsigned int consumer_id = 0; consumer_id < max_consumers; ++consumer_id){
+				cursors[consumer_id].store(inactive, std::memory_order_relaxed);
+			}
+		}
+		/**
+		writer is called with the item in the slot to be overwritten so that its storage can be reused;
+		returns false if the ring has been closed
+		*/
+		template<typename WriterT>
+		bool publish(const WriterT &writer){
+			SeqT seq = latest_seq.load(std::memory_order_relaxed) + 1;
+			unsigned int slot_id;
+			while(!claimSlot(seq, slot_id)){
+				if(isClosed()){ return false; }
+				std::this_thread::yield();
+			}
+			Slot &slot = slots[slot_id];
+			writer(slot.item);
+			slot.seq.store(seq, std::memory_order_relaxed);
+			slot.ref_count.store(0, std::memory_order_release);
+			latest_slot_id.store(slot_id, std::memory_order_release);
+			latest_seq.store(seq, std::memory_order_release);
+			return true;
+		}
+		/**
+		returns the ID to be used by the consumer with acquire or -1 if the maximum no. of consumers are already registered;
+		a new consumer starts with the latest item
+		*/
+		int registerConsumer(){
+			SeqT seq = latest_seq.load(std::memory_order_acquire);
+			for(unsigned int consumer_id = 0; consumer_id < max_consumers; ++consumer_id){
+				SeqT expected = inactive;
+				if(cursors[consumer_id].compare_exchange_strong(expected, seq > 0 ? seq - 1 : -1)){
+					return static_cast<int>(consumer_id);
+				}
+			}
+			return -1;
+		}
+		void unregisterConsumer(int consumer_id){
+			cursors[consumer_id].store(inactive, std::memory_order_release);
+		}
+		/**
+		non blocking attempt to get the item that the consumer should process next which is the latest one
+		with DropOldest and the one following the last one it acquired with Block;
+		returns false if no such item is available yet
+		*/
+		bool tryAcquire(int consumer_id, Ref &ref){
+			SeqT cursor = cursors[consumer_id].load(std::memory_order_relaxed);
+			SeqT wanted = policy == Policy::Block ? cursor + 1 : latest_seq.load(std::memory_order_acquire);
+			if(wanted < 0 || wanted <= cursor || wanted > latest_seq.load(std::memory_order_acquire)){ return false; }
+			if(policy == Policy::Block && acquireSlot(static_cast<unsigned int>(wanted % n_slots), wanted, ref)){
+				cursors[consumer_id].store(wanted, std::memory_order_release);
+				return true;
+			}
+			//! the wanted item has been overwritten, e.g. because the consumer registered while the producer was waiting
+			if(!tryAcquireLatest(ref) || ref.getSeq() <= cursor){
+				ref.release();
+				return false;
+			}
+			cursors[consumer_id].store(ref.getSeq(), std::memory_order_release);
+			return true;
+		}
+		//! blocks till an item is available for the consumer and returns false only if the ring has been closed
+		bool acquire(int consumer_id, Ref &ref){
+			while(!tryAcquire(consumer_id, ref)){
+				if(isClosed()){ return false; }
+				std::this_thread::yield();
+			}
+			return true;
+		}
+		//! get the latest item without registering as a consumer; returns false if nothing has been published yet
+		bool tryAcquireLatest(Ref &ref) const{
+			for(;;){
+				SeqT seq = latest_seq.load(std::memory_order_acquire);
+				if(seq < 0){ return false; }
+				unsigned int slot_id = latest_slot_id.load(std::memory_order_acquire);
+				//! the slot must still hold an item at least as new as the one seen above
+				if(acquireSlot(slot_id, -1, ref)){
+					if(ref.getSeq() >= seq){ return true; }
+					ref.release();
+				}
+				std::this_thread::yield();
+			}
+		}
+		SeqT latestSeq() const{ return latest_seq.load(std::memory_order_acquire); }
+		//! wake up the producer and all consumers which then fail once no items are left for them
+		void close(){ closed.store(true, std::memory_order_release); }
+		bool isClosed() const{ return closed.load(std::memory_order_acquire); }
+
+	private:
+		struct Slot{
+			ItemT item;
+			std::atomic<SeqT> seq;
+			//! no. of consumers currently using this slot or -1 while it is being written
+			mutable std::atomic<int> ref_count;
+			Slot() : seq(-1), ref_count(0){}
+		};
+		static constexpr SeqT inactive = LLONG_MIN;
+
+		const unsigned int n_slots;
+		const Policy policy;
+		const unsigned int max_consumers;
+		std::unique_ptr<Slot[]> slots;
+		std::unique_ptr<std::atomic<SeqT>[]> cursors;
+		std::atomic<SeqT> latest_seq;
+		std::atomic<unsigned int> latest_slot_id;
+		std::atomic<bool> closed;
+
+		//! increment the reference count of the slot unless it is being written and check that it holds the wanted item
+		bool acquireSlot(unsigned int slot_id, SeqT wanted, Ref &ref) const{
+			const Slot &slot = slots[slot_id];
+			int ref_count = slot.ref_count.load(std::memory_order_relaxed);
+			do{
+				if(ref_count < 0){ return false; }
+			} while(!slot.ref_count.compare_exchange_weak(ref_count, ref_count + 1,
+				std::memory_order_acquire, std::memory_order_relaxed));
+			SeqT seq = slot.seq.load(std::memory_order_relaxed);
+			if(seq < 0 || (wanted >= 0 && seq != wanted)){
+				slot.ref_count.fetch_sub(1, std::memory_order_release);
+				return false;
+			}
+			ref = Ref();
+			ref.ring = this;
+			ref.slot_id = slot_id;
+			ref.seq = seq;
+			return true;
+		}
+		//! lock the slot where the item with the given sequence number is to be written
+		bool claimSlot(SeqT seq, unsigned int &slot_id){
+			if(policy == Policy::Block){
+				//! items are written in order so that consumers can find them from the sequence number alone
+				slot_id = static_cast<unsigned int>(seq % n_slots);
+				SeqT overwritten_seq = seq - n_slots;
+				for(unsigned int consumer_id = 0; consumer_id < max_consumers; ++consumer_id){
+					SeqT cursor = cursors[consumer_id].load(std::memory_order_acquire);
+					if(cursor != inactive && cursor < overwritten_seq){ return false; }
+				}
+				return lockSlot(slot_id);
+			}
+			//! the oldest unreferenced slot other than the one with the latest item is overwritten
+			unsigned int latest_id = latest_slot_id.load(std::memory_order_relaxed);
+			bool found = false;
+			SeqT oldest_seq = 0;
+			for(unsigned int curr_id = 0; curr_id < n_slots; ++curr_id){
+				if(latest_seq.load(std::memory_order_relaxed) >= 0 && curr_id == latest_id){ continue; }
+				if(slots[curr_id].ref_count.load(std::memory_order_relaxed) != 0){ continue; }
+				SeqT curr_seq = slots[curr_id].seq.load(std::memory_order_relaxed);
+				if(!found || curr_seq < oldest_seq){
+					slot_id = curr_id;
+					oldest_seq = curr_seq;
+					found = true;
+				}
+			}
+			return found && lockSlot(slot_id);
+		}
+		bool lockSlot(unsigned int slot_id){
+			int unused = 0;
+			if(!slots[slot_id].ref_count.compare_exchange_strong(unused, -1, std::memory_order_acquire)){
+				return false;
+			}
+			slots[slot_id].seq.store(-1, std::memory_order_relaxed);
+			return true;
+		}
+	};
+}
+_MTF_END_NAMESPACE
+#endif
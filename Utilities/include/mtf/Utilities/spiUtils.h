@@ -57,6 +57,17 @@ namespace utils{
 			void getMask(const PixValT &curr_pix_vals, VectorXb &init_spi_mask);
 		};
 	}
+	namespace spi{
+		/**
+		compacted list of the IDs of the active entries in the mask or of all n entries if it is null;
+		meant to be built once every time the mask changes so that the kernels using it
+		run over the dense subset of active pixels without checking the mask for each of them
+		*/
+		void getActiveIDs(std::vector<unsigned int> &active_ids, const bool *mask, unsigned int n);
+		//! gathers the rows corresponding to all channels of the active pixels into a dense matrix
+		void getActiveRows(MatrixXd &active_rows, const MatrixXd &mat,
+			const std::vector<unsigned int> &active_ids, unsigned int n_channels);
+	}
 	double getMean(const bool *spi_mask, const VectorXd &vec,
 		int vec_size);
 	//! columnwise mean
@@ -72,8 +83,23 @@ namespace utils{
 		const RowVectorXd &df_dIt, const MatrixXd &dIt_dp,
 		const RowVectorXd &df_dI0, const MatrixXd &dI0_dp,		
 		int n_pix, int n_channels);
+	//! variants that use the compacted list of active pixel IDs instead of the mask
+	//! mean over all channels of the active pixels
+	double getMean(const std::vector<unsigned int> &active_ids, const VectorXd &vec,
+		int n_channels);
+	//! columnwise mean over the rows of all channels of the active pixels
+	void getMean(RowVectorXd &mean_vec, const std::vector<unsigned int> &active_ids,
+		const MatrixXd &mat, int n_channels);
+	void getProd(RowVectorXd &df_dp, const std::vector<unsigned int> &active_ids,
+		const RowVectorXd &df_dI, const MatrixXd &dI_dp, int n_channels);
+	void getDiffOfProd(RowVectorXd &df_dp, const std::vector<unsigned int> &active_ids,
+		const RowVectorXd &df_dIt, const MatrixXd &dIt_dp,
+		const RowVectorXd &df_dI0, const MatrixXd &dI0_dp, int n_channels);
 	void expandMask(bool *out_mask, const bool *in_mask, int res_ratio_x,
 		int res_ratio_y, int in_resx, int in_resy, int out_resx, int out_resy);
+	//! keeps every sub_ratio-th pixel along each dimension of a resx x resy patch that is also active in in_mask, if any
+	void getSubsampledMask(bool *out_mask, const bool *in_mask, int sub_ratio,
+		int resx, int resy);
 
 }
 _MTF_END_NAMESPACE
@@ -138,7 +138,7 @@ namespace utils{
 	MatrixX2d computeTPS(const CornersT &in_corners, const CornersT &out_corners);
 	void applyTPS(PtsT &out_pts, const PtsT &in_pts,
 		const PtsT &control_pts, const MatrixX2d &tps_params);
-	inline double tps(double r){ return r*r*log(r); }
+	inline double tps(double r){ return r > 0 ? r*r*log(r) : 0; }
 
 	//void getSupportPoints(ProjWarpT &warp, PtsT &pts, HomPtsT &pts_hm, 
 	//	const CornersT &corners,	const CornersT &basis_corners, 
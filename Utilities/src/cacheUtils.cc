@@ -0,0 +1,151 @@
+#include "mtf/Utilities/cacheUtils.h"
+#include "mtf/Utilities/excpUtils.h"
+#include "opencv2/imgproc/imgproc.hpp"
+
+_MTF_BEGIN_NAMESPACE
+namespace utils{
+	namespace{
+		struct Registration{
+			std::weak_ptr<FrameCache> cache;
+			//! used for unregistering since the weak pointer has already expired in the destructor
+			const FrameCache *owner;
+			double scale_factor;
+			int level;
+			int rows, cols, type;
+		};
+		//! maps the data pointers of all frames and pyramid levels to the caches they belong to
+		struct Registry{
+			std::mutex mutex;
+			std::map<const uchar*, Registration> images;
+		};
+		//! never destroyed so that caches held by static objects can still unregister themselves
+		Registry& getRegistry(){
+			static Registry *registry = new Registry;
+			return *registry;
+		}
+	}
+
+	FrameCache::Ptr FrameCache::create(const cv::Mat &frame, const std::string &type){
+		if(frame.empty() || !frame.isContinuous()){
+			throw InvalidArgument("FrameCache :: Frame must be non empty and continuous");
+		}
+		Ptr cache(new FrameCache(frame, type));
+		cache->registerImage(frame, 1, 0);
+		return cache;
+	}
+	FrameCache::FrameCache(const cv::Mat &frame, const std::string &type) :
+		_type(type), frame_id(-1), generation(1){
+		base.img = frame;
+		base.img_gen = generation;
+	}
+	FrameCache::~FrameCache(){
+		Registry &registry = getRegistry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+		//! a newer cache for the same frame might have replaced the registration of its buffer
+		auto unregister = [&](const cv::Mat &img){
+			auto img_it = registry.images.find(img.data);
+			if(img_it != registry.images.end() && img_it->second.owner == this){
+				registry.images.erase(img_it);
+			}
+		};
+		unregister(base.img);
+		for(auto &pyramid : pyramids){
+			for(const std::unique_ptr<Level> &level : pyramid.second){
+				unregister(level->img);
+			}
+		}
+	}
+	void FrameCache::update(int _frame_id){
+		std::lock_guard<std::mutex> lock(mutex);
+		frame_id = _frame_id;
+		++generation;
+		//! the base level is the frame itself so only its gradients need rebuilding
+		base.img_gen = generation;
+	}
+	const cv::Mat& FrameCache::getPyramidLevel(int level, double scale_factor){
+		std::lock_guard<std::mutex> lock(mutex);
+		return getLevel(level, scale_factor).img;
+	}
+	void FrameCache::getGradient(cv::Mat &grad_x, cv::Mat &grad_y, int level, double scale_factor){
+		std::lock_guard<std::mutex> lock(mutex);
+		Level &curr_level = getLevel(level, scale_factor);
+		if(curr_level.img.type() != CV_32FC1){
+			throw InvalidArgument(
+				cv::format("FrameCache :: Gradients are only supported for CV_32FC1 frames, not type: %d",
+				curr_level.img.type()));
+		}
+		if(curr_level.grad_gen != generation){
+			//! aperture size 1 gives the 3 tap [-1 0 1] kernel without any smoothing in the other direction
+			cv::Sobel(curr_level.img, curr_level.grad_x, CV_32F, 1, 0, 1, 0.5, 0, cv::BORDER_REPLICATE);
+			cv::Sobel(curr_level.img, curr_level.grad_y, CV_32F, 0, 1, 1, 0.5, 0, cv::BORDER_REPLICATE);
+			curr_level.grad_gen = generation;
+		}
+		grad_x = curr_level.grad_x;
+		grad_y = curr_level.grad_y;
+	}
+	FrameCache::Entry FrameCache::find(const cv::Mat &img){
+		Entry entry;
+		if(img.empty()){ return entry; }
+		Registry &registry = getRegistry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+		auto img_it = registry.images.find(img.data);
+		if(img_it == registry.images.end()){ return entry; }
+		const Registration &registration = img_it->second;
+		//! a header sharing only the start of the buffer, e.g. a ROI, does not match
+		if(registration.rows != img.rows || registration.cols != img.cols ||
+			registration.type != img.type()){
+			return entry;
+		}
+		entry.cache = registration.cache.lock();
+		entry.scale_factor = registration.scale_factor;
+		entry.level = registration.level;
+		return entry;
+	}
+	FrameCache::Level& FrameCache::getLevel(int level, double scale_factor){
+		if(level < 0){
+			throw InvalidArgument(cv::format("FrameCache :: Invalid pyramid level: %d", level));
+		}
+		if(level == 0){ return base; }
+		Level &prev_level = getLevel(level - 1, scale_factor);
+		std::vector<std::unique_ptr<Level>> &pyramid = pyramids[scale_factor];
+		while(static_cast<int>(pyramid.size()) < level){
+			const cv::Mat &prev_img = pyramid.empty() ? base.img : pyramid.back()->img;
+			int n_rows = static_cast<int>(prev_img.rows*scale_factor);
+			int n_cols = static_cast<int>(prev_img.cols*scale_factor);
+			if(n_rows <= 0 || n_cols <= 0){
+				throw InvalidArgument(
+					cv::format("FrameCache :: Pyramid level %d with scale factor %f has invalid size: %dx%d",
+					pyramid.size() + 1, scale_factor, n_cols, n_rows));
+			}
+			pyramid.emplace_back(new Level);
+			pyramid.back()->img.create(n_rows, n_cols, base.img.type());
+			registerImage(pyramid.back()->img, scale_factor, static_cast<int>(pyramid.size()));
+		}
+		Level &curr_level = *pyramid[level - 1];
+		if(curr_level.img_gen != generation){
+			//! same filtering as used by the pyramidal composites when building their own pyramids
+			if(scale_factor == 0.5){
+				cv::pyrDown(prev_level.img, curr_level.img, curr_level.img.size());
+			} else{
+				cv::resize(prev_level.img, curr_level.img, curr_level.img.size());
+				cv::GaussianBlur(curr_level.img, curr_level.img, cv::Size(5, 5), 3);
+			}
+			curr_level.img_gen = generation;
+		}
+		return curr_level;
+	}
+	void FrameCache::registerImage(const cv::Mat &img, double scale_factor, int level){
+		Registration registration;
+		registration.cache = shared_from_this();
+		registration.owner = this;
+		registration.scale_factor = scale_factor;
+		registration.level = level;
+		registration.rows = img.rows;
+		registration.cols = img.cols;
+		registration.type = img.type();
+		Registry &registry = getRegistry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+		registry.images[img.data] = registration;
+	}
+}
+_MTF_END_NAMESPACE
@@ -0,0 +1,370 @@
+#include "mtf/Utilities/dbUtils.h"
+
+#include <fstream>
+#include <cstring>
+#include <cmath>
+
+#ifdef _WIN32
+#include <iterator>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#define NN_DB_MAGIC "MTFNNDB"
+#define NN_DB_VERSION 1
+#define NN_DB_ALIGNMENT 64
+
+_MTF_BEGIN_NAMESPACE
+namespace utils{
+	struct NNDatabase::Header{
+		char magic[8];
+		uint32_t version;
+		uint32_t feat_type;
+		int32_t n_samples;
+		int32_t feat_size;
+		int32_t state_size;
+		int32_t has_graph;
+		//! byte offsets of the sections from the start of the file; the quantization section exists only for UInt8
+		uint64_t feat_offset;
+		uint64_t quant_offset;
+		uint64_t pert_offset;
+		uint64_t node_offsets_offset;
+		uint64_t node_nbrs_offset;
+		uint64_t file_size;
+	};
+	namespace{
+		size_t getFeatBytes(DBFeatType feat_type){
+			switch(feat_type){
+			case DBFeatType::Float64:
+				return sizeof(double);
+			case DBFeatType::Float32:
+				return sizeof(float);
+			case DBFeatType::Float16:
+				return sizeof(uint16_t);
+			default:
+				return sizeof(uint8_t);
+			}
+		}
+		uint64_t alignOffset(uint64_t offset){
+			return (offset + NN_DB_ALIGNMENT - 1) / NN_DB_ALIGNMENT * NN_DB_ALIGNMENT;
+		}
+		//! IEEE 754 half precision conversions with rounding to the nearest even value
+		uint16_t floatToHalf(float val){
+			uint32_t bits;
+			memcpy(&bits, &val, sizeof(bits));
+			uint32_t sign = (bits >> 16) & 0x8000;
+			uint32_t float_exp = (bits >> 23) & 0xff;
+			uint32_t mant = bits & 0x7fffff;
+			if(float_exp == 0xff){
+				return static_cast<uint16_t>(sign | 0x7c00 | (mant ? 0x200 : 0));
+			}
+			int exp = static_cast<int>(float_exp) - 127 + 15;
+			if(exp >= 31){ return static_cast<uint16_t>(sign | 0x7c00); }
+			if(exp <= 0){
+				//! subnormal half precision value
+				if(exp < -10){ return static_cast<uint16_t>(sign); }
+				mant |= 0x800000;
+				int shift = 14 - exp;
+				uint32_t half_mant = mant >> shift;
+				uint32_t rem = mant & ((1u << shift) - 1);
+				uint32_t halfway = 1u << (shift - 1);
+				if(rem > halfway || (rem == halfway && (half_mant & 1))){ ++half_mant; }
+				return static_cast<uint16_t>(sign | half_mant);
+			}
+			uint32_t half = sign | (static_cast<uint32_t>(exp) << 10) | (mant >> 13);
+			uint32_t rem = mant & 0x1fff;
+			//! a carry out of the mantissa correctly increments the exponent
+			if(rem > 0x1000 || (rem == 0x1000 && (half & 1))){ ++half; }
+			return static_cast<uint16_t>(half);
+		}
+		float halfToFloat(uint16_t half){
+			uint32_t sign = static_cast<uint32_t>(half & 0x8000) << 16;
+			uint32_t exp = (half >> 10) & 0x1f;
+			uint32_t mant = half & 0x3ff;
+			uint32_t bits;
+			if(exp == 0){
+				if(mant == 0){
+					bits = sign;
+				} else{
+					//! normalize the subnormal value
+					exp = 127 - 15 + 1;
+					while(!(mant & 0x400)){
+						mant <<= 1;
+						--exp;
+					}
+					bits = sign | (exp << 23) | ((mant & 0x3ff) << 13);
+				}
+			} else if(exp == 31){
+				bits = sign | 0x7f800000 | (mant << 13);
+			} else{
+				bits = sign | ((exp + 127 - 15) << 23) | (mant << 13);
+			}
+			float val;
+			memcpy(&val, &bits, sizeof(val));
+			return val;
+		}
+		void writePadding(std::ofstream &out_file, uint64_t offset){
+			static const char zeros[NN_DB_ALIGNMENT] = { 0 };
+			uint64_t pos = static_cast<uint64_t>(out_file.tellp());
+			out_file.write(zeros, offset - pos);
+		}
+	}
+	const char* toString(DBFeatType feat_type){
+		switch(feat_type){
+		case DBFeatType::Float64:
+			return "float64";
+		case DBFeatType::Float32:
+			return "float32";
+		case DBFeatType::Float16:
+			return "float16";
+		case DBFeatType::UInt8:
+			return "uint8";
+		default:
+			return "invalid";
+		}
+	}
+
+	NNDatabase::NNDatabase() : header(nullptr), data(nullptr), data_size(0),
+		quant_offset(nullptr), quant_scale(nullptr), perturbations(nullptr),
+		node_offsets(nullptr), node_nbrs(nullptr), features(nullptr), feat_stride(0){}
+
+	NNDatabase::~NNDatabase(){ close(); }
+
+	bool NNDatabase::write(const std::string &file_path, DBFeatType feat_type,
+		const double *_features, int n_samples, int feat_size,
+		const double *_perturbations, int state_size,
+		const std::vector<int64_t> &_node_offsets, const std::vector<int> &_node_nbrs){
+		bool has_graph = !_node_offsets.empty();
+		if(has_graph && (_node_offsets.size() != static_cast<size_t>(n_samples + 1) ||
+			_node_offsets.back() != static_cast<int64_t>(_node_nbrs.size()))){
+			printf("NNDatabase :: Graph with %d nodes and %d neighbours is not consistent with %d samples\n",
+				static_cast<int>(_node_offsets.size()) - 1, static_cast<int>(_node_nbrs.size()), n_samples);
+			return false;
+		}
+		Header header;
+		memset(&header, 0, sizeof(header));
+		memcpy(header.magic, NN_DB_MAGIC, sizeof(header.magic));
+		header.version = NN_DB_VERSION;
+		header.feat_type = static_cast<uint32_t>(feat_type);
+		header.n_samples = n_samples;
+		header.feat_size = feat_size;
+		header.state_size = state_size;
+		header.has_graph = has_graph;
+
+		const uint64_t n_feats = static_cast<uint64_t>(n_samples)*feat_size;
+		header.feat_offset = alignOffset(sizeof(Header));
+		uint64_t offset = header.feat_offset + n_feats*getFeatBytes(feat_type);
+		if(feat_type == DBFeatType::UInt8){
+			header.quant_offset = alignOffset(offset);
+			offset = header.quant_offset + 2 * feat_size*sizeof(double);
+		}
+		header.pert_offset = alignOffset(offset);
+		offset = header.pert_offset + static_cast<uint64_t>(n_samples)*state_size*sizeof(double);
+		if(has_graph){
+			header.node_offsets_offset = alignOffset(offset);
+			offset = header.node_offsets_offset + _node_offsets.size()*sizeof(int64_t);
+			header.node_nbrs_offset = alignOffset(offset);
+			offset = header.node_nbrs_offset + _node_nbrs.size()*sizeof(int);
+		}
+		header.file_size = offset;
+
+		std::ofstream out_file(file_path, std::ios::out | std::ios::binary);
+		if(!out_file.good()){ return false; }
+		out_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		writePadding(out_file, header.feat_offset);
+
+		std::vector<double> dim_offset, dim_scale;
+		if(feat_type == DBFeatType::UInt8){
+			dim_offset.assign(_features, _features + feat_size);
+			std::vector<double> dim_max(dim_offset);
+			for(int sample_id = 1; sample_id < n_samples; ++sample_id){
+				const double *sample = _features + static_cast<uint64_t>(sample_id)*feat_size;
+				for(int dim_id = 0; dim_id < feat_size; ++dim_id){
+					if(sample[dim_id] < dim_offset[dim_id]){ dim_offset[dim_id] = sample[dim_id]; }
+					if(sample[dim_id] > dim_max[dim_id]){ dim_max[dim_id] = sample[dim_id]; }
+				}
+			}
+			dim_scale.resize(feat_size);
+			for(int dim_id = 0; dim_id < feat_size; ++dim_id){
+				double range = dim_max[dim_id] - dim_offset[dim_id];
+				dim_scale[dim_id] = range > 0 ? range / 255.0 : 1.0;
+			}
+		}
+		if(feat_type == DBFeatType::Float64){
+			out_file.write(reinterpret_cast<const char*>(_features), n_feats*sizeof(double));
+		} else{
+			//! features are converted one sample at a time
+			std::vector<unsigned char> sample_data(feat_size*getFeatBytes(feat_type));
+			for(int sample_id = 0; sample_id < n_samples; ++sample_id){
+				const double *sample = _features + static_cast<uint64_t>(sample_id)*feat_size;
+				for(int dim_id = 0; dim_id < feat_size; ++dim_id){
+					switch(feat_type){
+					case DBFeatType::Float32:
+						reinterpret_cast<float*>(sample_data.data())[dim_id] = static_cast<float>(sample[dim_id]);
+						break;
+					case DBFeatType::Float16:
+						reinterpret_cast<uint16_t*>(sample_data.data())[dim_id] =
+							floatToHalf(static_cast<float>(sample[dim_id]));
+						break;
+					default:
+						double quant_val = std::round((sample[dim_id] - dim_offset[dim_id]) / dim_scale[dim_id]);
+						sample_data[dim_id] = static_cast<uint8_t>(quant_val < 0 ? 0 : quant_val > 255 ? 255 : quant_val);
+					}
+				}
+				out_file.write(reinterpret_cast<const char*>(sample_data.data()), sample_data.size());
+			}
+		}
+		if(feat_type == DBFeatType::UInt8){
+			writePadding(out_file, header.quant_offset);
+			out_file.write(reinterpret_cast<const char*>(dim_offset.data()), feat_size*sizeof(double));
+			out_file.write(reinterpret_cast<const char*>(dim_scale.data()), feat_size*sizeof(double));
+		}
+		writePadding(out_file, header.pert_offset);
+		out_file.write(reinterpret_cast<const char*>(_perturbations),
+			static_cast<uint64_t>(n_samples)*state_size*sizeof(double));
+		if(has_graph){
+			writePadding(out_file, header.node_offsets_offset);
+			out_file.write(reinterpret_cast<const char*>(_node_offsets.data()),
+				_node_offsets.size()*sizeof(int64_t));
+			writePadding(out_file, header.node_nbrs_offset);
+			out_file.write(reinterpret_cast<const char*>(_node_nbrs.data()),
+				_node_nbrs.size()*sizeof(int));
+		}
+		bool success = out_file.good();
+		out_file.close();
+		return success;
+	}
+
+	bool NNDatabase::open(const std::string &file_path){
+		close();
+#ifdef _WIN32
+		std::ifstream in_file(file_path, std::ios::in | std::ios::binary);
+		if(!in_file.good()){ return false; }
+		file_data.assign(std::istreambuf_iterator<char>(in_file), std::istreambuf_iterator<char>());
+		data = file_data.data();
+		data_size = file_data.size();
+#else
+		int fd = ::open(file_path.c_str(), O_RDONLY);
+		if(fd < 0){ return false; }
+		struct stat file_stat;
+		if(fstat(fd, &file_stat) != 0 || file_stat.st_size < static_cast<off_t>(sizeof(Header))){
+			::close(fd);
+			return false;
+		}
+		data_size = static_cast<size_t>(file_stat.st_size);
+		void *mapped_data = mmap(nullptr, data_size, PROT_READ, MAP_SHARED, fd, 0);
+		//! the mapping remains valid after the file is closed
+		::close(fd);
+		if(mapped_data == MAP_FAILED){
+			data_size = 0;
+			return false;
+		}
+		data = static_cast<const unsigned char*>(mapped_data);
+#endif
+		header = reinterpret_cast<const Header*>(data);
+		auto sectionValid = [&](uint64_t offset, uint64_t size){
+			return offset % NN_DB_ALIGNMENT == 0 && offset >= sizeof(Header) &&
+				offset <= data_size && size <= data_size - offset;
+		};
+		bool valid = data_size >= sizeof(Header) && !memcmp(header->magic, NN_DB_MAGIC, sizeof(header->magic)) &&
+			header->version == NN_DB_VERSION && header->feat_type <= static_cast<uint32_t>(DBFeatType::UInt8) &&
+			header->file_size == data_size && header->n_samples > 0 && header->feat_size > 0 && header->state_size > 0;
+		if(valid){
+			const uint64_t n_samples = header->n_samples;
+			feat_stride = header->feat_size*getFeatBytes(getFeatType());
+			valid = sectionValid(header->feat_offset, n_samples*feat_stride) &&
+				sectionValid(header->pert_offset, n_samples*header->state_size*sizeof(double)) &&
+				(getFeatType() != DBFeatType::UInt8 ||
+				sectionValid(header->quant_offset, 2 * header->feat_size*sizeof(double))) &&
+				(!header->has_graph || sectionValid(header->node_offsets_offset, (n_samples + 1)*sizeof(int64_t)));
+		}
+		if(valid && header->has_graph){
+			//! the graph is checked fully since an invalid neighbour would cause out of bounds accesses while searching
+			node_offsets = reinterpret_cast<const int64_t*>(data + header->node_offsets_offset);
+			node_nbrs = reinterpret_cast<const int*>(data + header->node_nbrs_offset);
+			valid = node_offsets[0] == 0 && node_offsets[header->n_samples] >= 0 &&
+				sectionValid(header->node_nbrs_offset, node_offsets[header->n_samples] * sizeof(int));
+			for(int sample_id = 0; valid && sample_id < header->n_samples; ++sample_id){
+				valid = node_offsets[sample_id + 1] >= node_offsets[sample_id];
+			}
+			for(int64_t nbr_id = 0; valid && nbr_id < node_offsets[header->n_samples]; ++nbr_id){
+				valid = node_nbrs[nbr_id] >= 0 && node_nbrs[nbr_id] < header->n_samples;
+			}
+		}
+		if(!valid){
+			printf("NNDatabase :: %s is not a valid database\n", file_path.c_str());
+			close();
+			return false;
+		}
+		features = data + header->feat_offset;
+		perturbations = reinterpret_cast<const double*>(data + header->pert_offset);
+		if(getFeatType() == DBFeatType::UInt8){
+			quant_offset = reinterpret_cast<const double*>(data + header->quant_offset);
+			quant_scale = quant_offset + header->feat_size;
+		}
+		return true;
+	}
+
+	void NNDatabase::close(){
+#ifdef _WIN32
+		file_data.clear();
+		file_data.shrink_to_fit();
+#else
+		if(data){
+			munmap(const_cast<unsigned char*>(data), data_size);
+		}
+#endif
+		header = nullptr;
+		data = nullptr;
+		data_size = 0;
+		quant_offset = quant_scale = perturbations = nullptr;
+		node_offsets = nullptr;
+		node_nbrs = nullptr;
+		features = nullptr;
+		feat_stride = 0;
+	}
+
+	int NNDatabase::getNSamples() const{ return header->n_samples; }
+	int NNDatabase::getFeatSize() const{ return header->feat_size; }
+	int NNDatabase::getStateSize() const{ return header->state_size; }
+	DBFeatType NNDatabase::getFeatType() const{ return static_cast<DBFeatType>(header->feat_type); }
+	bool NNDatabase::hasGraph() const{ return header->has_graph != 0; }
+
+	const double* NNDatabase::getFeatures(int sample_id, double *buffer) const{
+		const unsigned char *sample = features + sample_id*feat_stride;
+		const int feat_size = header->feat_size;
+		switch(getFeatType()){
+		case DBFeatType::Float64:
+			return reinterpret_cast<const double*>(sample);
+		case DBFeatType::Float32:
+			for(int dim_id = 0; dim_id < feat_size; ++dim_id){
+				buffer[dim_id] = reinterpret_cast<const float*>(sample)[dim_id];
+			}
+			break;
+		case DBFeatType::Float16:
+			for(int dim_id = 0; dim_id < feat_size; ++dim_id){
+				buffer[dim_id] = halfToFloat(reinterpret_cast<const uint16_t*>(sample)[dim_id]);
+			}
+			break;
+		case DBFeatType::UInt8:
+			for(int dim_id = 0; dim_id < feat_size; ++dim_id){
+				buffer[dim_id] = quant_offset[dim_id] + quant_scale[dim_id] * sample[dim_id];
+			}
+			break;
+		}
+		return buffer;
+	}
+	const double* NNDatabase::getPerturbation(int sample_id) const{
+		return perturbations + static_cast<size_t>(sample_id)*header->state_size;
+	}
+	int NNDatabase::getNNbrs(int sample_id) const{
+		return static_cast<int>(node_offsets[sample_id + 1] - node_offsets[sample_id]);
+	}
+	const int* NNDatabase::getNbrs(int sample_id) const{
+		return node_nbrs + node_offsets[sample_id];
+	}
+}
+_MTF_END_NAMESPACE
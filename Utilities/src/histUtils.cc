@@ -315,6 +315,31 @@ namespace utils{
 		}
 		hist *= hist_norm_mult;
 	}
+	void getBSplHistWithGrad(
+		// output arguments
+		VectorXd &hist, MatrixXd &hist_mat,
+		MatrixXd &hist_grad, MatrixX2i &bspl_ids,
+		// input arguments
+		const VectorXd &pix_vals, const BSpl3Table &bspl_table,
+		double pre_seed, int n_pix, double hist_norm_mult
+		) {
+		assert(hist_grad.cols() == n_pix);
+		assert(hist_mat.cols() == n_pix);
+		assert(bspl_ids.rows() == n_pix);
+
+		hist.fill(pre_seed);
+		_eig_set_zero(hist_mat, double);
+		_eig_set_zero(hist_grad, double);
+
+		for(int pix = 0; pix < n_pix; pix++) {
+			bspl_table.getWeights(hist_mat, hist_grad, bspl_ids, pix, pix_vals(pix));
+			for(int id = bspl_ids(pix, 0); id <= bspl_ids(pix, 1); id++) {
+				hist_grad(id, pix) *= -hist_norm_mult;
+				hist(id) += hist_mat(id, pix);
+			}
+		}
+		hist *= hist_norm_mult;
+	}
 
 	void getMIVecGrad(
 		// output arguments
@@ -460,6 +485,36 @@ namespace utils{
 		}
 	}
 
+	void BSpl3Table::initialize(const MatrixX2i &_std_bspl_ids, int _n_steps){
+		std_bspl_ids = _std_bspl_ids;
+		n_steps = _n_steps > 0 ? _n_steps : 0;
+		if(isExact()){
+			entries.clear();
+			max_entry_id = 0;
+			return;
+		}
+		int n_bins = static_cast<int>(std_bspl_ids.rows());
+		// one entry for each quantized value in [0, n_bins - 1]
+		max_entry_id = (n_bins - 1)*n_steps;
+		entries.resize(max_entry_id + 1);
+		for(int entry_id = 0; entry_id <= max_entry_id; ++entry_id){
+			double pix_val = static_cast<double>(entry_id) / static_cast<double>(n_steps);
+			Entry &entry = entries[entry_id];
+			entry.start_id = std_bspl_ids(static_cast<int>(pix_val), 0);
+			entry.end_id = std_bspl_ids(static_cast<int>(pix_val), 1);
+			if(entry.end_id - entry.start_id > 3){
+				throw InvalidArgument(
+					cv::format("BSpl3Table :: Pixel values cannot contribute to %d bins", entry.end_id - entry.start_id + 1));
+			}
+			double curr_diff = entry.start_id - pix_val;
+			for(int wt_id = 0; wt_id <= entry.end_id - entry.start_id; ++wt_id){
+				bSpl3WithGrad(entry.val[wt_id], entry.grad[wt_id], curr_diff);
+				cumBSpl3WithGrad(entry.cum_val[wt_id], entry.cum_grad[wt_id], curr_diff);
+				++curr_diff;
+			}
+		}
+	}
+
 	// computes the histogram for the given image specified as a vector of pixel values.
 	// Since the pixel values are allowed to be real numbers, each pixel contributes
 	// to multiple bins in the histogram according to a B Spline function of order 3
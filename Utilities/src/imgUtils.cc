@@ -8,6 +8,10 @@
 #include "tbb/tbb.h" 
 #endif
 
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
 _MTF_BEGIN_NAMESPACE
 
 namespace utils{
@@ -156,6 +160,130 @@ namespace utils{
 		return  biCubic(bicubic_coeff, dx, dy);
 	}
 
+	/**
+	bilinear interpolation without any border checks for locations known to lie in [0, w - 1) x [0, h - 1)
+	so that the upper neighbors are always within the image;
+	uses the same expression as the checked version so the results are identical
+	*/
+	inline double getPixValUnchecked(const EigPixT *img_data, unsigned int w, double x, double y){
+		int lx = static_cast<int>(x);
+		int ly = static_cast<int>(y);
+		double dx = x - lx;
+		double dy = y - ly;
+		const EigPixT *top = img_data + ly*w + lx;
+		const EigPixT *bottom = top + w;
+		return top[0] * (1 - dx)*(1 - dy) +
+			top[1] * dx*(1 - dy) +
+			bottom[0] * (1 - dx)*dy +
+			bottom[1] * dx*dy;
+	}
+	//! unchecked bilinear interpolation at 4 locations at once; 
+	//! the neighbors of all 4 are gathered together if the library is compiled with AVX2 enabled
+	//! (avx2=1 or WITH_AVX2=ON) and interpolated one location at a time otherwise
+	inline void getPixVals4Unchecked(double *pix_vals, const EigPixT *img_data, unsigned int w,
+		const double *x, const double *y){
+#ifdef __AVX2__
+		__m256d x_vec = _mm256_loadu_pd(x), y_vec = _mm256_loadu_pd(y);
+		__m256d lx_vec = _mm256_floor_pd(x_vec), ly_vec = _mm256_floor_pd(y_vec);
+		__m256d dx = _mm256_sub_pd(x_vec, lx_vec), dy = _mm256_sub_pd(y_vec, ly_vec);
+		__m256d ones = _mm256_set1_pd(1.0);
+		__m256d dx_c = _mm256_sub_pd(ones, dx), dy_c = _mm256_sub_pd(ones, dy);
+
+		__m128i offsets = _mm_add_epi32(_mm_mullo_epi32(_mm256_cvttpd_epi32(ly_vec),
+			_mm_set1_epi32(static_cast<int>(w))), _mm256_cvttpd_epi32(lx_vec));
+		__m256d tl = _mm256_cvtps_pd(_mm_i32gather_ps(img_data, offsets, sizeof(EigPixT)));
+		__m256d tr = _mm256_cvtps_pd(_mm_i32gather_ps(img_data + 1, offsets, sizeof(EigPixT)));
+		__m256d bl = _mm256_cvtps_pd(_mm_i32gather_ps(img_data + w, offsets, sizeof(EigPixT)));
+		__m256d br = _mm256_cvtps_pd(_mm_i32gather_ps(img_data + w + 1, offsets, sizeof(EigPixT)));
+
+		__m256d res = _mm256_mul_pd(_mm256_mul_pd(tl, dx_c), dy_c);
+		res = _mm256_add_pd(res, _mm256_mul_pd(_mm256_mul_pd(tr, dx), dy_c));
+		res = _mm256_add_pd(res, _mm256_mul_pd(_mm256_mul_pd(bl, dx_c), dy));
+		res = _mm256_add_pd(res, _mm256_mul_pd(_mm256_mul_pd(br, dx), dy));
+		_mm256_storeu_pd(pix_vals, res);
+#else
+		for(int i = 0; i < 4; ++i){
+			pix_vals[i] = getPixValUnchecked(img_data, w, x[i], y[i]);
+		}
+#endif
+	}
+	//! check if all the given points with an offset of grad_eps on either side can be sampled without border checks
+	template<typename PtsT>
+	inline bool checkInterior(const PtsT &pts, double grad_eps, unsigned int h, unsigned int w){
+		if(PIX_INTERP_TYPE != InterpType::Linear || GRAD_INTERP_TYPE != InterpType::Linear){
+			return false;
+		}
+		return pts.row(0).minCoeff() - grad_eps >= 0 && pts.row(0).maxCoeff() + grad_eps < w - 1 &&
+			pts.row(1).minCoeff() - grad_eps >= 0 && pts.row(1).maxCoeff() + grad_eps < h - 1;
+	}
+	//! same check for the warped offset points where each column has x and y coordinates of 4 points interleaved
+	inline bool checkInterior(const Matrix8Xd &warped_offset_pts, unsigned int h, unsigned int w){
+		if(GRAD_INTERP_TYPE != InterpType::Linear){
+			return false;
+		}
+		Map<const Matrix2Xd> offset_pts(warped_offset_pts.data(), 2, warped_offset_pts.cols() * 4);
+		return checkInterior(offset_pts, 0, h, w);
+	}
+
+	void getPixValsWithGrad(VectorXd &pix_vals, PixGradT &img_grad,
+		const EigImgT &img, const PtsT &pts, double grad_eps, unsigned int n_pix,
+		unsigned int h, unsigned int w, double norm_mult, double norm_add){
+		assert(pix_vals.size() == n_pix && img_grad.rows() == n_pix && pts.cols() == n_pix);
+
+		double grad_mult_factor = norm_mult / (2 * grad_eps);
+		if(!checkInterior(pts, grad_eps, h, w)){
+			for(unsigned int pix_id = 0; pix_id < n_pix; ++pix_id){
+				double curr_x = pts(0, pix_id), curr_y = pts(1, pix_id);
+				pix_vals(pix_id) = norm_mult * getPixVal<PIX_INTERP_TYPE, PIX_BORDER_TYPE>(
+					img, curr_x, curr_y, h, w) + norm_add;
+				img_grad(pix_id, 0) = (getPixVal<GRAD_INTERP_TYPE, PIX_BORDER_TYPE>(img, curr_x + grad_eps, curr_y, h, w) -
+					getPixVal<GRAD_INTERP_TYPE, PIX_BORDER_TYPE>(img, curr_x - grad_eps, curr_y, h, w))*grad_mult_factor;
+				img_grad(pix_id, 1) = (getPixVal<GRAD_INTERP_TYPE, PIX_BORDER_TYPE>(img, curr_x, curr_y + grad_eps, h, w) -
+					getPixVal<GRAD_INTERP_TYPE, PIX_BORDER_TYPE>(img, curr_x, curr_y - grad_eps, h, w))*grad_mult_factor;
+			}
+			return;
+		}
+		const EigPixT *img_data = img.data();
+		double offset_x[4], offset_y[4], offset_vals[4];
+		for(unsigned int pix_id = 0; pix_id < n_pix; ++pix_id){
+			double curr_x = pts(0, pix_id), curr_y = pts(1, pix_id);
+			pix_vals(pix_id) = norm_mult * getPixValUnchecked(img_data, w, curr_x, curr_y) + norm_add;
+
+			offset_x[0] = curr_x + grad_eps; offset_y[0] = curr_y;
+			offset_x[1] = curr_x - grad_eps; offset_y[1] = curr_y;
+			offset_x[2] = curr_x; offset_y[2] = curr_y + grad_eps;
+			offset_x[3] = curr_x; offset_y[3] = curr_y - grad_eps;
+			getPixVals4Unchecked(offset_vals, img_data, w, offset_x, offset_y);
+
+			img_grad(pix_id, 0) = (offset_vals[0] - offset_vals[1])*grad_mult_factor;
+			img_grad(pix_id, 1) = (offset_vals[2] - offset_vals[3])*grad_mult_factor;
+		}
+	}
+
+	void getImgGrad(PixGradT &img_grad, const EigImgT &grad_x, const EigImgT &grad_y,
+		const PtsT &pts, unsigned int n_pix, unsigned int h, unsigned int w,
+		double pix_mult_factor){
+		assert(img_grad.rows() == n_pix && pts.cols() == n_pix);
+		assert(grad_x.rows() == h && grad_x.cols() == w && grad_y.rows() == h && grad_y.cols() == w);
+
+		if(!checkInterior(pts, 0, h, w)){
+			for(unsigned int pix_id = 0; pix_id < n_pix; ++pix_id){
+				double curr_x = pts(0, pix_id), curr_y = pts(1, pix_id);
+				img_grad(pix_id, 0) = pix_mult_factor*getPixVal<GRAD_INTERP_TYPE, PIX_BORDER_TYPE>(
+					grad_x, curr_x, curr_y, h, w, 0);
+				img_grad(pix_id, 1) = pix_mult_factor*getPixVal<GRAD_INTERP_TYPE, PIX_BORDER_TYPE>(
+					grad_y, curr_x, curr_y, h, w, 0);
+			}
+			return;
+		}
+		const EigPixT *grad_x_data = grad_x.data(), *grad_y_data = grad_y.data();
+		for(unsigned int pix_id = 0; pix_id < n_pix; ++pix_id){
+			double curr_x = pts(0, pix_id), curr_y = pts(1, pix_id);
+			img_grad(pix_id, 0) = pix_mult_factor*getPixValUnchecked(grad_x_data, w, curr_x, curr_y);
+			img_grad(pix_id, 1) = pix_mult_factor*getPixValUnchecked(grad_y_data, w, curr_x, curr_y);
+		}
+	}
+
 #ifdef USE_TBB
 #include "imgUtils_tbb.cc"
 #else
@@ -183,6 +311,22 @@ namespace utils{
 		double grad_mult_factor = pix_mult_factor / (2 * grad_eps);
 		double pix_val_inc, pix_val_dec;
 
+		if(checkInterior(warped_offset_pts, h, w)){
+			//! all offset points are inside the image so the 4 samples for each pixel are interpolated together
+			const EigPixT *img_data = img.data();
+			double offset_x[4], offset_y[4], offset_vals[4];
+			for(unsigned int pix_id = 0; pix_id < n_pix; ++pix_id){
+				const double *curr_offset_pts = warped_offset_pts.col(pix_id).data();
+				for(int offset_id = 0; offset_id < 4; ++offset_id){
+					offset_x[offset_id] = curr_offset_pts[2 * offset_id];
+					offset_y[offset_id] = curr_offset_pts[2 * offset_id + 1];
+				}
+				getPixVals4Unchecked(offset_vals, img_data, w, offset_x, offset_y);
+				warped_img_grad(pix_id, 0) = (offset_vals[0] - offset_vals[1])*grad_mult_factor;
+				warped_img_grad(pix_id, 1) = (offset_vals[2] - offset_vals[3])*grad_mult_factor;
+			}
+			return;
+		}
 		for(unsigned int pix_id = 0; pix_id < n_pix; ++pix_id){
 
 			pix_val_inc = getPixVal<GRAD_INTERP_TYPE, PIX_BORDER_TYPE>(img, warped_offset_pts(0, pix_id),
@@ -8,7 +8,7 @@ namespace utils{
 		double _resize_factor, bool _hist_eq) : next(nullptr), output_type(_output_type),
 		frame_id(-1), rgb_input(true), rgb_output(_output_type == CV_32FC3 || _output_type == CV_8UC3),
 		resize_factor(_resize_factor), resize_images(_resize_factor != 1),
-		hist_eq(_hist_eq) {
+		hist_eq(_hist_eq), roi_margin(1) {
 		_type = cv::format("%s_%d_%.2f_%d", name.c_str(), output_type, resize_factor, hist_eq);
 	}
 
@@ -16,6 +16,9 @@ namespace utils{
 		frame_rgb.release();
 		frame_gs.release();
 		frame_rgb_uchar.release();
+		frame_cache.reset();
+		curr_frame_raw.release();
+		valid_rois.clear();
 		if(next.get()){ next->release(); }
 	}
 	void PreProcBase::initialize(const cv::Mat &frame_raw, int _frame_id, bool print_types){
@@ -68,10 +71,20 @@ namespace utils{
 				static_cast<int>(frame_raw.cols*resize_factor), output_type);
 			printf("Resizing images to : %d x %d\n", frame_resized.cols, frame_resized.rows);
 		}
+		curr_frame_raw = frame_raw;
 		processFrame(frame_raw);
+		valid_rois.assign(1, cv::Rect(0, 0, frame_raw.cols, frame_raw.rows));
+		//! the output buffer is only reallocated when the frame size changes
+		if(frame_cache && FrameCache::find(getFrame()).cache == frame_cache){
+			frame_cache->update(frame_id);
+		} else{
+			frame_cache = FrameCache::create(getFrame(), _type);
+			frame_cache->update(frame_id);
+		}
 		if(next.get()){ next->initialize(frame_raw, _frame_id); }
 	}
 	void PreProcBase::showFrame(std::string window_name){
+		if(roiMode()){ processFullFrame(); }
 		cv::Mat  disp_img;
 		switch(output_type){
 		case CV_32FC1:
@@ -165,6 +178,156 @@ namespace utils{
 				cv::format("PreProcBase::processFrame : Invalid output image type provided: %d", output_type));
 		}
 	}
+	void PreProcBase::setROI(int roi_id, const cv::Mat &corners){
+		rois[roi_id] = getROI(corners);
+		if(next.get()){ next->setROI(roi_id, corners); }
+	}
+	void PreProcBase::removeROI(int roi_id){
+		rois.erase(roi_id);
+		if(next.get()){ next->removeROI(roi_id); }
+	}
+	void PreProcBase::setROIMargin(double _roi_margin){
+		if(_roi_margin < 0){
+			throw mtf::utils::InvalidArgument(
+				cv::format("PreProcBase::setROIMargin : Invalid ROI margin provided: %f", _roi_margin));
+		}
+		roi_margin = _roi_margin;
+		if(next.get()){ next->setROIMargin(_roi_margin); }
+	}
+	cv::Rect PreProcBase::getROI(const cv::Mat &corners) const{
+		double min_x, max_x, min_y, max_y;
+		cv::minMaxLoc(corners.row(0), &min_x, &max_x);
+		cv::minMaxLoc(corners.row(1), &min_y, &max_y);
+		double margin_x = (max_x - min_x)*roi_margin, margin_y = (max_y - min_y)*roi_margin;
+		//! one extra pixel on each side for bilinear interpolation
+		cv::Point roi_tl(static_cast<int>(std::floor(min_x - margin_x)) - 1,
+			static_cast<int>(std::floor(min_y - margin_y)) - 1);
+		cv::Point roi_br(static_cast<int>(std::ceil(max_x + margin_x)) + 2,
+			static_cast<int>(std::ceil(max_y + margin_y)) + 2);
+		return cv::Rect(roi_tl, roi_br) & cv::Rect(0, 0, curr_frame_raw.cols, curr_frame_raw.rows);
+	}
+	bool PreProcBase::ensureROI(const cv::Mat &corners){
+		bool roi_added = false;
+		if(roiMode()){
+			//! only the region actually spanned by the corners needs to be checked
+			double min_x, max_x, min_y, max_y;
+			cv::minMaxLoc(corners.row(0), &min_x, &max_x);
+			cv::minMaxLoc(corners.row(1), &min_y, &max_y);
+			cv::Rect frame_rect(0, 0, curr_frame_raw.cols, curr_frame_raw.rows);
+			cv::Rect sampled_roi = cv::Rect(
+				cv::Point(static_cast<int>(std::floor(min_x)), static_cast<int>(std::floor(min_y))),
+				cv::Point(static_cast<int>(std::ceil(max_x)) + 2, static_cast<int>(std::ceil(max_y)) + 2)
+				) & frame_rect;
+			bool is_valid = sampled_roi.area() == 0;
+			for(unsigned int roi_id = 0; !is_valid && roi_id < valid_rois.size(); ++roi_id){
+				is_valid = (sampled_roi & valid_rois[roi_id]) == sampled_roi;
+			}
+			if(!is_valid){
+				cv::Rect new_roi = getROI(corners);
+				processROI(new_roi);
+				valid_rois.push_back(new_roi);
+				if(frame_cache){ frame_cache->update(frame_id); }
+				roi_added = true;
+			}
+		}
+		if(next.get() && next->ensureROI(corners)){ roi_added = true; }
+		return roi_added;
+	}
+	void PreProcBase::setProcessedFrame(const cv::Mat &processed, int _frame_id){
+		cv::Mat dst_frame = getFrame();
+		if(processed.rows != dst_frame.rows || processed.cols != dst_frame.cols || processed.type() != dst_frame.type()){
+			throw mtf::utils::InvalidArgument(
+				cv::format("PreProcBase::setProcessedFrame : Processed frame of size %d x %d and type %d does not match the output image of size %d x %d and type %d",
+				processed.cols, processed.rows, processed.type(), dst_frame.cols, dst_frame.rows, dst_frame.type()));
+		}
+		if(processed.data != dst_frame.data){ processed.copyTo(dst_frame); }
+		frame_id = _frame_id;
+		//! the whole frame has been processed so there is nothing left to be done on demand
+		valid_rois.assign(1, cv::Rect(0, 0, curr_frame_raw.cols, curr_frame_raw.rows));
+		if(frame_cache){ frame_cache->update(frame_id); }
+	}
+	void PreProcBase::processFullFrame(){
+		if(curr_frame_raw.empty()){ return; }
+		if(valid_rois.size() == 1 && valid_rois[0] == cv::Rect(0, 0, curr_frame_raw.cols, curr_frame_raw.rows)){
+			return;
+		}
+		processFrame(curr_frame_raw);
+		valid_rois.assign(1, cv::Rect(0, 0, curr_frame_raw.cols, curr_frame_raw.rows));
+		if(frame_cache){ frame_cache->update(frame_id); }
+	}
+	void PreProcBase::processROIs(){
+		valid_rois.clear();
+		for(auto const &roi : rois){
+			cv::Rect curr_roi = roi.second & cv::Rect(0, 0, curr_frame_raw.cols, curr_frame_raw.rows);
+			if(curr_roi.area() > 0){ valid_rois.push_back(curr_roi); }
+		}
+		//! overlapping regions are merged so that no pixel is filtered twice
+		bool rois_merged = true;
+		while(rois_merged){
+			rois_merged = false;
+			for(unsigned int roi_id = 0; !rois_merged && roi_id < valid_rois.size(); ++roi_id){
+				for(unsigned int other_id = roi_id + 1; other_id < valid_rois.size(); ++other_id){
+					if((valid_rois[roi_id] & valid_rois[other_id]).area() > 0){
+						valid_rois[roi_id] |= valid_rois[other_id];
+						valid_rois.erase(valid_rois.begin() + other_id);
+						rois_merged = true;
+						break;
+					}
+				}
+			}
+		}
+		for(const cv::Rect &roi : valid_rois){ processROI(roi); }
+	}
+	void PreProcBase::processROI(const cv::Rect &roi){
+		int border = filterBorder();
+		cv::Rect padded_roi = cv::Rect(roi.x - border, roi.y - border,
+			roi.width + 2 * border, roi.height + 2 * border) &
+			cv::Rect(0, 0, curr_frame_raw.cols, curr_frame_raw.rows);
+		cv::Mat roi_raw = curr_frame_raw(padded_roi);
+		cv::Mat roi_out, roi_rgb;
+		switch(output_type){
+		case CV_32FC1:
+			if(rgb_input){
+				roi_raw.convertTo(roi_rgb, CV_32FC3);
+				cv::cvtColor(roi_rgb, roi_out, CV_BGR2GRAY);
+			} else{
+				roi_raw.convertTo(roi_out, CV_32FC1);
+			}
+			break;
+		case CV_8UC1:
+			if(rgb_input){
+				cv::cvtColor(roi_raw, roi_out, CV_BGR2GRAY);
+			} else{
+				roi_raw.copyTo(roi_out);
+			}
+			break;
+		case CV_32FC3:
+			if(rgb_input){
+				roi_raw.convertTo(roi_out, CV_32FC3);
+			} else{
+				cv::cvtColor(roi_raw, roi_rgb, CV_GRAY2BGR);
+				roi_rgb.convertTo(roi_out, CV_32FC3);
+			}
+			break;
+		case CV_8UC3:
+			if(rgb_input){
+				roi_raw.copyTo(roi_out);
+			} else{
+				cv::cvtColor(roi_raw, roi_out, CV_GRAY2BGR);
+			}
+			break;
+		default:
+			throw mtf::utils::InvalidArgument(
+				cv::format("PreProcBase::processROI : Invalid output image type provided: %d", output_type));
+		}
+		/**
+		the padded region is filtered on its own so that its borders are extrapolated exactly as
+		those of the full frame wherever they coincide and the filter never reads stale pixels elsewhere
+		*/
+		apply(roi_out);
+		cv::Mat &frame_out = rgb_output ? frame_rgb : frame_gs;
+		roi_out(cv::Rect(roi.x - padded_roi.x, roi.y - padded_roi.y, roi.width, roi.height)).copyTo(frame_out(roi));
+	}
 	GaussianSmoothing::GaussianSmoothing(
 		int _output_type, double _resize_factor, bool _hist_eq,
 		int _kernel_size, double _sigma_x, double _sigma_y) :
@@ -331,6 +494,12 @@ namespace utils{
 					cv::format("NoPreProcessing::initialize : Invalid image type provided: %d", output_type));
 			}
 		}
+		if(frame_cache && FrameCache::find(curr_frame).cache == frame_cache){
+			frame_cache->update(frame_id);
+		} else{
+			frame_cache = FrameCache::create(curr_frame, _type);
+			frame_cache->update(frame_id);
+		}
 	}
 }
 _MTF_END_NAMESPACE
@@ -0,0 +1,256 @@
+#include "mtf/Utilities/profUtils.h"
+#include "mtf/Utilities/miscUtils.h"
+
+#include <chrono>
+#include <mutex>
+#include <memory>
+#include <cstring>
+#include <cstdio>
+#include <cmath>
+
+_MTF_BEGIN_NAMESPACE
+namespace utils{
+	namespace prof{
+		typedef std::chrono::steady_clock Clock;
+
+		std::atomic<bool> _enabled(false);
+
+		namespace{
+			//! histograms of all stages recorded by a single thread that is the only one writing to them
+			struct ThreadStats{
+				std::atomic<uint64_t> counts[max_stages][n_bins];
+				std::atomic<uint64_t> total_ns[max_stages];
+				std::atomic<uint64_t> max_ns[max_stages];
+				ThreadStats(){ clear(); }
+				void clear(){
+					for(int stage_id = 0; stage_id < max_stages; ++stage_id){
+						for(int bin_id = 0; bin_id < n_bins; ++bin_id){
+							counts[stage_id][bin_id].store(0, std::memory_order_relaxed);
+						}
+						total_ns[stage_id].store(0, std::memory_order_relaxed);
+						max_ns[stage_id].store(0, std::memory_order_relaxed);
+					}
+				}
+				//! readers in other threads may see a slightly stale value but never a torn one
+				static void add(std::atomic<uint64_t> &val, uint64_t inc){
+					val.store(val.load(std::memory_order_relaxed) + inc, std::memory_order_relaxed);
+				}
+			};
+			/**
+			the histograms are owned by the registry rather than the threads so that the intervals recorded by
+			threads that have since exited are not lost; the block of a thread that exits is handed to the next
+			new thread so that repeatedly spawning workers does not keep allocating memory
+			*/
+			struct Registry{
+				std::mutex mutex;
+				std::vector<std::string> labels;
+				std::vector<std::unique_ptr<ThreadStats>> stats;
+				std::vector<ThreadStats*> free_stats;
+				std::atomic<unsigned int> epoch;
+
+				std::mutex out_mutex;
+				std::string out_path;
+				double out_interval;
+				Clock::time_point last_out_time;
+
+				Registry() : epoch(1), out_interval(0){
+					labels.reserve(max_stages);
+				}
+			};
+			//! never destroyed so that it outlives the thread local states of all threads
+			Registry& getRegistry(){
+				static Registry *registry = new Registry;
+				return *registry;
+			}
+			struct ThreadState{
+				ThreadStats *stats;
+				Clock::time_point start_time;
+				//! epoch of the registry when the timer was started
+				unsigned int timer_epoch;
+				ThreadState() : stats(nullptr), timer_epoch(0){}
+				~ThreadState(){
+					if(!stats){ return; }
+					Registry &registry = getRegistry();
+					std::lock_guard<std::mutex> lock(registry.mutex);
+					registry.free_stats.push_back(stats);
+				}
+				ThreadStats* getStats(){
+					if(stats){ return stats; }
+					Registry &registry = getRegistry();
+					std::lock_guard<std::mutex> lock(registry.mutex);
+					if(registry.free_stats.empty()){
+						registry.stats.emplace_back(new ThreadStats);
+						stats = registry.stats.back().get();
+					} else{
+						stats = registry.free_stats.back();
+						registry.free_stats.pop_back();
+					}
+					return stats;
+				}
+			};
+			thread_local ThreadState thread_state;
+
+			inline int getMSB(uint64_t val){
+#if defined(__GNUC__) || defined(__GNUG__)
+				return 63 - __builtin_clzll(val);
+#else
+				int msb = 0;
+				while(val >>= 1){ ++msb; }
+				return msb;
+#endif
+			}
+			inline int getBinId(uint64_t interval_ns){
+				if(interval_ns < 256){ return 0; }
+				int msb = getMSB(interval_ns);
+				int bin_id = (msb - 8) * 4 + static_cast<int>((interval_ns >> (msb - 2)) & 3) + 1;
+				return bin_id < n_bins ? bin_id : n_bins - 1;
+			}
+			//! range of intervals in ns covered by a bin
+			inline void getBinExtents(int bin_id, double &min_ns, double &max_ns){
+				if(bin_id == 0){
+					min_ns = 0;
+					max_ns = 256;
+					return;
+				}
+				int msb = 8 + (bin_id - 1) / 4, sub_bin_id = (bin_id - 1) % 4;
+				min_ns = std::ldexp(4.0 + sub_bin_id, msb - 2);
+				max_ns = std::ldexp(5.0 + sub_bin_id, msb - 2);
+			}
+			//! linearly interpolated within the bin containing it and clamped to the maximum recorded interval
+			double getPercentile(const std::vector<uint64_t> &counts, uint64_t total_count,
+				double percentile, double max_ns){
+				double target_count = percentile * static_cast<double>(total_count);
+				double cum_count = 0;
+				for(int bin_id = 0; bin_id < n_bins; ++bin_id){
+					if(counts[bin_id] == 0){ continue; }
+					double bin_count = static_cast<double>(counts[bin_id]);
+					if(cum_count + bin_count >= target_count){
+						double bin_min, bin_max;
+						getBinExtents(bin_id, bin_min, bin_max);
+						double val = bin_min + (bin_max - bin_min) * (target_count - cum_count) / bin_count;
+						return val < max_ns ? val : max_ns;
+					}
+					cum_count += bin_count;
+				}
+				return max_ns;
+			}
+		}
+
+		void setEnabled(bool enabled){
+			getRegistry().epoch.fetch_add(1, std::memory_order_relaxed);
+			_enabled.store(enabled, std::memory_order_relaxed);
+		}
+		int getStageId(const char *label){
+			Registry &registry = getRegistry();
+			std::lock_guard<std::mutex> lock(registry.mutex);
+			for(unsigned int stage_id = 0; stage_id < registry.labels.size(); ++stage_id){
+				if(registry.labels[stage_id] == label){
+					return static_cast<int>(stage_id);
+				}
+			}
+			if(registry.labels.size() >= static_cast<unsigned int>(max_stages)){
+				return -1;
+			}
+			registry.labels.push_back(label);
+			return static_cast<int>(registry.labels.size()) - 1;
+		}
+		void startTimer(){
+			thread_state.timer_epoch = getRegistry().epoch.load(std::memory_order_relaxed);
+			thread_state.start_time = Clock::now();
+		}
+		void recordEvent(int stage_id){
+			Clock::time_point end_time = Clock::now();
+			unsigned int epoch = getRegistry().epoch.load(std::memory_order_relaxed);
+			if(stage_id >= 0 && thread_state.timer_epoch == epoch){
+				uint64_t interval_ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+					end_time - thread_state.start_time).count());
+				ThreadStats *stats = thread_state.getStats();
+				ThreadStats::add(stats->counts[stage_id][getBinId(interval_ns)], 1);
+				ThreadStats::add(stats->total_ns[stage_id], interval_ns);
+				if(interval_ns > stats->max_ns[stage_id].load(std::memory_order_relaxed)){
+					stats->max_ns[stage_id].store(interval_ns, std::memory_order_relaxed);
+				}
+			}
+			thread_state.timer_epoch = epoch;
+			thread_state.start_time = Clock::now();
+		}
+		std::vector<StageSummary> getSummary(){
+			Registry &registry = getRegistry();
+			std::lock_guard<std::mutex> lock(registry.mutex);
+			std::vector<StageSummary> summary;
+			std::vector<uint64_t> counts(n_bins);
+			for(unsigned int stage_id = 0; stage_id < registry.labels.size(); ++stage_id){
+				std::fill(counts.begin(), counts.end(), 0);
+				uint64_t total_count = 0, total_ns = 0, max_ns = 0;
+				for(const std::unique_ptr<ThreadStats> &stats : registry.stats){
+					for(int bin_id = 0; bin_id < n_bins; ++bin_id){
+						uint64_t count = stats->counts[stage_id][bin_id].load(std::memory_order_relaxed);
+						counts[bin_id] += count;
+						total_count += count;
+					}
+					total_ns += stats->total_ns[stage_id].load(std::memory_order_relaxed);
+					uint64_t stats_max_ns = stats->max_ns[stage_id].load(std::memory_order_relaxed);
+					if(stats_max_ns > max_ns){ max_ns = stats_max_ns; }
+				}
+				if(total_count == 0){ continue; }
+				StageSummary stage_summary;
+				stage_summary.label = registry.labels[stage_id];
+				stage_summary.count = total_count;
+				stage_summary.total = 1e-9 * static_cast<double>(total_ns);
+				stage_summary.mean = stage_summary.total / static_cast<double>(total_count);
+				stage_summary.max = 1e-9 * static_cast<double>(max_ns);
+				stage_summary.p50 = 1e-9 * getPercentile(counts, total_count, 0.50, static_cast<double>(max_ns));
+				stage_summary.p90 = 1e-9 * getPercentile(counts, total_count, 0.90, static_cast<double>(max_ns));
+				stage_summary.p99 = 1e-9 * getPercentile(counts, total_count, 0.99, static_cast<double>(max_ns));
+				summary.push_back(stage_summary);
+			}
+			return summary;
+		}
+		void reset(){
+			Registry &registry = getRegistry();
+			std::lock_guard<std::mutex> lock(registry.mutex);
+			for(const std::unique_ptr<ThreadStats> &stats : registry.stats){
+				stats->clear();
+			}
+		}
+		void setOutput(const std::string &file_path, double interval_secs){
+			Registry &registry = getRegistry();
+			std::lock_guard<std::mutex> lock(registry.out_mutex);
+			registry.out_path = file_path;
+			registry.out_interval = interval_secs;
+			registry.last_out_time = Clock::now();
+		}
+		void update(){
+			if(!isEnabled()){ return; }
+			Registry &registry = getRegistry();
+			//! another thread is already writing the summary
+			std::unique_lock<std::mutex> lock(registry.out_mutex, std::try_to_lock);
+			if(!lock.owns_lock() || registry.out_path.empty() || registry.out_interval <= 0){ return; }
+			Clock::time_point curr_time = Clock::now();
+			if(std::chrono::duration<double>(curr_time - registry.last_out_time).count() < registry.out_interval){
+				return;
+			}
+			registry.last_out_time = curr_time;
+			writeSummary(registry.out_path);
+		}
+		void writeSummary(const std::string &file_path){
+			std::vector<StageSummary> summary = getSummary();
+			FILE *fid = file_path.empty() ? stdout : fopen(file_path.c_str(), "a");
+			if(!fid){
+				printf("Profiler summary could not be written to %s\n", file_path.c_str());
+				return;
+			}
+			fprintf(fid, "\nprofile %s (times in ms)\n", getDateTime().c_str());
+			fprintf(fid, "%-40s %10s %12s %10s %10s %10s %10s %10s\n",
+				"stage", "count", "total", "mean", "p50", "p90", "p99", "max");
+			for(const StageSummary &stage_summary : summary){
+				fprintf(fid, "%-40s %10llu %12.3f %10.4f %10.4f %10.4f %10.4f %10.4f\n",
+					stage_summary.label.c_str(), static_cast<unsigned long long>(stage_summary.count),
+					stage_summary.total * 1e3, stage_summary.mean * 1e3, stage_summary.p50 * 1e3,
+					stage_summary.p90 * 1e3, stage_summary.p99 * 1e3, stage_summary.max * 1e3);
+			}
+			if(fid != stdout){ fclose(fid); }
+		}
+	}
+}
+_MTF_END_NAMESPACE
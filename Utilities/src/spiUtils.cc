@@ -162,6 +162,34 @@ namespace utils{
 				}
 			}
 		}
+		void getActiveIDs(std::vector<unsigned int> &active_ids, const bool *mask, unsigned int n){
+			active_ids.resize(n);
+			if(!mask){
+				for(unsigned int id = 0; id < n; ++id){ active_ids[id] = id; }
+				return;
+			}
+			//! written unconditionally and advanced only for active entries to avoid a branch per entry
+			unsigned int n_active = 0;
+			for(unsigned int id = 0; id < n; ++id){
+				active_ids[n_active] = id;
+				n_active += mask[id] ? 1 : 0;
+			}
+			active_ids.resize(n_active);
+		}
+		void getActiveRows(MatrixXd &active_rows, const MatrixXd &mat,
+			const std::vector<unsigned int> &active_ids, unsigned int n_channels){
+			active_rows.resize(active_ids.size()*n_channels, mat.cols());
+			for(int col_id = 0; col_id < mat.cols(); ++col_id){
+				const double *src_col = mat.col(col_id).data();
+				double *dst_col = active_rows.col(col_id).data();
+				for(unsigned int active_id : active_ids){
+					const double *src = src_col + active_id*n_channels;
+					for(unsigned int ch_id = 0; ch_id < n_channels; ++ch_id){
+						*dst_col++ = src[ch_id];
+					}
+				}
+			}
+		}
 	}
 
 	double getMean(const bool *spi_mask, const VectorXd &vec,
@@ -238,6 +266,49 @@ namespace utils{
 		}
 		//printMatrix(df_dp, "df_dp");
 	}
+	double getMean(const std::vector<unsigned int> &active_ids, const VectorXd &vec,
+		int n_channels){
+		double mean = 0;
+		for(unsigned int pix_id : active_ids){
+			mean += vec.segment(pix_id*n_channels, n_channels).sum();
+		}
+		return mean / (active_ids.size()*n_channels);
+	}
+	void getMean(RowVectorXd &mean_vec, const std::vector<unsigned int> &active_ids,
+		const MatrixXd &mat, int n_channels){
+		assert(mat.cols() == mean_vec.size());
+		mean_vec.setZero();
+		for(unsigned int pix_id : active_ids){
+			mean_vec += mat.middleRows(pix_id*n_channels, n_channels).colwise().sum();
+		}
+		mean_vec /= active_ids.size()*n_channels;
+	}
+	void getProd(RowVectorXd &df_dp, const std::vector<unsigned int> &active_ids,
+		const RowVectorXd &df_dI, const MatrixXd &dI_dp, int n_channels){
+		assert(dI_dp.cols() == df_dp.size() && dI_dp.rows() == df_dI.size());
+		df_dp.setZero();
+		for(unsigned int pix_id : active_ids){
+			int ch_pix_id = pix_id*n_channels;
+			for(int channel_id = 0; channel_id < n_channels; ++channel_id){
+				df_dp += df_dI[ch_pix_id] * dI_dp.row(ch_pix_id);
+				++ch_pix_id;
+			}
+		}
+	}
+	void getDiffOfProd(RowVectorXd &df_dp, const std::vector<unsigned int> &active_ids,
+		const RowVectorXd &df_dIt, const MatrixXd &dIt_dp,
+		const RowVectorXd &df_dI0, const MatrixXd &dI0_dp, int n_channels){
+		assert(dIt_dp.cols() == df_dp.size() && dI0_dp.cols() == df_dp.size());
+		df_dp.setZero();
+		for(unsigned int pix_id : active_ids){
+			int ch_pix_id = pix_id*n_channels;
+			for(int channel_id = 0; channel_id < n_channels; ++channel_id){
+				df_dp += df_dIt[ch_pix_id] * dIt_dp.row(ch_pix_id) -
+					df_dI0[ch_pix_id] * dI0_dp.row(ch_pix_id);
+				++ch_pix_id;
+			}
+		}
+	}
 	void expandMask(bool *out_mask, const bool *in_mask, int res_ratio_x,
 		int res_ratio_y, int in_resx, int in_resy, int out_resx, int out_resy){
 		assert(out_resx == in_resx*res_ratio_x);
@@ -256,6 +327,17 @@ namespace utils{
 			}
 		}
 	}
+	void getSubsampledMask(bool *out_mask, const bool *in_mask, int sub_ratio,
+		int resx, int resy){
+		assert(sub_ratio > 0);
+		for(int y_id = 0; y_id < resy; y_id++){
+			for(int x_id = 0; x_id < resx; x_id++){
+				int pix_id = y_id*resx + x_id;
+				out_mask[pix_id] = y_id % sub_ratio == 0 && x_id % sub_ratio == 0 &&
+					(!in_mask || in_mask[pix_id]);
+			}
+		}
+	}
 
 }
 _MTF_END_NAMESPACE
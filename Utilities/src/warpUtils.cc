@@ -1011,7 +1011,7 @@ namespace utils{
 	// and control points to the given points
 	void applyTPS(PtsT &out_pts, const PtsT &in_pts,
 		const PtsT &control_pts, const MatrixX2d &tps_params){
-		assert(out_pts.cols() == in_pts.size());
+		assert(out_pts.cols() == in_pts.cols());
 		assert(tps_params.rows() == control_pts.cols() + 3);
 		int n_pts = in_pts.cols();
 		int n_ctrl_pts = control_pts.cols();
@@ -1021,11 +1021,11 @@ namespace utils{
 		double ay = tps_params(n_ctrl_pts, 1),
 			by = tps_params(n_ctrl_pts + 1, 1),
 			cy = tps_params(n_ctrl_pts + 2, 1);
-		for(int pt_id = 0; pt_id < n_pts; ++n_pts){
+		for(int pt_id = 0; pt_id < n_pts; ++pt_id){
 
-			double out_pt_x = ax*in_pts(0, pt_id) + bx*in_pts(1, pt_id) + cx;
-			double out_pt_y = ay*in_pts(0, pt_id) + by*in_pts(1, pt_id) + cy;
-			for(int ctrl_pt_id = 0; ctrl_pt_id < n_ctrl_pts; ++n_pts){
+			double out_pt_x = ax + bx*in_pts(0, pt_id) + cx*in_pts(1, pt_id);
+			double out_pt_y = ay + by*in_pts(0, pt_id) + cy*in_pts(1, pt_id);
+			for(int ctrl_pt_id = 0; ctrl_pt_id < n_ctrl_pts; ++ctrl_pt_id){
 				double pt_tps = tps((control_pts.col(ctrl_pt_id) - in_pts.col(pt_id)).norm());
 				out_pt_x += tps_params(ctrl_pt_id, 0)*pt_tps;
 				out_pt_y += tps_params(ctrl_pt_id, 1)*pt_tps;
@@ -1033,7 +1033,7 @@ namespace utils{
 			out_pts(0, pt_id) = out_pt_x;
 			out_pts(1, pt_id) = out_pt_y;
 		}
-	}	
+	}
 }
 
 _MTF_END_NAMESPACE
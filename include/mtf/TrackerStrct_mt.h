@@ -3,6 +3,7 @@
 #include "mtf/mtf.h"
 #include "mtf/pipeline.h"
 #include "mtf/Utilities/miscUtils.h"
+#include "mtf/Utilities/queueUtils.h"
 #ifndef DISABLE_VISP
 #include <visp3/core/vpImagePoint.h>
 #include <visp3/gui/vpDisplayX.h>
@@ -21,51 +22,106 @@ typedef std::shared_ptr<mtf::TrackerBase> Tracker;
 typedef std::shared_ptr<InputStruct> InputStructPtr;
 typedef PreProc_ PreProc;
 
+//! copy of an input frame stored in the ring shared between the input and tracker threads
+struct FrameSlot{
+	cv::Mat frame;
+	int frame_id;
+	FrameSlot() : frame_id(-1){}
+};
+typedef mtf::utils::FrameRing<FrameSlot> FrameRing;
+typedef std::shared_ptr<FrameRing> FrameRingPtr;
+typedef FrameRing::Ref FrameRef;
+//! maximum no. of tracker threads that can read from the same input
+#define MAX_RING_CONSUMERS 64
 
+/**
+reads frames from the input and copies them into the ring since the buffer of the input
+itself is overwritten without any regard to the trackers that might still be using it
+*/
 struct InputThread{
-	InputThread(Input &_input) : input(_input){}
+	InputThread(Input &_input, FrameRingPtr &_ring) : input(_input), ring(_ring){}
 	void operator()(){
 		while(input->update()){
-			if(input->destroy){ return; }
+			if(input->destroy){ break; }
+			if(!ring->publish([this](FrameSlot &slot){
+				//! the existing storage of the slot is reused if the frame size does not change
+				input->getFrame().copyTo(slot.frame);
+				slot.frame_id = input->getFrameID();
+			})){
+				break;
+			}
 			boost::this_thread::interruption_point();
 		}
 		input->destroy = true;
+		ring->close();
 	}
 private:
 	Input input;
+	FrameRingPtr ring;
 };
 struct InputStruct : public mtf::utils::InputBase {
 	InputStruct() : is_valid(false), thread_created(false){}
-	InputStruct(Input &_input) : input(_input),
-		is_valid(false), thread_created(false){
-		t = boost::thread{ InputThread(input) };
-		is_valid = thread_created = true;
+	InputStruct(Input &_input) : is_valid(false), thread_created(false){
+		start(_input);
 	}
 	~InputStruct() {}
 	bool initialize() override{ return true; }
 	bool update() override{ return true; }
 	void remapBuffer(unsigned char** new_addr) override{}
-	const cv::Mat& getFrame() const override{ return input->getFrame(); }
+	/**
+	returns a copy of the latest frame that remains valid till the next call to this function from the same thread;
+	tracker threads should use acquire instead to avoid the copy
+	*/
+	const cv::Mat& getFrame() const override{
+		thread_local cv::Mat frame;
+		FrameRef ref;
+		if(acquireLatest(ref)){
+			ref->frame.copyTo(frame);
+		}
+		return frame;
+	}
 	cv::Mat& getFrame(mtf::utils::FrameType) override{
 		throw mtf::utils::InvalidArgument("Mutable frame cannot be obtained");
 	}
 #ifndef DISABLE_VISP
 	void getFrame(vpImage<vpRGBa> &vp_img) const override{
-		input->getFrame(vp_img);
+		FrameRef ref;
+		if(acquireLatest(ref)){
+			convert(ref->frame, vp_img);
+		}
 	}
 #endif
-	int getFrameID() const override{ return input->getFrameID(); }
+	int getFrameID() const override{
+		FrameRef ref;
+		return acquireLatest(ref) ? ref->frame_id : -1;
+	}
+	int getNFrames() const override{ return input->getNFrames(); }
 	int getHeight() const override{ return input->getHeight(); }
 	int getWidth() const override{ return input->getWidth(); }
 
+	//! returns -1 if no more tracker threads can be added
+	int registerConsumer() const{ return ring->registerConsumer(); }
+	void unregisterConsumer(int consumer_id) const{ ring->unregisterConsumer(consumer_id); }
+	/**
+	wait for the next frame that the given tracker thread should process and keep it from being
+	overwritten till the reference is released; returns false if the input has stopped
+	*/
+	bool acquire(int consumer_id, FrameRef &ref) const{
+		while(!ring->tryAcquire(consumer_id, ref)){
+			if(ring->isClosed()){ return false; }
+			boost::this_thread::interruption_point();
+			boost::this_thread::yield();
+		}
+		return true;
+	}
+
 	void reset(Input &_input) {
 		reset();
-		input = _input;
-		t = boost::thread{ InputThread(input) };
-		is_valid = thread_created = true;
+		start(_input);
 	}
 	void reset() {
 		if(thread_created) {
+			ring->close();
 			t.interrupt();
 			thread_created = false;
 		}
@@ -79,8 +135,25 @@ struct InputStruct : public mtf::utils::InputBase {
 	}
 private:
 	Input input;
+	FrameRingPtr ring;
 	boost::thread t;
 	bool is_valid, thread_created;
+
+	void start(Input &_input){
+		input = _input;
+		ring.reset(new FrameRing(input_ring_size, input_ring_block ?
+			FrameRing::Policy::Block : FrameRing::Policy::DropOldest, MAX_RING_CONSUMERS));
+		//! the frame read during initialization is made available before the thread starts
+		ring->publish([this](FrameSlot &slot){
+			input->getFrame().copyTo(slot.frame);
+			slot.frame_id = input->getFrameID();
+		});
+		t = boost::thread{ InputThread(input, ring) };
+		is_valid = thread_created = true;
+	}
+	bool acquireLatest(FrameRef &ref) const{
+		return ring && ring->tryAcquireLatest(ref);
+	}
 };
 
 struct ObjectSelectorThread{
@@ -198,24 +271,34 @@ struct TrackerThread{
 #else
 		cv::Scalar obj_col = mtf::utils::ObjUtils().getCol(tracker_id - 1);
 #endif
+		//! unregisters even if the thread is interrupted so that the input thread is not kept waiting for it
+		struct ConsumerGuard{
+			ConsumerGuard(const InputStruct &_input) : input(_input), id(_input.registerConsumer()){}
+			~ConsumerGuard(){ if(id >= 0){ input.unregisterConsumer(id); } }
+			const InputStruct &input;
+			const int id;
+		} consumer(*input);
+		if(consumer.id < 0){
+			cout << cv::format("Tracker %d cannot be run since the maximum no. of %d trackers are already running\n",
+				tracker_id, MAX_RING_CONSUMERS);
+			return;
+		}
+		int consumer_id = consumer.id;
 		(*is_running) = 1;
-		while(input->isValid()){
-			if(frame_id == input->getFrameID()){
-				//! do not process the same image multiple times
-				//cout << "skipping frame " << frame_id << "\n";
-				continue;
-			}
-			frame_id = input->getFrameID();
+		FrameRef frame_ref;
+		//! each frame is processed only once and cannot be overwritten while it is being processed
+		while(input->isValid() && input->acquire(consumer_id, frame_ref)){
+			frame_id = frame_ref->frame_id;
 			//cout << "processing frame " << frame_id << "\n";
 			try{
 				//! update pre-processor
-				pre_proc->update(input->getFrame());
+				pre_proc->update(frame_ref->frame, frame_id);
 				//! update tracker
 				tracker->update();
 
 				if(visualize) {
 #ifndef DISABLE_VISP					
-					input->getFrame(disp_frame);
+					input->convert(frame_ref->frame, disp_frame);
 					mtf::utils::drawRegion(disp_frame, tracker->getRegion(), obj_col,
 						line_thickness, tracker->name.c_str(), 0.50, show_corner_ids, 1 - show_corner_ids);
 					vpDisplay::display(disp_frame);
@@ -226,7 +309,7 @@ struct TrackerThread{
 						}
 					}
 #else
-					cv::Mat disp_frame = input->getFrame().clone();
+					cv::Mat disp_frame = frame_ref->frame.clone();
 					mtf::utils::drawRegion(disp_frame, tracker->getRegion(), obj_col,
 						line_thickness, tracker->name.c_str(), 0.50, show_corner_ids, 1 - show_corner_ids);
 					imshow(win_name, disp_frame);
@@ -245,10 +328,12 @@ struct TrackerThread{
 			} catch(const mtf::utils::Exception &err){
 				cout << cv::format("Exception of type %s encountered while updating the tracker: %s\n",
 					err.type(), err.what());
-				return;
+				break;
 			}
+			frame_ref.release();
 			boost::this_thread::interruption_point();
 		}
+		frame_ref.release();
 		(*is_running) = 0;
 		//printf("TrackerThread::is_running: %d\n", *is_running);
 #ifndef DISABLE_VISP
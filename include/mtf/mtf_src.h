@@ -11,6 +11,8 @@
 #include "../SM/src/FALK.cc"
 #include "../SM/src/IALK.cc"
 #include "../SM/src/PF.cc"
+#include "../SM/src/FixedLK.cc"
+#include "../SM/src/BatchTracker.cc"
 #include "../SM/src/GNN.cc"
 //! composite search methods
 #include "../SM/src/RKLT.cc"
@@ -131,6 +133,9 @@
 #include "../Utilities/src/miscUtils.cc"
 #include "../Utilities/src/graphUtils.cc"
 #include "../Utilities/src/spiUtils.cc"
+#include "../Utilities/src/dbUtils.cc"
+#include "../Utilities/src/profUtils.cc"
+#include "../Utilities/src/cacheUtils.cc"
 #ifndef DISABLE_REGNET
 #include "../Utilities/src/netUtils.cc"
 #endif
@@ -144,6 +149,8 @@
 #include "../SM/src/FALKParams.cc"
 #include "../SM/src/IALKParams.cc"
 #include "../SM/src/PFParams.cc"
+#include "../SM/src/FixedLKParams.cc"
+#include "../SM/src/BatchTrackerParams.cc"
 #ifndef DISABLE_FLANN
 #include "../SM/src/NNParams.cc"
 #include "../SM/src/FLANNParams.cc"
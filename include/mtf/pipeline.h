@@ -10,8 +10,12 @@
 //! general OpenCV tools for selecting objects, reading ground truth, etc.
 #include "mtf/Utilities/objUtils.h"
 #include "mtf/Utilities/excpUtils.h"
+//! bounded queues connecting the stages of the pipelined input
+#include "mtf/Utilities/queueUtils.h"
 
 #include <memory>
+#include <thread>
+#include <algorithm>
 
 #ifndef HETEROGENEOUS_INPUT
 #define HETEROGENEOUS_INPUT -1
@@ -246,6 +250,144 @@ inline PreProc_ getPreProc(int output_type,
 
 }
 
+/**
+input pipeline that runs decoding and pre processing in two background threads connected
+by bounded queues so that the next frames are being read and filtered while the current one is tracked;
+the pre processors in src_pre_procs are private to the pipeline and mirror the ones in dst_pre_procs
+that are used by the trackers, the output of the former being copied into the latter in place in update
+so that the images set in the trackers remain valid and PreProcBase::update becomes a no op for that frame;
+this takes ownership of the wrapped input
+*/
+class PipelinedInput : public utils::InputBase{
+public:
+	PipelinedInput(utils::InputBase *_input,
+		const vector<PreProc_> &_src_pre_procs, const vector<PreProc_> &_dst_pre_procs,
+		unsigned int queue_size) :
+		InputBase(baseParams()), input(_input),
+		decoded_frames(queue_size), processed_frames(queue_size){
+		if(_src_pre_procs.size() != _dst_pre_procs.size()){
+			throw utils::InvalidArgument(
+				cv::format("PipelinedInput :: No. of pipeline pre processors: %d does not match that of the trackers: %d",
+				static_cast<int>(_src_pre_procs.size()), static_cast<int>(_dst_pre_procs.size())));
+		}
+		//! pre processors are shared between trackers so only the distinct ones are updated
+		for(unsigned int obj_id = 0; obj_id < _dst_pre_procs.size(); ++obj_id){
+			PreProc_ src = _src_pre_procs[obj_id], dst = _dst_pre_procs[obj_id];
+			for(; src && dst; src = src->next, dst = dst->next){
+				if(std::find(dst_pre_procs.begin(), dst_pre_procs.end(), dst) != dst_pre_procs.end()){ continue; }
+				if(src->type() != dst->type()){
+					throw utils::InvalidArgument(
+						cv::format("PipelinedInput :: Pipeline pre processor of type %s does not match tracker pre processor of type %s",
+						src->type().c_str(), dst->type().c_str()));
+				}
+				src_pre_procs.push_back(src);
+				dst_pre_procs.push_back(dst);
+			}
+		}
+	}
+	~PipelinedInput(){
+		decoded_frames.close();
+		processed_frames.close();
+		if(decode_thread.joinable()){ decode_thread.join(); }
+		if(pre_proc_thread.joinable()){ pre_proc_thread.join(); }
+	}
+	/**
+	the wrapped input must have been initialized already and is continued from its current frame
+	*/
+	bool initialize() override{
+		curr_frame.frame_id = input->getFrameID();
+		curr_frame.raw = input->getFrame().clone();
+		decode_thread = std::thread(&PipelinedInput::decodeFrames, this);
+		pre_proc_thread = std::thread(&PipelinedInput::preProcessFrames, this);
+		return true;
+	}
+	bool update() override{
+		if(!processed_frames.pop(curr_frame)){
+			std::lock_guard<std::mutex> lock(err_mutex);
+			if(!err_msg.empty()){
+				printf("PipelinedInput :: %s\n", err_msg.c_str());
+			}
+			return false;
+		}
+		for(unsigned int obj_id = 0; obj_id < dst_pre_procs.size(); ++obj_id){
+			dst_pre_procs[obj_id]->setProcessedFrame(curr_frame.processed[obj_id], curr_frame.frame_id);
+		}
+		return true;
+	}
+	int getFrameID() const override{ return curr_frame.frame_id; }
+	const cv::Mat& getFrame() const override{ return curr_frame.raw; }
+	cv::Mat& getFrame(utils::FrameType frame_type) override{ return curr_frame.raw; }
+	int getNFrames() const override{ return input->getNFrames(); }
+	int getHeight() const override{ return input->getHeight(); }
+	int getWidth() const override{ return input->getWidth(); }
+	//! each frame is read into a newly allocated image
+	bool constBuffer() override{ return false; }
+
+private:
+	struct Frame{
+		int frame_id;
+		cv::Mat raw;
+		//! outputs of the distinct pre processors in the same order as src_pre_procs
+		vector<cv::Mat> processed;
+		Frame() : frame_id(-1){}
+	};
+	std::unique_ptr<utils::InputBase> input;
+	vector<PreProc_> src_pre_procs, dst_pre_procs;
+	utils::BoundedQueue<Frame> decoded_frames, processed_frames;
+	std::thread decode_thread, pre_proc_thread;
+	Frame curr_frame;
+	std::string err_msg;
+	std::mutex err_mutex;
+
+	//! the base class does not read anything itself so it is constructed as a live source to skip the sequence checks
+	static const utils::InputParams* baseParams(){
+		static const utils::InputParams params(SRC_USB_CAM, "", "", "", 1, false);
+		return &params;
+	}
+	void setError(const std::string &msg){
+		std::lock_guard<std::mutex> lock(err_mutex);
+		if(err_msg.empty()){ err_msg = msg; }
+	}
+	void decodeFrames(){
+		try{
+			while(input->getNFrames() <= 0 || input->getFrameID() < input->getNFrames() - 1){
+				if(!input->update()){
+					setError(cv::format("Frame %d could not be read from the input pipeline",
+						input->getFrameID() + 1));
+					break;
+				}
+				Frame frame;
+				frame.frame_id = input->getFrameID();
+				frame.raw = input->getFrame().clone();
+				if(!decoded_frames.push(std::move(frame))){ break; }
+			}
+		} catch(const utils::Exception &err){
+			setError(cv::format("Exception of type %s encountered while reading frames: %s",
+				err.type(), err.what()));
+		}
+		decoded_frames.close();
+	}
+	void preProcessFrames(){
+		try{
+			Frame frame;
+			while(decoded_frames.pop(frame)){
+				frame.processed.resize(src_pre_procs.size());
+				for(unsigned int obj_id = 0; obj_id < src_pre_procs.size(); ++obj_id){
+					src_pre_procs[obj_id]->update(frame.raw, frame.frame_id);
+					frame.processed[obj_id] = src_pre_procs[obj_id]->getFrame().clone();
+				}
+				if(!processed_frames.push(std::move(frame))){ break; }
+				frame = Frame();
+			}
+		} catch(const utils::Exception &err){
+			setError(cv::format("Exception of type %s encountered while pre processing frames: %s",
+				err.type(), err.what()));
+		}
+		decoded_frames.close();
+		processed_frames.close();
+	}
+};
+
 inline bool getObjectsToTrack(utils::ObjUtils &obj_utils, utils::InputBase *input){
 	bool init_obj_read = false;
 	int n_objs_to_get = track_single_obj ? 1 : n_trackers;